@@ -20,8 +20,11 @@
 #ifndef CPU_H
 #define CPU_H
 
+#include <stdint.h>
 #include <stdio.h>
+
 #include "cpu_conf.h"
+#include "panic.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -44,6 +47,30 @@ __attribute__((always_inline)) static inline void cpu_print_last_instruction(voi
     printf("%p\n", __builtin_return_address(0));
 }
 
+/**
+ * @brief   Returns the start address of the running firmware image
+ *
+ * native doesn't run from its emulated flash, so the address doesn't match
+ * any riotboot slot.
+ */
+static inline uint32_t cpu_get_image_baseaddr(void)
+{
+    return 0;
+}
+
+/**
+ * @brief   Jumping to an image in the emulated flash is not supported
+ *
+ * Panics, so booting a slot doesn't silently fall through.
+ *
+ * @param[in]   image_address   start address of the image
+ */
+static inline void cpu_jump_to_image(uint32_t image_address)
+{
+    (void)image_address;
+    core_panic(PANIC_GENERAL_ERROR, "native can't jump to a firmware image");
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -12,6 +12,14 @@
  * @{
  * @brief       mtd flash emulation for native
  *
+ * The flash is emulated by a file on the host that is mapped into memory
+ * once on initialization. Reads and writes access the mapping directly,
+ * mtd_flush() synchronizes it with the file. The file is created or
+ * extended with erased (0xff) bytes if it is smaller than the device.
+ *
+ * With the `mtd_native_stdio` module, the file is opened and accessed with
+ * stdio functions on every operation instead.
+ *
  * @file
  *
  * @author      Vincent Dupont <vincent@otakeys.com>
@@ -30,6 +38,7 @@ extern "C" {
 typedef struct mtd_native_dev {
     mtd_dev_t dev;      /**< mtd generic device */
     const char *fname;  /**< filename to use for memory emulation */
+    uint8_t *map;       /**< mapped file, used internally */
 } mtd_native_dev_t;
 
 /**
@@ -35,6 +35,18 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames read from the TAP per ISR call
+ *
+ * Frames that are already pending on the TAP when the ISR is handled are read
+ * in one go (up to this number) instead of signalling every single frame.
+ * If there are still frames pending afterwards, the TAP is polled (see
+ * @ref netdev_sec_irq_mitigation) until it is idle.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH_SIZE
+#define CONFIG_NETDEV_TAP_RX_BATCH_SIZE     (8U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -1,5 +1,6 @@
 /*
  * Copyright (C) 2016  OTA keys S.A.
+ *               2021  Freie Universität Berlin
  *
  * This file is subject to the terms and conditions of the GNU Lesser
  * General Public License v2.1. See the file LICENSE in the top level
@@ -8,19 +9,27 @@
 
 /**
  * @{
- * @brief       mtd flash emulation for native
+ * @brief       mtd flash emulation for native using a memory mapped file
  *
  * @file
  *
  * @author      Vincent Dupont <vincent@otakeys.com>
  */
 
-#include <stdio.h>
-#include <inttypes.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
 
+#include "iolist.h"
+#include "kernel_defines.h"
 #include "mtd.h"
 #include "mtd_native.h"
+#if IS_USED(MODULE_MTD_ASYNC)
+#include "mtd_async.h"
+#endif
 
 #include "native_internal.h"
 
@@ -29,78 +38,122 @@
 
 #define MIN(a, b) ((a) > (b) ? (b) : (a))
 
+static size_t _size(const mtd_dev_t *dev)
+{
+    return (size_t)dev->sector_count * dev->pages_per_sector * dev->page_size;
+}
+
+/* append erased bytes to the file until it has @p size bytes */
+static int _extend(int fd, size_t size)
+{
+    uint8_t erased[256];
+    off_t len = real_lseek(fd, 0, SEEK_END);
+
+    if (len < 0) {
+        return -EIO;
+    }
+
+    memset(erased, 0xff, sizeof(erased));
+    while ((size_t)len < size) {
+        ssize_t res = real_write(fd, erased, MIN(sizeof(erased), size - len));
+
+        if (res <= 0) {
+            return -EIO;
+        }
+        len += res;
+    }
+
+    return 0;
+}
+
 static int _init(mtd_dev_t *dev)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t size = _size(dev);
+    void *map;
+    int res;
 
     DEBUG("mtd_native: init, filename=%s\n", _dev->fname);
 
-    FILE *f = real_fopen(_dev->fname, "r");
+    if (_dev->map) {
+        return 0;
+    }
 
-    if (!f) {
-        DEBUG("mtd_native: init: creating file %s\n", _dev->fname);
-        f = real_fopen(_dev->fname, "w+");
-        if (!f) {
-            return -EIO;
+    _native_syscall_enter();
+    int fd = real_open(_dev->fname, O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0) {
+        _native_syscall_leave();
+        return -EIO;
+    }
+
+    res = _extend(fd, size);
+    if (res == 0) {
+        map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED) {
+            res = -EIO;
         }
-        size_t size = dev->sector_count * dev->pages_per_sector * dev->page_size;
-        for (size_t i = 0; i < size; i++) {
-            real_fputc(0xff, f);
+        else {
+            _dev->map = map;
         }
     }
 
-    real_fclose(f);
+    /* the mapping stays valid after closing the file */
+    real_close(fd);
+    _native_syscall_leave();
 
-    return 0;
+    return res;
 }
 
 static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: read from page %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _size(dev)) {
         return -EOVERFLOW;
     }
 
-    FILE *f = real_fopen(_dev->fname, "r");
-    if (!f) {
-        return -EIO;
+    memcpy(buff, _dev->map + addr, size);
+
+    return 0;
+}
+
+/* NOR flash can only clear bits, AND a word at a time */
+static void _program(uint8_t *dst, const uint8_t *src, size_t size)
+{
+    while (size && ((uintptr_t)dst % sizeof(uint64_t))) {
+        *dst++ &= *src++;
+        size--;
     }
-    real_fseek(f, addr, SEEK_SET);
-    size_t nread = real_fread(buff, 1, size, f);
-    real_fclose(f);
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t)) {
+        uint64_t word;
 
-    return (nread == size) ? 0 : -EIO;
+        memcpy(&word, src, sizeof(word));
+        *(uint64_t *)(uintptr_t)dst &= word;
+        dst += sizeof(uint64_t);
+        src += sizeof(uint64_t);
+    }
+    while (size--) {
+        *dst++ &= *src++;
+    }
 }
 
 static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: write from 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _size(dev)) {
         return -EOVERFLOW;
     }
     if (((addr % dev->page_size) + size) > dev->page_size) {
         return -EOVERFLOW;
     }
 
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
-        return -EIO;
-    }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        uint8_t c = real_fgetc(f);
-        real_fseek(f, -1, SEEK_CUR);
-        real_fputc(c & ((uint8_t*)buff)[i], f);
-    }
-    real_fclose(f);
+    _program(_dev->map + addr, buff, size);
 
     return 0;
 }
@@ -114,7 +167,7 @@ static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t
     DEBUG("mtd_native: write from page %" PRIx32 ", offset 0x%" PRIx32 " count %" PRIu32 "\n",
           page, offset, size);
 
-    if (page > dev->sector_count * dev->pages_per_sector) {
+    if (page >= dev->sector_count * dev->pages_per_sector) {
         return -EOVERFLOW;
     }
 
@@ -125,17 +178,7 @@ static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t
     uint32_t remaining = dev->page_size - offset;
     size = MIN(remaining, size);
 
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
-        return -EIO;
-    }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        uint8_t c = real_fgetc(f);
-        real_fseek(f, -1, SEEK_CUR);
-        real_fputc(c & ((uint8_t*)buff)[i], f);
-    }
-    real_fclose(f);
+    _program(_dev->map + addr, buff, size);
 
     return size;
 }
@@ -143,31 +186,114 @@ static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t
 static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
     size_t sector_size = dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: erase from sector %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _size(dev)) {
         return -EOVERFLOW;
     }
     if (((addr % sector_size) != 0) || ((size % sector_size) != 0)) {
         return -EOVERFLOW;
     }
 
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
-        return -EIO;
+    memset(_dev->map + addr, 0xff, size);
+
+    return 0;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t sector_size = dev->pages_per_sector * dev->page_size;
+
+    DEBUG("mtd_native: erase sector %" PRIu32 " count %" PRIu32 "\n", sector, count);
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
     }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        real_fputc(0xff, f);
+
+    memset(_dev->map + sector * sector_size, 0xff, count * sector_size);
+
+    return 0;
+}
+
+static int _flush(mtd_dev_t *dev)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    int res;
+
+    DEBUG("mtd_native: flush\n");
+
+    _native_syscall_enter();
+    res = msync(_dev->map, _size(dev), MS_SYNC);
+    _native_syscall_leave();
+
+    return res ? -EIO : 0;
+}
+
+static size_t _iol_size(const iolist_t *iol)
+{
+    size_t size = 0;
+
+    for (; iol; iol = iol->iol_next) {
+        size += iol->iol_len;
+    }
+    return size;
+}
+
+static int _read_iol(mtd_dev_t *dev, const iolist_t *iol, uint32_t addr)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t size = _iol_size(iol);
+
+    DEBUG("mtd_native: read_iol from 0x%" PRIx32 " count %" PRIu32 "\n",
+          addr, (uint32_t)size);
+
+    if ((addr > _size(dev)) || (size > _size(dev) - addr)) {
+        return -EOVERFLOW;
+    }
+
+    for (; iol; iol = iol->iol_next) {
+        memcpy(iol->iol_base, _dev->map + addr, iol->iol_len);
+        addr += iol->iol_len;
     }
-    real_fclose(f);
 
     return 0;
 }
 
+static int _write_iol(mtd_dev_t *dev, const iolist_t *iol, uint32_t addr)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t size = _iol_size(iol);
+
+    DEBUG("mtd_native: write_iol from 0x%" PRIx32 " count %" PRIu32 "\n",
+          addr, (uint32_t)size);
+
+    if ((addr > _size(dev)) || (size > _size(dev) - addr)) {
+        return -EOVERFLOW;
+    }
+
+    for (; iol; iol = iol->iol_next) {
+        _program(_dev->map + addr, iol->iol_base, iol->iol_len);
+        addr += iol->iol_len;
+    }
+
+    return 0;
+}
+
+#if IS_USED(MODULE_MTD_ASYNC)
+static int _submit(mtd_dev_t *dev, mtd_job_t *job)
+{
+    (void)dev;
+
+    /* the file is memory mapped, no need to defer to the worker thread */
+    mtd_job_complete(job, mtd_job_execute(job));
+
+    return 0;
+}
+#endif
+
 static int _power(mtd_dev_t *dev, enum mtd_power_state power)
 {
     (void) dev;
@@ -176,13 +302,19 @@ static int _power(mtd_dev_t *dev, enum mtd_power_state power)
     return -ENOTSUP;
 }
 
-
 const mtd_desc_t native_flash_driver = {
     .read = _read,
     .power = _power,
     .write = _write,
     .write_page = _write_page,
     .erase = _erase,
+    .erase_sector = _erase_sector,
+    .flush = _flush,
+    .read_iol = _read_iol,
+    .write_iol = _write_iol,
+#if IS_USED(MODULE_MTD_ASYNC)
+    .submit = _submit,
+#endif
     .init = _init,
 };
 
@@ -94,17 +94,7 @@ static inline int _set_promiscuous(netdev_t *netdev, int value)
     return value;
 }
 
-static inline void _isr(netdev_t *netdev)
-{
-    if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-    }
-#if DEVELHELP
-    else {
-        puts("netdev_tap: _isr(): no event_callback set.");
-    }
-#endif
-}
+static void _isr(netdev_t *netdev);
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
 {
@@ -177,18 +167,24 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
-static void _continue_reading(netdev_tap_t *dev)
+/* must be called with _native_in_syscall incremented */
+static bool _rx_pending(netdev_tap_t *dev)
 {
-    /* work around lost signals */
     fd_set rfds;
     struct timeval t;
     memset(&t, 0, sizeof(t));
     FD_ZERO(&rfds);
     FD_SET(dev->tap_fd, &rfds);
 
+    return (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1);
+}
+
+static void _continue_reading(netdev_tap_t *dev)
+{
+    /* work around lost signals */
     _native_in_syscall++; /* no switching here */
 
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+    if (_rx_pending(dev)) {
         int sig = SIGIO;
         extern int _sig_pipefd[2];
         extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
@@ -225,8 +221,6 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             static uint8_t nullbuf[ETHERNET_FRAME_LEN];
 
             real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -247,13 +241,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
-
             return 0;
         }
 
-        _continue_reading(dev);
-
         return nread;
     }
     else if (nread == -1) {
@@ -296,6 +286,46 @@ void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params) {
     dev->tap_name[IFNAMSIZ - 1] = '\0';
 }
 
+static void _isr(netdev_t *netdev)
+{
+    netdev_tap_t *dev = (netdev_tap_t *)netdev;
+    unsigned budget = CONFIG_NETDEV_TAP_RX_BATCH_SIZE;
+    bool pending;
+
+    if (!netdev->event_callback) {
+#if DEVELHELP
+        puts("netdev_tap: _isr(): no event_callback set.");
+#endif
+        /* nobody picks up the frame, drop it and keep receiving */
+        _native_syscall_enter();
+        if (_rx_pending(dev)) {
+            _recv(netdev, NULL, 1, NULL);
+        }
+        _native_syscall_leave();
+        _continue_reading(dev);
+        return;
+    }
+    /* drain frames already pending on the TAP without a round-trip through
+     * the signal handler for every single frame */
+    do {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        _native_syscall_enter();
+        pending = _rx_pending(dev);
+        _native_syscall_leave();
+    } while (--budget && pending);
+
+    if (pending) {
+        /* budget exhausted: keep async read disarmed and poll again once the
+         * upper layer handled its other pending work */
+        DEBUG("netdev_tap: budget exhausted, polling\n");
+        netdev_trigger_event_isr(netdev);
+        return;
+    }
+    /* idle: re-arm async read (or trigger the next ISR if a frame slipped in
+     * meanwhile) */
+    _continue_reading(dev);
+}
+
 static void _tap_isr(int fd, void *arg) {
     (void) fd;
 
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Create a patch for riotboot delta updates
+
+The patch describes the new image as ranges copied from the image installed
+on the device and literal data, see sys/include/riotboot/flashwrite_delta.h
+for the format.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+
+MAGIC = b"RBDP"
+OP_COPY = 0x01
+OP_INSERT = 0x02
+
+# matches are searched for blocks of this size at multiples of it in the
+# source, so any common range of at least twice this size is found
+BLOCK_SIZE = 16
+# number of source locations kept per block
+MAX_CANDIDATES = 8
+
+
+def _index(source):
+    index = {}
+    for pos in range(0, len(source) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        candidates = index.setdefault(source[pos:pos + BLOCK_SIZE], [])
+        if len(candidates) < MAX_CANDIDATES:
+            candidates.append(pos)
+    return index
+
+
+def _match_len(source, src_pos, target, dst_pos):
+    length = 0
+    # compare in chunks first, matching ranges tend to be long
+    step = 256
+    while step:
+        while (src_pos + length + step <= len(source) and
+               dst_pos + length + step <= len(target) and
+               source[src_pos + length:src_pos + length + step] ==
+               target[dst_pos + length:dst_pos + length + step]):
+            length += step
+        step //= 2
+    return length
+
+
+def diff(source, target):
+    """Returns the list of operations turning source into target"""
+    index = _index(source)
+    ops = []
+    literal = 0     # start of the pending literal data
+    pos = 0
+
+    while pos + BLOCK_SIZE <= len(target):
+        best_src, best_len = 0, 0
+        for src in index.get(target[pos:pos + BLOCK_SIZE], ()):
+            length = _match_len(source, src, target, pos)
+            if length > best_len:
+                best_src, best_len = src, length
+
+        if best_len < BLOCK_SIZE:
+            pos += 1
+            continue
+
+        # the match may start before the aligned block
+        while (pos > literal and best_src > 0 and
+               source[best_src - 1] == target[pos - 1]):
+            pos -= 1
+            best_src -= 1
+            best_len += 1
+
+        if pos > literal:
+            ops.append((OP_INSERT, target[literal:pos]))
+        ops.append((OP_COPY, best_src, best_len))
+        pos += best_len
+        literal = pos
+
+    if literal < len(target):
+        ops.append((OP_INSERT, target[literal:]))
+
+    return ops
+
+
+def serialize(source, target, ops):
+    patch = bytearray(MAGIC)
+    patch += struct.pack(">II", len(source), len(target))
+    patch += hashlib.sha256(source).digest()
+
+    for op in ops:
+        if op[0] == OP_COPY:
+            patch += struct.pack(">BII", OP_COPY, op[1], op[2])
+        else:
+            patch += struct.pack(">BI", OP_INSERT, len(op[1]))
+            patch += op[1]
+
+    return bytes(patch)
+
+
+def apply(source, patch):
+    """Reference implementation of the patch application"""
+    assert patch[:4] == MAGIC
+    source_len, target_len = struct.unpack(">II", patch[4:12])
+    assert hashlib.sha256(source[:source_len]).digest() == patch[12:44]
+    target = bytearray()
+    pos = 44
+    while pos < len(patch):
+        if patch[pos] == OP_COPY:
+            offset, length = struct.unpack(">II", patch[pos + 1:pos + 9])
+            target += source[offset:offset + length]
+            pos += 9
+        else:
+            length, = struct.unpack(">I", patch[pos + 1:pos + 5])
+            target += patch[pos + 5:pos + 5 + length]
+            pos += 5 + length
+    assert len(target) == target_len
+    return bytes(target)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("source",
+                        help="image installed on the device, e.g. "
+                             "<app>-slot0.<version>.riot.bin")
+    parser.add_argument("target", help="new image for the other slot")
+    parser.add_argument("output", help="patch file")
+    args = parser.parse_args()
+
+    with open(args.source, "rb") as f:
+        source = f.read()
+    with open(args.target, "rb") as f:
+        target = f.read()
+
+    patch = serialize(source, target, diff(source, target))
+
+    if apply(source, patch) != target:
+        sys.exit("error: patch doesn't reproduce the target image")
+
+    with open(args.output, "wb") as f:
+        f.write(patch)
+
+    print("{}: {} bytes, {:.1f}% of the image".format(
+        args.output, len(patch), 100 * len(patch) / max(len(target), 1)))
+
+
+if __name__ == "__main__":
+    main()
@@ -14,6 +14,14 @@ import json
 import os
 import uuid
 
+# the compressed images are published next to the plain ones with this suffix
+COMPRESSION_SUFFIX = {
+    "heatshrink": ".hs",
+}
+
+# suffix of the patches published next to the plain images
+DELTA_SUFFIX = ".delta"
+
 
 def str2int(x):
     if x.startswith("0x"):
@@ -35,6 +43,13 @@ def parse_arguments():
                         help='Manifest vendor uuid')
     parser.add_argument('--uuid-class', '-C', default="native",
                         help='Manifest class uuid')
+    payload = parser.add_mutually_exclusive_group()
+    payload.add_argument('--compression', '-c', choices=COMPRESSION_SUFFIX,
+                         help='Fetch the images compressed with the given '
+                              'algorithm')
+    payload.add_argument('--delta', '-d', action='store_true',
+                         help='Fetch patches against the running image '
+                              'instead of the images')
     parser.add_argument('slotfiles', nargs="+",
                         help='The list of slot file paths')
     return parser.parse_args()
@@ -68,6 +83,10 @@ def main(args):
         filename, offset, comp_name = image
 
         uri = os.path.join(args.urlroot, os.path.basename(filename))
+        if args.compression:
+            uri += COMPRESSION_SUFFIX[args.compression]
+        elif args.delta:
+            uri += DELTA_SUFFIX
 
         component = {
             "install-id": comp_name,
@@ -81,6 +100,9 @@ def main(args):
         if offset:
             component.update({"offset": offset})
 
+        if args.compression:
+            component.update({"compression-info": args.compression})
+
         template["components"].append(component)
 
     with open(args.output, 'w') as f:
@@ -19,6 +19,7 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "mutex.h"
@@ -454,6 +455,8 @@ static void nd_isr(netdev_t *netdev)
 {
     enc28j60_t *dev = (enc28j60_t *)netdev;
     uint8_t eir = cmd_rcr(dev, REG_EIR, -1);
+    unsigned budget = CONFIG_ENC28J60_RX_BUDGET;
+    bool poll = false;
 
     while (eir != 0) {
         if (eir & EIR_LINKIF) {
@@ -470,10 +473,14 @@ static void nd_isr(netdev_t *netdev)
             }
         }
         if (eir & EIR_PKTIF) {
+            bool more;
+
             do {
                 DEBUG("[enc28j60] isr: packet received\n");
                 netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-            } while (cmd_rcr(dev, REG_B1_EPKTCNT, 1) > 0);
+                more = (cmd_rcr(dev, REG_B1_EPKTCNT, 1) > 0);
+            } while (more && --budget);
+            poll = more;
         }
         if (eir & EIR_RXERIF) {
             DEBUG("[enc28j60] isr: incoming packet dropped - RX buffer full\n");
@@ -488,6 +495,13 @@ static void nd_isr(netdev_t *netdev)
             DEBUG("[enc28j60] isr: error during transmission - pkt dropped\n");
             cmd_bfc(dev, REG_EIR, -1, EIR_TXERIF);
         }
+        if (poll) {
+            /* RX budget exhausted: keep the interrupt disabled and have the
+             * ISR handler called again after other pending work was done */
+            DEBUG("[enc28j60] isr: budget exhausted, polling\n");
+            netdev_trigger_event_isr(netdev);
+            return;
+        }
         eir = cmd_rcr(dev, REG_EIR, -1);
     }
     /* enable global interrupt enable bit again */
@@ -32,6 +32,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum number of frames received per call of the ISR handler
+ *
+ * If more frames are pending, the device's interrupt stays disabled and the
+ * device is polled until its receive buffer is empty (see
+ * @ref netdev_sec_irq_mitigation).
+ */
+#ifndef CONFIG_ENC28J60_RX_BUDGET
+#define CONFIG_ENC28J60_RX_BUDGET           (8U)
+#endif
+
 /**
  * @brief   Struct containing the needed peripheral configuration
  */
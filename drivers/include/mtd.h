@@ -52,6 +52,16 @@ enum mtd_power_state {
  */
 typedef struct mtd_desc mtd_desc_t;
 
+/**
+ * @brief   Asynchronous MTD job, see @ref drivers_mtd_async
+ */
+typedef struct mtd_job mtd_job_t;
+
+/**
+ * @brief   iolist forward declaration, see iolist.h
+ */
+struct iolist;
+
 /**
  * @brief   MTD device descriptor
  */
@@ -212,6 +222,64 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+    /**
+     * @brief   Write data buffered by the driver back to the storage
+     *
+     * May be NULL if the driver does not buffer writes.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
+
+    /**
+     * @brief   Read from the Memory Technology Device (MTD) into multiple
+     *          buffers
+     *
+     * May be NULL, the MTD layer then reads each buffer separately.
+     *
+     * @param[in]  dev      Pointer to the selected driver
+     * @param[out] iol      Buffers to fill, in order
+     * @param[in]  addr     Starting address
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*read_iol)(mtd_dev_t *dev, const struct iolist *iol, uint32_t addr);
+
+    /**
+     * @brief   Write multiple buffers to the Memory Technology Device (MTD)
+     *
+     * The buffers are written back to back starting at @p addr and may
+     * cross page boundaries. No erase is performed.
+     *
+     * May be NULL, the MTD layer then writes each buffer separately.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     * @param[in] iol       Buffers to write, in order
+     * @param[in] addr      Starting address
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*write_iol)(mtd_dev_t *dev, const struct iolist *iol, uint32_t addr);
+
+    /**
+     * @brief   Start an asynchronous job, see @ref drivers_mtd_async
+     *
+     * May be NULL, jobs are then executed by the `mtd_async` worker thread.
+     * Once the job is finished, the driver calls mtd_job_complete().
+     *
+     * @param[in] dev       Pointer to the selected driver
+     * @param[in] job       The job
+     *
+     * @return 0 if the driver took the job
+     * @return < 0 if the job is to be executed by the worker thread
+     */
+    int (*submit)(mtd_dev_t *dev, mtd_job_t *job);
+
     /**
      * @brief   Properties of the MTD driver
      */
@@ -319,6 +387,52 @@ int mtd_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uint32_t count);
 int mtd_write_page_raw(mtd_dev_t *mtd, const void *src, uint32_t page,
                        uint32_t offset, uint32_t size);
 
+/**
+ * @brief   Read data from a MTD device into multiple buffers
+ *
+ * Fills the buffers of @p iol in order with the data starting at @p addr.
+ * Drivers that support it read all buffers in a single transfer.
+ *
+ * @param      mtd   the device to read from
+ * @param[out] iol   the buffers to fill in
+ * @param[in]  addr  the start address to read from
+ *
+ * @return 0 on success
+ * @return < 0 if an error occurred
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -ENOTSUP if operation is not supported on @p mtd
+ * @return -EOVERFLOW if @p addr or the size of @p iol are not valid, i.e.
+ *         outside memory
+ * @return -EIO if I/O error occurred
+ */
+int mtd_read_iol(mtd_dev_t *mtd, const struct iolist *iol, uint32_t addr);
+
+/**
+ * @brief   Write multiple buffers to a MTD device
+ *
+ * Writes the buffers of @p iol back to back starting at @p addr. Unlike
+ * mtd_write(), the data may cross page boundaries. This performs a raw
+ * write, no automatic read-modify-write cycle is performed.
+ *
+ * Drivers that support it write all buffers of a page in a single
+ * transfer, so e.g. a header and a payload need not be copied into a
+ * common buffer first.
+ *
+ * @param      mtd   the device to write to
+ * @param[in]  iol   the buffers to write
+ * @param[in]  addr  the start address to write to
+ *
+ * @return 0 on success
+ * @return < 0 if an error occurred
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -ENOTSUP if operation is not supported on @p mtd
+ * @return -EOVERFLOW if @p addr or the size of @p iol are not valid, i.e.
+ *         outside memory
+ * @return -EIO if I/O error occurred
+ * @return -EINVAL if parameters are invalid
+ */
+int mtd_write_iol(mtd_dev_t *mtd, const struct iolist *iol, uint32_t addr);
+
 /**
  * @brief   Write data to a MTD device with pagewise addressing
  *
@@ -397,6 +511,21 @@ int mtd_erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t num);
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write data buffered by a MTD device back to the storage
+ *
+ * Data written with mtd_write() or mtd_write_page() may be held back by the
+ * driver until this is called, e.g. by a cache or a memory mapped file.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @return 0 if all data was written back or nothing is buffered
+ * @return < 0 if an error occurred
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EIO if I/O error occurred
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
 #if defined(MODULE_VFS) || defined(DOXYGEN)
 /**
  * @brief   MTD driver for VFS
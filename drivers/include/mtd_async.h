@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD jobs
+ * @ingroup     drivers_mtd
+ * @brief       Asynchronous reading, writing and erasing of MTD devices
+ *
+ * Operations are described as @ref mtd_job_t and submitted with
+ * mtd_job_submit(). The submitting thread continues immediately, e.g. to
+ * prepare the next buffer, while the flash is busy. It is notified through
+ * the completion callback of the job, an event posted to an event queue, or
+ * blocks in mtd_job_wait() once it needs the result.
+ *
+ * Drivers that can execute jobs on their own implement
+ * mtd_desc_t::submit and report finished jobs with mtd_job_complete().
+ * Jobs of all other devices are executed in order by the `mtd_async`
+ * worker thread using the synchronous MTD functions.
+ *
+ * The memory referenced by a job, including the job itself and its
+ * iolist, must remain valid until the job is completed, i.e. until
+ * mtd_job_wait() returned or mtd_job_is_done() is true. The job can be
+ * reused afterwards.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * iolist_t data = { .iol_base = buf, .iol_len = sizeof(buf) };
+ * mtd_job_t job = {
+ *     .dev = MTD_0,
+ *     .op = MTD_JOB_WRITE,
+ *     .iol = &data,
+ *     .addr = 0,
+ * };
+ *
+ * mtd_job_submit(&job);
+ * // ... do something else ...
+ * int res = mtd_job_wait(&job);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD job API
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "clist.h"
+#include "event.h"
+#include "iolist.h"
+#include "mtd.h"
+#include "mutex.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Stack size of the MTD worker thread
+ */
+#ifndef MTD_ASYNC_STACKSIZE
+#define MTD_ASYNC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the MTD worker thread
+ */
+#ifndef MTD_ASYNC_PRIO
+#define MTD_ASYNC_PRIO          (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   MTD operations
+ */
+typedef enum {
+    MTD_JOB_READ,           /**< read into mtd_job_t::iol, see mtd_read_iol() */
+    MTD_JOB_WRITE,          /**< write mtd_job_t::iol, see mtd_write_iol() */
+    MTD_JOB_ERASE_SECTOR,   /**< erase mtd_job_t::count sectors starting at
+                                 sector mtd_job_t::addr */
+    MTD_JOB_OP_NUMOF,       /**< number of operations */
+} mtd_job_op_t;
+
+/**
+ * @brief   Completion callback
+ *
+ * Called in the context of the driver completing the job, which may be the
+ * MTD worker thread or an interrupt service routine. It must not block.
+ * The job is only completed after the callback returned, so it must not be
+ * submitted again from within the callback.
+ *
+ * @param[in]   job     the completed job, mtd_job_t::result holds the
+ *                      result
+ * @param[in]   arg     argument given in mtd_job_t::arg
+ */
+typedef void (*mtd_job_cb_t)(mtd_job_t *job, void *arg);
+
+/**
+ * @brief   An asynchronous MTD job
+ */
+struct mtd_job {
+    clist_node_t node;          /**< queue entry, used internally */
+    mtd_dev_t *dev;             /**< the device */
+    mtd_job_op_t op;            /**< the operation */
+    const iolist_t *iol;        /**< buffers of read and write jobs */
+    uint32_t addr;              /**< byte address, first sector for erasing */
+    uint32_t count;             /**< number of sectors to erase */
+    mtd_job_cb_t cb;            /**< completion callback, may be NULL */
+    void *arg;                  /**< argument of @ref mtd_job_t::cb */
+    event_queue_t *queue;       /**< queue to post @ref mtd_job_t::event to
+                                     on completion, may be NULL */
+    event_t *event;             /**< event to post on completion */
+    int result;                 /**< result of the job, 0 on success,
+                                     valid once the job is completed */
+    volatile bool pending;      /**< true until the job is completed */
+    mutex_t done;               /**< unlocked on completion, used internally */
+};
+
+/**
+ * @brief   Start the MTD worker thread
+ *
+ * Called automatically by auto_init.
+ */
+void mtd_async_init(void);
+
+/**
+ * @brief   Submit a job
+ *
+ * Jobs for the same device are executed in the order they were submitted.
+ *
+ * @param[in,out]   job     the job, all fields but the internal ones and
+ *                          mtd_job_t::result have to be set
+ *
+ * @return  0 on success
+ * @return  -ENODEV if mtd_job_t::dev is not a valid device
+ * @return  -EINVAL if the operation is unknown
+ */
+int mtd_job_submit(mtd_job_t *job);
+
+/**
+ * @brief   Wait for a job to complete
+ *
+ * Must not be called from interrupt context.
+ *
+ * @param[in]   job     a submitted job
+ *
+ * @return  mtd_job_t::result
+ */
+int mtd_job_wait(mtd_job_t *job);
+
+/**
+ * @brief   Check if a job is completed
+ *
+ * @param[in]   job     a submitted job
+ *
+ * @return  true if the job is completed
+ */
+static inline bool mtd_job_is_done(const mtd_job_t *job)
+{
+    return !job->pending;
+}
+
+/**
+ * @brief   Execute a job synchronously
+ *
+ * Used by the MTD worker thread. Drivers can use this in
+ * mtd_desc_t::submit for operations that complete immediately.
+ *
+ * @param[in]   job     the job
+ *
+ * @return  the result of the job, see mtd_job_t::result
+ */
+int mtd_job_execute(mtd_job_t *job);
+
+/**
+ * @brief   Complete a job
+ *
+ * Called by drivers once a job is finished. Runs the completion callback,
+ * posts the completion event and wakes up a thread waiting in
+ * mtd_job_wait(). May be called from interrupt context.
+ *
+ * @param[in]   job     the finished job
+ * @param[in]   result  the result, see mtd_job_t::result
+ */
+void mtd_job_complete(mtd_job_t *job, int result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_ASYNC_H */
+/** @} */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD page cache
+ * @ingroup     drivers_storage
+ * @brief       Write-back page cache for MTD devices
+ *
+ * This MTD module wraps another MTD device and keeps the most recently used
+ * pages of it in RAM. File systems repeatedly read the same metadata pages
+ * and update them with small writes; with the cache, these are served from
+ * RAM and the writes to a page are combined into a single write to the
+ * backing device.
+ *
+ * Written data is held back until the page is evicted or mtd_flush() is
+ * called on the cache device. Data that has not been flushed is lost on
+ * power failure or reset.
+ *
+ * Pages are replaced in least recently used order. Writes to the cache are
+ * applied the way the backing device would apply them: on devices without
+ * @ref MTD_DRIVER_FLAG_DIRECT_WRITE the data is ANDed into the cached page,
+ * as on NOR flash. The cache device reports the same write semantics as the
+ * backing device: once initialized, its driver carries
+ * @ref MTD_DRIVER_FLAG_DIRECT_WRITE exactly if the driver of the backing device
+ * does. Only the range between the first and the last modified
+ * byte of a page is written back. Erasing is passed to the backing device
+ * immediately and drops the cached pages of the erased sectors.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * The cache needs a line for each cached page and a buffer for their
+ * contents:
+ *
+ * ```
+ * static mtd_cache_line_t lines[4];
+ * static uint8_t buf[4 * PAGE_SIZE];
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0, lines, buf);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry of the cache device is taken from the backing device when
+ * the cache is initialized with mtd_init(), the backing device is
+ * initialized as well.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD page cache
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Shortcut macro for initializing a @ref mtd_cache_t
+ *
+ * @param[in]   _parent     the backing MTD device
+ * @param[in]   _lines      array of @ref mtd_cache_line_t, one per page
+ * @param[in]   _buf        buffer of ARRAY_SIZE(_lines) pages
+ */
+#define MTD_CACHE_INIT(_parent, _lines, _buf) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .lock = MUTEX_INIT, \
+    .lines = _lines, \
+    .buf = _buf, \
+    .buf_size = sizeof(_buf), \
+    .num = ARRAY_SIZE(_lines), \
+}
+
+/**
+ * @brief   A cached page
+ */
+typedef struct {
+    uint32_t page;          /**< page number, UINT32_MAX if unused */
+    uint32_t used;          /**< time of the last access */
+    uint16_t dirty_start;   /**< first modified byte */
+    uint16_t dirty_end;     /**< end of the modified bytes, 0 if clean */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD page cache
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mutex_t lock;               /**< guards the cache */
+    mtd_cache_line_t *lines;    /**< cached pages */
+    uint8_t *buf;               /**< contents of the cached pages */
+    uint32_t buf_size;          /**< size of @p buf in bytes */
+    uint16_t num;               /**< number of @p lines */
+    uint32_t clock;             /**< access counter for LRU replacement */
+    uint32_t hits;              /**< accesses served from the cache */
+    uint32_t misses;            /**< accesses that had to load a page */
+    uint32_t writebacks;        /**< pages written to the backing device */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Cache MTD device operations table for backing devices with
+ *          @ref MTD_DRIVER_FLAG_DIRECT_WRITE
+ *
+ * Selected by the cache on initialization, don't use it directly.
+ */
+extern const mtd_desc_t mtd_cache_direct_driver;
+
+/**
+ * @brief   Reset the hit, miss and write-back counters of a cache
+ *
+ * @param[in]   cache   the cache
+ */
+static inline void mtd_cache_reset_stats(mtd_cache_t *cache)
+{
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->writebacks = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
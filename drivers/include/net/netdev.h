@@ -158,6 +158,26 @@
  *          called for @ref NETDEV_EVENT_ISR, but it **must** run in thread
  *          context for all other events.
  *
+ * ## Interrupt mitigation {#netdev_sec_irq_mitigation}
+ *
+ * Under high load, signalling every single frame by an interrupt makes the
+ * system spend most of its time switching between interrupt and thread
+ * context. Drivers may therefore switch to polling once they were interrupted:
+ *
+ * 1. the interrupt routine masks the device's interrupt and calls
+ *    @ref netdev_trigger_event_isr()
+ * 2. @ref netdev_driver_t::isr "isr()" handles at most a driver specific
+ *    budget of received frames
+ * 3. if frames are still pending after the budget is exhausted, the interrupt
+ *    stays masked and @ref netdev_driver_t::isr "isr()" calls
+ *    @ref netdev_trigger_event_isr() itself (from thread context) to be
+ *    called again after the hosting thread handled its other pending work
+ * 4. only if the device is idle the interrupt is unmasked again
+ *
+ * Code hosting the driver **must** therefore also accept @ref NETDEV_EVENT_ISR
+ * from within @ref netdev_driver_t::isr "isr()" and **must not** lose this
+ * request, otherwise the device would stay masked.
+ *
  *
  * # Example
  *
@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include "bitarithm.h"
+#include "iolist.h"
 #include "mtd.h"
 
 int mtd_init(mtd_dev_t *mtd)
@@ -226,6 +227,70 @@ int mtd_write_page_raw(mtd_dev_t *mtd, const void *src, uint32_t page, uint32_t
     return 0;
 }
 
+int mtd_read_iol(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (mtd->driver->read_iol) {
+        return mtd->driver->read_iol(mtd, iol, addr);
+    }
+
+    for (; iol; iol = iol->iol_next) {
+        if (iol->iol_len == 0) {
+            continue;
+        }
+
+        int res = mtd_read(mtd, iol->iol_base, addr, iol->iol_len);
+        if (res < 0) {
+            return res;
+        }
+
+        addr += iol->iol_len;
+    }
+
+    return 0;
+}
+
+int mtd_write_iol(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (mtd->driver->write_iol) {
+        return mtd->driver->write_iol(mtd, iol, addr);
+    }
+
+    /* page size is always a power of two */
+    const uint32_t page_mask = mtd->page_size - 1;
+
+    for (; iol; iol = iol->iol_next) {
+        const char *src = iol->iol_base;
+        size_t len = iol->iol_len;
+
+        /* mtd_write() must not cross page boundaries */
+        while (len) {
+            uint32_t chunk = mtd->page_size - (addr & page_mask);
+            if (chunk > len) {
+                chunk = len;
+            }
+
+            int res = mtd_write(mtd, src, addr, chunk);
+            if (res < 0) {
+                return res;
+            }
+
+            src  += chunk;
+            addr += chunk;
+            len  -= chunk;
+        }
+    }
+
+    return 0;
+}
+
 int mtd_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t count)
 {
     if (!mtd || !mtd->driver) {
@@ -288,4 +353,17 @@ int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
     }
 }
 
+int mtd_flush(mtd_dev_t *mtd)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (mtd->driver->flush) {
+        return mtd->driver->flush(mtd);
+    }
+
+    return 0;
+}
+
 /** @} */
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD jobs and the worker thread
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mtd_async.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* wakes up the worker thread */
+#define MTD_ASYNC_FLAG_QUEUE    (1U << 0)
+
+/* jobs to execute in the worker thread */
+static clist_node_t _queue;
+static thread_t *_worker;
+static char _stack[MTD_ASYNC_STACKSIZE];
+
+int mtd_job_execute(mtd_job_t *job)
+{
+    switch (job->op) {
+    case MTD_JOB_READ:
+        return mtd_read_iol(job->dev, job->iol, job->addr);
+    case MTD_JOB_WRITE:
+        return mtd_write_iol(job->dev, job->iol, job->addr);
+    case MTD_JOB_ERASE_SECTOR:
+        return mtd_erase_sector(job->dev, job->addr, job->count);
+    default:
+        return -ENOTSUP;
+    }
+}
+
+void mtd_job_complete(mtd_job_t *job, int result)
+{
+    job->result = result;
+    if (job->cb) {
+        job->cb(job, job->arg);
+    }
+    if (job->queue) {
+        event_post(job->queue, job->event);
+    }
+
+    /* the owner may reuse the job as soon as it is no longer pending, so
+     * don't let it run before the job is no longer accessed */
+    unsigned state = irq_disable();
+    job->pending = false;
+    mutex_unlock(&job->done);
+    irq_restore(state);
+}
+
+static void *_worker_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        unsigned state = irq_disable();
+        clist_node_t *node = clist_lpop(&_queue);
+        irq_restore(state);
+
+        if (node == NULL) {
+            thread_flags_wait_any(MTD_ASYNC_FLAG_QUEUE);
+            continue;
+        }
+
+        mtd_job_t *job = container_of(node, mtd_job_t, node);
+        DEBUG("mtd_async: executing job %p (op %u)\n", (void *)job,
+              (unsigned)job->op);
+        mtd_job_complete(job, mtd_job_execute(job));
+    }
+
+    return NULL;
+}
+
+void mtd_async_init(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack), MTD_ASYNC_PRIO,
+                                     THREAD_CREATE_STACKTEST, _worker_thread,
+                                     NULL, "mtd");
+
+    _worker = thread_get(pid);
+}
+
+int mtd_job_submit(mtd_job_t *job)
+{
+    if (!job->dev || !job->dev->driver) {
+        return -ENODEV;
+    }
+    if ((unsigned)job->op >= MTD_JOB_OP_NUMOF) {
+        return -EINVAL;
+    }
+
+    job->pending = true;
+    mutex_init(&job->done);
+    mutex_lock(&job->done);
+
+    if (job->dev->driver->submit &&
+        (job->dev->driver->submit(job->dev, job) == 0)) {
+        return 0;
+    }
+
+    unsigned state = irq_disable();
+    clist_rpush(&_queue, &job->node);
+    irq_restore(state);
+
+    /* jobs queued before the worker is started are picked up once it runs */
+    if (_worker) {
+        thread_flags_set(_worker, MTD_ASYNC_FLAG_QUEUE);
+    }
+
+    return 0;
+}
+
+int mtd_job_wait(mtd_job_t *job)
+{
+    mutex_lock(&job->done);
+    mutex_unlock(&job->done);
+    return job->result;
+}
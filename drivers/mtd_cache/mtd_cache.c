@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back page cache for MTD devices
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define LINE_UNUSED     (UINT32_MAX)
+
+#define MIN(a, b)       ((a) > (b) ? (b) : (a))
+#define MAX(a, b)       ((a) > (b) ? (a) : (b))
+
+static uint8_t *_line_data(mtd_cache_t *cache, const mtd_cache_line_t *line)
+{
+    return cache->buf + (line - cache->lines) * cache->mtd.page_size;
+}
+
+static uint32_t _page_count(const mtd_cache_t *cache)
+{
+    return cache->mtd.sector_count * cache->mtd.pages_per_sector;
+}
+
+static int _writeback(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (line->dirty_end == 0) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back page %" PRIu32 " [%u, %u)\n", line->page,
+          line->dirty_start, line->dirty_end);
+
+    int res = mtd_write_page_raw(cache->parent,
+                                 _line_data(cache, line) + line->dirty_start,
+                                 line->page, line->dirty_start,
+                                 line->dirty_end - line->dirty_start);
+    if (res < 0) {
+        return res;
+    }
+
+    line->dirty_start = 0;
+    line->dirty_end = 0;
+    cache->writebacks++;
+    return 0;
+}
+
+static mtd_cache_line_t *_lookup(mtd_cache_t *cache, uint32_t page)
+{
+    for (unsigned i = 0; i < cache->num; i++) {
+        if (cache->lines[i].page == page) {
+            cache->lines[i].used = ++cache->clock;
+            return &cache->lines[i];
+        }
+    }
+    return NULL;
+}
+
+static int _load(mtd_cache_t *cache, uint32_t page, bool fill,
+                 mtd_cache_line_t **out)
+{
+    mtd_cache_line_t *victim = &cache->lines[0];
+
+    /* take an unused line or the least recently used one */
+    for (unsigned i = 0; i < cache->num; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+        if (line->page == LINE_UNUSED) {
+            victim = line;
+            break;
+        }
+        if (cache->clock - line->used > cache->clock - victim->used) {
+            victim = line;
+        }
+    }
+
+    int res = _writeback(cache, victim);
+    if (res < 0) {
+        return res;
+    }
+
+    victim->page = LINE_UNUSED;
+    if (fill) {
+        res = mtd_read_page(cache->parent, _line_data(cache, victim), page, 0,
+                            cache->mtd.page_size);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    victim->page = page;
+    victim->used = ++cache->clock;
+    *out = victim;
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    mutex_lock(&cache->lock);
+
+    /* write back what is left from a previous initialization */
+    int res = 0;
+    for (unsigned i = 0; i < cache->num; i++) {
+        res = _writeback(cache, &cache->lines[i]);
+        if (res < 0) {
+            goto out;
+        }
+    }
+
+    res = mtd_init(cache->parent);
+    if (res < 0) {
+        goto out;
+    }
+
+    /* mtd_init() checks the flags of the driver after calling this, so the
+     * cache can report the write semantics of the backing device */
+    if (cache->parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE) {
+        mtd->driver = &mtd_cache_direct_driver;
+    }
+    else {
+        mtd->driver = &mtd_cache_driver;
+    }
+
+    /* the geometry of some devices is only known after initialization */
+    mtd->sector_count = cache->parent->sector_count;
+    mtd->pages_per_sector = cache->parent->pages_per_sector;
+    mtd->page_size = cache->parent->page_size;
+
+    if ((mtd->page_size > UINT16_MAX) ||
+        (cache->buf_size < cache->num * mtd->page_size) ||
+        (cache->num == 0)) {
+        res = -EINVAL;
+        goto out;
+    }
+
+    for (unsigned i = 0; i < cache->num; i++) {
+        cache->lines[i] = (mtd_cache_line_t){ .page = LINE_UNUSED };
+    }
+
+out:
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (page >= _page_count(cache) || offset >= mtd->page_size) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(size, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+
+    int res = 0;
+    mtd_cache_line_t *line = _lookup(cache, page);
+    if (line) {
+        cache->hits++;
+    }
+    else {
+        cache->misses++;
+        res = _load(cache, page, true, &line);
+    }
+
+    if (res == 0) {
+        memcpy(dest, _line_data(cache, line) + offset, size);
+        res = size;
+    }
+
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const bool direct = cache->parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE;
+
+    if (page >= _page_count(cache) || offset >= mtd->page_size) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(size, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+
+    int res = 0;
+    mtd_cache_line_t *line = _lookup(cache, page);
+    if (line) {
+        cache->hits++;
+    }
+    else {
+        /* a page that is overwritten completely needs no reading first */
+        bool fill = !direct || size < mtd->page_size;
+        cache->misses++;
+        res = _load(cache, page, fill, &line);
+    }
+
+    if (res < 0) {
+        goto out;
+    }
+
+    uint8_t *data = _line_data(cache, line) + offset;
+    if (direct) {
+        memcpy(data, src, size);
+    }
+    else {
+        /* programming flash can only clear bits */
+        const uint8_t *in = src;
+        for (uint32_t i = 0; i < size; i++) {
+            data[i] &= in[i];
+        }
+    }
+
+    if (line->dirty_end == 0) {
+        line->dirty_start = offset;
+        line->dirty_end = offset + size;
+    }
+    else {
+        line->dirty_start = MIN(line->dirty_start, offset);
+        line->dirty_end = MAX(line->dirty_end, offset + size);
+    }
+    res = size;
+
+out:
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t first = sector * mtd->pages_per_sector;
+    const uint32_t last = first + count * mtd->pages_per_sector;
+
+    mutex_lock(&cache->lock);
+
+    /* pending writes to the erased sectors are obsolete */
+    for (unsigned i = 0; i < cache->num; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+        if (line->page != LINE_UNUSED &&
+            line->page >= first && line->page < last) {
+            *line = (mtd_cache_line_t){ .page = LINE_UNUSED };
+        }
+    }
+
+    int res = mtd_erase_sector(cache->parent, sector, count);
+
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _flush_locked(mtd_cache_t *cache)
+{
+    int res = 0;
+
+    for (unsigned i = 0; i < cache->num; i++) {
+        int tmp = _writeback(cache, &cache->lines[i]);
+        if (tmp < 0) {
+            res = tmp;
+        }
+    }
+
+    if (res == 0) {
+        res = mtd_flush(cache->parent);
+    }
+
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    mutex_lock(&cache->lock);
+    int res = _flush_locked(cache);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    mutex_lock(&cache->lock);
+
+    int res = 0;
+    if (power == MTD_POWER_DOWN) {
+        res = _flush_locked(cache);
+    }
+    if (res == 0) {
+        res = mtd_power(cache->parent, power);
+    }
+
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flush = _flush,
+};
+
+const mtd_desc_t mtd_cache_direct_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flush = _flush,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
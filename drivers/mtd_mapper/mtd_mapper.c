@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <errno.h>
 
+#include "iolist.h"
 #include "kernel_defines.h"
 #include "mtd.h"
 #include "mtd_mapper.h"
@@ -170,6 +171,54 @@ static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
     return res;
 }
 
+static size_t _iol_size(const iolist_t *iol)
+{
+    size_t size = 0;
+
+    for (; iol; iol = iol->iol_next) {
+        size += iol->iol_len;
+    }
+    return size;
+}
+
+static int _read_iol(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    mtd_mapper_region_t *region = container_of(mtd, mtd_mapper_region_t, mtd);
+
+    if (addr + _iol_size(iol) > _region_size(region)) {
+        return -EOVERFLOW;
+    }
+
+    _lock(region);
+    int res = mtd_read_iol(region->parent->mtd, iol, addr + _byte_offset(region));
+    _unlock(region);
+    return res;
+}
+
+static int _write_iol(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    mtd_mapper_region_t *region = container_of(mtd, mtd_mapper_region_t, mtd);
+
+    if (addr + _iol_size(iol) > _region_size(region)) {
+        return -EOVERFLOW;
+    }
+
+    _lock(region);
+    int res = mtd_write_iol(region->parent->mtd, iol, addr + _byte_offset(region));
+    _unlock(region);
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_mapper_region_t *region = container_of(mtd, mtd_mapper_region_t, mtd);
+
+    _lock(region);
+    int res = mtd_flush(region->parent->mtd);
+    _unlock(region);
+    return res;
+}
+
 const mtd_desc_t mtd_mapper_driver = {
     .init = _init,
     .read = _read,
@@ -178,4 +227,7 @@ const mtd_desc_t mtd_mapper_driver = {
     .write_page = _write_page,
     .erase = _erase,
     .erase_sector = _erase_sector,
+    .flush = _flush,
+    .read_iol = _read_iol,
+    .write_iol = _write_iol,
 };
@@ -29,6 +29,7 @@
 #include "xtimer.h"
 #include "thread.h"
 #include "byteorder.h"
+#include "iolist.h"
 #include "mtd_spi_nor.h"
 
 #define ENABLE_DEBUG    0
@@ -168,6 +169,28 @@ static void mtd_spi_cmd_addr_write(const mtd_spi_nor_t *dev, uint8_t opcode,
     }
 }
 
+/**
+ * @internal
+ * @brief Send command opcode followed by address, keeping CS asserted for
+ *        the data that follows
+ *
+ * @param[in]  dev    pointer to device descriptor
+ * @param[in]  opcode command opcode
+ * @param[in]  addr   address (big endian)
+ */
+static void mtd_spi_cmd_addr(const mtd_spi_nor_t *dev, uint8_t opcode,
+                             uint32_t addr)
+{
+    TRACE("mtd_spi_cmd_addr: %p, %02x, (%06"PRIx32")\n",
+          (void *)dev, (unsigned int)opcode, addr);
+
+    uint8_t *addr_buf = _be_addr(dev, &addr);
+
+    spi_transfer_byte(_get_spi(dev), dev->params->cs, true, opcode);
+    spi_transfer_bytes(_get_spi(dev), dev->params->cs, true,
+                       addr_buf, NULL, dev->params->addr_width);
+}
+
 /**
  * @internal
  * @brief Send command opcode followed by a read to buffer
@@ -596,6 +619,102 @@ static int mtd_spi_nor_write_page(mtd_dev_t *mtd, const void *src, uint32_t page
     return size;
 }
 
+static size_t _iol_size(const iolist_t *iol)
+{
+    size_t size = 0;
+
+    for (; iol; iol = iol->iol_next) {
+        size += iol->iol_len;
+    }
+    return size;
+}
+
+static int mtd_spi_nor_read_iol(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    uint32_t chipsize = mtd->page_size * mtd->pages_per_sector * mtd->sector_count;
+    size_t size = _iol_size(iol);
+
+    DEBUG("mtd_spi_nor_read_iol: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
+          (void *)mtd, (void *)iol, addr, (uint32_t)size);
+
+    if ((addr > chipsize) || (size > chipsize - addr)) {
+        return -EOVERFLOW;
+    }
+    if (size == 0) {
+        return 0;
+    }
+
+    mtd_spi_acquire(dev);
+
+    /* a single read command for all buffers */
+    mtd_spi_cmd_addr(dev, dev->params->opcode->read, addr);
+    for (; iol; iol = iol->iol_next) {
+        if (iol->iol_len == 0) {
+            continue;
+        }
+        size -= iol->iol_len;
+        spi_transfer_bytes(_get_spi(dev), dev->params->cs, size > 0,
+                           NULL, iol->iol_base, iol->iol_len);
+    }
+
+    mtd_spi_release(dev);
+
+    return 0;
+}
+
+static int mtd_spi_nor_write_iol(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    uint32_t total_size = mtd->page_size * mtd->pages_per_sector * mtd->sector_count;
+    size_t size = _iol_size(iol);
+
+    DEBUG("mtd_spi_nor_write_iol: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
+          (void *)mtd, (void *)iol, addr, (uint32_t)size);
+
+    if ((addr > total_size) || (size > total_size - addr)) {
+        return -EOVERFLOW;
+    }
+
+    const uint8_t *src = NULL;
+    size_t left = 0;
+
+    mtd_spi_acquire(dev);
+
+    while (size) {
+        /* one page program command per page, gathering all buffers */
+        uint32_t chunk = MIN(size, mtd->page_size - (addr % mtd->page_size));
+
+        mtd_spi_cmd(dev, dev->params->opcode->wren);
+        mtd_spi_cmd_addr(dev, dev->params->opcode->page_program, addr);
+
+        addr += chunk;
+        size -= chunk;
+
+        while (chunk) {
+            while (left == 0) {
+                src = iol->iol_base;
+                left = iol->iol_len;
+                iol = iol->iol_next;
+            }
+
+            uint32_t n = MIN(left, chunk);
+            chunk -= n;
+            spi_transfer_bytes(_get_spi(dev), dev->params->cs, chunk > 0,
+                               src, NULL, n);
+            src  += n;
+            left -= n;
+        }
+
+        /* waiting for the command to complete before continuing */
+        wait_for_write_complete(dev, 0);
+    }
+
+    mtd_spi_release(dev);
+
+    return 0;
+}
+
 static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
 {
     DEBUG("mtd_spi_nor_erase: %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
@@ -679,4 +798,6 @@ const mtd_desc_t mtd_spi_nor_driver = {
     .write_page = mtd_spi_nor_write_page,
     .erase = mtd_spi_nor_erase,
     .power = mtd_spi_nor_power,
+    .read_iol = mtd_spi_nor_read_iol,
+    .write_iol = mtd_spi_nor_write_iol,
 };
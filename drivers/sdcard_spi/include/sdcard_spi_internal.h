@@ -97,6 +97,8 @@ extern "C" {
 #define SD_CMD_17 17 /* Reads a block of the size selected by the SET_BLOCKLEN command */
 #define SD_CMD_18 18 /* Continuously transfers data blocks from card to host
                         until interrupted by a STOP_TRANSMISSION command */
+#define SD_CMD_23 23 /* Sent as ACMD23 sets the number of blocks to be pre-erased
+                        before the next multiple block write */
 #define SD_CMD_24 24 /* Writes a block of the size selected by the SET_BLOCKLEN command */
 #define SD_CMD_25 25 /* Continuously writes blocks of data until 'Stop Tran'token is sent */
 #define SD_CMD_41 41 /* Reserved (used for ACMD41) */
@@ -188,6 +190,14 @@ extern "C" {
  */
 #define SD_CARD_DUMMY_BYTE  (0xFF)
 
+/**
+ * @brief Number of dummy bytes clocked out per SPI transfer while receiving
+ *        data blocks
+ */
+#ifndef SD_CARD_DUMMY_CHUNK_SIZE
+#define SD_CARD_DUMMY_CHUNK_SIZE (64)
+#endif
+
 /**
  * @brief 1 kiB in Bytes
  */
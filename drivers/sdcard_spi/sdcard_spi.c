@@ -571,6 +571,30 @@ static inline int _transfer_bytes(sdcard_spi_t *card, const uint8_t *out, uint8_
     unsigned trans_bytes = 0;
     uint8_t in_temp;
 
+    /* once the card is in SPI mode, move whole blocks in as few transfers as
+       possible instead of going through the byte-wise wrapper */
+    if (_dyn_spi_rxtx_byte == &_hw_spi_rxtx_byte) {
+        if (out != NULL) {
+            spi_transfer_bytes(card->params.spi_dev, GPIO_UNDEF, true, out, in, length);
+            return length;
+        }
+
+        /* the card expects 0xFF as dummy bytes */
+        static const uint8_t dummy[SD_CARD_DUMMY_CHUNK_SIZE] = {
+            [0 ... SD_CARD_DUMMY_CHUNK_SIZE - 1] = SD_CARD_DUMMY_BYTE
+        };
+        while (trans_bytes < length) {
+            unsigned chunk = length - trans_bytes;
+            if (chunk > sizeof(dummy)) {
+                chunk = sizeof(dummy);
+            }
+            spi_transfer_bytes(card->params.spi_dev, GPIO_UNDEF, true, dummy,
+                               (in != NULL) ? &in[trans_bytes] : NULL, chunk);
+            trans_bytes += chunk;
+        }
+        return trans_bytes;
+    }
+
     for (trans_bytes = 0; trans_bytes < length; trans_bytes++) {
         if (out != NULL) {
             trans_ret = _dyn_spi_rxtx_byte(card, out[trans_bytes], &in_temp);
@@ -752,6 +776,16 @@ static inline int _write_blocks(sdcard_spi_t *card, uint8_t cmd_idx, int bladdr,
     _select_card_spi(card);
     int written = 0;
 
+    /* let the card pre-erase the whole range so it doesn't need to erase
+       block by block while the data comes in */
+    if (cmd_idx == SD_CMD_25) {
+        uint8_t acmd23_r1 = sdcard_spi_send_acmd(card, SD_CMD_23, nbl, 0);
+        if (!R1_VALID(acmd23_r1) || R1_ERROR(acmd23_r1)) {
+            /* this is only a hint, the write works without it */
+            DEBUG("_write_blocks: ACMD23: [IGNORED]\n");
+        }
+    }
+
     uint32_t addr = card->use_block_addr ? bladdr : (bladdr * SD_HC_BLOCK_SIZE);
     uint8_t cmd_r1_resu = sdcard_spi_send_cmd(card, cmd_idx, addr, SD_BLOCK_WRITE_CMD_RETRY_US);
 
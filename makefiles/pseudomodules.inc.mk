@@ -21,6 +21,7 @@ PSEUDOMODULES += cortexm_fpu
 PSEUDOMODULES += cortexm_svc
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crypto_%	# crypto_aes or crypto_3des
+NO_PSEUDOMODULES += crypto_async
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
 PSEUDOMODULES += dhcpv6_%
@@ -60,6 +61,7 @@ PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
 PSEUDOMODULES += gnrc_sixlowpan_frag_hint
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_stats
+PSEUDOMODULES += gnrc_sixlowpan_iphc_cache
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
@@ -82,6 +84,7 @@ PSEUDOMODULES += log_color
 PSEUDOMODULES += lora
 PSEUDOMODULES += mpu_stack_guard
 PSEUDOMODULES += mpu_noexec_ram
+PSEUDOMODULES += mtd_native_stdio
 PSEUDOMODULES += mtd_write_page
 PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += netdev_default
@@ -310,6 +313,21 @@ PSEUDOMODULES += ds18_optimized
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# Alternative AES implementations: bitsliced constant-time or x86 AES-NI
+PSEUDOMODULES += crypto_aes_ct
+PSEUDOMODULES += crypto_aes_ni
+# Ed25519 signature verification
+PSEUDOMODULES += crypto_ed25519
+
+# This pseudomodule causes the SHA-2 rounds to be unrolled (more flash, less CPU)
+PSEUDOMODULES += hashes_sha2xx_unroll
+# Use the x86 SHA extensions for SHA-224/256 if the host CPU supports them
+PSEUDOMODULES += hashes_sha_ni
+# SHA-256 of multiple messages in parallel (sha256_mb())
+PSEUDOMODULES += hashes_sha256_mb
+
+# Use the x86 carry-less multiplication for CRC-32 if the host CPU supports it
+PSEUDOMODULES += checksum_crc32_pclmul
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
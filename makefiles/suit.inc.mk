@@ -25,18 +25,71 @@ SUIT_VENDOR ?= "riot-os.org"
 SUIT_SEQNR ?= $(APP_VER)
 SUIT_CLASS ?= $(BOARD)
 
+# Set to "heatshrink" to publish compressed images, the device decompresses
+# them while writing (needs USEMODULE += riotboot_flashwrite_heatshrink).
+# The window and lookahead sizes must match the decoder configuration.
+SUIT_COMPRESSION ?=
+HEATSHRINK ?= heatshrink
+HEATSHRINK_FLAGS ?= -w 8 -l 4
+
+# Set to the APP_VER of the firmware installed on the devices to publish
+# patches against it instead of complete images (needs
+# USEMODULE += riotboot_flashwrite_delta). Each slot is patched against the
+# old image of the other slot, which is the one running during the update.
+SUIT_DELTA_FROM ?=
+SUIT_DELTA_TOOL ?= $(RIOTBASE)/dist/tools/riotboot_delta/gen_delta.py
+
+SUIT_PAYLOADS := $(SLOT0_RIOT_BIN) $(SLOT1_RIOT_BIN)
+ifeq (heatshrink,$(SUIT_COMPRESSION))
+  SUIT_PAYLOADS := $(SLOT0_RIOT_BIN).hs $(SLOT1_RIOT_BIN).hs
+endif
+ifneq (,$(SUIT_DELTA_FROM))
+  ifneq (,$(SUIT_COMPRESSION))
+    $(error SUIT_DELTA_FROM and SUIT_COMPRESSION can't be combined)
+  endif
+  SUIT_PAYLOADS := $(SLOT0_RIOT_BIN).delta $(SLOT1_RIOT_BIN).delta
+endif
+
+%.riot.bin.hs: %.riot.bin
+	$(HEATSHRINK) -e $(HEATSHRINK_FLAGS) $< $@
+
+# The vendored suit-tool can't encode compression-info, manifests using it
+# are created by a copy with dist/tools/suit/suit_tool_compression.patch
+# applied
+SUIT_TOOL_CREATE ?= $(SUIT_TOOL)
+ifneq (,$(SUIT_COMPRESSION))
+  SUIT_TOOL_PATCHED_DIR ?= $(BINDIR)/suit-manifest-generator
+  SUIT_TOOL_CREATE = $(SUIT_TOOL_PATCHED_DIR)/bin/suit-tool
+  SUIT_TOOL_CREATE_DEPS = $(SUIT_TOOL_PATCHED_DIR)/.patched
+
+  $(SUIT_TOOL_CREATE_DEPS): $(RIOTBASE)/dist/tools/suit/suit_tool_compression.patch
+	@rm -rf $(@D)
+	@mkdir -p $(dir $(@D))
+	@cp -r $(RIOTBASE)/dist/tools/suit/suit-manifest-generator $(@D)
+	patch -s -d $(@D) -p1 < $<
+	@touch $@
+endif
+
+$(SLOT0_RIOT_BIN).delta: $(SLOT0_RIOT_BIN)
+	$(SUIT_DELTA_TOOL) $(BINDIR_APP)-slot1.$(SUIT_DELTA_FROM).riot.bin $< $@
+
+$(SLOT1_RIOT_BIN).delta: $(SLOT1_RIOT_BIN)
+	$(SUIT_DELTA_TOOL) $(BINDIR_APP)-slot0.$(SUIT_DELTA_FROM).riot.bin $< $@
+
 #
-$(SUIT_MANIFEST): $(SLOT0_RIOT_BIN) $(SLOT1_RIOT_BIN)
+$(SUIT_MANIFEST): $(SUIT_PAYLOADS) $(SUIT_TOOL_CREATE_DEPS)
 	$(RIOTBASE)/dist/tools/suit/gen_manifest.py \
 	  --urlroot $(SUIT_COAP_ROOT) \
 	  --seqnr $(SUIT_SEQNR) \
 	  --uuid-vendor $(SUIT_VENDOR) \
 	  --uuid-class $(SUIT_CLASS) \
+	  $(if $(SUIT_COMPRESSION),--compression $(SUIT_COMPRESSION)) \
+	  $(if $(SUIT_DELTA_FROM),--delta) \
 	  -o $@.tmp \
 	  $(SLOT0_RIOT_BIN):$(SLOT0_OFFSET) \
 	  $(SLOT1_RIOT_BIN):$(SLOT1_OFFSET)
 
-	$(SUIT_TOOL) create -f suit -i $@.tmp -o $@
+	$(SUIT_TOOL_CREATE) create -f suit -i $@.tmp -o $@
 
 	rm -f $@.tmp
 
@@ -57,7 +110,7 @@ SUIT_MANIFESTS := $(SUIT_MANIFEST) \
 
 suit/manifest: $(SUIT_MANIFESTS)
 
-suit/publish: $(SUIT_MANIFESTS) $(SLOT0_RIOT_BIN) $(SLOT1_RIOT_BIN)
+suit/publish: $(SUIT_MANIFESTS) $(SUIT_PAYLOADS)
 	@mkdir -p $(SUIT_COAP_FSROOT)/$(SUIT_COAP_BASEPATH)
 	@cp $^ $(SUIT_COAP_FSROOT)/$(SUIT_COAP_BASEPATH)
 	@for file in $^; do \
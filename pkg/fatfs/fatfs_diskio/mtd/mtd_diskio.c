@@ -125,16 +125,23 @@ DRESULT disk_write(BYTE pdrv, const BYTE *buff, DWORD sector, UINT count)
         return RES_PARERR;
     }
 
-    /* erase memory before writing to it */
-    int res = mtd_erase_sector(fatfs_mtd_devs[pdrv], sector, count);
+    int res;
 
-    if (res != 0) {
-        return RES_ERROR; /* erase failed! */
+    /* erase memory before writing to it, devices that can be written
+       directly (e.g. SD cards) take care of that on their own */
+    if ((fatfs_mtd_devs[pdrv]->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE) == 0) {
+        res = mtd_erase_sector(fatfs_mtd_devs[pdrv], sector, count);
+
+        if (res != 0) {
+            return RES_ERROR; /* erase failed! */
+        }
     }
 
     uint32_t sector_size = fatfs_mtd_devs[pdrv]->page_size
                          * fatfs_mtd_devs[pdrv]->pages_per_sector;
 
+    /* hand the whole range down at once, so it can be transferred as a
+       single multi-block write */
     res = mtd_write_page_raw(fatfs_mtd_devs[pdrv], buff,
                              sector, 0, count * sector_size);
 
@@ -164,8 +171,8 @@ DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
     switch (cmd) {
 #if (FF_FS_READONLY == 0)
         case CTRL_SYNC:
-            /* r/w is always finished within r/w-functions of mtd */
-            return RES_OK;
+            /* write back data the device may still have buffered */
+            return (mtd_flush(fatfs_mtd_devs[pdrv]) == 0) ? RES_OK : RES_ERROR;
 #endif
 
 #if (FF_USE_MKFS == 1)
@@ -246,6 +246,18 @@ void auto_init(void)
         }
     }
 
+    if (IS_USED(MODULE_MTD_ASYNC)) {
+        LOG_DEBUG("Auto init mtd_async.\n");
+        extern void mtd_async_init(void);
+        mtd_async_init();
+    }
+
+    if (IS_USED(MODULE_CRYPTO_ASYNC)) {
+        LOG_DEBUG("Auto init crypto_async.\n");
+        extern void crypto_async_init(void);
+        crypto_async_init();
+    }
+
     if (IS_USED(MODULE_TEST_UTILS_INTERACTIVE_SYNC) && !IS_USED(MODULE_SHELL)) {
         extern void test_utils_interactive_sync(void);
         test_utils_interactive_sync();
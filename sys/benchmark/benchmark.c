@@ -34,3 +34,32 @@ void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
            "  ---  %9" PRIu32 " calls per sec\n",
            name, time, full, div, per_sec);
 }
+
+void benchmark_print_throughput(uint32_t time, unsigned long runs, size_t len,
+                                const char *name)
+{
+    uint64_t bytes = (uint64_t)runs * len;
+
+    time = time ? time : 1;
+    /* bytes per millisecond equals kB/s */
+    uint32_t rate = (uint32_t)((bytes * 1000U) / time);
+
+    printf("%s: %lu x %lu bytes in %" PRIu32 "us (%" PRIu32 " kB/s",
+           name, runs, (unsigned long)len, time, rate);
+#ifdef CLOCK_CORECLOCK
+    /* in hundredths of a cycle, fast implementations need less than one */
+    uint32_t cycles = (uint32_t)(((uint64_t)time * (CLOCK_CORECLOCK / 10000U))
+                                 / (bytes ? bytes : 1));
+    printf(", %" PRIu32 ".%02" PRIu32 " cycles/byte", cycles / 100, cycles % 100);
+#endif
+    puts(")");
+}
+
+void benchmark_print_rate(uint32_t time, unsigned long runs, const char *name)
+{
+    time = time ? time : 1;
+    uint32_t per_sec = (uint32_t)(((uint64_t)1000000UL * runs) / time);
+
+    printf("%s: %lu in %" PRIu32 "us (%" PRIu32 " per sec)\n",
+           name, runs, time, per_sec);
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_checksum_crc32
+ * @{
+ *
+ * @file
+ * @brief       Internal interface of the PCLMULQDQ CRC-32 implementation
+ *
+ * Only available with the `checksum_crc32_pclmul` module.
+ */
+
+#ifndef CRC32_PCLMUL_H
+#define CRC32_PCLMUL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Minimum number of bytes processed by the folding functions
+ */
+#define CRC32_PCLMUL_MIN_LEN    (64U)
+
+/**
+ * @brief   The folding functions process multiples of this many bytes
+ */
+#define CRC32_PCLMUL_ALIGN      (16U)
+
+/**
+ * @brief   Check if the host CPU supports PCLMULQDQ and SSE4.1
+ */
+bool crc32_pclmul_supported(void);
+
+/**
+ * @brief   Update a CRC-32 register by folding with PCLMULQDQ
+ *
+ * @param[in]  crc  CRC register, i.e. the inverted checksum
+ * @param[in]  buf  data, at least @ref CRC32_PCLMUL_MIN_LEN bytes
+ * @param[in]  len  number of bytes, multiple of @ref CRC32_PCLMUL_ALIGN
+ *
+ * @return  new CRC register
+ */
+uint32_t crc32_pclmul(uint32_t crc, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Update a CRC-32C register by folding with PCLMULQDQ
+ *
+ * @param[in]  crc  CRC register, i.e. the inverted checksum
+ * @param[in]  buf  data, at least @ref CRC32_PCLMUL_MIN_LEN bytes
+ * @param[in]  len  number of bytes, multiple of @ref CRC32_PCLMUL_ALIGN
+ *
+ * @return  new CRC register
+ */
+uint32_t crc32c_pclmul(uint32_t crc, const uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC32_PCLMUL_H */
+/** @} */
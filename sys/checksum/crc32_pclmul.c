@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_checksum_crc32
+ * @{
+ *
+ * @file
+ * @brief       CRC-32 folding using the x86 carry-less multiplication
+ *
+ * Folds four 128 bit accumulators over 64 byte chunks, then into a single
+ * 128 bit value and finally reduces it to 32 bits with a Barrett reduction,
+ * as described in Intel's "Fast CRC Computation for Generic Polynomials
+ * Using PCLMULQDQ Instruction". Only usable on `native` running on an x86
+ * host.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "_crc32_pclmul.h"
+
+/* the intrinsics are usable without -mpclmul -msse4.1 for the application */
+#define PCLMUL_TARGET       __attribute__((target("pclmul,sse4.1")))
+
+/**
+ * Folding constants of a reflected polynomial P, each bit reflected and
+ * shifted left by one:
+ * x^(4*128+32), x^(4*128-32), x^(128+32), x^(128-32), x^64 mod P,
+ * followed by P itself and the Barrett constant x^64 / P.
+ */
+typedef struct {
+    uint64_t k1k2[2];
+    uint64_t k3k4[2];
+    uint64_t k5[2];
+    uint64_t pu[2];
+} _fold_consts_t;
+
+static const _fold_consts_t _crc32_consts = {
+    .k1k2 = { 0x0154442bd4, 0x01c6e41596 },
+    .k3k4 = { 0x01751997d0, 0x00ccaa009e },
+    .k5 = { 0x0163cd6124, 0 },
+    .pu = { 0x01db710641, 0x01f7011641 },
+};
+
+static const _fold_consts_t _crc32c_consts = {
+    .k1k2 = { 0x00740eef02, 0x009e4addf8 },
+    .k3k4 = { 0x00f20c0dfe, 0x014cd00bd6 },
+    .k5 = { 0x00dd45aab8, 0 },
+    .pu = { 0x0105ec76f1, 0x00dea713f1 },
+};
+
+bool crc32_pclmul_supported(void)
+{
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+}
+
+PCLMUL_TARGET
+static inline __m128i _fold(__m128i x, __m128i k, __m128i data)
+{
+    __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), data);
+}
+
+PCLMUL_TARGET
+static uint32_t _crc_fold(const _fold_consts_t *c, uint32_t crc,
+                          const uint8_t *buf, size_t len)
+{
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x0, x1, x2, x3, k;
+
+    x0 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128(crc));
+    buf += 64;
+    len -= 64;
+
+    /* fold 4 x 128 bit by 512 bits */
+    k = _mm_loadu_si128((const __m128i *)c->k1k2);
+    while (len >= 64) {
+        x0 = _fold(x0, k, _mm_loadu_si128((const __m128i *)(buf + 0x00)));
+        x1 = _fold(x1, k, _mm_loadu_si128((const __m128i *)(buf + 0x10)));
+        x2 = _fold(x2, k, _mm_loadu_si128((const __m128i *)(buf + 0x20)));
+        x3 = _fold(x3, k, _mm_loadu_si128((const __m128i *)(buf + 0x30)));
+        buf += 64;
+        len -= 64;
+    }
+
+    /* fold into a single 128 bit value, then the remaining 16 byte blocks */
+    k = _mm_loadu_si128((const __m128i *)c->k3k4);
+    x0 = _fold(x0, k, x1);
+    x0 = _fold(x0, k, x2);
+    x0 = _fold(x0, k, x3);
+    while (len >= 16) {
+        x0 = _fold(x0, k, _mm_loadu_si128((const __m128i *)buf));
+        buf += 16;
+        len -= 16;
+    }
+
+    /* fold 128 to 64 bits */
+    x1 = _mm_clmulepi64_si128(x0, k, 0x10);
+    x0 = _mm_xor_si128(_mm_srli_si128(x0, 8), x1);
+    k = _mm_loadu_si128((const __m128i *)c->k5);
+    x1 = _mm_srli_si128(x0, 4);
+    x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), k, 0x00);
+    x0 = _mm_xor_si128(x0, x1);
+
+    /* Barrett reduction to 32 bits */
+    k = _mm_loadu_si128((const __m128i *)c->pu);
+    x1 = _mm_and_si128(x0, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k, 0x10);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k, 0x00);
+    x0 = _mm_xor_si128(x0, x1);
+
+    return _mm_extract_epi32(x0, 1);
+}
+
+uint32_t crc32_pclmul(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    return _crc_fold(&_crc32_consts, crc, buf, len);
+}
+
+uint32_t crc32c_pclmul(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    return _crc_fold(&_crc32c_consts, crc, buf, len);
+}
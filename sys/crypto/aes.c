@@ -47,7 +47,8 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks
 };
 const cipher_id_t CIPHER_AES_128 = &aes_interface;
 
@@ -1024,23 +1025,12 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with an already expanded key
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _aes_encrypt_block(const AES_KEY *key, const uint8_t *plainBlock,
+                               uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
@@ -1288,6 +1278,51 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
+}
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    /* setup AES_KEY */
+    int res;
+    AES_KEY aeskey;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    _aes_encrypt_block(&aeskey, plainBlock, cipherBlock);
+    return 1;
+}
+
+/*
+ * Encrypt multiple consecutive blocks, expanding the key only once
+ * in and out can overlap
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t blocks)
+{
+    /* setup AES_KEY */
+    int res;
+    AES_KEY aeskey;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t i = 0; i < blocks; i++) {
+        _aes_encrypt_block(&aeskey, plain, cipher);
+        plain += AES_BLOCK_SIZE;
+        cipher += AES_BLOCK_SIZE;
+    }
     return 1;
 }
 
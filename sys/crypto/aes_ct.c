@@ -0,0 +1,575 @@
+/*
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Adapted from BearSSL's src/symcipher/aes_ct.c, aes_ct_enc.c and
+ * aes_ct_dec.c to the RIOT cipher interface.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Bitsliced, constant-time implementation of AES-128
+ *
+ * Selected with the `crypto_aes_ct` module instead of the T-table
+ * implementation in aes.c. No secret dependent memory accesses or branches
+ * are made, so no timing information leaks through caches. Two blocks are
+ * processed in parallel in eight 32-bit words. The S-box is the circuit
+ * by Joan Boyar and René Peralta.
+ *
+ * @author      Thomas Pornin <pornin@bolet.org>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/helper.h"
+
+#define AES_CT_ROUNDS       (10U)
+#define AES_CT_SKEY_WORDS   ((AES_CT_ROUNDS + 1) * 8)
+
+/**
+ * Interface to the aes cipher
+ */
+static const cipher_interface_t aes_interface = {
+    AES_BLOCK_SIZE,
+    aes_init,
+    aes_encrypt,
+    aes_decrypt,
+    aes_encrypt_blocks
+};
+const cipher_id_t CIPHER_AES_128 = &aes_interface;
+
+static inline uint32_t _dec32le(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) |
+           ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static inline void _enc32le(uint8_t *dst, uint32_t x)
+{
+    dst[0] = (uint8_t)x;
+    dst[1] = (uint8_t)(x >> 8);
+    dst[2] = (uint8_t)(x >> 16);
+    dst[3] = (uint8_t)(x >> 24);
+}
+
+static inline uint32_t _rotr16(uint32_t x)
+{
+    return (x << 16) | (x >> 16);
+}
+
+static void _sbox(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/* S^-1(x) = A^-1(S(A^-1(x))), with A being the affine transformation of the
+ * S-box (including the constant) */
+static void _inv_affine(uint32_t *q)
+{
+    uint32_t q0, q1, q2, q3, q4, q5, q6, q7;
+
+    q0 = ~q[0];
+    q1 = ~q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = ~q[5];
+    q6 = ~q[6];
+    q7 = q[7];
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+static void _inv_sbox(uint32_t *q)
+{
+    _inv_affine(q);
+    _sbox(q);
+    _inv_affine(q);
+}
+
+#define _SWAPN(cl, ch, s, x, y) \
+    do { \
+        uint32_t a = (x), b = (y); \
+        (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+    } while (0)
+
+#define _SWAP2(x, y)    _SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+#define _SWAP4(x, y)    _SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+#define _SWAP8(x, y)    _SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+/* converts between the bitsliced and the "normal" representation (it is its
+ * own inverse) */
+static void _ortho(uint32_t *q)
+{
+    _SWAP2(q[0], q[1]);
+    _SWAP2(q[2], q[3]);
+    _SWAP2(q[4], q[5]);
+    _SWAP2(q[6], q[7]);
+
+    _SWAP4(q[0], q[2]);
+    _SWAP4(q[1], q[3]);
+    _SWAP4(q[4], q[6]);
+    _SWAP4(q[5], q[7]);
+
+    _SWAP8(q[0], q[4]);
+    _SWAP8(q[1], q[5]);
+    _SWAP8(q[2], q[6]);
+    _SWAP8(q[3], q[7]);
+}
+
+static uint32_t _sub_word(uint32_t x)
+{
+    uint32_t q[8];
+
+    memset(q, 0, sizeof(q));
+    q[0] = x;
+    _ortho(q);
+    _sbox(q);
+    _ortho(q);
+    return q[0];
+}
+
+static void _key_schedule(uint32_t *skey, const uint8_t *key)
+{
+    static const uint8_t rcon[] = {
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+    };
+    uint32_t tmp[(AES_CT_ROUNDS + 1) * 4 * 2];
+    uint32_t w = 0;
+    const unsigned nk = AES_KEY_SIZE / 4;
+    const unsigned nkf = (AES_CT_ROUNDS + 1) * 4;
+
+    for (unsigned i = 0; i < nk; i++) {
+        w = _dec32le(key + (i << 2));
+        tmp[(i << 1) + 0] = w;
+        tmp[(i << 1) + 1] = w;
+    }
+    for (unsigned i = nk, j = 0, k = 0; i < nkf; i++) {
+        if (j == 0) {
+            w = (w << 24) | (w >> 8);
+            w = _sub_word(w) ^ rcon[k];
+        }
+        w ^= tmp[(i - nk) << 1];
+        tmp[(i << 1) + 0] = w;
+        tmp[(i << 1) + 1] = w;
+        if (++j == nk) {
+            j = 0;
+            k++;
+        }
+    }
+    for (unsigned i = 0; i < nkf; i += 4) {
+        _ortho(tmp + (i << 1));
+    }
+    /* compress to one word per key word and expand again to the layout used
+     * with two blocks in parallel */
+    for (unsigned i = 0, j = 0; i < nkf; i++, j += 2) {
+        uint32_t c = (tmp[j] & 0x55555555) | (tmp[j + 1] & 0xAAAAAAAA);
+        uint32_t x = c & 0x55555555;
+        uint32_t y = c & 0xAAAAAAAA;
+
+        skey[j + 0] = x | (x << 1);
+        skey[j + 1] = y | (y >> 1);
+    }
+    crypto_secure_wipe(tmp, sizeof(tmp));
+}
+
+static inline void _add_round_key(uint32_t *q, const uint32_t *sk)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        q[i] ^= sk[i];
+    }
+}
+
+static void _shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FF)
+               | ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+               | ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+               | ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+    }
+}
+
+static void _inv_shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FF)
+               | ((x & 0x00003F00) << 2) | ((x & 0x0000C000) >> 6)
+               | ((x & 0x000F0000) << 4) | ((x & 0x00F00000) >> 4)
+               | ((x & 0x03000000) << 6) | ((x & 0xFC000000) >> 2);
+    }
+}
+
+static void _mix_columns(uint32_t *q)
+{
+    uint32_t q0, q1, q2, q3, q4, q5, q6, q7;
+    uint32_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> 8) | (q0 << 24);
+    r1 = (q1 >> 8) | (q1 << 24);
+    r2 = (q2 >> 8) | (q2 << 24);
+    r3 = (q3 >> 8) | (q3 << 24);
+    r4 = (q4 >> 8) | (q4 << 24);
+    r5 = (q5 >> 8) | (q5 << 24);
+    r6 = (q6 >> 8) | (q6 << 24);
+    r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q7 ^ r7 ^ r0 ^ _rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ _rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ _rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ _rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ _rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ _rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ _rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ _rotr16(q7 ^ r7);
+}
+
+static void _inv_mix_columns(uint32_t *q)
+{
+    uint32_t q0, q1, q2, q3, q4, q5, q6, q7;
+    uint32_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> 8) | (q0 << 24);
+    r1 = (q1 >> 8) | (q1 << 24);
+    r2 = (q2 >> 8) | (q2 << 24);
+    r3 = (q3 >> 8) | (q3 << 24);
+    r4 = (q4 >> 8) | (q4 << 24);
+    r5 = (q5 >> 8) | (q5 << 24);
+    r6 = (q6 >> 8) | (q6 << 24);
+    r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ _rotr16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^
+           _rotr16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^
+           _rotr16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ _rotr16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+
+static void _encrypt(const uint32_t *skey, uint32_t *q)
+{
+    _add_round_key(q, skey);
+    for (unsigned u = 1; u < AES_CT_ROUNDS; u++) {
+        _sbox(q);
+        _shift_rows(q);
+        _mix_columns(q);
+        _add_round_key(q, skey + (u << 3));
+    }
+    _sbox(q);
+    _shift_rows(q);
+    _add_round_key(q, skey + (AES_CT_ROUNDS << 3));
+}
+
+static void _decrypt(const uint32_t *skey, uint32_t *q)
+{
+    _add_round_key(q, skey + (AES_CT_ROUNDS << 3));
+    for (unsigned u = AES_CT_ROUNDS - 1; u > 0; u--) {
+        _inv_shift_rows(q);
+        _inv_sbox(q);
+        _add_round_key(q, skey + (u << 3));
+        _inv_mix_columns(q);
+    }
+    _inv_shift_rows(q);
+    _inv_sbox(q);
+    _add_round_key(q, skey);
+}
+
+/* loads up to two blocks: the first one into the even, the second one into the
+ * odd words */
+static void _load(uint32_t *q, const uint8_t *in, unsigned blocks)
+{
+    for (unsigned i = 0; i < 4; i++) {
+        q[i << 1] = _dec32le(in + (i << 2));
+        q[(i << 1) + 1] = (blocks > 1) ? _dec32le(in + 16 + (i << 2)) : 0;
+    }
+    _ortho(q);
+}
+
+static void _store(uint8_t *out, uint32_t *q, unsigned blocks)
+{
+    _ortho(q);
+    for (unsigned i = 0; i < 4; i++) {
+        _enc32le(out + (i << 2), q[i << 1]);
+        if (blocks > 1) {
+            _enc32le(out + 16 + (i << 2), q[(i << 1) + 1]);
+        }
+    }
+}
+
+int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
+{
+    /* This implementation only supports a single key size (defined in
+     * AES_KEY_SIZE) */
+    if (keySize != AES_KEY_SIZE) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+    /* Make sure that context is large enough. If this is not the case,
+     * you should build with -DAES */
+    if (CIPHER_MAX_CONTEXT_SIZE < AES_KEY_SIZE) {
+        return CIPHER_ERR_BAD_CONTEXT_SIZE;
+    }
+
+    memcpy(context->context, key, AES_KEY_SIZE);
+    return CIPHER_INIT_SUCCESS;
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t blocks)
+{
+    uint32_t skey[AES_CT_SKEY_WORDS];
+    uint32_t q[8];
+
+    _key_schedule(skey, context->context);
+    while (blocks > 0) {
+        unsigned n = (blocks > 1) ? 2 : 1;
+
+        _load(q, plain, n);
+        _encrypt(skey, q);
+        _store(cipher, q, n);
+        plain += n * AES_BLOCK_SIZE;
+        cipher += n * AES_BLOCK_SIZE;
+        blocks -= n;
+    }
+    crypto_secure_wipe(skey, sizeof(skey));
+    crypto_secure_wipe(q, sizeof(q));
+    return 1;
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    uint32_t skey[AES_CT_SKEY_WORDS];
+    uint32_t q[8];
+
+    _key_schedule(skey, context->context);
+    _load(q, cipherBlock, 1);
+    _decrypt(skey, q);
+    _store(plainBlock, q, 1);
+    crypto_secure_wipe(skey, sizeof(skey));
+    crypto_secure_wipe(q, sizeof(q));
+    return 1;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       AES-128 using the x86 AES-NI instructions
+ *
+ * Selected with the `crypto_aes_ni` module instead of the T-table
+ * implementation in aes.c. Only usable on `native` running on an x86 host
+ * whose CPU supports AES-NI, aes_init() fails on any other host.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+
+#define AES_NI_ROUNDS       (10U)
+
+/* the intrinsics are usable without -maes -msse2 for the whole application */
+#define AES_NI_TARGET       __attribute__((target("aes,sse2")))
+
+/* blocks encrypted interleaved to hide the latency of AESENC */
+#define AES_NI_PARALLEL     (4U)
+
+/**
+ * Interface to the aes cipher
+ */
+static const cipher_interface_t aes_interface = {
+    AES_BLOCK_SIZE,
+    aes_init,
+    aes_encrypt,
+    aes_decrypt,
+    aes_encrypt_blocks
+};
+const cipher_id_t CIPHER_AES_128 = &aes_interface;
+
+AES_NI_TARGET
+static inline __m128i _expand_step(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, _MM_SHUFFLE(3, 3, 3, 3));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+/* AESKEYGENASSIST needs the round constant as immediate */
+#define _EXPAND(rk, i, rcon) \
+    rk[i] = _expand_step(rk[i - 1], _mm_aeskeygenassist_si128(rk[i - 1], rcon))
+
+AES_NI_TARGET
+static void _key_schedule(__m128i *rk, const cipher_context_t *context)
+{
+    rk[0] = _mm_loadu_si128((const __m128i *)context->context);
+    _EXPAND(rk, 1, 0x01);
+    _EXPAND(rk, 2, 0x02);
+    _EXPAND(rk, 3, 0x04);
+    _EXPAND(rk, 4, 0x08);
+    _EXPAND(rk, 5, 0x10);
+    _EXPAND(rk, 6, 0x20);
+    _EXPAND(rk, 7, 0x40);
+    _EXPAND(rk, 8, 0x80);
+    _EXPAND(rk, 9, 0x1b);
+    _EXPAND(rk, 10, 0x36);
+}
+
+AES_NI_TARGET
+static void _wipe(__m128i *rk, unsigned numof)
+{
+    volatile __m128i *vrk = rk;
+
+    for (unsigned i = 0; i < numof; i++) {
+        vrk[i] = _mm_setzero_si128();
+    }
+}
+
+int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
+{
+    /* This implementation only supports a single key size (defined in
+     * AES_KEY_SIZE) */
+    if (keySize != AES_KEY_SIZE) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+    /* Make sure that context is large enough. If this is not the case,
+     * you should build with -DAES */
+    if (CIPHER_MAX_CONTEXT_SIZE < AES_KEY_SIZE) {
+        return CIPHER_ERR_BAD_CONTEXT_SIZE;
+    }
+
+    /* the host CPU has to support AES-NI, the other functions are only
+     * reachable with a context initialized here */
+    if (!__builtin_cpu_supports("aes")) {
+        return CIPHER_ERR_UNSUPPORTED;
+    }
+
+    memcpy(context->context, key, AES_KEY_SIZE);
+    return CIPHER_INIT_SUCCESS;
+}
+
+AES_NI_TARGET
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t blocks)
+{
+    __m128i rk[AES_NI_ROUNDS + 1];
+
+    _key_schedule(rk, context);
+
+    while (blocks >= AES_NI_PARALLEL) {
+        __m128i b[AES_NI_PARALLEL];
+
+        for (unsigned j = 0; j < AES_NI_PARALLEL; j++) {
+            b[j] = _mm_loadu_si128((const __m128i *)(plain + j * AES_BLOCK_SIZE));
+            b[j] = _mm_xor_si128(b[j], rk[0]);
+        }
+        for (unsigned r = 1; r < AES_NI_ROUNDS; r++) {
+            for (unsigned j = 0; j < AES_NI_PARALLEL; j++) {
+                b[j] = _mm_aesenc_si128(b[j], rk[r]);
+            }
+        }
+        for (unsigned j = 0; j < AES_NI_PARALLEL; j++) {
+            b[j] = _mm_aesenclast_si128(b[j], rk[AES_NI_ROUNDS]);
+            _mm_storeu_si128((__m128i *)(cipher + j * AES_BLOCK_SIZE), b[j]);
+        }
+        plain += AES_NI_PARALLEL * AES_BLOCK_SIZE;
+        cipher += AES_NI_PARALLEL * AES_BLOCK_SIZE;
+        blocks -= AES_NI_PARALLEL;
+    }
+    while (blocks--) {
+        __m128i b = _mm_loadu_si128((const __m128i *)plain);
+
+        b = _mm_xor_si128(b, rk[0]);
+        for (unsigned r = 1; r < AES_NI_ROUNDS; r++) {
+            b = _mm_aesenc_si128(b, rk[r]);
+        }
+        b = _mm_aesenclast_si128(b, rk[AES_NI_ROUNDS]);
+        _mm_storeu_si128((__m128i *)cipher, b);
+        plain += AES_BLOCK_SIZE;
+        cipher += AES_BLOCK_SIZE;
+    }
+
+    _wipe(rk, AES_NI_ROUNDS + 1);
+    return 1;
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+AES_NI_TARGET
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    __m128i rk[AES_NI_ROUNDS + 1];
+    __m128i b = _mm_loadu_si128((const __m128i *)cipherBlock);
+
+    _key_schedule(rk, context);
+
+    /* equivalent inverse cipher: apply InvMixColumns to the inner round keys */
+    b = _mm_xor_si128(b, rk[AES_NI_ROUNDS]);
+    for (unsigned r = AES_NI_ROUNDS - 1; r > 0; r--) {
+        b = _mm_aesdec_si128(b, _mm_aesimc_si128(rk[r]));
+    }
+    b = _mm_aesdeclast_si128(b, rk[0]);
+    _mm_storeu_si128((__m128i *)plainBlock, b);
+
+    _wipe(rk, AES_NI_ROUNDS + 1);
+    return 1;
+}
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous crypto jobs and the software backend
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "crypto/async.h"
+#include "crypto/chacha20poly1305.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#if IS_USED(MODULE_CIPHER_MODES)
+#include "crypto/modes/ccm.h"
+#endif
+#if IS_USED(MODULE_HASHES)
+#include "hashes/sha256.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* wakes up the worker thread */
+#define CRYPTO_ASYNC_FLAG_QUEUE     (1U << 0)
+
+static crypto_async_backend_t *_backends;
+
+/* jobs to execute in software */
+static clist_node_t _queue;
+static thread_t *_worker;
+static char _stack[CRYPTO_ASYNC_STACKSIZE];
+
+static int _cipher_blocks(crypto_job_t *job)
+{
+    const crypto_job_cipher_t *p = &job->params.cipher;
+    int block_size = cipher_get_block_size(p->cipher);
+
+    if (p->len % block_size) {
+        return -EINVAL;
+    }
+
+    if (job->op == CRYPTO_JOB_CIPHER_ENCRYPT) {
+        if (cipher_encrypt_blocks(p->cipher, p->input, p->output,
+                                  p->len / block_size) != 1) {
+            return -EINVAL;
+        }
+        return p->len;
+    }
+
+    for (size_t off = 0; off < p->len; off += block_size) {
+        if (cipher_decrypt(p->cipher, p->input + off, p->output + off) != 1) {
+            return -EINVAL;
+        }
+    }
+    return p->len;
+}
+
+#if IS_USED(MODULE_CIPHER_MODES)
+static int _ccm(crypto_job_t *job)
+{
+    const crypto_job_ccm_t *p = &job->params.ccm;
+
+    if (job->op == CRYPTO_JOB_CCM_ENCRYPT) {
+        return cipher_encrypt_ccm(p->cipher, p->auth_data, p->auth_data_len,
+                                  p->mac_length, p->length_encoding,
+                                  p->nonce, p->nonce_len,
+                                  p->input, p->input_len, p->output);
+    }
+    return cipher_decrypt_ccm(p->cipher, p->auth_data, p->auth_data_len,
+                              p->mac_length, p->length_encoding,
+                              p->nonce, p->nonce_len,
+                              p->input, p->input_len, p->output);
+}
+#endif
+
+static int _chacha20poly1305(crypto_job_t *job)
+{
+    const crypto_job_aead_t *p = &job->params.aead;
+    size_t len;
+
+    if (job->op == CRYPTO_JOB_CHACHA20POLY1305_ENCRYPT) {
+        chacha20poly1305_encrypt(p->output, p->input, p->input_len,
+                                 p->aad, p->aad_len, p->key, p->nonce);
+        return p->input_len + CHACHA20POLY1305_TAG_BYTES;
+    }
+
+    if (p->input_len < CHACHA20POLY1305_TAG_BYTES) {
+        return -EINVAL;
+    }
+    if (!chacha20poly1305_decrypt(p->input, p->input_len, p->output, &len,
+                                  p->aad, p->aad_len, p->key, p->nonce)) {
+        return -EBADMSG;
+    }
+    return len;
+}
+
+int crypto_job_execute(crypto_job_t *job)
+{
+    switch (job->op) {
+    case CRYPTO_JOB_CIPHER_ENCRYPT:
+    case CRYPTO_JOB_CIPHER_DECRYPT:
+        return _cipher_blocks(job);
+#if IS_USED(MODULE_CIPHER_MODES)
+    case CRYPTO_JOB_CCM_ENCRYPT:
+    case CRYPTO_JOB_CCM_DECRYPT:
+        return _ccm(job);
+#endif
+    case CRYPTO_JOB_CHACHA20POLY1305_ENCRYPT:
+    case CRYPTO_JOB_CHACHA20POLY1305_DECRYPT:
+        return _chacha20poly1305(job);
+#if IS_USED(MODULE_HASHES)
+    case CRYPTO_JOB_SHA256:
+        sha256(job->params.hash.data, job->params.hash.len,
+               job->params.hash.digest);
+        return SHA256_DIGEST_LENGTH;
+#endif
+    default:
+        return -ENOTSUP;
+    }
+}
+
+void crypto_async_complete(crypto_job_t *job, int result)
+{
+    job->result = result;
+    if (job->cb) {
+        job->cb(job, job->arg);
+    }
+
+    /* the owner may reuse the job as soon as it is no longer pending, so
+     * don't let it run before the job is no longer accessed */
+    unsigned state = irq_disable();
+    job->pending = false;
+    mutex_unlock(&job->done);
+    irq_restore(state);
+}
+
+static void _soft_submit(crypto_job_t *job)
+{
+    unsigned state = irq_disable();
+    clist_rpush(&_queue, &job->node);
+    irq_restore(state);
+
+    /* jobs queued before the worker is started are picked up once it runs */
+    if (_worker) {
+        thread_flags_set(_worker, CRYPTO_ASYNC_FLAG_QUEUE);
+    }
+}
+
+static void *_worker_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        unsigned state = irq_disable();
+        clist_node_t *node = clist_lpop(&_queue);
+        irq_restore(state);
+
+        if (node == NULL) {
+            thread_flags_wait_any(CRYPTO_ASYNC_FLAG_QUEUE);
+            continue;
+        }
+
+        crypto_job_t *job = container_of(node, crypto_job_t, node);
+        DEBUG("crypto_async: executing job %p (op %u)\n", (void *)job,
+              (unsigned)job->op);
+        crypto_async_complete(job, crypto_job_execute(job));
+    }
+
+    return NULL;
+}
+
+void crypto_async_init(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack), CRYPTO_ASYNC_PRIO,
+                                     THREAD_CREATE_STACKTEST, _worker_thread,
+                                     NULL, "crypto");
+
+    _worker = thread_get(pid);
+}
+
+void crypto_async_register(crypto_async_backend_t *backend)
+{
+    unsigned state = irq_disable();
+    backend->next = _backends;
+    _backends = backend;
+    irq_restore(state);
+}
+
+static void _dispatch(crypto_job_t *job)
+{
+    for (crypto_async_backend_t *b = _backends; b; b = b->next) {
+        if ((b->ops & (1UL << job->op)) && (b->submit(b, job) == 0)) {
+            return;
+        }
+    }
+    _soft_submit(job);
+}
+
+int crypto_job_submit(crypto_job_t *job)
+{
+    return crypto_job_submit_batch(job, 1);
+}
+
+int crypto_job_submit_batch(crypto_job_t *jobs, size_t num)
+{
+    for (size_t i = 0; i < num; i++) {
+        if ((unsigned)jobs[i].op >= CRYPTO_JOB_OP_NUMOF) {
+            return -EINVAL;
+        }
+    }
+
+    /* a pending job is still linked into a queue, submitting it again would
+     * corrupt that queue */
+    unsigned state = irq_disable();
+    for (size_t i = 0; i < num; i++) {
+        if (jobs[i].pending) {
+            irq_restore(state);
+            return -EBUSY;
+        }
+    }
+    for (size_t i = 0; i < num; i++) {
+        jobs[i].pending = true;
+        jobs[i].done = (mutex_t)MUTEX_INIT_LOCKED;
+    }
+    irq_restore(state);
+
+    for (size_t i = 0; i < num; i++) {
+        _dispatch(&jobs[i]);
+    }
+    return 0;
+}
+
+int crypto_job_wait(crypto_job_t *job)
+{
+    mutex_lock(&job->done);
+    mutex_unlock(&job->done);
+    return job->result;
+}
@@ -40,6 +40,25 @@
 
 #include <string.h>
 
+/* Several blocks are computed at once in the lanes of a SIMD vector on hosts
+ * that have one. Elsewhere the scalar code is used, which is smaller. */
+#if defined(__i386__) || defined(__x86_64__)
+#  define CHACHA_SIMD
+#  if CONFIG_CRYPTO_CHACHA_SIMD_LANES == 8
+#    define CHACHA_SIMD_TARGET      __attribute__((target("avx2")))
+#    define CHACHA_SIMD_SUPPORTED() __builtin_cpu_supports("avx2")
+#  else
+#    define CHACHA_SIMD_TARGET      __attribute__((target("sse2")))
+#    define CHACHA_SIMD_SUPPORTED() __builtin_cpu_supports("sse2")
+#  endif
+#elif defined(__ARM_NEON)
+#  define CHACHA_SIMD
+#  define CHACHA_SIMD_TARGET
+#  define CHACHA_SIMD_SUPPORTED() (1)
+#endif
+
+#define LANES   CONFIG_CRYPTO_CHACHA_SIMD_LANES
+
 static void _r(uint32_t *d, uint32_t *a, const uint32_t *b, unsigned c)
 {
     *a += *b;
@@ -115,6 +134,85 @@ void chacha_keystream_bytes(chacha_ctx *ctx, void *x)
     }
 }
 
+#ifdef CHACHA_SIMD
+typedef uint32_t chacha_vec_t __attribute__((vector_size(LANES * sizeof(uint32_t))));
+
+#define ROTL(x, n)  (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) do { \
+        a += b; d ^= a; d = ROTL(d, 16); \
+        c += d; b ^= c; b = ROTL(b, 12); \
+        a += b; d ^= a; d = ROTL(d, 8); \
+        c += d; b ^= c; b = ROTL(b, 7); \
+    } while (0)
+
+/* Compute LANES consecutive blocks, block i in lane i */
+CHACHA_SIMD_TARGET
+static void _keystream_lanes(const uint32_t input[16], uint8_t rounds,
+                             uint8_t *output)
+{
+    chacha_vec_t in[16], x[16];
+
+    for (unsigned i = 0; i < 16; i++) {
+        in[i] = (chacha_vec_t){ 0 } + input[i];
+    }
+    /* consecutive block counters with carry into the upper word */
+    for (unsigned l = 0; l < LANES; l++) {
+        in[12][l] = input[12] + l;
+        in[13][l] = input[13] + (in[12][l] < input[12]);
+    }
+    memcpy(x, in, sizeof(x));
+
+    for (unsigned i = 0; i < rounds; i += 2) {
+        QUARTERROUND(x[0], x[4], x[8], x[12]);
+        QUARTERROUND(x[1], x[5], x[9], x[13]);
+        QUARTERROUND(x[2], x[6], x[10], x[14]);
+        QUARTERROUND(x[3], x[7], x[11], x[15]);
+        QUARTERROUND(x[0], x[5], x[10], x[15]);
+        QUARTERROUND(x[1], x[6], x[11], x[12]);
+        QUARTERROUND(x[2], x[7], x[8], x[13]);
+        QUARTERROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (unsigned i = 0; i < 16; i++) {
+        x[i] += in[i];
+    }
+    for (unsigned l = 0; l < LANES; l++) {
+        for (unsigned i = 0; i < 16; i++) {
+            uint32_t word = x[i][l];
+
+            memcpy(&output[64 * l + 4 * i], &word, sizeof(word));
+        }
+    }
+}
+#endif /* CHACHA_SIMD */
+
+void chacha_keystream_blocks(chacha_ctx *ctx, void *x, size_t blocks)
+{
+    uint8_t *output = x;
+
+#ifdef CHACHA_SIMD
+    if (blocks >= LANES && CHACHA_SIMD_SUPPORTED()) {
+        do {
+            _keystream_lanes(ctx->state, ctx->rounds, output);
+
+            uint32_t counter = ctx->state[12];
+            ctx->state[12] += LANES;
+            if (ctx->state[12] < counter) {
+                ++ctx->state[13];
+            }
+            output += 64 * LANES;
+            blocks -= LANES;
+        } while (blocks >= LANES);
+    }
+#endif
+
+    while (blocks--) {
+        chacha_keystream_bytes(ctx, output);
+        output += 64;
+    }
+}
+
 void chacha_encrypt_bytes(chacha_ctx *ctx, const uint8_t *m, uint8_t *c)
 {
     uint8_t x[64];
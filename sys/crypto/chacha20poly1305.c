@@ -19,10 +19,12 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
 
+#include "crypto/chacha.h"
 #include "crypto/helper.h"
 #include "crypto/chacha20poly1305.h"
 #include "crypto/poly1305.h"
@@ -51,63 +53,81 @@ static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
     *d = (tmp << c) | (tmp >> (32 - c));
 }
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
+static void _add_initial(uint32_t *state, const uint8_t *key,
                          const uint8_t *nonce, uint32_t blk)
 {
     for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+        state[i] += constant[i];
     }
     for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+        state[i+4] += unaligned_get_u32(key + 4*i);
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
+    state[12] += unaligned_get_u32((uint8_t*)&blk);
+    state[13] += unaligned_get_u32(nonce);
+    state[14] += unaligned_get_u32(nonce+4);
+    state[15] += unaligned_get_u32(nonce+8);
 }
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
+static void _keystream_block(uint32_t *state, const uint8_t *key,
+                             const uint8_t *nonce, uint32_t blk)
 {
     /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
+    memset(state, 0, 16 * sizeof(uint32_t));
+    _add_initial(state, key, nonce, blk);
 
     /* perform rounds */
     for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
+        uint32_t *a = &state[((i                    ) & 3)          ];
+        uint32_t *b = &state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
+        uint32_t *c = &state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
+        uint32_t *d = &state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
         _r(a, b, d, 16);
         _r(c, d, b, 12);
         _r(a, b, d, 8);
         _r(c, d, b, 7);
     }
     /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
+    _add_initial(state, key, nonce, blk);
 }
 
-static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                    const uint8_t *nonce, const uint8_t *in, uint8_t *out, size_t len)
+static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
+                       const uint8_t *nonce, uint32_t blk)
 {
-    /* Number of full 64 byte blocks */
-    const size_t num_blocks = len >> 6;
-    size_t pos = 0;
-    /* xcrypt full blocks */
-    for (size_t i = 0; i < num_blocks; i++, pos += 64) {
-        _keystream(ctx, key, nonce, i+1);
-        for (size_t j = 0; j < 64; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
-        }
-    }
-    /* xcrypt remaining bytes */
-    if (len - pos) {
-        _keystream(ctx, key, nonce, num_blocks+1);
-        for (size_t j = 0; j < len - pos; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+    _keystream_block(ctx->state, key, nonce, blk);
+}
+
+static void _xcrypt(const uint8_t *key, const uint8_t *nonce,
+                    const uint8_t *in, uint8_t *out, size_t len)
+{
+    /* the RFC 8439 layout with a 32 bit counter and a 96 bit nonce is used
+     * with the generic ChaCha core, which computes several blocks at once */
+    chacha_ctx ctx;
+    uint8_t stream[CONFIG_CRYPTO_CHACHA_SIMD_LANES * 64];
+
+    memcpy(ctx.state, constant, sizeof(constant));
+    memcpy(&ctx.state[4], key, CHACHA20POLY1305_KEY_BYTES);
+    /* the message starts at block 1, block 0 is the poly1305 key */
+    ctx.state[12] = 1;
+    memcpy(&ctx.state[13], nonce, CHACHA20POLY1305_NONCE_BYTES);
+    ctx.rounds = 20;
+
+    while (len > 0) {
+        size_t blocks = (len + 63) / 64;
+
+        if (blocks > CONFIG_CRYPTO_CHACHA_SIMD_LANES) {
+            blocks = CONFIG_CRYPTO_CHACHA_SIMD_LANES;
         }
+        size_t chunk = (len < 64 * blocks) ? len : 64 * blocks;
+
+        chacha_keystream_blocks(&ctx, stream, blocks);
+        crypto_xor(out, in, stream, chunk);
+        in += chunk;
+        out += chunk;
+        len -= chunk;
     }
+
+    crypto_secure_wipe(&ctx, sizeof(ctx));
+    crypto_secure_wipe(stream, sizeof(stream));
 }
 
 static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
@@ -141,9 +161,7 @@ void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
                               size_t msglen, const uint8_t *aad, size_t aadlen,
                               const uint8_t *key, const uint8_t *nonce)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, msg, cipher, msglen);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
+    _xcrypt(key, nonce, msg, cipher, msglen);
     /* Generate tag */
     _poly1305_gentag(&cipher[msglen], key, nonce,
                     cipher, msglen, aad, aadlen);
@@ -162,8 +180,93 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
     if (crypto_equals(cipher+*msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
         return 0;
     }
-    chacha20poly1305_ctx_t ctx;
-    /* Number of full blocks */
-    _xcrypt(&ctx, key, nonce, cipher, msg, *msglen);
+    _xcrypt(key, nonce, cipher, msg, *msglen);
     return 1;
 }
+
+void chacha20poly1305_stream_init(chacha20poly1305_stream_ctx_t *ctx,
+                                  const uint8_t *key, const uint8_t *nonce)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    memcpy(ctx->key, key, CHACHA20POLY1305_KEY_BYTES);
+    memcpy(ctx->nonce, nonce, CHACHA20POLY1305_NONCE_BYTES);
+    /* generate one time key, the message starts at block 1 */
+    _keystream_block(ctx->stream, key, nonce, 0);
+    poly1305_init(&ctx->poly, (uint8_t*)ctx->stream);
+    ctx->counter = 1;
+    ctx->stream_pos = sizeof(ctx->stream);
+}
+
+void chacha20poly1305_stream_aad(chacha20poly1305_stream_ctx_t *ctx,
+                                 const uint8_t *aad, size_t aadlen)
+{
+    /* additional data is only accepted before the message */
+    assert(ctx->msglen == 0);
+    poly1305_update(&ctx->poly, aad, aadlen);
+    ctx->aadlen += aadlen;
+}
+
+/* Pad the additional data once the first part of the message arrives */
+static void _stream_start_msg(chacha20poly1305_stream_ctx_t *ctx)
+{
+    if (!ctx->aad_padded) {
+        poly1305_update(&ctx->poly, padding, (16 - ctx->aadlen) & 0xF);
+        ctx->aad_padded = 1;
+    }
+}
+
+static void _stream_xcrypt(chacha20poly1305_stream_ctx_t *ctx,
+                           const uint8_t *in, uint8_t *out, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (ctx->stream_pos == sizeof(ctx->stream)) {
+            _keystream_block(ctx->stream, ctx->key, ctx->nonce,
+                             ctx->counter++);
+            ctx->stream_pos = 0;
+        }
+        out[i] = in[i] ^ ((uint8_t*)ctx->stream)[ctx->stream_pos++];
+    }
+    ctx->msglen += len;
+}
+
+void chacha20poly1305_stream_encrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *cipher, const uint8_t *msg,
+                                     size_t len)
+{
+    _stream_start_msg(ctx);
+    _stream_xcrypt(ctx, msg, cipher, len);
+    /* the tag covers the ciphertext */
+    poly1305_update(&ctx->poly, cipher, len);
+}
+
+void chacha20poly1305_stream_decrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *msg, const uint8_t *cipher,
+                                     size_t len)
+{
+    _stream_start_msg(ctx);
+    /* MAC the ciphertext before it may get overwritten by the plaintext */
+    poly1305_update(&ctx->poly, cipher, len);
+    _stream_xcrypt(ctx, cipher, msg, len);
+}
+
+void chacha20poly1305_stream_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                    uint8_t *tag)
+{
+    _stream_start_msg(ctx);
+    poly1305_update(&ctx->poly, padding, (16 - ctx->msglen) & 0xF);
+    const uint64_t lengths[2] = {ctx->aadlen, ctx->msglen};
+    poly1305_update(&ctx->poly, (uint8_t*)lengths, sizeof(lengths));
+    poly1305_finish(&ctx->poly, tag);
+    crypto_secure_wipe(ctx, sizeof(*ctx));
+}
+
+int chacha20poly1305_stream_verify(chacha20poly1305_stream_ctx_t *ctx,
+                                   const uint8_t *tag)
+{
+    uint8_t mac[CHACHA20POLY1305_TAG_BYTES];
+
+    chacha20poly1305_stream_finish(ctx, mac);
+    int res = crypto_equals(tag, mac, CHACHA20POLY1305_TAG_BYTES);
+    crypto_secure_wipe(mac, sizeof(mac));
+    return res;
+}
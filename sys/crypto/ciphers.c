@@ -34,6 +34,29 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
 }
 
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks)
+{
+    const cipher_interface_t *interface = cipher->interface;
+
+    if (interface->encrypt_blocks) {
+        return interface->encrypt_blocks(&cipher->context, input, output,
+                                         blocks);
+    }
+
+    for (size_t i = 0; i < blocks; i++) {
+        int res = interface->encrypt(&cipher->context, input, output);
+
+        if (res != 1) {
+            return res;
+        }
+        input += interface->block_size;
+        output += interface->block_size;
+    }
+    return 1;
+}
+
+
 int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output)
 {
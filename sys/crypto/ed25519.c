@@ -0,0 +1,2015 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto_ed25519
+ * @{
+ *
+ * @file
+ * @brief       Ed25519 signature verification
+ *
+ * Point arithmetic on the twisted Edwards curve follows the formulas of the
+ * ref10 implementation by Bernstein et al. (public domain). Double scalar
+ * multiplications use Straus' method with width 4 NAFs, the precomputed
+ * tables are evaluated with the signed radix 16 comb method.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/ed25519.h"
+#include "hashes/sha512.h"
+
+#define ROWS        CONFIG_CRYPTO_ED25519_COMB_ROWS
+#define PASSES      (64 / ROWS)
+#define BATCH       CONFIG_CRYPTO_ED25519_BATCH_SIZE
+
+/* number of odd multiples used with NAFs, the digits are in [-7, 7] */
+#define ODD         (4U)
+
+#if (ROWS != 2) && (ROWS != 4) && (ROWS != 8) && (ROWS != 16)
+#error "CONFIG_CRYPTO_ED25519_COMB_ROWS has to be 2, 4, 8 or 16"
+#endif
+
+#if BATCH < 1
+#error "CONFIG_CRYPTO_ED25519_BATCH_SIZE has to be at least 1"
+#endif
+
+typedef ed25519_fe_t fe;
+typedef ed25519_precomp_t ge_precomp;
+
+/* extended coordinates: x = X/Z, y = Y/Z, x * y = T/Z, when used as
+ * projective point (X:Y:Z) the value of T is stale */
+typedef struct {
+    fe X, Y, Z, T;
+} ge_p3;
+
+/* completed coordinates: x = X/Z, y = Y/T */
+typedef struct {
+    fe X, Y, Z, T;
+} ge_p1p1;
+
+typedef struct {
+    fe YplusX, YminusX, Z, T2d;
+} ge_cached;
+
+/*
+ * Arithmetic modulo p = 2^255 - 19. Results are reduced far enough to be
+ * used as input of any other operation, fe_tobytes() yields the canonical
+ * encoding.
+ */
+#ifdef __SIZEOF_INT128__
+
+typedef unsigned __int128 u128;
+
+#define MASK51      ((UINT64_C(1) << 51) - 1)
+
+static void _fe_carry(uint64_t *h)
+{
+    uint64_t c;
+
+    c = h[0] >> 51; h[0] &= MASK51; h[1] += c;
+    c = h[1] >> 51; h[1] &= MASK51; h[2] += c;
+    c = h[2] >> 51; h[2] &= MASK51; h[3] += c;
+    c = h[3] >> 51; h[3] &= MASK51; h[4] += c;
+    c = h[4] >> 51; h[4] &= MASK51; h[0] += 19 * c;
+}
+
+static void fe_add(fe *h, const fe *f, const fe *g)
+{
+    for (unsigned i = 0; i < 5; i++) {
+        h->v[i] = f->v[i] + g->v[i];
+    }
+    _fe_carry(h->v);
+}
+
+static void fe_sub(fe *h, const fe *f, const fe *g)
+{
+    /* add 2 * p to stay positive */
+    h->v[0] = f->v[0] + UINT64_C(0xfffffffffffda) - g->v[0];
+    for (unsigned i = 1; i < 5; i++) {
+        h->v[i] = f->v[i] + UINT64_C(0xffffffffffffe) - g->v[i];
+    }
+    _fe_carry(h->v);
+}
+
+static void _fe_reduce(fe *h, u128 r0, u128 r1, u128 r2, u128 r3, u128 r4)
+{
+    uint64_t c;
+
+    r1 += (uint64_t)(r0 >> 51);
+    r2 += (uint64_t)(r1 >> 51);
+    r3 += (uint64_t)(r2 >> 51);
+    r4 += (uint64_t)(r3 >> 51);
+    c = (uint64_t)(r4 >> 51);
+
+    h->v[0] = ((uint64_t)r0 & MASK51) + 19 * c;
+    h->v[1] = ((uint64_t)r1 & MASK51) + (h->v[0] >> 51);
+    h->v[0] &= MASK51;
+    h->v[2] = (uint64_t)r2 & MASK51;
+    h->v[3] = (uint64_t)r3 & MASK51;
+    h->v[4] = (uint64_t)r4 & MASK51;
+}
+
+static void fe_mul(fe *h, const fe *f, const fe *g)
+{
+    uint64_t f0 = f->v[0], f1 = f->v[1], f2 = f->v[2], f3 = f->v[3];
+    uint64_t f4 = f->v[4];
+    uint64_t g0 = g->v[0], g1 = g->v[1], g2 = g->v[2], g3 = g->v[3];
+    uint64_t g4 = g->v[4];
+    uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3;
+    uint64_t g4_19 = 19 * g4;
+
+    _fe_reduce(h,
+               (u128)f0 * g0 + (u128)f1 * g4_19 + (u128)f2 * g3_19 +
+               (u128)f3 * g2_19 + (u128)f4 * g1_19,
+               (u128)f0 * g1 + (u128)f1 * g0 + (u128)f2 * g4_19 +
+               (u128)f3 * g3_19 + (u128)f4 * g2_19,
+               (u128)f0 * g2 + (u128)f1 * g1 + (u128)f2 * g0 +
+               (u128)f3 * g4_19 + (u128)f4 * g3_19,
+               (u128)f0 * g3 + (u128)f1 * g2 + (u128)f2 * g1 +
+               (u128)f3 * g0 + (u128)f4 * g4_19,
+               (u128)f0 * g4 + (u128)f1 * g3 + (u128)f2 * g2 +
+               (u128)f3 * g1 + (u128)f4 * g0);
+}
+
+static void fe_sq(fe *h, const fe *f)
+{
+    uint64_t f0 = f->v[0], f1 = f->v[1], f2 = f->v[2], f3 = f->v[3];
+    uint64_t f4 = f->v[4];
+    uint64_t d0 = 2 * f0, d1 = 2 * f1, d2 = 2 * f2, d3 = 2 * f3;
+    uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+
+    _fe_reduce(h,
+               (u128)f0 * f0 + (u128)d1 * f4_19 + (u128)d2 * f3_19,
+               (u128)d0 * f1 + (u128)d2 * f4_19 + (u128)f3 * f3_19,
+               (u128)d0 * f2 + (u128)f1 * f1 + (u128)d3 * f4_19,
+               (u128)d0 * f3 + (u128)d1 * f2 + (u128)f4 * f4_19,
+               (u128)d0 * f4 + (u128)d1 * f3 + (u128)f2 * f2);
+}
+
+static uint64_t _load64_le(const uint8_t *s)
+{
+    uint64_t r = 0;
+
+    for (unsigned i = 0; i < 8; i++) {
+        r |= (uint64_t)s[i] << (8 * i);
+    }
+    return r;
+}
+
+static void fe_frombytes(fe *h, const uint8_t *s)
+{
+    uint64_t w0 = _load64_le(s), w1 = _load64_le(s + 8);
+    uint64_t w2 = _load64_le(s + 16), w3 = _load64_le(s + 24);
+
+    /* the most significant bit is ignored */
+    h->v[0] = w0 & MASK51;
+    h->v[1] = ((w0 >> 51) | (w1 << 13)) & MASK51;
+    h->v[2] = ((w1 >> 38) | (w2 << 26)) & MASK51;
+    h->v[3] = ((w2 >> 25) | (w3 << 39)) & MASK51;
+    h->v[4] = (w3 >> 12) & MASK51;
+}
+
+static void fe_tobytes(uint8_t *s, const fe *f)
+{
+    uint64_t h[5];
+    uint64_t q;
+
+    memcpy(h, f->v, sizeof(h));
+    _fe_carry(h);
+    _fe_carry(h);
+
+    /* h < 2 * p now, subtract p if h + 19 >= 2^255 */
+    q = (h[0] + 19) >> 51;
+    q = (h[1] + q) >> 51;
+    q = (h[2] + q) >> 51;
+    q = (h[3] + q) >> 51;
+    q = (h[4] + q) >> 51;
+
+    h[0] += 19 * q;
+    h[1] += h[0] >> 51; h[0] &= MASK51;
+    h[2] += h[1] >> 51; h[1] &= MASK51;
+    h[3] += h[2] >> 51; h[2] &= MASK51;
+    h[4] += h[3] >> 51; h[3] &= MASK51;
+    h[4] &= MASK51;
+
+    uint64_t w[4] = {
+        h[0] | (h[1] << 51),
+        (h[1] >> 13) | (h[2] << 38),
+        (h[2] >> 26) | (h[3] << 25),
+        (h[3] >> 39) | (h[4] << 12),
+    };
+
+    for (unsigned i = 0; i < 32; i++) {
+        s[i] = w[i / 8] >> (8 * (i % 8));
+    }
+}
+
+#else /* !__SIZEOF_INT128__ */
+
+/* limb i holds 26 bits if i is even and 25 bits if i is odd */
+#define LIMB_BITS(i)    (26 - ((i) & 1))
+
+static void _fe_carry64(int64_t *t, unsigned passes)
+{
+    while (passes--) {
+        for (unsigned i = 0; i < 10; i++) {
+            int64_t c = t[i] >> LIMB_BITS(i);
+
+            t[i] -= c * ((int64_t)1 << LIMB_BITS(i));
+            if (i < 9) {
+                t[i + 1] += c;
+            }
+            else {
+                t[0] += 19 * c;
+            }
+        }
+    }
+}
+
+static void _fe_carry(fe *h, int64_t *t, unsigned passes)
+{
+    _fe_carry64(t, passes);
+    for (unsigned i = 0; i < 10; i++) {
+        h->v[i] = t[i];
+    }
+}
+
+static void fe_add(fe *h, const fe *f, const fe *g)
+{
+    int64_t t[10];
+
+    for (unsigned i = 0; i < 10; i++) {
+        t[i] = (int64_t)f->v[i] + g->v[i];
+    }
+    _fe_carry(h, t, 1);
+}
+
+static void fe_sub(fe *h, const fe *f, const fe *g)
+{
+    int64_t t[10];
+
+    for (unsigned i = 0; i < 10; i++) {
+        t[i] = (int64_t)f->v[i] - g->v[i];
+    }
+    _fe_carry(h, t, 1);
+}
+
+static void fe_mul(fe *h, const fe *f, const fe *g)
+{
+    int64_t t[10] = { 0 };
+    int32_t g19[10];
+
+    for (unsigned j = 0; j < 10; j++) {
+        g19[j] = 19 * g->v[j];
+    }
+    /* the product of two odd limbs is twice as large as its position */
+    for (unsigned i = 0; i < 10; i++) {
+        int64_t fi = f->v[i];
+        int64_t fi2 = (i & 1) ? 2 * fi : fi;
+
+        for (unsigned j = 0; j < 10 - i; j++) {
+            t[i + j] += ((j & 1) ? fi2 : fi) * g->v[j];
+        }
+        for (unsigned j = 10 - i; j < 10; j++) {
+            t[i + j - 10] += ((j & 1) ? fi2 : fi) * g19[j];
+        }
+    }
+    _fe_carry(h, t, 2);
+}
+
+static void fe_sq(fe *h, const fe *f)
+{
+    fe_mul(h, f, f);
+}
+
+static void fe_frombytes(fe *h, const uint8_t *s)
+{
+    uint64_t acc = 0;
+    unsigned bits = 0;
+
+    /* the most significant bit is ignored */
+    for (unsigned i = 0; i < 10; i++) {
+        while (bits < LIMB_BITS(i)) {
+            acc |= (uint64_t)*s++ << bits;
+            bits += 8;
+        }
+        h->v[i] = acc & ((UINT32_C(1) << LIMB_BITS(i)) - 1);
+        acc >>= LIMB_BITS(i);
+        bits -= LIMB_BITS(i);
+    }
+}
+
+static void fe_tobytes(uint8_t *s, const fe *f)
+{
+    int64_t t[10];
+    int64_t q;
+    uint64_t acc = 0;
+    unsigned bits = 0;
+
+    for (unsigned i = 0; i < 10; i++) {
+        t[i] = f->v[i];
+    }
+    /* 0 <= t < 2 * p afterwards */
+    _fe_carry64(t, 2);
+
+    /* q = 1 if t >= p, see ref10 fe_tobytes() */
+    q = (19 * t[9] + ((int64_t)1 << 24)) >> 25;
+    for (unsigned i = 0; i < 10; i++) {
+        q = (t[i] + q) >> LIMB_BITS(i);
+    }
+    t[0] += 19 * q;
+    for (unsigned i = 0; i < 9; i++) {
+        int64_t c = t[i] >> LIMB_BITS(i);
+
+        t[i] -= c * ((int64_t)1 << LIMB_BITS(i));
+        t[i + 1] += c;
+    }
+    t[9] &= (INT64_C(1) << 25) - 1;
+
+    for (unsigned i = 0; i < 10; i++) {
+        acc |= (uint64_t)t[i] << bits;
+        bits += LIMB_BITS(i);
+        while (bits >= 8) {
+            *s++ = acc;
+            acc >>= 8;
+            bits -= 8;
+        }
+    }
+    *s = acc;
+}
+
+#endif /* __SIZEOF_INT128__ */
+
+#ifdef __SIZEOF_INT128__
+static const fe _d = { { 0x34dca135978a3ULL, 0x1a8283b156ebdULL, 0x5e7a26001c029ULL, 0x739c663a03cbbULL, 0x52036cee2b6ffULL } };
+static const fe _d2 = { { 0x69b9426b2f159ULL, 0x35050762add7aULL, 0x3cf44c0038052ULL, 0x6738cc7407977ULL, 0x2406d9dc56dffULL } };
+static const fe _sqrtm1 = { { 0x61b274a0ea0b0ULL, 0x0d5a5fc8f189dULL, 0x7ef5e9cbd0c60ULL, 0x78595a6804c9eULL, 0x2b8324804fc1dULL } };
+
+/* multiples 1 to 8 of the base point */
+static const ed25519_precomp_t _base_row0[8] = {
+    { { { 0x493c6f58c3b85ULL, 0x0df7181c325f7ULL, 0x0f50b0b3e4cb7ULL, 0x5329385a44c32ULL, 0x07cf9d3a33d4bULL } },
+      { { 0x03905d740913eULL, 0x0ba2817d673a2ULL, 0x23e2827f4e67cULL, 0x133d2e0c21a34ULL, 0x44fd2f9298f81ULL } },
+      { { 0x11205877aaa68ULL, 0x479955893d579ULL, 0x50d66309b67a0ULL, 0x2d42d0dbee5eeULL, 0x6f117b689f0c6ULL } } },
+    { { { 0x4e7fc933c71d7ULL, 0x2cf41feb6b244ULL, 0x7581c0a7d1a76ULL, 0x7172d534d32f0ULL, 0x590c063fa87d2ULL } },
+      { { 0x1a56042b4d5a8ULL, 0x189cc159ed153ULL, 0x5b8deaa3cae04ULL, 0x2aaf04f11b5d8ULL, 0x6bb595a669c92ULL } },
+      { { 0x2a8b3a59b7a5fULL, 0x3abb359ef087fULL, 0x4f5a8c4db05afULL, 0x5b9a807d04205ULL, 0x701af5b13ea50ULL } } },
+    { { { 0x5b0a84cee9730ULL, 0x61d10c97155e4ULL, 0x4059cc8096a10ULL, 0x47a608da8014fULL, 0x7a164e1b9a80fULL } },
+      { { 0x11fe8a4fcd265ULL, 0x7bcb8374faaccULL, 0x52f5af4ef4d4fULL, 0x5314098f98d10ULL, 0x2ab91587555bdULL } },
+      { { 0x6933f0dd0d889ULL, 0x44386bb4c4295ULL, 0x3cb6d3162508cULL, 0x26368b872a2c6ULL, 0x5a2826af12b9bULL } } },
+    { { { 0x351b98efc099fULL, 0x68fbfa4a7050eULL, 0x42a49959d971bULL, 0x393e51a469efdULL, 0x680e910321e58ULL } },
+      { { 0x6050a056818bfULL, 0x62acc1f5532bfULL, 0x28141ccc9fa25ULL, 0x24d61f471e683ULL, 0x27933f4c7445aULL } },
+      { { 0x3fbe9c476ff09ULL, 0x0af6b982e4b42ULL, 0x0ad1251ba78e5ULL, 0x715aeedee7c88ULL, 0x7f9d0cbf63553ULL } } },
+    { { { 0x2bc4408a5bb33ULL, 0x078ebdda05442ULL, 0x2ffb112354123ULL, 0x375ee8df5862dULL, 0x2945ccf146e20ULL } },
+      { { 0x182c3a447d6baULL, 0x22964e536eff2ULL, 0x192821f540053ULL, 0x2f9f19e788e5cULL, 0x154a7e73eb1b5ULL } },
+      { { 0x3dbf1812a8285ULL, 0x0fa17ba3f9797ULL, 0x6f69cb49c3820ULL, 0x34d5a0db3858dULL, 0x43aabe696b3bbULL } } },
+    { { { 0x4eeeb77157131ULL, 0x1201915f10741ULL, 0x1669cda6c9c56ULL, 0x45ec032db346dULL, 0x51e57bb6a2cc3ULL } },
+      { { 0x006b67b7d8ca4ULL, 0x084fa44e72933ULL, 0x1154ee55d6f8aULL, 0x4425d842e7390ULL, 0x38b64c41ae417ULL } },
+      { { 0x4326702ea4b71ULL, 0x06834376030b5ULL, 0x0ef0512f9c380ULL, 0x0f1a9f2512584ULL, 0x10b8e91a9f0d6ULL } } },
+    { { { 0x25cd0944ea3bfULL, 0x75673b81a4d63ULL, 0x150b925d1c0d4ULL, 0x13f38d9294114ULL, 0x461bea69283c9ULL } },
+      { { 0x72c9aaa3221b1ULL, 0x267774474f74dULL, 0x064b0e9b28085ULL, 0x3f04ef53b27c9ULL, 0x1d6edd5d2e531ULL } },
+      { { 0x36dc801b8b3a2ULL, 0x0e0a7d4935e30ULL, 0x1deb7cecc0d7dULL, 0x053a94e20dd2cULL, 0x7a9fbb1c6a0f9ULL } } },
+    { { { 0x7596604dd3e8fULL, 0x6fc510e058b36ULL, 0x3670c8db2cc0dULL, 0x297d899ce332fULL, 0x0915e76061bceULL } },
+      { { 0x75dedf39234d9ULL, 0x01c36ab1f3c54ULL, 0x0f08fee58f5daULL, 0x0e19613a0d637ULL, 0x3a9024a1320e0ULL } },
+      { { 0x1f5d9c9a2911aULL, 0x7117994fafcf8ULL, 0x2d8a8cae28dc5ULL, 0x74ab1b2090c87ULL, 0x26907c5c2ecc4ULL } } },
+};
+
+/* multiples 1 to 8 of 16^(64 / ROWS * row) * B for rows 1 to ROWS - 1 */
+static const ed25519_precomp_t _base_rows[][8] = {
+#if (1 % (16 / ROWS)) == 0
+    {
+        { { { 0x34c597c6691aeULL, 0x7a150b6990fc4ULL, 0x52beb9d922274ULL, 0x70eed7164861aULL, 0x0a871e070c6a9ULL } },
+          { { 0x07d44744346beULL, 0x282b6a564a81dULL, 0x4ed80f875236bULL, 0x6fbbe1d450c50ULL, 0x4eb728c12fcdbULL } },
+          { { 0x1b5994bbc8989ULL, 0x74b7ba84c0660ULL, 0x75678f1cdaeb8ULL, 0x23206b0d6f10cULL, 0x3ee7300f2685dULL } } },
+        { { { 0x27947841e7518ULL, 0x32c7388dae87fULL, 0x414add3971be9ULL, 0x01850832f0ef1ULL, 0x7d47c6a2cfb89ULL } },
+          { { 0x255e49e7dd6b7ULL, 0x38c2163d59ebaULL, 0x3861f2a005845ULL, 0x2e11e4ccbaec9ULL, 0x1381576297912ULL } },
+          { { 0x2d0148ef0d6e0ULL, 0x3522a8de787fbULL, 0x2ee055e74f9d2ULL, 0x64038f6310813ULL, 0x148cf58d34c9eULL } } },
+        { { { 0x72f7d9ae4756dULL, 0x7711e690ffc4aULL, 0x582a2355b0d16ULL, 0x0dccfe885b6b4ULL, 0x278febad4eaeaULL } },
+          { { 0x492f67934f027ULL, 0x7ded0815528d4ULL, 0x58461511a6612ULL, 0x5ea2e50de1544ULL, 0x3ff2fa1ebd5dbULL } },
+          { { 0x2681f8c933966ULL, 0x3840521931635ULL, 0x674f14a308652ULL, 0x3bd9c88a94890ULL, 0x4104dd02fe9c6ULL } } },
+        { { { 0x14e06db096ab8ULL, 0x1219c89e6b024ULL, 0x278abd486a2dbULL, 0x240b292609520ULL, 0x0165b5a48efcaULL } },
+          { { 0x2bf5e1124422aULL, 0x673146756ae56ULL, 0x14ad99a87e830ULL, 0x1eaca65b080fdULL, 0x2c863b00afaf5ULL } },
+          { { 0x0a474a0846a76ULL, 0x099a5ef981e32ULL, 0x2a8ae3c4bbfe6ULL, 0x45c34af14832cULL, 0x591b67d9bffecULL } } },
+        { { { 0x1b3719f18b55dULL, 0x754318c83d337ULL, 0x27c17b7919797ULL, 0x145b084089b61ULL, 0x489b4f8670301ULL } },
+          { { 0x70d1c80b49bfaULL, 0x3d57e7d914625ULL, 0x3c0722165e545ULL, 0x5e5b93819e04fULL, 0x3de02ec7ca8f7ULL } },
+          { { 0x2102d3aeb92efULL, 0x68c22d50c3a46ULL, 0x42ea89385894eULL, 0x75f9ebf55f38cULL, 0x49f5fbba496cbULL } } },
+        { { { 0x5628c1e9c572eULL, 0x598b108e822abULL, 0x55d8fae29361aULL, 0x0adc8d1a97b28ULL, 0x06a1a6c288675ULL } },
+          { { 0x49a108a5bcfd4ULL, 0x6178c8e7d6612ULL, 0x1f03473710375ULL, 0x73a49614a6098ULL, 0x5604a86dcbfa6ULL } },
+          { { 0x0d1d47c1764b6ULL, 0x01c08316a2e51ULL, 0x2b3db45c95045ULL, 0x1634f818d300cULL, 0x20989e89fe274ULL } } },
+        { { { 0x4278b85eaec2eULL, 0x0ef59657be2ceULL, 0x72fd169588770ULL, 0x2e9b205260b30ULL, 0x730b9950f7059ULL } },
+          { { 0x777fd3a2dcc7fULL, 0x594a9fb124932ULL, 0x01f8e80ca15f0ULL, 0x714d13cec3269ULL, 0x0403ed1d0ca67ULL } },
+          { { 0x32d35874ec552ULL, 0x1f3048df1b929ULL, 0x300d73b179b23ULL, 0x6e67be5a37d0bULL, 0x5bd7454308303ULL } } },
+        { { { 0x4932115e7792aULL, 0x457b9bbb930b8ULL, 0x68f5d8b193226ULL, 0x4164e8f1ed456ULL, 0x5bb7db123067fULL } },
+          { { 0x2d19528b24cc2ULL, 0x4ac66b8302ff3ULL, 0x701c8d9fdad51ULL, 0x6c1b35c5b3727ULL, 0x133a78007380aULL } },
+          { { 0x1f467c6ca62beULL, 0x2c4232a5dc12cULL, 0x7551dc013b087ULL, 0x0690c11b03bcdULL, 0x740dca6d58f0eULL } } },
+    },
+#endif
+#if (2 % (16 / ROWS)) == 0
+    {
+        { { { 0x5b69f7b85c5e8ULL, 0x17a2d175650ecULL, 0x4cc3e6dbfc19eULL, 0x73e1d3873be0eULL, 0x3a5f6d51b0af8ULL } },
+          { { 0x68756a60dac5fULL, 0x55d757b8aec26ULL, 0x3383df45f80bdULL, 0x6783f8c9f96a6ULL, 0x20234a7789ecdULL } },
+          { { 0x20db67178b252ULL, 0x73aa3da2c0edaULL, 0x79045c01c70d3ULL, 0x1b37b15251059ULL, 0x7cd682353cffeULL } } },
+        { { { 0x5cd6068acf4f3ULL, 0x3079afc7a74ccULL, 0x58097650b64b4ULL, 0x47fabac9c4e99ULL, 0x3ef0253b2b2cdULL } },
+          { { 0x1a45bd887fab6ULL, 0x65748076dc17cULL, 0x5b98000aa11a8ULL, 0x4a1ecc9080974ULL, 0x2838c8863bdc0ULL } },
+          { { 0x3b0cf4a465030ULL, 0x022b8aef57a2dULL, 0x2ad0677e925adULL, 0x4094167d7457aULL, 0x21dcb8a606a82ULL } } },
+        { { { 0x500fabe7731baULL, 0x7cc53c3113351ULL, 0x7cf65fe080d81ULL, 0x3c5d966011ba1ULL, 0x5d840dbf6c6f6ULL } },
+          { { 0x004468c9d9fc8ULL, 0x5da8554796b8cULL, 0x3b8be70950025ULL, 0x6d5892da6a609ULL, 0x0bc3d08194a31ULL } },
+          { { 0x6380d309fe18bULL, 0x4d73c2cb8ee0dULL, 0x6b882adbac0b6ULL, 0x36eabdddd4cbeULL, 0x3a4276232ac19ULL } } },
+        { { { 0x0c172db447ecbULL, 0x3f8c505b7a77fULL, 0x6a857f97f3f10ULL, 0x4fcc0567fe03aULL, 0x0770c9e824e1aULL } },
+          { { 0x2432c8a7084faULL, 0x47bf73ca8a968ULL, 0x1639176262867ULL, 0x5e8df4f8010ceULL, 0x1ff177cea16deULL } },
+          { { 0x1d99a45b5b5fdULL, 0x523674f2499ecULL, 0x0f8fa26182613ULL, 0x58f7398048c98ULL, 0x39f264fd41500ULL } } },
+        { { { 0x34aabfe097be1ULL, 0x43bfc03253a33ULL, 0x29bc7fe91b7f3ULL, 0x0a761e4844a16ULL, 0x65c621272c35fULL } },
+          { { 0x53417dbe7e29cULL, 0x54573827394f5ULL, 0x565eea6f650ddULL, 0x42050748dc749ULL, 0x1712d73468889ULL } },
+          { { 0x389f8ce3193ddULL, 0x2d424b8177ce5ULL, 0x073fa0d3440cdULL, 0x139020cd49e97ULL, 0x22f9800ab19ceULL } } },
+        { { { 0x29fdd9a6efdacULL, 0x7c694a9282840ULL, 0x6f7cdeee44b3aULL, 0x55a3207b25cc3ULL, 0x4171a4d38598cULL } },
+          { { 0x2368a3e9ef8cbULL, 0x454aa08e2ac0bULL, 0x490923f8fa700ULL, 0x372aa9ea4582fULL, 0x13f416cd64762ULL } },
+          { { 0x758aa99c94c8cULL, 0x5f6001700ff44ULL, 0x7694e488c01bdULL, 0x0d5fde948eed6ULL, 0x508214fa574bdULL } } },
+        { { { 0x215bb53d003d6ULL, 0x1179e792ca8c3ULL, 0x1a0e96ac840a2ULL, 0x22393e2bb3ab6ULL, 0x3a7758a4c86cbULL } },
+          { { 0x269153ed6fe4bULL, 0x72a23aef89840ULL, 0x052be5299699cULL, 0x3a5e5ef132316ULL, 0x22f960ec6fabaULL } },
+          { { 0x111f693ae5076ULL, 0x3e3bfaa94ca90ULL, 0x445799476b887ULL, 0x24a0912464879ULL, 0x5d9fd15f8de7fULL } } },
+        { { { 0x44d2aeed7521eULL, 0x50865d2c2a7e4ULL, 0x2705b5238ea40ULL, 0x46c70b25d3b97ULL, 0x3bc187fa47eb9ULL } },
+          { { 0x408d36d63727fULL, 0x5faf8f6a66062ULL, 0x2bb892da8de6bULL, 0x769d4f0c7e2e6ULL, 0x332f35914f8fbULL } },
+          { { 0x70115ea86c20cULL, 0x16d88da24ada8ULL, 0x1980622662adfULL, 0x501ebbc195a9dULL, 0x450d81ce906fbULL } } },
+    },
+#endif
+#if (3 % (16 / ROWS)) == 0
+    {
+        { { { 0x62b434f460efbULL, 0x294c6c0fad3fcULL, 0x68368937b4c0fULL, 0x5c9f82910875bULL, 0x237e7dbe00545ULL } },
+          { { 0x6f74bc53c1431ULL, 0x1c40e5dbbd9c2ULL, 0x6c8fb9cae5c97ULL, 0x4845c5ce1b7daULL, 0x7e2e0e450b5ccULL } },
+          { { 0x575ed6701b430ULL, 0x4d3e17fa20026ULL, 0x791fc888c4253ULL, 0x2f1ba99078ac1ULL, 0x71afa699b1115ULL } } },
+        { { { 0x23c1c473b50d6ULL, 0x3e7671de21d48ULL, 0x326fa5547a1e8ULL, 0x50e4dc25fafd9ULL, 0x00731fbc78f89ULL } },
+          { { 0x66f9b3953b61dULL, 0x555f4283cccb9ULL, 0x7dd67fb1960e7ULL, 0x14707a1affed4ULL, 0x021142e9c2b1cULL } },
+          { { 0x0c71848f81880ULL, 0x44bd9d8233c86ULL, 0x6e8578efe5830ULL, 0x4045b6d7041b5ULL, 0x4c4d6f3347e15ULL } } },
+        { { { 0x4ddfc988f1970ULL, 0x4f6173ea365e1ULL, 0x645daf9ae4588ULL, 0x7d43763db623bULL, 0x38bf9500a88f9ULL } },
+          { { 0x7eccfc17d1fc9ULL, 0x4ca280782831eULL, 0x7b8337db1d7d6ULL, 0x5116def3895fbULL, 0x193fddaaa7e47ULL } },
+          { { 0x2c93c37e8876fULL, 0x3431a28c583faULL, 0x49049da8bd879ULL, 0x4b4a8407ac11cULL, 0x6a6fb99ebf0d4ULL } } },
+        { { { 0x122b5b6e423c6ULL, 0x21e50dff1ddd6ULL, 0x73d76324e75c0ULL, 0x588485495418eULL, 0x136fda9f42c5eULL } },
+          { { 0x6c1bb560855ebULL, 0x71f127e13ad48ULL, 0x5c6b304905aecULL, 0x3756b8e889bc7ULL, 0x75f76914a3189ULL } },
+          { { 0x4dfb1a305bdd1ULL, 0x3b3ff05811f29ULL, 0x6ed62283cd92eULL, 0x65d1543ec52e1ULL, 0x022183510be8dULL } } },
+        { { { 0x2710143307a7fULL, 0x3d88fb48bf3abULL, 0x249eb4ec18f7aULL, 0x136115dff295fULL, 0x1387c441fd404ULL } },
+          { { 0x766385ead2d14ULL, 0x0194f8b06095eULL, 0x08478f6823b62ULL, 0x6018689d37308ULL, 0x6a071ce17b806ULL } },
+          { { 0x3c3d187978af8ULL, 0x7afe1c88276baULL, 0x51df281c8ad68ULL, 0x64906bda4245dULL, 0x3171b26aaf1edULL } } },
+        { { { 0x5b7d8b28a47d1ULL, 0x2c2ee149e34c1ULL, 0x776f5629afc53ULL, 0x1f4ea50fc49a9ULL, 0x6c514a6334424ULL } },
+          { { 0x7319097564ca8ULL, 0x1844ebc233525ULL, 0x21d4543fdeee1ULL, 0x1ad27aaff1bd2ULL, 0x221fd4873cf08ULL } },
+          { { 0x2204f3a156341ULL, 0x537414065a464ULL, 0x43c0c3bedcf83ULL, 0x5557e706ea620ULL, 0x48daa596fb924ULL } } },
+        { { { 0x61d5dc84c9793ULL, 0x47de83040c29eULL, 0x189deb26507e7ULL, 0x4d4e6fadc479aULL, 0x58c837fa0e8a7ULL } },
+          { { 0x28e665ca59cc7ULL, 0x165c715940dd9ULL, 0x0785f3aa11c95ULL, 0x57b98d7e38469ULL, 0x676dd6fccad84ULL } },
+          { { 0x1688596fc9058ULL, 0x66f6ad403619fULL, 0x4d759a87772efULL, 0x7856e6173bea4ULL, 0x1c4f73f2c6a57ULL } } },
+        { { { 0x6706efc7c3484ULL, 0x6987839ec366dULL, 0x0731f95cf7f26ULL, 0x3ae758ebce4bcULL, 0x70459adb7daf6ULL } },
+          { { 0x24fbd305fa0bbULL, 0x40a98cc75a1cfULL, 0x78ce1220a7533ULL, 0x6217a10e1c197ULL, 0x795ac80d1bf64ULL } },
+          { { 0x1db4991b42bb3ULL, 0x469605b994372ULL, 0x631e3715c9a58ULL, 0x7e9cfefcf728fULL, 0x5fe162848ce21ULL } } },
+    },
+#endif
+#if (4 % (16 / ROWS)) == 0
+    {
+        { { { 0x265e777d1f515ULL, 0x0f1f54c1e39a5ULL, 0x2f01b95522646ULL, 0x4fdd8db9dde6dULL, 0x654878cba97ccULL } },
+          { { 0x38ec78df6b0feULL, 0x13caebea36a22ULL, 0x5ebc6e54e5f6aULL, 0x32804903d0eb8ULL, 0x2102fdba2b20dULL } },
+          { { 0x6e405055ce6a1ULL, 0x5024a35a532d3ULL, 0x1f69054daf29dULL, 0x15d1d0d7a8bd5ULL, 0x0ad725db29ecbULL } } },
+        { { { 0x7bc0c9b056f85ULL, 0x51cfebffaffd8ULL, 0x44abbe94df549ULL, 0x7ecbbd7e33121ULL, 0x4f675f5302399ULL } },
+          { { 0x267b1834e2457ULL, 0x6ae19c378bb88ULL, 0x7457b5ed9d512ULL, 0x3280d783d05fbULL, 0x4aefcffb71a03ULL } },
+          { { 0x536360415171eULL, 0x2313309077865ULL, 0x251444334afbcULL, 0x2b0c3853756e8ULL, 0x0bccbb72a2a86ULL } } },
+        { { { 0x55e4c50fe1296ULL, 0x05fdd13efc30dULL, 0x1c0c6c380e5eeULL, 0x3e11de3fb62a8ULL, 0x6678fd69108f3ULL } },
+          { { 0x6962feab1a9c8ULL, 0x6aca28fb9a30bULL, 0x56db7ca1b9f98ULL, 0x39f58497018ddULL, 0x4024f0ab59d6bULL } },
+          { { 0x6fa31636863c2ULL, 0x10ae5a67e42b0ULL, 0x27abbf01fda31ULL, 0x380a7b9e64fbcULL, 0x2d42e2108ead4ULL } } },
+        { { { 0x17b0d0f537593ULL, 0x16263c0c9842eULL, 0x4ab827e4539a4ULL, 0x6370ddb43d73aULL, 0x420bf3a79b423ULL } },
+          { { 0x5131594dfd29bULL, 0x3a627e98d52feULL, 0x1154041855661ULL, 0x19175d09f8384ULL, 0x676b2608b8d2dULL } },
+          { { 0x0ba651c5b2b47ULL, 0x5862363701027ULL, 0x0c4d6c219c6dbULL, 0x0f03dff8658deULL, 0x745d2ffa9c0cfULL } } },
+        { { { 0x6df5721d34e6aULL, 0x4f32f767a0c06ULL, 0x1d5abeac76e20ULL, 0x41ce9e104e1e4ULL, 0x06e15be54c1dcULL } },
+          { { 0x25a1e2bc9c8bdULL, 0x104c8f3b037eaULL, 0x405576fa96c98ULL, 0x2e86a88e3876fULL, 0x1ae23ceb960cfULL } },
+          { { 0x25d871932994aULL, 0x6b9d63b560b6eULL, 0x2df2814c8d472ULL, 0x0fbbee20aa4edULL, 0x58ded861278ecULL } } },
+        { { { 0x35ba8b6c2c9a8ULL, 0x1dea58b3185bfULL, 0x4b455cd23bbbeULL, 0x5ec19c04883f8ULL, 0x08ba696b531d5ULL } },
+          { { 0x73793f266c55cULL, 0x0b988a9c93b02ULL, 0x09b0ea32325dbULL, 0x37cae71c17c5eULL, 0x2ff39de85485fULL } },
+          { { 0x53eeec3efc57aULL, 0x2fa9fe9022efdULL, 0x699c72c138154ULL, 0x72a751ebd1ff8ULL, 0x120633b4947cfULL } } },
+        { { { 0x531474912100aULL, 0x5afcdf7c0d057ULL, 0x7a9e71b788dedULL, 0x5ef708f3b0c88ULL, 0x07433be3cb393ULL } },
+          { { 0x4987891610042ULL, 0x79d9d7f5d0172ULL, 0x3c293013b9ec4ULL, 0x0c2b85f39cacaULL, 0x35d30a99b4d59ULL } },
+          { { 0x144c05ce997f4ULL, 0x4960b8a347fefULL, 0x1da11f15d74f7ULL, 0x54fac19c0feadULL, 0x2d873ede7af6dULL } } },
+        { { { 0x202e14e5df981ULL, 0x2ea02bc3eb54cULL, 0x38875b2883564ULL, 0x1298c513ae9ddULL, 0x0543618a01600ULL } },
+          { { 0x2316443373409ULL, 0x5de95503b22afULL, 0x699201beae2dfULL, 0x3db5849ff737aULL, 0x2e773654707faULL } },
+          { { 0x2bdf4974c23c1ULL, 0x4b3b9c8d261bdULL, 0x26ae8b2a9bc28ULL, 0x3068210165c51ULL, 0x4b1443362d079ULL } } },
+    },
+#endif
+#if (5 % (16 / ROWS)) == 0
+    {
+        { { { 0x0aaf9b4b75601ULL, 0x26b91b5ae44f3ULL, 0x6de808d7ab1c8ULL, 0x6a769675530b0ULL, 0x1bbfb284e98f7ULL } },
+          { { 0x5058a382b33f3ULL, 0x175a91816913eULL, 0x4f6cdb96b8ae8ULL, 0x17347c9da81d2ULL, 0x5aa3ed9d95a23ULL } },
+          { { 0x777e9c7d96561ULL, 0x28e58f006ccacULL, 0x541bbbb2cac49ULL, 0x3e63282994cecULL, 0x4a07e14e5e895ULL } } },
+        { { { 0x358cdc477a49bULL, 0x3cc88fe02e481ULL, 0x721aab7f4e36bULL, 0x0408cc9469953ULL, 0x50af7aed84afaULL } },
+          { { 0x412cb980df999ULL, 0x5e78dd8ee29dcULL, 0x171dff68c575dULL, 0x2015dd2f6ef49ULL, 0x3f0bac391d313ULL } },
+          { { 0x7de0115f65be5ULL, 0x4242c21364dc9ULL, 0x6b75b64a66098ULL, 0x0033c0102c085ULL, 0x1921a316baebdULL } } },
+        { { { 0x2ad9ad9f3c18bULL, 0x5ec1638339aebULL, 0x5703b6559a83bULL, 0x3fa9f4d05d612ULL, 0x7b049deca062cULL } },
+          { { 0x22f7edfb870fcULL, 0x569eed677b128ULL, 0x30937dcb0a5afULL, 0x758039c78ea1bULL, 0x6458df41e273aULL } },
+          { { 0x3e37a35444483ULL, 0x661fdb7d27b99ULL, 0x317761dd621e4ULL, 0x7323c30026189ULL, 0x6093dccbc2950ULL } } },
+        { { { 0x6eebe6084034bULL, 0x6cf01f70a8d7bULL, 0x0b41a54c6670aULL, 0x6c84b99bb55dbULL, 0x6e3180c98b647ULL } },
+          { { 0x39a8585e0706dULL, 0x3167ce72663feULL, 0x63d14ecdb4297ULL, 0x4be21dcf970b8ULL, 0x57d1ea084827aULL } },
+          { { 0x2b6e7a128b071ULL, 0x5b27511755dcfULL, 0x08584c2930565ULL, 0x68c7bda6f4159ULL, 0x363e999ddd97bULL } } },
+        { { { 0x048dce24baec6ULL, 0x2b75795ec05e3ULL, 0x3bfa4c5da6dc9ULL, 0x1aac8659e371eULL, 0x231f979bc6f9bULL } },
+          { { 0x043c135ee1fc4ULL, 0x2a11c9919f2d5ULL, 0x6334cc25dbacdULL, 0x295da17b400daULL, 0x48ee9b78693a0ULL } },
+          { { 0x1de4bcc2af3c6ULL, 0x61fc411a3eb86ULL, 0x53ed19ac12ec0ULL, 0x209dbc6b804e0ULL, 0x079bfa9b08792ULL } } },
+        { { { 0x1ed80a2d54245ULL, 0x70efec72a5e79ULL, 0x42151d42a822dULL, 0x1b5ebb6d631e8ULL, 0x1ef4fb1594706ULL } },
+          { { 0x03a51da300df4ULL, 0x467b52b561c72ULL, 0x4d5920210e590ULL, 0x0ca769e789685ULL, 0x038c77f684817ULL } },
+          { { 0x65ee65b167becULL, 0x052da19b850a9ULL, 0x0408665656429ULL, 0x7ab39596f9a4cULL, 0x575ee92a4a0bfULL } } },
+        { { { 0x6bc450aa4d801ULL, 0x4f4a6773b0ba8ULL, 0x6241b0b0ebc48ULL, 0x40d9c4f1d9315ULL, 0x200a1e7e382f5ULL } },
+          { { 0x080908a182fcfULL, 0x0532913b7ba98ULL, 0x3dccf78c385c3ULL, 0x68002dd5eaba9ULL, 0x43d4e7112cd3fULL } },
+          { { 0x5b967eaf93ac5ULL, 0x360acca580a31ULL, 0x1c65fd5c6f262ULL, 0x71c7f15c2ecabULL, 0x050eca52651e4ULL } } },
+        { { { 0x4397660e668eaULL, 0x7c2a75692f2f5ULL, 0x3b29e7e6c66efULL, 0x72ba658bcda9aULL, 0x6151c09fa131aULL } },
+          { { 0x31ade453f0c9cULL, 0x3dfee07737868ULL, 0x611ecf7a7d411ULL, 0x2637e6cbd64f6ULL, 0x4b0ee6c21c58fULL } },
+          { { 0x55c0dfdf05d96ULL, 0x405569dcf475eULL, 0x05c5c277498bbULL, 0x18588d95dc389ULL, 0x1fef24fa800f0ULL } } },
+    },
+#endif
+#if (6 % (16 / ROWS)) == 0
+    {
+        { { { 0x0639c12ddb0a4ULL, 0x6180490cd7ab3ULL, 0x3f3918297467cULL, 0x74568be1781acULL, 0x07a195152e095ULL } },
+          { { 0x7a9c59c2ec4deULL, 0x7e9f09e79652dULL, 0x6a3e422f22d86ULL, 0x2ae8e3b836c8bULL, 0x63b795fc7ad32ULL } },
+          { { 0x68f02389e5fc8ULL, 0x059f1bc877506ULL, 0x504990e410cecULL, 0x09bd7d0feaee2ULL, 0x3e8fe83d032f0ULL } } },
+        { { { 0x04c8de8efd13cULL, 0x1c67c06e6210eULL, 0x183378f7f146aULL, 0x64352ceaed289ULL, 0x22d60899a6258ULL } },
+          { { 0x315b90570a294ULL, 0x60ce108a925f1ULL, 0x6eff61253c909ULL, 0x003ef0e2d70b0ULL, 0x75ba3b797fac4ULL } },
+          { { 0x1dbc070cdd196ULL, 0x16d8fb1534c47ULL, 0x500498183fa2aULL, 0x72f59c423de75ULL, 0x0904d07b87779ULL } } },
+        { { { 0x22d6648f940b9ULL, 0x197a5a1873e86ULL, 0x207e4c41a54bcULL, 0x5360b3b4bd6d0ULL, 0x6240aacebaf72ULL } },
+          { { 0x61fd4ddba919cULL, 0x7d8e991b55699ULL, 0x61b31473cc76cULL, 0x7039631e631d6ULL, 0x43e2143fbc1ddULL } },
+          { { 0x4749c5ba295a0ULL, 0x37946fa4b5f06ULL, 0x724c5ab5a51f1ULL, 0x65633789dd3f3ULL, 0x56bdaf238db40ULL } } },
+        { { { 0x0d36cc19d3bb2ULL, 0x6ec4470d72262ULL, 0x6853d7018a9aeULL, 0x3aa3e4dc2c8ebULL, 0x03aa31507e1e5ULL } },
+          { { 0x2b9e3f53533ebULL, 0x2add727a806c5ULL, 0x56955c8ce15a3ULL, 0x18c4f070a290eULL, 0x1d24a86d83741ULL } },
+          { { 0x47648ffd4ce1fULL, 0x60a9591839e9dULL, 0x424d5f38117abULL, 0x42cc46912c10eULL, 0x43b261dc9aeb4ULL } } },
+        { { { 0x13d8b6c951364ULL, 0x4c0017e8f632aULL, 0x53e559e53f9c4ULL, 0x4b20146886eeaULL, 0x02b4d5e242940ULL } },
+          { { 0x31e1988bb79bbULL, 0x7b82f46b3bcabULL, 0x0f7a8ce827b41ULL, 0x5e15816177130ULL, 0x326055cf5b276ULL } },
+          { { 0x155cb28d18df2ULL, 0x0c30d9ca11694ULL, 0x2090e27ab3119ULL, 0x208624e7a49b6ULL, 0x27a6c809ae5d3ULL } } },
+        { { { 0x4270ac43d6954ULL, 0x2ed4cd95659a5ULL, 0x75c0db37528f9ULL, 0x2ccbcfd2c9234ULL, 0x221503603d8c2ULL } },
+          { { 0x6ebcd1f0db188ULL, 0x74ceb4b7d1174ULL, 0x7d56168df4f5cULL, 0x0bf79176fd18aULL, 0x2cb67174ff60aULL } },
+          { { 0x6cdf9390be1d0ULL, 0x08e519c7e2b3dULL, 0x253c3d2a50881ULL, 0x21b41448e333dULL, 0x7b1df4b73890fULL } } },
+        { { { 0x6221807f8f58cULL, 0x3fa92813a8be5ULL, 0x6da98c38d5572ULL, 0x01ed95554468fULL, 0x68698245d352eULL } },
+          { { 0x2f2e0b3b2a224ULL, 0x0c56aa22c1c92ULL, 0x5fdec39f1b278ULL, 0x4c90af5c7f106ULL, 0x61fcef2658fc5ULL } },
+          { { 0x15d852a18187aULL, 0x270dbb59afb76ULL, 0x7db120bcf92abULL, 0x0e7a25d714087ULL, 0x46cf4c473daf0ULL } } },
+        { { { 0x46ea7f1498140ULL, 0x70725690a8427ULL, 0x0a73ae9f079fbULL, 0x2dd924461c62bULL, 0x1065aae50d8ccULL } },
+          { { 0x525ed9ec4e5f9ULL, 0x022d20660684cULL, 0x7972b70397b68ULL, 0x7a03958d3f965ULL, 0x29387bcd14eb5ULL } },
+          { { 0x44525df200d57ULL, 0x2d7f94ce94385ULL, 0x60d00c170ecb7ULL, 0x38b0503f3d8f0ULL, 0x69a198e64f1ceULL } } },
+    },
+#endif
+#if (7 % (16 / ROWS)) == 0
+    {
+        { { { 0x7d1ef5fddc09cULL, 0x7beeaebb9dad9ULL, 0x058d30ba0acfbULL, 0x5cd92eab5ae90ULL, 0x3041c6bb04ed2ULL } },
+          { { 0x42b256768d593ULL, 0x2e88459427b4fULL, 0x02b3876630701ULL, 0x34878d405eae5ULL, 0x29cdd1adc088aULL } },
+          { { 0x2f2f9d956e148ULL, 0x6b3e6ad65c1feULL, 0x5b00972b79e5dULL, 0x53d8d234c5dafULL, 0x104bbd6814049ULL } } },
+        { { { 0x59a5fd67ff163ULL, 0x3a998ead0352bULL, 0x083c95fa4af9aULL, 0x6fadbfc01266fULL, 0x204f2a20fb072ULL } },
+          { { 0x0fd3168f1ed67ULL, 0x1bb0de7784a3eULL, 0x34bcb78b20477ULL, 0x0a4a26e2e2182ULL, 0x5be8cc57092a7ULL } },
+          { { 0x43b3d30ebb079ULL, 0x357aca5c61902ULL, 0x5b570c5d62455ULL, 0x30fb29e1e18c7ULL, 0x2570fb17c2791ULL } } },
+        { { { 0x6a9550bb8245aULL, 0x511f20a1a2325ULL, 0x29324d7239beeULL, 0x3343cc37516c4ULL, 0x241c5f91de018ULL } },
+          { { 0x2367f2cb61575ULL, 0x6c39ac04d87dfULL, 0x6d4958bd7e5bdULL, 0x566f4638a1532ULL, 0x3dcb65ea53030ULL } },
+          { { 0x0172940de6caaULL, 0x6045b2e67451bULL, 0x56c07463efcb3ULL, 0x0728b6bfe6e91ULL, 0x08420edd5fcdfULL } } },
+        { { { 0x0c34e04f410ceULL, 0x344edc0d0a06bULL, 0x6e45486d84d6dULL, 0x44e2ecb3863f5ULL, 0x04d654f321db8ULL } },
+          { { 0x720ab8362fa4aULL, 0x29c4347cdd9bfULL, 0x0e798ad5f8463ULL, 0x4fef18bcb0bfeULL, 0x0d9a53efbc176ULL } },
+          { { 0x5c116ddbdb5d5ULL, 0x6d1b4bba5abcfULL, 0x4d28a48a5537aULL, 0x56b8e5b040b99ULL, 0x4a7a4f2618991ULL } } },
+        { { { 0x3b291af372a4bULL, 0x60e3028fe4498ULL, 0x2267bca4f6a09ULL, 0x719eec242b243ULL, 0x4a96314223e0eULL } },
+          { { 0x718025fb15f95ULL, 0x68d6b8371fe94ULL, 0x3804448f7d97cULL, 0x42466fe784280ULL, 0x11b50c4cddd31ULL } },
+          { { 0x0274408a4ffd6ULL, 0x7d382aedb34ddULL, 0x40acfc9ce385dULL, 0x628bb99a45b1eULL, 0x4f4bce4dce6bcULL } } },
+        { { { 0x2616ec49d0b6fULL, 0x1f95d8462e61cULL, 0x1ad3e9b9159c6ULL, 0x79ba475a04df9ULL, 0x3042cee561595ULL } },
+          { { 0x7ce5ae2242584ULL, 0x2d25eb153d4e3ULL, 0x3a8f3d09ba9c9ULL, 0x0f3690d04eb8eULL, 0x73fcdd14b71c0ULL } },
+          { { 0x67079449bac41ULL, 0x5b79c4621484fULL, 0x61069f2156b8dULL, 0x0eb26573b10afULL, 0x389e740c9a9ceULL } } },
+        { { { 0x578f6570eac28ULL, 0x644f2339c3937ULL, 0x66e47b7956c2cULL, 0x34832fe1f55d0ULL, 0x25c425e5d6263ULL } },
+          { { 0x4b3ae34dcb9ceULL, 0x47c691a15ac9fULL, 0x318e06e5d400cULL, 0x3c422d9f83eb1ULL, 0x61545379465a6ULL } },
+          { { 0x606a6f1d7de6eULL, 0x4f1c0c46107e7ULL, 0x229b1dcfbe5d8ULL, 0x3acc60a7b1327ULL, 0x6539a08915484ULL } } },
+        { { { 0x4dbd414bb4a19ULL, 0x7930849f1dbb8ULL, 0x329c5a466caf0ULL, 0x6c824544feb9bULL, 0x0f65320ef019bULL } },
+          { { 0x21f74c3d2f773ULL, 0x024b88d08bd3aULL, 0x6e678cf054151ULL, 0x43631272e747cULL, 0x11c5e4aac5cd1ULL } },
+          { { 0x6d1b1cafde0c6ULL, 0x462c76a303a90ULL, 0x3ca4e693cff9bULL, 0x3952cd45786fdULL, 0x4cabc7bdec330ULL } } },
+    },
+#endif
+#if (8 % (16 / ROWS)) == 0
+    {
+        { { { 0x304bfacad8ea2ULL, 0x502917d108b07ULL, 0x043176ca6dd0fULL, 0x5d5158f2c1d84ULL, 0x2b5449e58eb3bULL } },
+          { { 0x27562eb3dbe47ULL, 0x291d7b4170be7ULL, 0x5d1ca67dfa8e1ULL, 0x2a88061f298a2ULL, 0x1304e9e71627dULL } },
+          { { 0x014d26adc9cfeULL, 0x7f1691ba16f13ULL, 0x5e71828f06eacULL, 0x349ed07f0fffcULL, 0x4468de2d7c2ddULL } } },
+        { { { 0x2d8c6f86307ceULL, 0x6286ba1850973ULL, 0x5e9dcb08444d4ULL, 0x1a96a543362b2ULL, 0x5da6427e63247ULL } },
+          { { 0x3355e9419469eULL, 0x1847bb8ea8a37ULL, 0x1fe6588cf9b71ULL, 0x6b1c9d2db6b22ULL, 0x6cce7c6ffb44bULL } },
+          { { 0x4c688deac22caULL, 0x6f775c3ff0352ULL, 0x565603ee419bbULL, 0x6544456c61c46ULL, 0x58f29abfe79f2ULL } } },
+        { { { 0x264bf710ecdf6ULL, 0x708c58527896bULL, 0x42ceae6c53394ULL, 0x4381b21e82b6aULL, 0x6af93724185b4ULL } },
+          { { 0x6cfab8de73e68ULL, 0x3e6efced4bd21ULL, 0x0056609500dbeULL, 0x71b7824ad85dfULL, 0x577629c4a7f41ULL } },
+          { { 0x0024509c6a888ULL, 0x2696ab12e6644ULL, 0x0cca27f4b80d8ULL, 0x0c7c1f11b119eULL, 0x701f25bb0caecULL } } },
+        { { { 0x0f6d97cbec113ULL, 0x4ce97fb7c93a3ULL, 0x139835a11281bULL, 0x728907ada9156ULL, 0x720a5bc050955ULL } },
+          { { 0x0b0f8e4616cedULL, 0x1d3c4b50fb875ULL, 0x2f29673dc0198ULL, 0x5f4b0f1830ffaULL, 0x2e0c92bfbdc40ULL } },
+          { { 0x709439b805a35ULL, 0x6ec48557f8187ULL, 0x08a4d1ba13a2cULL, 0x076348a0bf9aeULL, 0x0e9b9cbb144efULL } } },
+        { { { 0x69bd55db1beeeULL, 0x6e14e47f731bdULL, 0x1a35e47270eacULL, 0x66f225478df8eULL, 0x366d44191cfd3ULL } },
+          { { 0x2d48ffb5720adULL, 0x57b7f21a1df77ULL, 0x5550effba0645ULL, 0x5ec6a4098a931ULL, 0x221104eb3f337ULL } },
+          { { 0x41743f2bc8c14ULL, 0x796b0ad8773c7ULL, 0x29fee5cbb689bULL, 0x122665c178734ULL, 0x4167a4e6bc593ULL } } },
+        { { { 0x62665f8ce8feeULL, 0x29d101ac59857ULL, 0x4d93bbba59ffcULL, 0x17b7897373f17ULL, 0x34b33370cb7edULL } },
+          { { 0x39d2876f62700ULL, 0x001cecd1d6c87ULL, 0x7f01a11747675ULL, 0x2350da5a18190ULL, 0x7938bb7e22552ULL } },
+          { { 0x591ee8681d6ccULL, 0x39db0b4ea79b8ULL, 0x202220f380842ULL, 0x2f276ba42e0acULL, 0x1176fc6e2dfe6ULL } } },
+        { { { 0x0e28949770eb8ULL, 0x5559e88147b72ULL, 0x35e1e6e63ef30ULL, 0x35b109aa7ff6fULL, 0x1f6a3e54f2690ULL } },
+          { { 0x76cd05b9c619bULL, 0x69654b0901695ULL, 0x7a53710b77f27ULL, 0x79a1ea7d28175ULL, 0x08fc3a4c677d5ULL } },
+          { { 0x4c199d30734eaULL, 0x6c622cb9acc14ULL, 0x5660a55030216ULL, 0x068f1199f11fbULL, 0x4f2fad0116b90ULL } } },
+        { { { 0x4d91db73bb638ULL, 0x55f82538112c5ULL, 0x6d85a279815deULL, 0x740b7b0cd9cf9ULL, 0x3451995f2944eULL } },
+          { { 0x6b24194ae4e54ULL, 0x2230afded8897ULL, 0x23412617d5071ULL, 0x3d5d30f35969bULL, 0x445484a4972efULL } },
+          { { 0x2fcd09fea7d7cULL, 0x296126b9ed22aULL, 0x4a171012a05b2ULL, 0x1db92c74d5523ULL, 0x10b89ca604289ULL } } },
+    },
+#endif
+#if (9 % (16 / ROWS)) == 0
+    {
+        { { { 0x0fcfa36048d13ULL, 0x66e7133bbb383ULL, 0x64b42a8a45676ULL, 0x4ea6e4f9a85cfULL, 0x26f57eee878a1ULL } },
+          { { 0x20cc9782a0ddeULL, 0x65d4e3070aab3ULL, 0x7bc8e31547736ULL, 0x09ebfb1432d98ULL, 0x504aa77679736ULL } },
+          { { 0x32cd55687efb1ULL, 0x4448f5e2f6195ULL, 0x568919d460345ULL, 0x034c2e0ad1a27ULL, 0x4041943d9dba3ULL } } },
+        { { { 0x17743a26caaddULL, 0x48c9156f9c964ULL, 0x7ef278d1e9ad0ULL, 0x00ce58ea7bd01ULL, 0x12d931429800dULL } },
+          { { 0x0eeba43ebcc96ULL, 0x384dd5395f878ULL, 0x1df331a35d272ULL, 0x207ecfd4af70eULL, 0x1420a1d976843ULL } },
+          { { 0x67799d337594fULL, 0x01647548f6018ULL, 0x57fce5578f145ULL, 0x009220c142a71ULL, 0x1b4f92314359aULL } } },
+        { { { 0x73030a49866b1ULL, 0x2442be90b2679ULL, 0x77bd3d8947dcfULL, 0x1fb55c1552028ULL, 0x5ff191d56f9a2ULL } },
+          { { 0x4109d89150951ULL, 0x225bd2d2d47cbULL, 0x57cc080e73beaULL, 0x6d71075721fcbULL, 0x239b572a7f132ULL } },
+          { { 0x6d433ac2d9068ULL, 0x72bf930a47033ULL, 0x64facf4a20eadULL, 0x365f7a2b9402aULL, 0x020c526a758f3ULL } } },
+        { { { 0x1ef59f042cc89ULL, 0x3b1c24976dd26ULL, 0x31d665cb16272ULL, 0x28656e470c557ULL, 0x452cfe0a5602cULL } },
+          { { 0x034f89ed8dbbcULL, 0x73b8f948d8ef3ULL, 0x786c1d323caabULL, 0x43bd4a9266e51ULL, 0x02aacc4615313ULL } },
+          { { 0x0f7a0647877dfULL, 0x4e1cc0f93f0d4ULL, 0x7ec4726ef1190ULL, 0x3bdd58bf512f8ULL, 0x4cfb7d7b304b8ULL } } },
+        { { { 0x699c29789ef12ULL, 0x63beae321bc50ULL, 0x325c340adbb35ULL, 0x562e1a1e42bf6ULL, 0x5b1d4cbc434d3ULL } },
+          { { 0x43d6cb89b75feULL, 0x3338d5b900e56ULL, 0x38d327d531a53ULL, 0x1b25c61d51b9fULL, 0x14b4622b39075ULL } },
+          { { 0x32615cc0a9f26ULL, 0x57711b99cb6dfULL, 0x5a69c14e93c38ULL, 0x6e88980a4c599ULL, 0x2f98f71258592ULL } } },
+        { { { 0x2ae444f54a701ULL, 0x615397afbc5c2ULL, 0x60d7783f3f8fbULL, 0x2aa675fc486baULL, 0x1d8062e9e7614ULL } },
+          { { 0x4a74cb50f9e56ULL, 0x531d1c2640192ULL, 0x0c03d9d6c7fd2ULL, 0x57ccd156610c1ULL, 0x3a6ae249d806aULL } },
+          { { 0x2da85a9907c5aULL, 0x6b23721ec4cafULL, 0x4d2d3a4683aa2ULL, 0x7f9c6870efdefULL, 0x298b8ce8aef25ULL } } },
+        { { { 0x272ea0a2165deULL, 0x68179ef3ed06fULL, 0x4e2b9c0feac1eULL, 0x3ee290b1b63bbULL, 0x6ba6271803a7dULL } },
+          { { 0x27953eff70cb2ULL, 0x54f22ae0ec552ULL, 0x29f3da92e2724ULL, 0x242ca0c22bd18ULL, 0x34b8a8404d5ceULL } },
+          { { 0x6ecb583693335ULL, 0x3ec76bfdfb84dULL, 0x2c895cf56a04fULL, 0x6355149d54d52ULL, 0x71d62bdd465e1ULL } } },
+        { { { 0x5b5dab1f75ef5ULL, 0x1e2d60cbeb9a5ULL, 0x527c2175dfe57ULL, 0x59e8a2b8ff51fULL, 0x1c333621262b2ULL } },
+          { { 0x3cc28d378df80ULL, 0x72141f4968ca6ULL, 0x407696bdb6d0dULL, 0x5d271b22ffcfbULL, 0x74d5f317f3172ULL } },
+          { { 0x7e55467d9ca81ULL, 0x6a5653186f50dULL, 0x6b188ece62df1ULL, 0x4c66d36844971ULL, 0x4aebcc4547e9dULL } } },
+    },
+#endif
+#if (10 % (16 / ROWS)) == 0
+    {
+        { { { 0x6bffb305b2f51ULL, 0x5b112b2d712ddULL, 0x35774974fe4e2ULL, 0x04af87a96e3a3ULL, 0x57968290bb3a0ULL } },
+          { { 0x7974e8c58aedcULL, 0x7757e083488c6ULL, 0x601c62ae7bc8bULL, 0x45370c2ecab74ULL, 0x2f1b78fab143aULL } },
+          { { 0x2b8430a20e101ULL, 0x1a49e1d88fee3ULL, 0x38bbb47ce4d96ULL, 0x1f0e7ba84d437ULL, 0x7dc43e35dc2aaULL } } },
+        { { { 0x02a5c273e9718ULL, 0x32bc9dfb28b4fULL, 0x48df4f8d5db1aULL, 0x54c87976c028fULL, 0x044fb81d82d50ULL } },
+          { { 0x66665887dd9c3ULL, 0x629760a6ab0b2ULL, 0x481e6c7243e6cULL, 0x097e37046fc77ULL, 0x7ef72016758ccULL } },
+          { { 0x718c5a907e3d9ULL, 0x3b9c98c6b383bULL, 0x006ed255eccdcULL, 0x6976538229a59ULL, 0x7f79823f9c30dULL } } },
+        { { { 0x41ff068f587baULL, 0x1c00a191bcd53ULL, 0x7b56f9c209e25ULL, 0x3781e5fccaabeULL, 0x64a9b0431c06dULL } },
+          { { 0x4d239a3b513e8ULL, 0x29723f51b1066ULL, 0x642f4cf04d9c3ULL, 0x4da095aa09b7aULL, 0x0a4e0373d784dULL } },
+          { { 0x3d6a15b7d2919ULL, 0x41aa75046a5d6ULL, 0x691751ec2d3daULL, 0x23638ab6721c4ULL, 0x071a7d0ace183ULL } } },
+        { { { 0x4355220e14431ULL, 0x0e1362a283981ULL, 0x2757cd8359654ULL, 0x2e9cd7ab10d90ULL, 0x7c69bcf761775ULL } },
+          { { 0x72daac887ba0bULL, 0x0b7f4ac5dda60ULL, 0x3bdda2c0498a4ULL, 0x74e67aa180160ULL, 0x2c3bcc7146ea7ULL } },
+          { { 0x0d7eb04e8295fULL, 0x4a5ea1e6fa0feULL, 0x45e635c436c60ULL, 0x28ef4a8d4d18bULL, 0x6f5a9a7322acaULL } } },
+        { { { 0x1d4eba3d944beULL, 0x0100f15f3dce5ULL, 0x61a700e367825ULL, 0x5922292ab3d23ULL, 0x02ab9680ee8d3ULL } },
+          { { 0x1000c2f41c6c5ULL, 0x0219fdf737174ULL, 0x314727f127de7ULL, 0x7e5277d23b81eULL, 0x494e21a2e147aULL } },
+          { { 0x48a85dde50d9aULL, 0x1c1f734493df4ULL, 0x47bdb64866889ULL, 0x59a7d048f8eecULL, 0x6b5d76cbea46bULL } } },
+        { { { 0x141171e782522ULL, 0x6806d26da7c1fULL, 0x3f31d1bc79ab9ULL, 0x09f20459f5168ULL, 0x16fb869c03dd3ULL } },
+          { { 0x7556cec0cd994ULL, 0x5eb9a03b7510aULL, 0x50ad1dd91cb71ULL, 0x1aa5780b48a47ULL, 0x0ae333f685277ULL } },
+          { { 0x6199733b60962ULL, 0x69b157c266511ULL, 0x64740f893f1caULL, 0x03aa408fbf684ULL, 0x3f81e38b8f70dULL } } },
+        { { { 0x37f355f17c824ULL, 0x07ae85334815bULL, 0x7e3abddd2e48fULL, 0x61eeabe1f45e5ULL, 0x0ad3e2d34cdedULL } },
+          { { 0x10fcc7ed9affeULL, 0x4248cb0e96ff2ULL, 0x4311c115172e2ULL, 0x4c9d41cbf6925ULL, 0x50510fc104f50ULL } },
+          { { 0x40fc5336e249dULL, 0x3386639fb2de1ULL, 0x7bbf871d17b78ULL, 0x75f796b7e8004ULL, 0x127c158bf0fa1ULL } } },
+        { { { 0x28fc4ae51b974ULL, 0x26e89bfd2dbd4ULL, 0x4e122a07665cfULL, 0x7cab1203405c3ULL, 0x4ed82479d167dULL } },
+          { { 0x17c422e9879a2ULL, 0x28a5946c8fec3ULL, 0x53ab32e912b77ULL, 0x7b44da09fe0a5ULL, 0x354ef87d07ef4ULL } },
+          { { 0x3b52260c5d975ULL, 0x79d6836171fdcULL, 0x7d994f140d4bbULL, 0x1b6c404561854ULL, 0x302d92d205392ULL } } },
+    },
+#endif
+#if (11 % (16 / ROWS)) == 0
+    {
+        { { { 0x4dae0b5511c9aULL, 0x5257fffe0d456ULL, 0x54108d1eb2180ULL, 0x096cc0f9baefaULL, 0x3f6bd725da4eaULL } },
+          { { 0x0b9ab7f5745c6ULL, 0x5caf0f8d21d63ULL, 0x7debea408ea2bULL, 0x09edb93896d16ULL, 0x36597d25ea5c0ULL } },
+          { { 0x58d7b106058acULL, 0x3cdf8d20bee69ULL, 0x00a4cb765015eULL, 0x36832337c7cc9ULL, 0x7b7ecc19da60dULL } } },
+        { { { 0x64a51a77cfa9bULL, 0x29cf470ca0db5ULL, 0x4b60b6e0898d9ULL, 0x55d04ddffe6c7ULL, 0x03bedc661bf5cULL } },
+          { { 0x2373c695c690dULL, 0x4c0c8520dcf18ULL, 0x384af4b7494b9ULL, 0x4ab4a8ea22225ULL, 0x4235ad7601743ULL } },
+          { { 0x0cb0d078975f5ULL, 0x292313e530c4bULL, 0x38dbb9124a509ULL, 0x350d0655a11f1ULL, 0x0e7ce2b0cdf06ULL } } },
+        { { { 0x6fedfd94b70f9ULL, 0x2383f9745bfd4ULL, 0x4beae27c4c301ULL, 0x75aa4416a3f3fULL, 0x615256138aeceULL } },
+          { { 0x4643ac48c85a3ULL, 0x6878c2735b892ULL, 0x3a53523f4d877ULL, 0x3a504ed8bee9dULL, 0x666e0a5d8fb46ULL } },
+          { { 0x3f64e4870cb0dULL, 0x61548b16d6557ULL, 0x7a261773596f3ULL, 0x7724d5f275d3aULL, 0x7f0bc810d514dULL } } },
+        { { { 0x49dad737213a0ULL, 0x745dee5d31075ULL, 0x7b1a55e7fdbe2ULL, 0x5ba988f176ea1ULL, 0x1d3a907ddec5aULL } },
+          { { 0x06ba426f4136fULL, 0x3cafc0606b720ULL, 0x518f0a2359cdaULL, 0x5fae5e46feca7ULL, 0x0d1f8dbcf8eedULL } },
+          { { 0x693313ed081dcULL, 0x5b0a366901742ULL, 0x40c872ca4ca7eULL, 0x6f18094009e01ULL, 0x00011b44a31bfULL } } },
+        { { { 0x61f696a0aa75cULL, 0x38b0a57ad42caULL, 0x1e59ab706fdc9ULL, 0x01308d46ebfcdULL, 0x63d988a2d2851ULL } },
+          { { 0x7a06c3fc66c0cULL, 0x1c9bac1ba47fbULL, 0x23935c575038eULL, 0x3f0bd71c59c13ULL, 0x3ac48d916e835ULL } },
+          { { 0x20753afbd232eULL, 0x71fbb1ed06002ULL, 0x39cae47a4af3aULL, 0x0337c0b34d9c2ULL, 0x33fad52b2368aULL } } },
+        { { { 0x4c8d0c422cfe8ULL, 0x760b4275971a5ULL, 0x3da95bc1cad3dULL, 0x0f151ff5b7376ULL, 0x3cc355ccb90a7ULL } },
+          { { 0x649c6c5e41e16ULL, 0x60667eee6aa80ULL, 0x4179d182be190ULL, 0x653d9567e6979ULL, 0x16c0f429a256dULL } },
+          { { 0x69443903e9131ULL, 0x16f4ac6f9dd36ULL, 0x2ea4912e29253ULL, 0x2b4643e68d25dULL, 0x631eaf426bae7ULL } } },
+        { { { 0x175b9a3700de8ULL, 0x77c5f00aa48fbULL, 0x3917785ca0317ULL, 0x05aa9b2c79399ULL, 0x431f2c7f665f8ULL } },
+          { { 0x10410da66fe9fULL, 0x24d82dcb4d67dULL, 0x3e6fe0e17752dULL, 0x4dade1ecbb08fULL, 0x5599648b1ea91ULL } },
+          { { 0x26344858f7b19ULL, 0x5f43d4a295ac0ULL, 0x242a75c52acd4ULL, 0x5934480220d10ULL, 0x7b04715f91253ULL } } },
+        { { { 0x6c280c4e6bac6ULL, 0x3ada3b361766eULL, 0x42fe5125c3b4fULL, 0x111d84d4aac22ULL, 0x48d0acfa57cdeULL } },
+          { { 0x5bd28acf6ae43ULL, 0x16fab8f56907dULL, 0x7acb11218d5f2ULL, 0x41fe02023b4dbULL, 0x59b37bf5c2f65ULL } },
+          { { 0x726e47dabe671ULL, 0x2ec45e746f6c1ULL, 0x6580e53c74686ULL, 0x5eda104673f74ULL, 0x16234191336d3ULL } } },
+    },
+#endif
+#if (12 % (16 / ROWS)) == 0
+    {
+        { { { 0x5cc9dc80c1ac0ULL, 0x683671486d4cdULL, 0x76f5f1a5e8173ULL, 0x6d5d3f5f9df4aULL, 0x7da0b8f68d7e7ULL } },
+          { { 0x02014385675a6ULL, 0x6155fb53d1defULL, 0x37ea32e89927cULL, 0x059a668f5a82eULL, 0x46115aba1d4dcULL } },
+          { { 0x71953c3b5da76ULL, 0x6642233d37a81ULL, 0x2c9658076b1bdULL, 0x5a581e63010ffULL, 0x5a5f887e83674ULL } } },
+        { { { 0x628d3a0a643b9ULL, 0x01cd8640c93d2ULL, 0x0b7b0cad70f2cULL, 0x3864da98144beULL, 0x43e37ae2d5d1cULL } },
+          { { 0x301cf70a13d11ULL, 0x2a6a1ba1891ecULL, 0x2f291fb3f3ae0ULL, 0x21a7b814bea52ULL, 0x3669b656e44d1ULL } },
+          { { 0x63f06eda6e133ULL, 0x233342758070fULL, 0x098e0459cc075ULL, 0x4df5ead6c7c1bULL, 0x6a21e6cd4fd5eULL } } },
+        { { { 0x129126699b2e3ULL, 0x0ee11a2603de8ULL, 0x60ac2f5c74c21ULL, 0x59b192a196808ULL, 0x45371b07001e8ULL } },
+          { { 0x6170a3046e65fULL, 0x5401a46a49e38ULL, 0x20add5561c4a8ULL, 0x7abb4edde9e46ULL, 0x586bf9f1a195fULL } },
+          { { 0x3088d5ef8790bULL, 0x38c2126fcb4dbULL, 0x685bae149e3c3ULL, 0x0bcd601a4e930ULL, 0x0eafb03790e52ULL } } },
+        { { { 0x0805e0f75ae1dULL, 0x464cc59860a28ULL, 0x248e5b7b00befULL, 0x5d99675ef8f75ULL, 0x44ae3344c5435ULL } },
+          { { 0x555c13748042fULL, 0x4d041754232c0ULL, 0x521b430866907ULL, 0x3308e40fb9c39ULL, 0x309acc675a02cULL } },
+          { { 0x289b9bba543eeULL, 0x3ab592e28539eULL, 0x64d82abcdd83aULL, 0x3c78ec172e327ULL, 0x62d5221b7f946ULL } } },
+        { { { 0x5d4263af77a3cULL, 0x23fdd2289aeb0ULL, 0x7dc64f77eb9ecULL, 0x01bd28338402cULL, 0x14f29a5383922ULL } },
+          { { 0x4299c18d0936dULL, 0x5914183418a49ULL, 0x52a18c721aed5ULL, 0x2b151ba82976dULL, 0x5c0efde4bc754ULL } },
+          { { 0x17edc25b2d7f5ULL, 0x37336a6081beeULL, 0x7b5318887e5c3ULL, 0x49f6d491a5be1ULL, 0x5e72365c7bee0ULL } } },
+        { { { 0x339062f08b33eULL, 0x4bbf3e657cfb2ULL, 0x67af7f56e5967ULL, 0x4dbd67f9ed68fULL, 0x70b20555cb734ULL } },
+          { { 0x3fc074571217fULL, 0x3a0d29b2b6aebULL, 0x06478ccdde59dULL, 0x55e4d051bddfaULL, 0x77f1104c47b4eULL } },
+          { { 0x113c555112c4cULL, 0x7535103f9b7caULL, 0x140ed1d9a2108ULL, 0x02522333bc2afULL, 0x0e34398f4a064ULL } } },
+        { { { 0x30b093e4b1928ULL, 0x1ce7e7ec80312ULL, 0x4e575bdf78f84ULL, 0x61f7a190bed39ULL, 0x6f8aded6ca379ULL } },
+          { { 0x522d93ecebde8ULL, 0x024f045e0f6cfULL, 0x16db63426cfa1ULL, 0x1b93a1fd30fd8ULL, 0x5e5405368a362ULL } },
+          { { 0x0123dfdb7b29aULL, 0x4344356523c68ULL, 0x79a527921ee5fULL, 0x74bfccb3e817eULL, 0x780de72ec8d3dULL } } },
+        { { { 0x7eaf300f42772ULL, 0x5455188354ce3ULL, 0x4dcca4a3dcbacULL, 0x3d314d0bfebcbULL, 0x1defc6ad32b58ULL } },
+          { { 0x28545089ae7bcULL, 0x1e38fe9a0c15cULL, 0x12046e0e2377bULL, 0x6721c560aa885ULL, 0x0eb28bf671928ULL } },
+          { { 0x3be1aef5195a7ULL, 0x6f22f62bdb5ebULL, 0x39768b8523049ULL, 0x43394c8fbfdbdULL, 0x467d201bf8dd2ULL } } },
+    },
+#endif
+#if (13 % (16 / ROWS)) == 0
+    {
+        { { { 0x257a22796bb14ULL, 0x6f360fb443e75ULL, 0x680e47220eaeaULL, 0x2fcf2a5f10c18ULL, 0x5ee7fb38d8320ULL } },
+          { { 0x40ff9ce5ec54bULL, 0x57185e261b35bULL, 0x3e254540e70a9ULL, 0x1b5814003e3f8ULL, 0x78968314ac04bULL } },
+          { { 0x5fdcb41446a8eULL, 0x5286926ff2a71ULL, 0x0f231e296b3f6ULL, 0x684a357c84693ULL, 0x61d0633c9bca0ULL } } },
+        { { { 0x328bcf8fc73dfULL, 0x3b4de06ff95b4ULL, 0x30aa427ba11a5ULL, 0x5ee31bfda6d9cULL, 0x5b23ac2df8067ULL } },
+          { { 0x44935ffdb2566ULL, 0x12f016d176c6eULL, 0x4fbb00f16f5aeULL, 0x3fab78d99402aULL, 0x6e965fd847aedULL } },
+          { { 0x2b953ee80527bULL, 0x55f5bcdb1b35aULL, 0x43a0b3fa23c66ULL, 0x76e07388b820aULL, 0x79b9bbb9dd95dULL } } },
+        { { { 0x17dae8e9f7374ULL, 0x719f76102da33ULL, 0x5117c2a80ca8bULL, 0x41a66b65d0936ULL, 0x1ba811460accbULL } },
+          { { 0x355406a3126c2ULL, 0x50d1918727d76ULL, 0x6e5ea0b498e0eULL, 0x0a3b6063214f2ULL, 0x5065f158c9fd2ULL } },
+          { { 0x169fb0c429954ULL, 0x59aedd9ecee10ULL, 0x39916eb851802ULL, 0x57917555cc538ULL, 0x3981f39e58a4fULL } } },
+        { { { 0x5dfa56de66fdeULL, 0x0058809075908ULL, 0x6d3d8cb854a94ULL, 0x5b2f4e970b1e3ULL, 0x30f4452edcbc1ULL } },
+          { { 0x38a7559230a93ULL, 0x52c1cde8ba31fULL, 0x2a4f2d4745a3dULL, 0x07e9d42d4a28aULL, 0x38dc083705acdULL } },
+          { { 0x52782c5759740ULL, 0x53f3397d990adULL, 0x3a939c7e84d15ULL, 0x234c4227e39e0ULL, 0x632d9a1a593f2ULL } } },
+        { { { 0x1fd11ed0c84a7ULL, 0x021b3ed2757e1ULL, 0x73e1de58fc1c6ULL, 0x5d110c84616abULL, 0x3a5a7df28af64ULL } },
+          { { 0x36b15b807cba6ULL, 0x3f78a9e1afed7ULL, 0x0a59c2c608f1fULL, 0x52bdd8ecb81b7ULL, 0x0b24f48847ed4ULL } },
+          { { 0x2d4be511beac7ULL, 0x6bda4d99e5b9bULL, 0x17e6996914e01ULL, 0x7b1f0ce7fcf80ULL, 0x34fcf74475481ULL } } },
+        { { { 0x31dab78cfaa98ULL, 0x4e3216e5e54b7ULL, 0x249823973b689ULL, 0x2584984e48885ULL, 0x0119a3042fb37ULL } },
+          { { 0x7e04c789767caULL, 0x1671b28cfb832ULL, 0x7e57ea2e1c537ULL, 0x1fbaaef444141ULL, 0x3d3bdc164dfa6ULL } },
+          { { 0x2d89ce8c2177dULL, 0x6cd12ba182cf4ULL, 0x20a8ac19a7697ULL, 0x539fab2cc72d9ULL, 0x56c088f1ede20ULL } } },
+        { { { 0x35fac24f38f02ULL, 0x7d75c6197ab03ULL, 0x33e4bc2a42fa7ULL, 0x1c7cd10b48145ULL, 0x038b7ea483590ULL } },
+          { { 0x53d1110a86e17ULL, 0x6416eb65f466dULL, 0x41ca6235fce20ULL, 0x5c3fc8a99bb12ULL, 0x09674c6b99108ULL } },
+          { { 0x6f82199316ff8ULL, 0x05d54f1a9f3e9ULL, 0x3bcc5d0bd274aULL, 0x5b284b8d2d5adULL, 0x6e5e31025969eULL } } },
+        { { { 0x4fb0e63066222ULL, 0x130f59747e660ULL, 0x041868fecd41aULL, 0x3105e8c923bc6ULL, 0x3058ad43d1838ULL } },
+          { { 0x462f587e593fbULL, 0x3d94ba7ce362dULL, 0x330f9b52667b7ULL, 0x5d45a48e0f00aULL, 0x08f5114789a8dULL } },
+          { { 0x40ffde57663d0ULL, 0x71445d4c20647ULL, 0x2653e68170f7cULL, 0x64cdee3c55ed6ULL, 0x26549fa4efe3dULL } } },
+    },
+#endif
+#if (14 % (16 / ROWS)) == 0
+    {
+        { { { 0x600c9193b877fULL, 0x21c1b8a0d7765ULL, 0x379927fb38ea2ULL, 0x70d7679dbe01bULL, 0x5f46040898de9ULL } },
+          { { 0x58845832fcedbULL, 0x135cd7f0c6e73ULL, 0x53ffbdfe8e35bULL, 0x22f195e06e55bULL, 0x73937e8814bceULL } },
+          { { 0x37116297bf48dULL, 0x45a9e0d069720ULL, 0x25af71aa744ecULL, 0x41af0cb8aaba3ULL, 0x2cf8a4e891d5eULL } } },
+        { { { 0x5487e17d06ba2ULL, 0x3872a032d6596ULL, 0x65e28c09348e0ULL, 0x27b6bb2ce40c2ULL, 0x7a6f7f2891d6aULL } },
+          { { 0x3fd8707110f67ULL, 0x26f8716a92db2ULL, 0x1cdaa1b753027ULL, 0x504be58b52661ULL, 0x2049bd6e58252ULL } },
+          { { 0x1fd8d6a9aef49ULL, 0x7cb67b7216fa1ULL, 0x67aff53c3b982ULL, 0x20ea610da9628ULL, 0x6011aadfc5459ULL } } },
+        { { { 0x6d0c802cbf890ULL, 0x141bfed554c7bULL, 0x6dbb667ef4263ULL, 0x58f3126857edcULL, 0x69ce18b779340ULL } },
+          { { 0x7926dcf95f83cULL, 0x42e25120e2becULL, 0x63de96df1fa15ULL, 0x4f06b50f3f9ccULL, 0x6fc5cc1b0b62fULL } },
+          { { 0x75528b29879cbULL, 0x79a8fd2125a3dULL, 0x27c8d4b746ab8ULL, 0x0f8893f02210cULL, 0x15596b3ae5710ULL } } },
+        { { { 0x731167e5124caULL, 0x17b38e8bbe13fULL, 0x3d55b942f9056ULL, 0x09c1495be913fULL, 0x3aa4e241afb6dULL } },
+          { { 0x739d23f9179a2ULL, 0x632fadbb9e8c4ULL, 0x7c8522bfe0c48ULL, 0x6ed0983ef5aa9ULL, 0x0d2237687b5f4ULL } },
+          { { 0x138bf2a3305f5ULL, 0x1f45d24d86598ULL, 0x5274bad2160feULL, 0x1b6041d58d12aULL, 0x32fcaa6e4687aULL } } },
+        { { { 0x7a4732787ccdfULL, 0x11e427c7f0640ULL, 0x03659385f8c64ULL, 0x5f4ead9766bfbULL, 0x746f6336c2600ULL } },
+          { { 0x56e8dc57d9af5ULL, 0x5b3be17be4f78ULL, 0x3bf928cf82f4bULL, 0x52e55600a6f11ULL, 0x4627e9cefebd6ULL } },
+          { { 0x2f345ab6c971cULL, 0x653286e63e7e9ULL, 0x51061b78a23adULL, 0x14999acb54501ULL, 0x7b4917007ed66ULL } } },
+        { { { 0x41b28dd53a2ddULL, 0x37be85f87ea86ULL, 0x74be3d2a85e41ULL, 0x1be87fac96ca6ULL, 0x1d03620fe08cdULL } },
+          { { 0x5fb5cab84b064ULL, 0x2513e778285b0ULL, 0x457383125e043ULL, 0x6bda3b56e223dULL, 0x122ba376f844fULL } },
+          { { 0x232cda2b4e554ULL, 0x0422ba30ff840ULL, 0x751e7667b43f5ULL, 0x6261755da5f3eULL, 0x02c70bf52b68eULL } } },
+        { { { 0x532bf458d72e1ULL, 0x40f96e796b59cULL, 0x22ef79d6f9da3ULL, 0x501ab67beca77ULL, 0x6b0697e3feb43ULL } },
+          { { 0x7ec4b5d0b2fbbULL, 0x200e910595450ULL, 0x742057105715eULL, 0x2f07022530f60ULL, 0x26334f0a409efULL } },
+          { { 0x0f04adf62a3c0ULL, 0x5e0edb48bb6d9ULL, 0x7c34aa4fbc003ULL, 0x7d74e4e5cac24ULL, 0x1cc37f43441b2ULL } } },
+        { { { 0x656f1c9ceaeb9ULL, 0x7031cacad5aecULL, 0x1308cd0716c57ULL, 0x41c1373941942ULL, 0x3a346f772f196ULL } },
+          { { 0x7565a5cc7324fULL, 0x01ca0d5244a11ULL, 0x116b067418713ULL, 0x0a57d8c55edaeULL, 0x6c6809c103803ULL } },
+          { { 0x55112e2da6ac8ULL, 0x6363d0a3dba5aULL, 0x319c98ba6f40cULL, 0x2e84b03a36ec7ULL, 0x05911b9f6ef7cULL } } },
+    },
+#endif
+#if (15 % (16 / ROWS)) == 0
+    {
+        { { { 0x7f29362730383ULL, 0x7fd7951459c36ULL, 0x7504c512d49e7ULL, 0x087ed7e3bc55fULL, 0x7deb10149c726ULL } },
+          { { 0x048478f387475ULL, 0x69397d9678a3eULL, 0x67c8156c976f3ULL, 0x2eb4d5589226cULL, 0x2c709e6c1c10aULL } },
+          { { 0x2af6a8766ee7aULL, 0x08aaa79a1d96cULL, 0x42f92d59b2fb0ULL, 0x1752c40009c07ULL, 0x08e68e9ff62ceULL } } },
+        { { { 0x509d50ab8f2f9ULL, 0x1b8ab247be5e5ULL, 0x5d9b2e6b2e486ULL, 0x4faa5479a1339ULL, 0x4cb13bd738f71ULL } },
+          { { 0x5500a4bc130adULL, 0x127a17a938695ULL, 0x02a26fa34e36dULL, 0x584d12e1ecc28ULL, 0x2f1f3f87eeba3ULL } },
+          { { 0x48c75e515b64aULL, 0x75b6952071ef0ULL, 0x5d46d42965406ULL, 0x7746106989f9fULL, 0x19a1e353c0ae2ULL } } },
+        { { { 0x172cdd596bdbdULL, 0x0731ddf881684ULL, 0x10426d64f8115ULL, 0x71a4fd8a9a3daULL, 0x736bd3990266aULL } },
+          { { 0x47560bafa05c3ULL, 0x418dcabcc2fa3ULL, 0x35991cecf8682ULL, 0x24371a94b8c60ULL, 0x41546b11c20c3ULL } },
+          { { 0x32d509334b3b4ULL, 0x16c102cae70aaULL, 0x1720dd51bf445ULL, 0x5ae662faf9821ULL, 0x412295a2b87faULL } } },
+        { { { 0x55261e293eac6ULL, 0x06426759b65ccULL, 0x40265ae116a48ULL, 0x6c02304bae5bcULL, 0x0760bb8d195adULL } },
+          { { 0x19b88f57ed6e9ULL, 0x4cdbf1904a339ULL, 0x42b49cd4e4f2cULL, 0x71a2e771909d9ULL, 0x14e153ebb52d2ULL } },
+          { { 0x61a17cde6818aULL, 0x53dad34108827ULL, 0x32b32c55c55b6ULL, 0x2f9165f9347a3ULL, 0x6b34be9bc33acULL } } },
+        { { { 0x469656571f2d3ULL, 0x0aa61ce6f423fULL, 0x3f940d71b27a1ULL, 0x185f19d73d16aULL, 0x01b9c7b62e6ddULL } },
+          { { 0x72f643a78c0b2ULL, 0x3de45c04f9e7bULL, 0x706d68d30fa5cULL, 0x696f63e8e2f24ULL, 0x2012c18f0922dULL } },
+          { { 0x355e55ac89d29ULL, 0x3e8b414ec7101ULL, 0x39db07c520c90ULL, 0x6f41e9b77efe1ULL, 0x08af5b784e4baULL } } },
+        { { { 0x314d289cc2c4bULL, 0x23450e2f1bc4eULL, 0x0cd93392f92f4ULL, 0x1370c6a946b7dULL, 0x6423c1d5afd98ULL } },
+          { { 0x499dc881f2533ULL, 0x34ef26476c506ULL, 0x4d107d2741497ULL, 0x346c4bd6efdb3ULL, 0x32b79d71163a1ULL } },
+          { { 0x5f8d9edfcb36aULL, 0x1e6e8dcbf3990ULL, 0x7974f348af30aULL, 0x6e6724ef19c7cULL, 0x480a5efbc13e2ULL } } },
+        { { { 0x14ce442ce221fULL, 0x18980a72516ccULL, 0x072f80db86677ULL, 0x703331fda526eULL, 0x24b31d47691c8ULL } },
+          { { 0x1e70b01622071ULL, 0x1f163b5f8a16aULL, 0x56aaf341ad417ULL, 0x7989635d830f7ULL, 0x47aa27600cb7bULL } },
+          { { 0x41eedc015f8c3ULL, 0x7cf8d27ef854aULL, 0x289e3584693f9ULL, 0x04a7857b309a7ULL, 0x545b585d14ddaULL } } },
+        { { { 0x4e4d0e3b321e1ULL, 0x7451fe3d2ac40ULL, 0x666f678eea98dULL, 0x038858667feadULL, 0x4d22dc3e64c8dULL } },
+          { { 0x7275ea0d43a0fULL, 0x681137dd7ccf7ULL, 0x1e79cbab79a38ULL, 0x22a214489a66aULL, 0x0f62f9c332ba5ULL } },
+          { { 0x46589d63b5f39ULL, 0x7eaf979ec3f96ULL, 0x4ebe81572b9a8ULL, 0x21b7f5d61694aULL, 0x1c0fa01a36371ULL } } },
+    },
+#endif
+};
+#else
+static const fe _d = { { 0x35978a3, 0x0d37284, 0x3156ebd, 0x06a0a0e, 0x001c029, 0x179e898, 0x3a03cbb, 0x1ce7198, 0x2e2b6ff, 0x1480db3 } };
+static const fe _d2 = { { 0x2b2f159, 0x1a6e509, 0x22add7a, 0x0d4141d, 0x0038052, 0x0f3d130, 0x3407977, 0x19ce331, 0x1c56dff, 0x0901b67 } };
+static const fe _sqrtm1 = { { 0x20ea0b0, 0x186c9d2, 0x08f189d, 0x035697f, 0x0bd0c60, 0x1fbd7a7, 0x2804c9e, 0x1e16569, 0x004fc1d, 0x0ae0c92 } };
+
+/* multiples 1 to 8 of the base point */
+static const ed25519_precomp_t _base_row0[8] = {
+    { { { 0x18c3b85, 0x124f1bd, 0x1c325f7, 0x037dc60, 0x33e4cb7, 0x03d42c2, 0x1a44c32, 0x14ca4e1, 0x3a33d4b, 0x01f3e74 } },
+      { { 0x340913e, 0x00e4175, 0x3d673a2, 0x02e8a05, 0x3f4e67c, 0x08f8a09, 0x0c21a34, 0x04cf4b8, 0x1298f81, 0x113f4be } },
+      { { 0x37aaa68, 0x0448161, 0x093d579, 0x11e6556, 0x09b67a0, 0x143598c, 0x1bee5ee, 0x0b50b43, 0x289f0c6, 0x1bc45ed } } },
+    { { { 0x33c71d7, 0x139ff24, 0x2b6b244, 0x0b3d07f, 0x27d1a76, 0x1d60702, 0x34d32f0, 0x1c5cb54, 0x3fa87d2, 0x1643018 } },
+      { { 0x2b4d5a8, 0x0695810, 0x19ed153, 0x0627305, 0x23cae04, 0x16e37aa, 0x311b5d8, 0x0aabc13, 0x2669c92, 0x1aed656 } },
+      { { 0x19b7a5f, 0x0aa2ce9, 0x1ef087f, 0x0eaecd6, 0x0db05af, 0x13d6a31, 0x3d04205, 0x16e6a01, 0x313ea50, 0x1c06bd6 } } },
+    { { { 0x0ee9730, 0x16c2a13, 0x17155e4, 0x1874432, 0x0096a10, 0x1016732, 0x1a8014f, 0x11e9823, 0x1b9a80f, 0x1e85938 } },
+      { { 0x0fcd265, 0x047fa29, 0x34faacc, 0x1ef2e0d, 0x0ef4d4f, 0x14bd6bd, 0x0f98d10, 0x14c5026, 0x07555bd, 0x0aae456 } },
+      { { 0x1d0d889, 0x1a4cfc3, 0x34c4295, 0x110e1ae, 0x162508c, 0x0f2db4c, 0x072a2c6, 0x098da2e, 0x2f12b9b, 0x168a09a } } },
+    { { { 0x2fc099f, 0x0d46e63, 0x0a7050e, 0x1a3efe9, 0x19d971b, 0x10a9265, 0x2469efd, 0x0e4f946, 0x0321e58, 0x1a03a44 } },
+      { { 0x16818bf, 0x1814281, 0x35532bf, 0x18ab307, 0x0c9fa25, 0x0a05073, 0x071e683, 0x093587d, 0x0c7445a, 0x09e4cfd } },
+      { { 0x076ff09, 0x0fefa71, 0x02e4b42, 0x02bdae6, 0x1ba78e5, 0x02b4494, 0x1ee7c88, 0x1c56bbb, 0x3f63553, 0x1fe7432 } } },
+    { { { 0x0a5bb33, 0x0af1102, 0x1a05442, 0x01e3af7, 0x2354123, 0x0bfec44, 0x1f5862d, 0x0dd7ba3, 0x3146e20, 0x0a51733 } },
+      { { 0x047d6ba, 0x060b0e9, 0x136eff2, 0x08a5939, 0x3540053, 0x064a087, 0x2788e5c, 0x0be7c67, 0x33eb1b5, 0x05529f9 } },
+      { { 0x12a8285, 0x0f6fc60, 0x23f9797, 0x03e85ee, 0x09c3820, 0x1bda72d, 0x1b3858d, 0x0d35683, 0x296b3bb, 0x10eaaf9 } } },
+    { { { 0x3157131, 0x13bbadd, 0x1f10741, 0x0480645, 0x26c9c56, 0x059a736, 0x2db346d, 0x117b00c, 0x36a2cc3, 0x14795ee } },
+      { { 0x37d8ca4, 0x001ad9e, 0x0e72933, 0x0213e91, 0x15d6f8a, 0x04553b9, 0x02e7390, 0x1109761, 0x01ae417, 0x0e2d931 } },
+      { { 0x2ea4b71, 0x10c99c0, 0x36030b5, 0x01a0d0d, 0x2f9c380, 0x03bc144, 0x2512584, 0x03c6a7c, 0x1a9f0d6, 0x042e3a4 } } },
+    { { { 0x04ea3bf, 0x0973425, 0x01a4d63, 0x1d59cee, 0x1d1c0d4, 0x0542e49, 0x1294114, 0x04fce36, 0x29283c9, 0x1186fa9 } },
+      { { 0x23221b1, 0x1cb26aa, 0x074f74d, 0x099ddd1, 0x1b28085, 0x0192c3a, 0x13b27c9, 0x0fc13bd, 0x1d2e531, 0x075bb75 } },
+      { { 0x1b8b3a2, 0x0db7200, 0x0935e30, 0x03829f5, 0x2cc0d7d, 0x077adf3, 0x220dd2c, 0x014ea53, 0x1c6a0f9, 0x1ea7eec } } },
+    { { { 0x0dd3e8f, 0x1d65981, 0x2058b36, 0x1bf1443, 0x1b2cc0d, 0x0d9c323, 0x1ce332f, 0x0a5f626, 0x2061bce, 0x024579d } },
+      { { 0x39234d9, 0x1d77b7c, 0x31f3c54, 0x0070daa, 0x258f5da, 0x03c23fb, 0x3a0d637, 0x0386584, 0x21320e0, 0x0ea4092 } },
+      { { 0x1a2911a, 0x07d7672, 0x0fafcf8, 0x1c45e65, 0x2e28dc5, 0x0b62a32, 0x2090c87, 0x1d2ac6c, 0x1c2ecc4, 0x09a41f1 } } },
+};
+
+/* multiples 1 to 8 of 16^(64 / ROWS * row) * B for rows 1 to ROWS - 1 */
+static const ed25519_precomp_t _base_rows[][8] = {
+#if (1 % (16 / ROWS)) == 0
+    {
+        { { { 0x06691ae, 0x0d3165f, 0x2990fc4, 0x1e8542d, 0x1922274, 0x14afae7, 0x164861a, 0x1c3bb5c, 0x070c6a9, 0x02a1c78 } },
+          { { 0x04346be, 0x01f511d, 0x164a81d, 0x0a0ada9, 0x075236b, 0x13b603e, 0x1450c50, 0x1beef87, 0x012fcdb, 0x13adca3 } },
+          { { 0x3bc8989, 0x06d6652, 0x04c0660, 0x1d2deea, 0x1cdaeb8, 0x1d59e3c, 0x0d6f10c, 0x08c81ac, 0x0f2685d, 0x0fb9cc0 } } },
+        { { { 0x01e7518, 0x09e51e1, 0x0dae87f, 0x0cb1ce2, 0x3971be9, 0x1052b74, 0x32f0ef1, 0x0061420, 0x22cfb89, 0x1f51f1a } },
+          { { 0x27dd6b7, 0x0957927, 0x3d59eba, 0x0e30858, 0x2005845, 0x0e187ca, 0x0cbaec9, 0x0b84793, 0x2297912, 0x04e055d } },
+          { { 0x2f0d6e0, 0x0b40523, 0x1e787fb, 0x0d48aa3, 0x274f9d2, 0x0bb8157, 0x2310813, 0x1900e3d, 0x0d34c9e, 0x05233d6 } } },
+        { { { 0x2e4756d, 0x1cbdf66, 0x10ffc4a, 0x1dc479a, 0x15b0d16, 0x160a88d, 0x085b6b4, 0x03733fa, 0x2d4eaea, 0x09e3fae } },
+          { { 0x134f027, 0x124bd9e, 0x15528d4, 0x1f7b420, 0x11a6612, 0x1611854, 0x0de1544, 0x17a8b94, 0x1ebd5db, 0x0ffcbe8 } },
+          { { 0x0933966, 0x09a07e3, 0x1931635, 0x0e10148, 0x2308652, 0x19d3c52, 0x0a94890, 0x0ef6722, 0x02fe9c6, 0x1041374 } } },
+        { { { 0x3096ab8, 0x05381b6, 0x1e6b024, 0x0486722, 0x086a2db, 0x09e2af5, 0x2609520, 0x0902ca4, 0x248efca, 0x00596d6 } },
+          { { 0x124422a, 0x0afd784, 0x356ae56, 0x19cc519, 0x287e830, 0x052b666, 0x1b080fd, 0x07ab299, 0x00afaf5, 0x0b218ec } },
+          { { 0x0846a76, 0x0291d28, 0x3981e32, 0x026697b, 0x04bbfe6, 0x0aa2b8f, 0x314832c, 0x1170d2b, 0x19bffec, 0x1646d9f } } },
+        { { { 0x318b55d, 0x06cdc67, 0x083d337, 0x1d50c63, 0x3919797, 0x09f05ed, 0x0089b61, 0x0516c21, 0x0670301, 0x1226d3e } },
+          { { 0x0b49bfa, 0x1c34720, 0x1914625, 0x0f55f9f, 0x165e545, 0x0f01c88, 0x019e04f, 0x1796e4e, 0x07ca8f7, 0x0f780bb } },
+          { { 0x2eb92ef, 0x0840b4e, 0x10c3a46, 0x1a308b5, 0x385894e, 0x10baa24, 0x355f38c, 0x1d7e7af, 0x3a496cb, 0x127d7ee } } },
+        { { { 0x29c572e, 0x158a307, 0x0e822ab, 0x1662c42, 0x229361a, 0x15763eb, 0x1a97b28, 0x02b7234, 0x0288675, 0x01a869b } },
+          { { 0x25bcfd4, 0x1268422, 0x27d6612, 0x185e323, 0x3710375, 0x07c0d1c, 0x14a6098, 0x1ce9258, 0x2dcbfa6, 0x15812a1 } },
+          { { 0x01764b6, 0x034751f, 0x16a2e51, 0x007020c, 0x1c95045, 0x0acf6d1, 0x18d300c, 0x058d3e0, 0x09fe274, 0x082627a } } },
+        { { { 0x1eaec2e, 0x109e2e1, 0x17be2ce, 0x03bd659, 0x1588770, 0x1cbf45a, 0x1260b30, 0x0ba6c81, 0x10f7059, 0x1cc2e65 } },
+          { { 0x22dcc7f, 0x1ddff4e, 0x3124932, 0x1652a7e, 0x0ca15f0, 0x007e3a0, 0x0ec3269, 0x1c5344f, 0x1d0ca67, 0x0100fb4 } },
+          { { 0x34ec552, 0x0cb4d61, 0x1f1b929, 0x07cc123, 0x3179b23, 0x0c035ce, 0x1a37d0b, 0x1b99ef9, 0x0308303, 0x16f5d15 } } },
+        { { { 0x1e7792a, 0x124c845, 0x3b930b8, 0x115ee6e, 0x3193226, 0x1a3d762, 0x31ed456, 0x10593a3, 0x123067f, 0x16edf6c } },
+          { { 0x0b24cc2, 0x0b4654a, 0x0302ff3, 0x12b19ae, 0x1fdad51, 0x1c07236, 0x05b3727, 0x1b06cd7, 0x007380a, 0x04ce9e0 } },
+          { { 0x2ca62be, 0x07d19f1, 0x25dc12c, 0x0b108ca, 0x013b087, 0x1d54770, 0x1b03bcd, 0x01a4304, 0x2d58f0e, 0x1d03729 } } },
+    },
+#endif
+#if (2 % (16 / ROWS)) == 0
+    {
+        { { { 0x385c5e8, 0x16da7de, 0x35650ec, 0x05e8b45, 0x1bfc19e, 0x1330f9b, 0x073be0e, 0x1cf874e, 0x11b0af8, 0x0e97db5 } },
+          { { 0x20dac5f, 0x1a1d5a9, 0x38aec26, 0x1575d5e, 0x05f80bd, 0x0ce0f7d, 0x09f96a6, 0x19e0fe3, 0x3789ecd, 0x0808d29 } },
+          { { 0x178b252, 0x0836d9c, 0x22c0eda, 0x1cea8f6, 0x01c70d3, 0x1e41170, 0x1251059, 0x06cdec5, 0x353cffe, 0x1f35a08 } } },
+        { { { 0x0acf4f3, 0x173581a, 0x07a74cc, 0x0c1e6bf, 0x10b64b4, 0x16025d9, 0x09c4e99, 0x11feaeb, 0x3b2b2cd, 0x0fbc094 } },
+          { { 0x087fab6, 0x06916f6, 0x36dc17c, 0x195d201, 0x0aa11a8, 0x16e6000, 0x1080974, 0x1287b32, 0x063bdc0, 0x0a0e322 } },
+          { { 0x2465030, 0x0ec33d2, 0x2f57a2d, 0x008ae2b, 0x3e925ad, 0x0ab419d, 0x3d7457a, 0x1025059, 0x2606a82, 0x08772e2 } } },
+        { { { 0x27731ba, 0x1403eaf, 0x3113351, 0x1f314f0, 0x2080d81, 0x1f3d97f, 0x2011ba1, 0x0f17659, 0x3f6c6f6, 0x1761036 } },
+          { { 0x09d9fc8, 0x00111a3, 0x0796b8c, 0x176a155, 0x0950025, 0x0ee2f9c, 0x1a6a609, 0x1b5624b, 0x0194a31, 0x02f0f42 } },
+          { { 0x09fe18b, 0x18e034c, 0x0b8ee0d, 0x135cf0b, 0x1bac0b6, 0x1ae20ab, 0x1dd4cbe, 0x0dbaaf7, 0x232ac19, 0x0e909d8 } } },
+        { { { 0x3447ecb, 0x0305cb6, 0x1b7a77f, 0x0fe3141, 0x17f3f10, 0x1aa15fe, 0x27fe03a, 0x13f3015, 0x2824e1a, 0x01dc327 } },
+          { { 0x27084fa, 0x090cb22, 0x0a8a968, 0x11efdcf, 0x2262867, 0x058e45d, 0x38010ce, 0x17a37d3, 0x0ea16de, 0x07fc5df } },
+          { { 0x1b5b5fd, 0x0766691, 0x32499ec, 0x148d9d3, 0x2182613, 0x03e3e89, 0x0048c98, 0x163dce6, 0x3d41500, 0x0e7c993 } } },
+        { { { 0x2097be1, 0x0d2aaff, 0x3253a33, 0x10eff00, 0x291b7f3, 0x0a6f1ff, 0x0844a16, 0x029d879, 0x272c35f, 0x1971884 } },
+          { { 0x3e7e29c, 0x14d05f6, 0x27394f5, 0x1515ce0, 0x2f650dd, 0x1597ba9, 0x08dc749, 0x108141d, 0x3468889, 0x05c4b5c } },
+          { { 0x23193dd, 0x0e27e33, 0x0177ce5, 0x0b5092e, 0x13440cd, 0x01cfe83, 0x0d49e97, 0x04e4083, 0x0ab19ce, 0x08be600 } } },
+        { { { 0x26efdac, 0x0a7f766, 0x1282840, 0x1f1a52a, 0x2e44b3a, 0x1bdf37b, 0x3b25cc3, 0x1568c81, 0x138598c, 0x105c693 } },
+          { { 0x29ef8cb, 0x08da28f, 0x0e2ac0b, 0x1152a82, 0x38fa700, 0x124248f, 0x2a4582f, 0x0dcaaa7, 0x0d64762, 0x04fd05b } },
+          { { 0x1c94c8c, 0x1d62aa6, 0x300ff44, 0x17d8005, 0x08c01bd, 0x1da5392, 0x148eed6, 0x0357f7a, 0x3a574bd, 0x1420853 } } },
+        { { { 0x3d003d6, 0x0856ed4, 0x12ca8c3, 0x045e79e, 0x2c840a2, 0x0683a5a, 0x2bb3ab6, 0x088e4f8, 0x24c86cb, 0x0e9dd62 } },
+          { { 0x2d6fe4b, 0x09a454f, 0x2f89840, 0x1ca88eb, 0x299699c, 0x014af94, 0x3132316, 0x0e9797b, 0x2c6faba, 0x08be583 } },
+          { { 0x3ae5076, 0x0447da4, 0x294ca90, 0x0f8efea, 0x076b887, 0x1115e65, 0x2464879, 0x0928244, 0x1f8de7f, 0x1767f45 } } },
+        { { { 0x2d7521e, 0x1134abb, 0x2c2a7e4, 0x1421974, 0x238ea40, 0x09c16d4, 0x25d3b97, 0x11b1c2c, 0x3a47eb9, 0x0ef061f } },
+          { { 0x163727f, 0x10234db, 0x2a66062, 0x17ebe3d, 0x1a8de6b, 0x0aee24b, 0x0c7e2e6, 0x1da753c, 0x114f8fb, 0x0ccbcd6 } },
+          { { 0x286c20c, 0x1c0457a, 0x224ada8, 0x05b6236, 0x2662adf, 0x0660188, 0x0195a9d, 0x1407aef, 0x0e906fb, 0x1143607 } } },
+    },
+#endif
+#if (3 % (16 / ROWS)) == 0
+    {
+        { { { 0x3460efb, 0x18ad0d3, 0x0fad3fc, 0x0a531b0, 0x37b4c0f, 0x1a0da24, 0x110875b, 0x1727e0a, 0x3e00545, 0x08df9f6 } },
+          { { 0x13c1431, 0x1bdd2f1, 0x1bbd9c2, 0x0710397, 0x0ae5c97, 0x1b23ee7, 0x0e1b7da, 0x1211717, 0x050b5cc, 0x1f8b839 } },
+          { { 0x301b430, 0x15d7b59, 0x3a20026, 0x134f85f, 0x08c4253, 0x1e47f22, 0x1078ac1, 0x0bc6ea6, 0x19b1115, 0x1c6be9a } } },
+        { { { 0x33b50d6, 0x08f0711, 0x1e21d48, 0x0f9d9c7, 0x147a1e8, 0x0c9be95, 0x25fafd9, 0x1439370, 0x3c78f89, 0x001cc7e } },
+          { { 0x153b61d, 0x19be6ce, 0x03cccb9, 0x1557d0a, 0x31960e7, 0x1f759fe, 0x1affed4, 0x051c1e8, 0x29c2b1c, 0x008450b } },
+          { { 0x0f81880, 0x031c612, 0x0233c86, 0x112f676, 0x2fe5830, 0x1ba15e3, 0x17041b5, 0x10116db, 0x3347e15, 0x13135bc } } },
+        { { { 0x08f1970, 0x1377f26, 0x2a365e1, 0x13d85cf, 0x1ae4588, 0x19176be, 0x3db623b, 0x1f50dd8, 0x00a88f9, 0x0e2fe54 } },
+          { { 0x17d1fc9, 0x1fb33f0, 0x382831e, 0x1328a01, 0x1b1d7d6, 0x1ee0cdf, 0x33895fb, 0x1445b7b, 0x2aa7e47, 0x064ff76 } },
+          { { 0x3e8876f, 0x0b24f0d, 0x0c583fa, 0x0d0c68a, 0x28bd879, 0x1241276, 0x07ac11c, 0x12d2a10, 0x1ebf0d4, 0x1a9bee6 } } },
+        { { { 0x2e423c6, 0x048ad6d, 0x3f1ddd6, 0x0879437, 0x24e75c0, 0x1cf5d8c, 0x095418e, 0x1621215, 0x1f42c5e, 0x04dbf6a } },
+          { { 0x20855eb, 0x1b06ed5, 0x213ad48, 0x1c7c49f, 0x0905aec, 0x171acc1, 0x2889bc7, 0x0dd5ae3, 0x14a3189, 0x1d7dda4 } },
+          { { 0x305bdd1, 0x137ec68, 0x1811f29, 0x0ecffc1, 0x03cd92e, 0x1bb588a, 0x3ec52e1, 0x1974550, 0x110be8d, 0x008860d } } },
+        { { { 0x3307a7f, 0x09c4050, 0x08bf3ab, 0x0f623ed, 0x2c18f7a, 0x0927ad3, 0x1ff295f, 0x04d8457, 0x01fd404, 0x04e1f11 } },
+          { { 0x2ad2d14, 0x1d98e17, 0x306095e, 0x00653e2, 0x2823b62, 0x0211e3d, 0x1d37308, 0x18061a2, 0x217b806, 0x1a81c73 } },
+          { { 0x3978af8, 0x0f0f461, 0x08276ba, 0x1ebf872, 0x1c8ad68, 0x1477ca0, 0x1a4245d, 0x19241af, 0x2aaf1ed, 0x0c5c6c9 } } },
+        { { { 0x28a47d1, 0x16df62c, 0x09e34c1, 0x0b0bb85, 0x29afc53, 0x1ddbd58, 0x0fc49a9, 0x07d3a94, 0x2334424, 0x1b14529 } },
+          { { 0x3564ca8, 0x1cc6425, 0x0233525, 0x06113af, 0x3fdeee1, 0x0875150, 0x2ff1bd2, 0x06b49ea, 0x073cf08, 0x0887f52 } },
+          { { 0x2156341, 0x08813ce, 0x065a464, 0x14dd050, 0x3edcf83, 0x10f030e, 0x06ea620, 0x1555f9c, 0x16fb924, 0x1236a96 } } },
+        { { { 0x04c9793, 0x1875772, 0x040c29e, 0x11f7a0c, 0x26507e7, 0x06277ac, 0x2dc479a, 0x13539be, 0x3a0e8a7, 0x16320df } },
+          { { 0x0a59cc7, 0x0a39997, 0x1940dd9, 0x05971c5, 0x2a11c95, 0x01e17ce, 0x3e38469, 0x15ee635, 0x3ccad84, 0x19db75b } },
+          { { 0x2fc9058, 0x05a2165, 0x003619f, 0x19bdab5, 0x07772ef, 0x135d66a, 0x173bea4, 0x1e15b98, 0x32c6a57, 0x0713dcf } } },
+        { { { 0x07c3484, 0x19c1bbf, 0x1ec366d, 0x1a61e0e, 0x1cf7f26, 0x01cc7e5, 0x2bce4bc, 0x0eb9d63, 0x1b7daf6, 0x1c1166b } },
+          { { 0x05fa0bb, 0x093ef4c, 0x075a1cf, 0x102a633, 0x20a7533, 0x1e33848, 0x0e1c197, 0x1885e84, 0x0d1bf64, 0x1e56b20 } },
+          { { 0x1b42bb3, 0x076d264, 0x3994372, 0x11a5816, 0x15c9a58, 0x18c78dc, 0x3cf728f, 0x1fa73fb, 0x048ce21, 0x17f858a } } },
+    },
+#endif
+#if (4 % (16 / ROWS)) == 0
+    {
+        { { { 0x3d1f515, 0x09979dd, 0x01e39a5, 0x03c7d53, 0x1522646, 0x0bc06e5, 0x39dde6d, 0x13f7636, 0x0ba97cc, 0x19521e3 } },
+          { { 0x1f6b0fe, 0x0e3b1e3, 0x2a36a22, 0x04f2baf, 0x14e5f6a, 0x17af1b9, 0x03d0eb8, 0x0ca0124, 0x3a2b20d, 0x0840bf6 } },
+          { { 0x15ce6a1, 0x1b90141, 0x1a532d3, 0x140928d, 0x0daf29d, 0x07da415, 0x17a8bd5, 0x0574743, 0x1b29ecb, 0x02b5c97 } } },
+        { { { 0x3056f85, 0x1ef0326, 0x3faffd8, 0x1473faf, 0x14df549, 0x112aefa, 0x3e33121, 0x1fb2ef5, 0x1302399, 0x13d9d7d } },
+          { { 0x34e2457, 0x099ec60, 0x378bb88, 0x1ab8670, 0x2d9d512, 0x1d15ed7, 0x03d05fb, 0x0ca035e, 0x3b71a03, 0x12bbf3f } },
+          { { 0x015171e, 0x14d8d81, 0x1077865, 0x08c4cc2, 0x334afbc, 0x0945110, 0x13756e8, 0x0ac30e1, 0x32a2a86, 0x02f32ed } } },
+        { { { 0x0fe1296, 0x1579314, 0x3efc30d, 0x017f744, 0x380e5ee, 0x07031b0, 0x3fb62a8, 0x0f84778, 0x29108f3, 0x199e3f5 } },
+          { { 0x2b1a9c8, 0x1a58bfa, 0x3b9a30b, 0x1ab28a3, 0x21b9f98, 0x15b6df2, 0x17018dd, 0x0e7d612, 0x2b59d6b, 0x10093c2 } },
+          { { 0x36863c2, 0x1be8c58, 0x27e42b0, 0x042b969, 0x01fda31, 0x09eaefc, 0x1e64fbc, 0x0e029ee, 0x108ead4, 0x0b50b88 } } },
+        { { { 0x3537593, 0x05ec343, 0x0c9842e, 0x05898f0, 0x24539a4, 0x12ae09f, 0x343d73a, 0x18dc376, 0x279b423, 0x1082fce } },
+          { { 0x0dfd29b, 0x144c565, 0x18d52fe, 0x0e989fa, 0x1855661, 0x0455010, 0x09f8384, 0x0645d74, 0x08b8d2d, 0x19dac98 } },
+          { { 0x05b2b47, 0x02e9947, 0x3701027, 0x16188d8, 0x219c6db, 0x03135b0, 0x38658de, 0x03c0f7f, 0x3a9c0cf, 0x1d174bf } } },
+        { { { 0x1d34e6a, 0x1b7d5c8, 0x27a0c06, 0x13ccbdd, 0x2c76e20, 0x0756afa, 0x104e1e4, 0x1073a78, 0x254c1dc, 0x01b856f } },
+          { { 0x3c9c8bd, 0x096878a, 0x3b037ea, 0x041323c, 0x3a96c98, 0x10155db, 0x0e3876f, 0x0ba1aa2, 0x2b960cf, 0x06b88f3 } },
+          { { 0x132994a, 0x09761c6, 0x3560b6e, 0x1ae758e, 0x0c8d472, 0x0b7ca05, 0x20aa4ed, 0x03eefb8, 0x21278ec, 0x1637b61 } } },
+        { { { 0x2c2c9a8, 0x0d6ea2d, 0x33185bf, 0x077a962, 0x123bbbe, 0x12d1573, 0x04883f8, 0x17b0670, 0x2b531d5, 0x022e9a5 } },
+          { { 0x266c55c, 0x1cde4fc, 0x1c93b02, 0x02e622a, 0x32325db, 0x026c3a8, 0x1c17c5e, 0x0df2b9c, 0x285485f, 0x0bfce77 } },
+          { { 0x3efc57a, 0x14fbbb0, 0x1022efd, 0x0bea7fa, 0x0138154, 0x1a671cb, 0x2bd1ff8, 0x1ca9d47, 0x34947cf, 0x04818ce } } },
+        { { { 0x112100a, 0x14c51d2, 0x3c0d057, 0x16bf37d, 0x3788ded, 0x1ea79c6, 0x33b0c88, 0x17bdc23, 0x23cb393, 0x01d0cef } },
+          { { 0x1610042, 0x1261e24, 0x35d0172, 0x1e7675f, 0x13b9ec4, 0x0f0a4c0, 0x339caca, 0x030ae17, 0x19b4d59, 0x0d74c2a } },
+          { { 0x0e997f4, 0x0513017, 0x2347fef, 0x12582e2, 0x15d74f7, 0x076847c, 0x1c0fead, 0x153eb06, 0x1e7af6d, 0x0b61cfb } } },
+        { { { 0x25df981, 0x080b853, 0x03eb54c, 0x0ba80af, 0x2883564, 0x0e21d6c, 0x13ae9dd, 0x04a6314, 0x0a01600, 0x0150d86 } },
+          { { 0x3373409, 0x08c5910, 0x03b22af, 0x177a554, 0x3eae2df, 0x1a64806, 0x1ff737a, 0x0f6d612, 0x14707fa, 0x0b9dcd9 } },
+          { { 0x34c23c1, 0x0af7d25, 0x0d261bd, 0x12cee72, 0x2a9bc28, 0x09aba2c, 0x0165c51, 0x0c1a084, 0x362d079, 0x12c510c } } },
+    },
+#endif
+#if (5 % (16 / ROWS)) == 0
+    {
+        { { { 0x0b75601, 0x02abe6d, 0x1ae44f3, 0x09ae46d, 0x17ab1c8, 0x1b7a023, 0x35530b0, 0x1a9da59, 0x04e98f7, 0x06efeca } },
+          { { 0x02b33f3, 0x141628e, 0x016913e, 0x05d6a46, 0x16b8ae8, 0x13db36e, 0x1da81d2, 0x05cd1f2, 0x1d95a23, 0x16a8fb6 } },
+          { { 0x3d96561, 0x1ddfa71, 0x006ccac, 0x0a3963c, 0x32cac49, 0x1506eee, 0x2994cec, 0x0f98ca0, 0x0e5e895, 0x1281f85 } } },
+        { { { 0x077a49b, 0x0d63371, 0x202e481, 0x0f3223f, 0x3f4e36b, 0x1c86aad, 0x1469953, 0x0102332, 0x2d84afa, 0x142bdeb } },
+          { { 0x00df999, 0x104b2e6, 0x0ee29dc, 0x179e376, 0x28c575d, 0x05c77fd, 0x2f6ef49, 0x0805774, 0x391d313, 0x0fc2eb0 } },
+          { { 0x1f65be5, 0x1f78045, 0x1364dc9, 0x1090b08, 0x0a66098, 0x1add6d9, 0x102c085, 0x000cf00, 0x16baebd, 0x064868c } } },
+        { { { 0x1f3c18b, 0x0ab66b6, 0x0339aeb, 0x17b058e, 0x159a83b, 0x15c0ed9, 0x105d612, 0x0fea7d3, 0x2ca062c, 0x1ec1277 } },
+          { { 0x3b870fc, 0x08bdfb7, 0x277b128, 0x15a7bb5, 0x0b0a5af, 0x0c24df7, 0x078ea1b, 0x1d600e7, 0x01e273a, 0x191637d } },
+          { { 0x1444483, 0x0f8de8d, 0x3d27b99, 0x1987f6d, 0x1d621e4, 0x0c5dd87, 0x0026189, 0x1cc8f0c, 0x0bc2950, 0x1824f73 } } },
+        { { { 0x084034b, 0x1bbaf98, 0x30a8d7b, 0x1b3c07d, 0x0c6670a, 0x02d0695, 0x1bb55db, 0x1b212e6, 0x098b647, 0x1b8c603 } },
+          { { 0x1e0706d, 0x0e6a161, 0x32663fe, 0x0c59f39, 0x0db4297, 0x18f453b, 0x0f970b8, 0x12f8877, 0x084827a, 0x15f47a8 } },
+          { { 0x128b071, 0x0adb9e8, 0x1755dcf, 0x16c9d44, 0x2930565, 0x0216130, 0x26f4159, 0x1a31ef6, 0x1ddd97b, 0x0d8fa66 } } },
+        { { { 0x24baec6, 0x0123738, 0x1ec05e3, 0x0add5e5, 0x1da6dc9, 0x0efe931, 0x19e371e, 0x06ab219, 0x1bc6f9b, 0x08c7e5e } },
+          { { 0x1ee1fc4, 0x010f04d, 0x119f2d5, 0x0a84726, 0x25dbacd, 0x18cd330, 0x3b400da, 0x0a57685, 0x38693a0, 0x123ba6d } },
+          { { 0x02af3c6, 0x07792f3, 0x1a3eb86, 0x187f104, 0x2c12ec0, 0x14fb466, 0x2b804e0, 0x08276f1, 0x1b08792, 0x01e6fea } } },
+        { { { 0x2d54245, 0x07b6028, 0x32a5e79, 0x1c3bfb1, 0x02a822d, 0x1085475, 0x2d631e8, 0x06d7aed, 0x1594706, 0x07bd3ec } },
+          { { 0x2300df4, 0x00e9476, 0x3561c72, 0x119ed4a, 0x210e590, 0x1356480, 0x2789685, 0x0329da7, 0x3684817, 0x00e31df } },
+          { { 0x3167bec, 0x197b996, 0x1b850a9, 0x014b686, 0x1656429, 0x0102199, 0x16f9a4c, 0x1eace56, 0x2a4a0bf, 0x15d7ba4 } } },
+        { { { 0x2a4d801, 0x1af1142, 0x33b0ba8, 0x13d299d, 0x30ebc48, 0x18906c2, 0x31d9315, 0x1036713, 0x3e382f5, 0x0802879 } },
+          { { 0x2182fcf, 0x0202422, 0x3b7ba98, 0x014ca44, 0x0c385c3, 0x0f733de, 0x15eaba9, 0x1a000b7, 0x112cd3f, 0x10f539c } },
+          { { 0x2f93ac5, 0x16e59fa, 0x2580a31, 0x0d82b32, 0x1c6f262, 0x07197f5, 0x1c2ecab, 0x1c71fc5, 0x12651e4, 0x0143b29 } } },
+        { { { 0x0e668ea, 0x10e5d98, 0x292f2f5, 0x1f0a9d5, 0x26c66ef, 0x0eca79f, 0x0bcda9a, 0x1cae996, 0x1fa131a, 0x1854702 } },
+          { { 0x13f0c9c, 0x0c6b791, 0x3737868, 0x0f7fb81, 0x3a7d411, 0x1847b3d, 0x0bd64f6, 0x098df9b, 0x021c58f, 0x12c3b9b } },
+          { { 0x1f05d96, 0x157037f, 0x1cf475e, 0x10155a7, 0x37498bb, 0x0171709, 0x15dc389, 0x0616236, 0x3a800f0, 0x07fbc93 } } },
+    },
+#endif
+#if (6 % (16 / ROWS)) == 0
+    {
+        { { { 0x2ddb0a4, 0x018e704, 0x0cd7ab3, 0x1860124, 0x297467c, 0x0fce460, 0x21781ac, 0x1d15a2f, 0x152e095, 0x01e8654 } },
+          { { 0x02ec4de, 0x1ea7167, 0x279652d, 0x1fa7c27, 0x2f22d86, 0x1a8f908, 0x3836c8b, 0x0aba38e, 0x3c7ad32, 0x18ede57 } },
+          { { 0x09e5fc8, 0x1a3c08e, 0x0877506, 0x0167c6f, 0x2410cec, 0x1412643, 0x0feaee2, 0x026f5f4, 0x3d032f0, 0x0fa3fa0 } } },
+        { { { 0x0efd13c, 0x013237a, 0x2e6210e, 0x0719f01, 0x37f146a, 0x060cde3, 0x2aed289, 0x190d4b3, 0x19a6258, 0x08b5822 } },
+          { { 0x170a294, 0x0c56e41, 0x0a925f1, 0x1833842, 0x253c909, 0x1bbfd84, 0x22d70b0, 0x000fbc3, 0x397fac4, 0x1d6e8ed } },
+          { { 0x0cdd196, 0x076f01c, 0x1534c47, 0x05b63ec, 0x183fa2a, 0x1401260, 0x023de75, 0x1cbd671, 0x3b87779, 0x0241341 } } },
+        { { { 0x0f940b9, 0x08b5992, 0x1873e86, 0x065e968, 0x01a54bc, 0x081f931, 0x34bd6d0, 0x14d82ce, 0x0ebaf72, 0x18902ab } },
+          { { 0x1ba919c, 0x187f537, 0x1b55699, 0x1f63a64, 0x33cc76c, 0x186cc51, 0x1e631d6, 0x1c0e58c, 0x3fbc1dd, 0x10f8850 } },
+          { { 0x3a295a0, 0x11d2716, 0x24b5f06, 0x0de51be, 0x35a51f1, 0x1c9316a, 0x09dd3f3, 0x1958cde, 0x238db40, 0x15af6bc } } },
+        { { { 0x19d3bb2, 0x034db30, 0x0d72262, 0x1bb111c, 0x018a9ae, 0x1a14f5c, 0x1c2c8eb, 0x0ea8f93, 0x107e1e5, 0x00ea8c5 } },
+          { { 0x13533eb, 0x0ae78fd, 0x3a806c5, 0x0ab75c9, 0x0ce15a3, 0x15a5572, 0x30a290e, 0x06313c1, 0x2d83741, 0x07492a1 } },
+          { { 0x3d4ce1f, 0x11d923f, 0x1839e9d, 0x182a564, 0x38117ab, 0x109357c, 0x112c10e, 0x10b311a, 0x1c9aeb4, 0x10ec987 } } },
+        { { { 0x0951364, 0x04f62db, 0x28f632a, 0x130005f, 0x253f9c4, 0x14f9567, 0x2886eea, 0x12c8051, 0x2242940, 0x00ad357 } },
+          { { 0x0bb79bb, 0x0c78662, 0x2b3bcab, 0x1ee0bd1, 0x2827b41, 0x03dea33, 0x2177130, 0x1785605, 0x0f5b276, 0x0c98157 } },
+          { { 0x0d18df2, 0x05572ca, 0x0a11694, 0x030c367, 0x3ab3119, 0x0824389, 0x27a49b6, 0x0821893, 0x09ae5d3, 0x09e9b20 } } },
+        { { { 0x03d6954, 0x109c2b1, 0x15659a5, 0x0bb5336, 0x37528f9, 0x1d7036c, 0x12c9234, 0x0b32f3f, 0x203d8c2, 0x088540d } },
+          { { 0x30db188, 0x1baf347, 0x37d1174, 0x1d33ad2, 0x0df4f5c, 0x1f5585a, 0x36fd18a, 0x02fde45, 0x34ff60a, 0x0b2d9c5 } },
+          { { 0x10be1d0, 0x1b37e4e, 0x07e2b3d, 0x0239467, 0x2a50881, 0x094f0f4, 0x08e333d, 0x086d051, 0x373890f, 0x1ec77d2 } } },
+        { { { 0x3f8f58c, 0x1888601, 0x13a8be5, 0x0fea4a0, 0x38d5572, 0x1b6a630, 0x154468f, 0x007b655, 0x05d352e, 0x1a1a609 } },
+          { { 0x3b2a224, 0x0bcb82c, 0x22c1c92, 0x0315aa8, 0x1f1b278, 0x17f7b0e, 0x1c7f106, 0x13242bd, 0x2658fc5, 0x187f3bc } },
+          { { 0x218187a, 0x057614a, 0x19afb76, 0x09c36ed, 0x3cf92ab, 0x1f6c482, 0x1714087, 0x039e897, 0x073daf0, 0x11b3d31 } } },
+        { { { 0x1498140, 0x11ba9fc, 0x10a8427, 0x1c1c95a, 0x1f079fb, 0x029ceba, 0x061c62b, 0x0b76491, 0x250d8cc, 0x04196ab } },
+          { { 0x2c4e5f9, 0x1497b67, 0x260684c, 0x008b481, 0x0397b68, 0x1e5cadc, 0x0d3f965, 0x1e80e56, 0x0d14eb5, 0x0a4e1ef } },
+          { { 0x3200d57, 0x1114977, 0x0e94385, 0x0b5fe53, 0x170ecb7, 0x1834030, 0x3f3d8f0, 0x0e2c140, 0x264f1ce, 0x1a68663 } } },
+    },
+#endif
+#if (7 % (16 / ROWS)) == 0
+    {
+        { { { 0x3ddc09c, 0x1f47bd7, 0x3b9dad9, 0x1efbaba, 0x3a0acfb, 0x01634c2, 0x2b5ae90, 0x17364ba, 0x3b04ed2, 0x0c1071a } },
+          { { 0x368d593, 0x10ac959, 0x1427b4f, 0x0ba2116, 0x2630701, 0x00ace1d, 0x005eae5, 0x0d21e35, 0x2dc088a, 0x0a73746 } },
+          { { 0x156e148, 0x0bcbe76, 0x165c1fe, 0x1acf9ab, 0x2b79e5d, 0x16c025c, 0x34c5daf, 0x14f6348, 0x2814049, 0x0412ef5 } } },
+        { { { 0x27ff163, 0x16697f5, 0x2d0352b, 0x0ea663a, 0x3a4af9a, 0x020f257, 0x001266f, 0x1beb6ff, 0x20fb072, 0x0813ca8 } },
+          { { 0x0f1ed67, 0x03f4c5a, 0x3784a3e, 0x06ec379, 0x0b20477, 0x0d2f2de, 0x22e2182, 0x029289b, 0x17092a7, 0x16fa331 } },
+          { { 0x0ebb079, 0x10ecf4c, 0x1c61902, 0x0d5eb29, 0x1d62455, 0x16d5c31, 0x21e18c7, 0x0c3eca7, 0x17c2791, 0x095c3ec } } },
+        { { { 0x3b8245a, 0x1aa5542, 0x21a2325, 0x1447c82, 0x3239bee, 0x0a4c935, 0x37516c4, 0x0cd0f30, 0x11de018, 0x090717e } },
+          { { 0x0b61575, 0x08d9fcb, 0x04d87df, 0x1b0e6b0, 0x3d7e5bd, 0x1b52562, 0x38a1532, 0x159bd18, 0x2a53030, 0x0f72d97 } },
+          { { 0x0de6caa, 0x005ca50, 0x267451b, 0x18116cb, 0x23efcb3, 0x15b01d1, 0x3fe6e91, 0x01ca2da, 0x1d5fcdf, 0x021083b } } },
+        { { { 0x0f410ce, 0x030d381, 0x0d0a06b, 0x0d13b70, 0x2d84d6d, 0x1b91521, 0x33863f5, 0x1138bb2, 0x3321db8, 0x0135953 } },
+          { { 0x362fa4a, 0x1c82ae0, 0x3cdd9bf, 0x0a710d1, 0x15f8463, 0x039e62b, 0x3cb0bfe, 0x13fbc62, 0x2fbc176, 0x036694f } },
+          { { 0x1bdb5d5, 0x17045b7, 0x3a5abcf, 0x1b46d2e, 0x0a5537a, 0x134a292, 0x3040b99, 0x15ae396, 0x2618991, 0x129e93c } } },
+        { { { 0x3372a4b, 0x0eca46b, 0x0fe4498, 0x1838c0a, 0x24f6a09, 0x0899ef2, 0x242b243, 0x1c67bb0, 0x0223e0e, 0x12a58c5 } },
+          { { 0x3b15f95, 0x1c60097, 0x371fe94, 0x1a35ae0, 0x0f7d97c, 0x0e01112, 0x2784280, 0x10919bf, 0x0cddd31, 0x046d431 } },
+          { { 0x0a4ffd6, 0x009d102, 0x2db34dd, 0x1f4e0ab, 0x1ce385d, 0x102b3f2, 0x1a45b1e, 0x18a2ee6, 0x0dce6bc, 0x13d2f39 } } },
+        { { { 0x09d0b6f, 0x0985bb1, 0x062e61c, 0x07e5761, 0x39159c6, 0x06b4fa6, 0x1a04df9, 0x1e6e91d, 0x2561595, 0x0c10b3b } },
+          { { 0x2242584, 0x1f396b8, 0x153d4e3, 0x0b497ac, 0x09ba9c9, 0x0ea3cf4, 0x104eb8e, 0x03cda43, 0x14b71c0, 0x1cff374 } },
+          { { 0x09bac41, 0x19c1e51, 0x221484f, 0x16de711, 0x2156b8d, 0x1841a7c, 0x33b10af, 0x03ac995, 0x0c9a9ce, 0x0e279d0 } } },
+        { { { 0x30eac28, 0x15e3d95, 0x39c3937, 0x1913c8c, 0x3956c2c, 0x19b91ed, 0x21f55d0, 0x0d20cbf, 0x25d6263, 0x0971097 } },
+          { { 0x0dcb9ce, 0x12ceb8d, 0x215ac9f, 0x11f1a46, 0x25d400c, 0x0c6381b, 0x1f83eb1, 0x0f108b6, 0x39465a6, 0x185514d } },
+          { { 0x1d7de6e, 0x181a9bc, 0x06107e7, 0x13c7031, 0x0fbe5d8, 0x08a6c77, 0x27b1327, 0x0eb3182, 0x0915484, 0x194e682 } } },
+        { { { 0x0bb4a19, 0x136f505, 0x1f1dbb8, 0x1e4c212, 0x066caf0, 0x0ca7169, 0x04feb9b, 0x1b20915, 0x0ef019b, 0x03d94c8 } },
+          { { 0x3d2f773, 0x087dd30, 0x108bd3a, 0x0092e23, 0x3054151, 0x1b99e33, 0x32e747c, 0x10d8c49, 0x2ac5cd1, 0x0471792 } },
+          { { 0x2fde0c6, 0x1b46c72, 0x2303a90, 0x118b1da, 0x13cff9b, 0x0f2939a, 0x05786fd, 0x0e54b35, 0x3dec330, 0x132af1e } } },
+    },
+#endif
+#if (8 % (16 / ROWS)) == 0
+    {
+        { { { 0x0ad8ea2, 0x0c12feb, 0x1108b07, 0x140a45f, 0x0a6dd0f, 0x010c5db, 0x32c1d84, 0x1754563, 0x258eb3b, 0x0ad5127 } },
+          { { 0x33dbe47, 0x09d58ba, 0x0170be7, 0x0a475ed, 0x3dfa8e1, 0x1747299, 0x1f298a2, 0x0aa2018, 0x271627d, 0x04c13a7 } },
+          { { 0x2dc9cfe, 0x005349a, 0x3a16f13, 0x1fc5a46, 0x0f06eac, 0x179c60a, 0x3f0fffc, 0x0d27b41, 0x2d7c2dd, 0x111a378 } } },
+        { { { 0x06307ce, 0x0b631be, 0x1850973, 0x18a1ae8, 0x08444d4, 0x17a772c, 0x03362b2, 0x06a5a95, 0x3e63247, 0x1769909 } },
+          { { 0x019469e, 0x0cd57a5, 0x0ea8a37, 0x0611eee, 0x0cf9b71, 0x07f9962, 0x2db6b22, 0x1ac7274, 0x2ffb44b, 0x1b339f1 } },
+          { { 0x2ac22ca, 0x131a237, 0x3ff0352, 0x1bddd70, 0x2e419bb, 0x159580f, 0x2c61c46, 0x1951115, 0x3fe79f2, 0x163ca6a } } },
+        { { { 0x10ecdf6, 0x0992fdc, 0x127896b, 0x1c23161, 0x2c53394, 0x10b3ab9, 0x1e82b6a, 0x10e06c8, 0x24185b4, 0x1abe4dc } },
+          { { 0x1e73e68, 0x1b3eae3, 0x2d4bd21, 0x0f9bbf3, 0x1500dbe, 0x0015982, 0x0ad85df, 0x1c6de09, 0x04a7f41, 0x15dd8a7 } },
+          { { 0x1c6a888, 0x0009142, 0x12e6644, 0x09a5aac, 0x34b80d8, 0x033289f, 0x11b119e, 0x031f07c, 0x3b0caec, 0x1c07c96 } } },
+        { { { 0x0bec113, 0x03db65f, 0x37c93a3, 0x133a5fe, 0x211281b, 0x04e60d6, 0x2da9156, 0x1ca241e, 0x0050955, 0x1c8296f } },
+          { { 0x0616ced, 0x02c3e39, 0x10fb875, 0x074f12d, 0x3dc0198, 0x0bca59c, 0x1830ffa, 0x17d2c3c, 0x3fbdc40, 0x0b8324a } },
+          { { 0x3805a35, 0x1c250e6, 0x17f8187, 0x1bb1215, 0x3a13a2c, 0x0229346, 0x20bf9ae, 0x01d8d22, 0x3b144ef, 0x03a6e72 } } },
+        { { { 0x1b1beee, 0x1a6f557, 0x3f731bd, 0x1b85391, 0x3270eac, 0x068d791, 0x078df8e, 0x19bc895, 0x191cfd3, 0x0d9b510 } },
+          { { 0x35720ad, 0x0b523fe, 0x1a1df77, 0x15edfc8, 0x3ba0645, 0x15543bf, 0x098a931, 0x17b1a90, 0x2b3f337, 0x0884413 } },
+          { { 0x2bc8c14, 0x105d0fc, 0x18773c7, 0x1e5ac2b, 0x0bb689b, 0x0a7fb97, 0x0178734, 0x0489997, 0x26bc593, 0x1059e93 } } },
+        { { { 0x0ce8fee, 0x189997e, 0x2c59857, 0x0a74406, 0x3a59ffc, 0x1364eee, 0x3373f17, 0x05ede25, 0x30cb7ed, 0x0d2cccd } },
+          { { 0x2f62700, 0x0e74a1d, 0x11d6c87, 0x00073b3, 0x1747675, 0x1fc0684, 0x1a18190, 0x08d4369, 0x3e22552, 0x1e4e2ed } },
+          { { 0x281d6cc, 0x1647ba1, 0x0ea79b8, 0x0e76c2d, 0x3380842, 0x0808883, 0x242e0ac, 0x0bc9dae, 0x2e2dfe6, 0x045dbf1 } } },
+        { { { 0x1770eb8, 0x038a252, 0x0147b72, 0x15567a2, 0x263ef30, 0x0d7879b, 0x2a7ff6f, 0x0d6c426, 0x14f2690, 0x07da8f9 } },
+          { { 0x39c619b, 0x1db3416, 0x0901695, 0x1a5952c, 0x0b77f27, 0x1e94dc4, 0x3d28175, 0x1e687a9, 0x0c677d5, 0x023f0e9 } },
+          { { 0x30734ea, 0x1306674, 0x39acc14, 0x1b188b2, 0x1030216, 0x1598295, 0x19f11fb, 0x01a3c46, 0x0116b90, 0x13cbeb4 } } },
+        { { { 0x33bb638, 0x136476d, 0x38112c5, 0x157e094, 0x39815de, 0x1b61689, 0x0cd9cf9, 0x1d02dec, 0x1f2944e, 0x0d14665 } },
+          { { 0x0ae4e54, 0x1ac9065, 0x1ed8897, 0x088c2bf, 0x17d5071, 0x08d0498, 0x335969b, 0x0f574c3, 0x24972ef, 0x1115212 } },
+          { { 0x3ea7d7c, 0x0bf3427, 0x39ed22a, 0x0a5849a, 0x12a05b2, 0x1285c40, 0x34d5523, 0x076e4b1, 0x2604289, 0x042e272 } } },
+    },
+#endif
+#if (9 % (16 / ROWS)) == 0
+    {
+        { { { 0x2048d13, 0x03f3e8d, 0x3bbb383, 0x19b9c4c, 0x0a45676, 0x192d0aa, 0x39a85cf, 0x13a9b93, 0x2e878a1, 0x09bd5fb } },
+          { { 0x02a0dde, 0x083325e, 0x070aab3, 0x197538c, 0x1547736, 0x1ef238c, 0x1432d98, 0x027afec, 0x3679736, 0x1412a9d } },
+          { { 0x287efb1, 0x0cb3555, 0x22f6195, 0x11123d7, 0x1460345, 0x15a2467, 0x0ad1a27, 0x00d30b8, 0x3d9dba3, 0x1010650 } } },
+        { { { 0x26caadd, 0x05dd0e8, 0x2f9c964, 0x1232455, 0x11e9ad0, 0x1fbc9e3, 0x2a7bd01, 0x0033963, 0x029800d, 0x04b64c5 } },
+          { { 0x3ebcc96, 0x03bae90, 0x395f878, 0x0e13754, 0x235d272, 0x077ccc6, 0x14af70e, 0x081fb3f, 0x1976843, 0x0508287 } },
+          { { 0x337594f, 0x19de674, 0x08f6018, 0x00591d5, 0x178f145, 0x15ff395, 0x0142a71, 0x0024883, 0x314359a, 0x06d3e48 } } },
+        { { { 0x09866b1, 0x1cc0c29, 0x10b2679, 0x0910afa, 0x0947dcf, 0x1def4f6, 0x1552028, 0x07ed570, 0x156f9a2, 0x17fc647 } },
+          { { 0x1150951, 0x1042762, 0x12d47cb, 0x0896f4b, 0x0e73bea, 0x15f3020, 0x1721fcb, 0x1b5c41d, 0x2a7f132, 0x08e6d5c } },
+          { { 0x02d9068, 0x1b50ceb, 0x0a47033, 0x1cafe4c, 0x0a20ead, 0x193eb3d, 0x2b9402a, 0x0d97de8, 0x2a758f3, 0x0083149 } } },
+        { { { 0x042cc89, 0x07bd67c, 0x176dd26, 0x0ec7092, 0x0b16272, 0x0c75997, 0x070c557, 0x0a195b9, 0x0a5602c, 0x114b3f8 } },
+          { { 0x2d8dbbc, 0x00d3e27, 0x08d8ef3, 0x1cee3e5, 0x323caab, 0x1e1b074, 0x1266e51, 0x10ef52a, 0x0615313, 0x00aab31 } },
+          { { 0x07877df, 0x03de819, 0x393f0d4, 0x1387303, 0x2ef1190, 0x1fb11c9, 0x3f512f8, 0x0ef7562, 0x3b304b8, 0x133edf5 } } },
+        { { { 0x389ef12, 0x1a670a5, 0x321bc50, 0x18efab8, 0x0adbb35, 0x0c970d0, 0x1e42bf6, 0x158b868, 0x3c434d3, 0x16c7532 } },
+          { { 0x09b75fe, 0x10f5b2e, 0x3900e56, 0x0cce356, 0x1531a53, 0x0e34c9f, 0x1d51b9f, 0x06c9718, 0x2b39075, 0x052d188 } },
+          { { 0x00a9f26, 0x0c98573, 0x19cb6df, 0x15dc46e, 0x0e93c38, 0x169a705, 0x0a4c599, 0x1ba2260, 0x1258592, 0x0be63dc } } },
+        { { { 0x354a701, 0x0ab9113, 0x2fbc5c2, 0x1854e5e, 0x3f3f8fb, 0x1835de0, 0x3c486ba, 0x0aa99d7, 0x29e7614, 0x076018b } },
+          { { 0x10f9e56, 0x129d32d, 0x2640192, 0x14c7470, 0x16c7fd2, 0x0300f67, 0x16610c1, 0x15f3345, 0x09d806a, 0x0e9ab89 } },
+          { { 0x1907c5a, 0x0b6a16a, 0x1ec4caf, 0x1ac8dc8, 0x0683aa2, 0x134b4e9, 0x30efdef, 0x1fe71a1, 0x28aef25, 0x0a62e33 } } },
+        { { { 0x22165de, 0x09cba82, 0x33ed06f, 0x1a05e7b, 0x0feac1e, 0x138ae70, 0x31b63bb, 0x0fb8a42, 0x1803a7d, 0x1ae989c } },
+          { { 0x3f70cb2, 0x09e54fb, 0x20ec552, 0x153c8ab, 0x12e2724, 0x0a7cf6a, 0x022bd18, 0x090b283, 0x004d5ce, 0x0d2e2a1 } },
+          { { 0x3693335, 0x1bb2d60, 0x3dfb84d, 0x0fb1daf, 0x356a04f, 0x0b22573, 0x1d54d52, 0x18d5452, 0x1d465e1, 0x1c758af } } },
+        { { { 0x1f75ef5, 0x16d76ac, 0x0beb9a5, 0x078b583, 0x35dfe57, 0x149f085, 0x38ff51f, 0x167a28a, 0x21262b2, 0x070ccd8 } },
+          { { 0x378df80, 0x0f30a34, 0x0968ca6, 0x1c8507d, 0x3db6d0d, 0x101da5a, 0x22ffcfb, 0x1749c6c, 0x17f3172, 0x1d357cc } },
+          { { 0x3d9ca81, 0x1f95519, 0x186f50d, 0x1a9594c, 0x0e62df1, 0x1ac623b, 0x2844971, 0x1319b4d, 0x0547e9d, 0x12baf31 } } },
+    },
+#endif
+#if (10 % (16 / ROWS)) == 0
+    {
+        { { { 0x05b2f51, 0x1affecc, 0x2d712dd, 0x16c44ac, 0x34fe4e2, 0x0d5dd25, 0x296e3a3, 0x012be1e, 0x10bb3a0, 0x15e5a0a } },
+          { { 0x058aedc, 0x1e5d3a3, 0x03488c6, 0x1dd5f82, 0x2e7bc8b, 0x180718a, 0x2ecab74, 0x114dc30, 0x3ab143a, 0x0bc6de3 } },
+          { { 0x220e101, 0x0ae10c2, 0x188fee3, 0x0692787, 0x3ce4d96, 0x0e2eed1, 0x284d437, 0x07c39ee, 0x35dc2aa, 0x1f710f8 } } },
+        { { { 0x33e9718, 0x00a9709, 0x3b28b4f, 0x0caf277, 0x0d5db1a, 0x1237d3e, 0x36c028f, 0x15321e5, 0x1d82d50, 0x0113ee0 } },
+          { { 0x07dd9c3, 0x1999962, 0x26ab0b2, 0x18a5d82, 0x3243e6c, 0x12079b1, 0x046fc77, 0x025f8dc, 0x16758cc, 0x1fbdc80 } },
+          { { 0x107e3d9, 0x1c6316a, 0x06b383b, 0x0ee7263, 0x15eccdc, 0x001bb49, 0x0229a59, 0x1a5d94e, 0x3f9c30d, 0x1fde608 } } },
+        { { { 0x0f587ba, 0x107fc1a, 0x11bcd53, 0x0700286, 0x0209e25, 0x1ed5be7, 0x3ccaabe, 0x0de0797, 0x031c06d, 0x192a6c1 } },
+          { { 0x3b513e8, 0x1348e68, 0x11b1066, 0x0a5c8fd, 0x304d9c3, 0x190bd33, 0x2a09b7a, 0x1368256, 0x33d784d, 0x029380d } },
+          { { 0x37d2919, 0x0f5a856, 0x046a5d6, 0x106a9d4, 0x2c2d3da, 0x1a45d47, 0x36721c4, 0x08d8e2a, 0x0ace183, 0x01c69f4 } } },
+        { { { 0x0e14431, 0x10d5488, 0x2283981, 0x0384d8a, 0x0359654, 0x09d5f36, 0x2b10d90, 0x0ba735e, 0x3761775, 0x1f1a6f3 } },
+          { { 0x087ba0b, 0x1cb6ab2, 0x05dda60, 0x02dfd2b, 0x00498a4, 0x0ef768b, 0x2180160, 0x1d399ea, 0x3146ea7, 0x0b0ef31 } },
+          { { 0x0e8295f, 0x035fac1, 0x26fa0fe, 0x1297a87, 0x0436c60, 0x11798d7, 0x0d4d18b, 0x0a3bd2a, 0x3322aca, 0x1bd6a69 } } },
+        { { { 0x3d944be, 0x0753ae8, 0x1f3dce5, 0x00403c5, 0x2367825, 0x1869c03, 0x2ab3d23, 0x16488a4, 0x00ee8d3, 0x00aae5a } },
+          { { 0x341c6c5, 0x040030b, 0x3737174, 0x00867f7, 0x3127de7, 0x0c51c9f, 0x123b81e, 0x1f949df, 0x22e147a, 0x1253886 } },
+          { { 0x1e50d9a, 0x122a177, 0x0493df4, 0x0707dcd, 0x0866889, 0x11ef6d9, 0x08f8eec, 0x1669f41, 0x0bea46b, 0x1ad75db } } },
+        { { { 0x2782522, 0x05045c7, 0x2da7c1f, 0x1a01b49, 0x3c79ab9, 0x0fcc746, 0x19f5168, 0x027c811, 0x1c03dd3, 0x05bee1a } },
+          { { 0x00cd994, 0x1d55b3b, 0x3b7510a, 0x17ae680, 0x191cb71, 0x142b477, 0x0b48a47, 0x06a95e0, 0x3685277, 0x02b8ccf } },
+          { { 0x3b60962, 0x18665cc, 0x0266511, 0x1a6c55f, 0x093f1ca, 0x191d03e, 0x0fbf684, 0x00ea902, 0x0b8f70d, 0x0fe078e } } },
+        { { { 0x317c824, 0x0dfcd57, 0x334815b, 0x01eba14, 0x1d2e48f, 0x1f8eaf7, 0x21f45e5, 0x187baaf, 0x134cded, 0x02b4f8b } },
+          { { 0x2d9affe, 0x043f31f, 0x0e96ff2, 0x109232c, 0x15172e2, 0x10c4704, 0x0bf6925, 0x1327507, 0x0104f50, 0x141443f } },
+          { { 0x36e249d, 0x103f14c, 0x1fb2de1, 0x0ce198e, 0x1d17b78, 0x1eefe1c, 0x37e8004, 0x1d7de5a, 0x0bf0fa1, 0x049f056 } } },
+        { { { 0x251b974, 0x0a3f12b, 0x3d2dbd4, 0x09ba26f, 0x07665cf, 0x13848a8, 0x03405c3, 0x1f2ac48, 0x39d167d, 0x13b6091 } },
+          { { 0x29879a2, 0x05f108b, 0x2c8fec3, 0x0a29651, 0x2912b77, 0x14eaccb, 0x09fe0a5, 0x1ed1368, 0x3d07ef4, 0x0d53be1 } },
+          { { 0x0c5d975, 0x0ed4898, 0x2171fdc, 0x1e75a0d, 0x140d4bb, 0x1f6653c, 0x0561854, 0x06db101, 0x1205392, 0x0c0b64b } } },
+    },
+#endif
+#if (11 % (16 / ROWS)) == 0
+    {
+        { { { 0x1511c9a, 0x136b82d, 0x3e0d456, 0x1495fff, 0x1eb2180, 0x1504234, 0x39baefa, 0x025b303, 0x25da4ea, 0x0fdaf5c } },
+          { { 0x35745c6, 0x02e6adf, 0x0d21d63, 0x172bc3e, 0x008ea2b, 0x1f7afa9, 0x3896d16, 0x027b6e4, 0x25ea5c0, 0x0d965f4 } },
+          { { 0x06058ac, 0x1635ec4, 0x20bee69, 0x0f37e34, 0x365015e, 0x002932d, 0x37c7cc9, 0x0da0c8c, 0x19da60d, 0x1edfb30 } } },
+        { { { 0x37cfa9b, 0x1929469, 0x0ca0db5, 0x0a73d1c, 0x20898d9, 0x12d82db, 0x1ffe6c7, 0x1574137, 0x261bf5c, 0x00efb71 } },
+          { { 0x15c690d, 0x08dcf1a, 0x20dcf18, 0x1303214, 0x37494b9, 0x0e12bd2, 0x2a22225, 0x12ad2a3, 0x3601743, 0x108d6b5 } },
+          { { 0x38975f5, 0x032c341, 0x2530c4b, 0x0a48c4f, 0x124a509, 0x0e36ee4, 0x15a11f1, 0x0d43419, 0x30cdf06, 0x039f38a } } },
+        { { { 0x14b70f9, 0x1bfb7f6, 0x345bfd4, 0x08e0fe5, 0x3c4c301, 0x12fab89, 0x16a3f3f, 0x1d6a910, 0x138aece, 0x1854958 } },
+          { { 0x08c85a3, 0x1190eb1, 0x335b892, 0x1a1e309, 0x3f4d877, 0x0e94d48, 0x18bee9d, 0x0e9413b, 0x1d8fb46, 0x199b829 } },
+          { { 0x070cb0d, 0x0fd9392, 0x16d6557, 0x185522c, 0x33596f3, 0x1e8985d, 0x3275d3a, 0x1dc9357, 0x10d514d, 0x1fc2f20 } } },
+        { { { 0x37213a0, 0x1276b5c, 0x1d31075, 0x1d177b9, 0x27fdbe2, 0x1ec6957, 0x3176ea1, 0x16ea623, 0x3ddec5a, 0x074ea41 } },
+          { { 0x2f4136f, 0x01ae909, 0x206b720, 0x0f2bf01, 0x2359cda, 0x1463c28, 0x06feca7, 0x17eb979, 0x3cf8eed, 0x0347e36 } },
+          { { 0x2d081dc, 0x1a4cc4f, 0x2901742, 0x16c28d9, 0x0a4ca7e, 0x10321cb, 0x0009e01, 0x1bc6025, 0x04a31bf, 0x000046d } } },
+        { { { 0x20aa75c, 0x187da5a, 0x3ad42ca, 0x0e2c295, 0x306fdc9, 0x07966ad, 0x06ebfcd, 0x004c235, 0x22d2851, 0x18f6622 } },
+          { { 0x3c66c0c, 0x1e81b0f, 0x1ba47fb, 0x0726eb0, 0x175038e, 0x08e4d71, 0x1c59c13, 0x0fc2f5c, 0x116e835, 0x0eb1236 } },
+          { { 0x3bd232e, 0x081d4eb, 0x2d06002, 0x1c7eec7, 0x3a4af3a, 0x0e72b91, 0x334d9c2, 0x00cdf02, 0x2b2368a, 0x0cfeb54 } } },
+        { { { 0x022cfe8, 0x1323431, 0x35971a5, 0x1d82d09, 0x01cad3d, 0x0f6a56f, 0x35b7376, 0x03c547f, 0x0cb90a7, 0x0f30d57 } },
+          { { 0x1e41e16, 0x19271b1, 0x2e6aa80, 0x18199fb, 0x02be190, 0x105e746, 0x27e6979, 0x194f655, 0x29a256d, 0x05b03d0 } },
+          { { 0x03e9131, 0x1a510e4, 0x2f9dd36, 0x05bd2b1, 0x2e29253, 0x0ba9244, 0x268d25d, 0x0ad190f, 0x026bae7, 0x18c7abd } } },
+        { { { 0x3700de8, 0x05d6e68, 0x0aa48fb, 0x1df17c0, 0x1ca0317, 0x0e45de1, 0x2c79399, 0x016aa6c, 0x3f665f8, 0x10c7cb1 } },
+          { { 0x266fe9f, 0x0410436, 0x0b4d67d, 0x09360b7, 0x217752d, 0x0f9bf83, 0x2cbb08f, 0x136b787, 0x0b1ea91, 0x1566592 } },
+          { { 0x18f7b19, 0x098d121, 0x2295ac0, 0x17d0f52, 0x052acd4, 0x090a9d7, 0x0220d10, 0x164d120, 0x1f91253, 0x1ec11c5 } } },
+        { { { 0x0e6bac6, 0x1b0a031, 0x361766e, 0x0eb68ec, 0x25c3b4f, 0x10bf944, 0x14aac22, 0x0447613, 0x3a57cde, 0x12342b3 } },
+          { { 0x0f6ae43, 0x16f4a2b, 0x356907d, 0x05beae3, 0x218d5f2, 0x1eb2c44, 0x023b4db, 0x107f808, 0x35c2f65, 0x166cdef } },
+          { { 0x1abe671, 0x1c9b91f, 0x346f6c1, 0x0bb1179, 0x3c74686, 0x1960394, 0x0673f74, 0x17b6841, 0x11336d3, 0x0588d06 } } },
+    },
+#endif
+#if (12 % (16 / ROWS)) == 0
+    {
+        { { { 0x00c1ac0, 0x1732772, 0x086d4cd, 0x1a0d9c5, 0x25e8173, 0x1dbd7c6, 0x1f9df4a, 0x1b574fd, 0x368d7e7, 0x1f682e3 } },
+          { { 0x05675a6, 0x008050e, 0x13d1def, 0x18557ed, 0x289927c, 0x0dfa8cb, 0x0f5a82e, 0x016699a, 0x3a1d4dc, 0x118456a } },
+          { { 0x3b5da76, 0x1c654f0, 0x3d37a81, 0x199088c, 0x076b1bd, 0x0b25960, 0x23010ff, 0x1696079, 0x3e83674, 0x1697e21 } } },
+        { { { 0x0a643b9, 0x18a34e8, 0x00c93d2, 0x0073619, 0x2d70f2c, 0x02dec32, 0x18144be, 0x0e1936a, 0x22d5d1c, 0x10f8deb } },
+          { { 0x0a13d11, 0x0c073dc, 0x21891ec, 0x0a9a86e, 0x33f3ae0, 0x0bca47e, 0x14bea52, 0x0869ee0, 0x16e44d1, 0x0d9a6d9 } },
+          { { 0x1a6e133, 0x18fc1bb, 0x358070f, 0x08ccd09, 0x19cc075, 0x0263811, 0x16c7c1b, 0x137d7ab, 0x0d4fd5e, 0x1a8879b } } },
+        { { { 0x299b2e3, 0x04a4499, 0x2603de8, 0x03b8468, 0x1c74c21, 0x182b0bd, 0x2196808, 0x166c64a, 0x07001e8, 0x114dc6c } },
+          { { 0x046e65f, 0x185c28c, 0x2a49e38, 0x1500691, 0x161c4a8, 0x082b755, 0x1de9e46, 0x1eaed3b, 0x31a195f, 0x161afe7 } },
+          { { 0x2f8790b, 0x0c22357, 0x2fcb4db, 0x0e30849, 0x149e3c3, 0x1a16eb8, 0x1a4e930, 0x02f3580, 0x3790e52, 0x03abec0 } } },
+        { { { 0x375ae1d, 0x0201783, 0x1860a28, 0x1193316, 0x3b00bef, 0x092396d, 0x1ef8f75, 0x176659d, 0x04c5435, 0x112b8cd } },
+          { { 0x348042f, 0x155704d, 0x14232c0, 0x134105d, 0x0866907, 0x1486d0c, 0x0fb9c39, 0x0cc2390, 0x275a02c, 0x0c26b31 } },
+          { { 0x3a543ee, 0x0a26e6e, 0x228539e, 0x0ead64b, 0x3cdd83a, 0x19360aa, 0x172e327, 0x0f1e3b0, 0x1b7f946, 0x18b5488 } } },
+        { { { 0x2f77a3c, 0x175098e, 0x289aeb0, 0x08ff748, 0x37eb9ec, 0x1f7193d, 0x338402c, 0x006f4a0, 0x1383922, 0x053ca69 } },
+          { { 0x0d0936d, 0x10a6706, 0x3418a49, 0x1645060, 0x321aed5, 0x14a8631, 0x282976d, 0x0ac546e, 0x24bc754, 0x1703bf7 } },
+          { { 0x1b2d7f5, 0x05fb709, 0x2081bee, 0x0dccda9, 0x087e5c3, 0x1ed4c62, 0x11a5be1, 0x127db52, 0x1c7bee0, 0x179c8d9 } } },
+        { { { 0x308b33e, 0x0ce418b, 0x257cfb2, 0x12efcf9, 0x16e5967, 0x19ebdfd, 0x39ed68f, 0x136f59f, 0x15cb734, 0x1c2c815 } },
+          { { 0x171217f, 0x0ff01d1, 0x32b6aeb, 0x0e834a6, 0x0dde59d, 0x0191e33, 0x11bddfa, 0x1579341, 0x0c47b4e, 0x1dfc441 } },
+          { { 0x1112c4c, 0x044f155, 0x3f9b7ca, 0x1d4d440, 0x19a2108, 0x0503b47, 0x33bc2af, 0x009488c, 0x0f4a064, 0x038d0e6 } } },
+        { { { 0x24b1928, 0x0c2c24f, 0x2c80312, 0x0739f9f, 0x1f78f84, 0x1395d6f, 0x10bed39, 0x187de86, 0x16ca379, 0x1be2b7b } },
+          { { 0x2cebde8, 0x148b64f, 0x1e0f6cf, 0x0093c11, 0x026cfa1, 0x05b6d8d, 0x3d30fd8, 0x06e4e87, 0x368a362, 0x1795014 } },
+          { { 0x1b7b29a, 0x0048f7f, 0x2523c68, 0x10d10d5, 0x121ee5f, 0x1e6949e, 0x33e817e, 0x1d2ff32, 0x2ec8d3d, 0x1e0379c } } },
+        { { { 0x0f42772, 0x1fabcc0, 0x0354ce3, 0x1515462, 0x23dcbac, 0x1373292, 0x0bfebcb, 0x0f4c534, 0x2d32b58, 0x077bf1a } },
+          { { 0x09ae7bc, 0x0a15142, 0x1a0c15c, 0x078e3fa, 0x0e2377b, 0x04811b8, 0x20aa885, 0x19c8715, 0x3671928, 0x03aca2f } },
+          { { 0x35195a7, 0x0ef86bb, 0x2bdb5eb, 0x1bc8bd8, 0x0523049, 0x0e5da2e, 0x0fbfdbd, 0x10ce532, 0x1bf8dd2, 0x119f480 } } },
+    },
+#endif
+#if (13 % (16 / ROWS)) == 0
+    {
+        { { { 0x396bb14, 0x095e889, 0x3443e75, 0x1bcd83e, 0x220eaea, 0x1a0391c, 0x1f10c18, 0x0bf3ca9, 0x38d8320, 0x17b9fec } },
+          { { 0x25ec54b, 0x103fe73, 0x261b35b, 0x15c6178, 0x00e70a9, 0x0f89515, 0x003e3f8, 0x06d6050, 0x14ac04b, 0x1e25a0c } },
+          { { 0x1446a8e, 0x17f72d0, 0x2ff2a71, 0x14a1a49, 0x296b3f6, 0x03c8c78, 0x3c84693, 0x1a128d5, 0x3c9bca0, 0x187418c } } },
+        { { { 0x0fc73df, 0x0ca2f3e, 0x2ff95b4, 0x0ed3781, 0x3ba11a5, 0x0c2a909, 0x3da6d9c, 0x17b8c6f, 0x2df8067, 0x16c8eb0 } },
+          { { 0x3db2566, 0x1124d7f, 0x1176c6e, 0x04bc05b, 0x316f5ae, 0x13eec03, 0x199402a, 0x0feade3, 0x1847aed, 0x1ba597f } },
+          { { 0x280527b, 0x0ae54fb, 0x1b1b35a, 0x157d6f3, 0x3a23c66, 0x10e82cf, 0x08b820a, 0x1db81ce, 0x39dd95d, 0x1e6e6ee } } },
+        { { { 0x29f7374, 0x05f6ba3, 0x102da33, 0x1c67dd8, 0x280ca8b, 0x1445f0a, 0x25d0936, 0x10699ad, 0x060accb, 0x06ea045 } },
+          { { 0x23126c2, 0x0d5501a, 0x0727d76, 0x1434646, 0x3498e0e, 0x1b97a82, 0x23214f2, 0x028ed81, 0x18c9fd2, 0x14197c5 } },
+          { { 0x0429954, 0x05a7ec3, 0x1ecee10, 0x166bb76, 0x3851802, 0x0e645ba, 0x15cc538, 0x15e45d5, 0x1e58a4f, 0x0e607ce } } },
+        { { { 0x1e66fde, 0x177e95b, 0x1075908, 0x0016202, 0x3854a94, 0x1b4f632, 0x170b1e3, 0x16cbd3a, 0x2edcbc1, 0x0c3d114 } },
+          { { 0x1230a93, 0x0e29d56, 0x28ba31f, 0x14b0737, 0x0745a3d, 0x0a93cb5, 0x2d4a28a, 0x01fa750, 0x3705acd, 0x0e37020 } },
+          { { 0x1759740, 0x149e0b1, 0x3d990ad, 0x14fcce5, 0x3e84d15, 0x0ea4e71, 0x27e39e0, 0x08d3108, 0x1a593f2, 0x18cb668 } } },
+        { { { 0x10c84a7, 0x07f447b, 0x12757e1, 0x0086cfb, 0x18fc1c6, 0x1cf8779, 0x04616ab, 0x1744432, 0x328af64, 0x0e969f7 } },
+          { { 0x007cba6, 0x0dac56e, 0x21afed7, 0x0fde2a7, 0x0608f1f, 0x029670b, 0x2cb81b7, 0x14af763, 0x0847ed4, 0x02c93d2 } },
+          { { 0x11beac7, 0x0b52f94, 0x19e5b9b, 0x1af6936, 0x2914e01, 0x05f9a65, 0x27fcf80, 0x1ec7c33, 0x0475481, 0x0d3f3dd } } },
+        { { { 0x0cfaa98, 0x0c76ade, 0x25e54b7, 0x138c85b, 0x173b689, 0x092608e, 0x0e48885, 0x0961261, 0x042fb37, 0x004668c } },
+          { { 0x09767ca, 0x1f8131e, 0x0cfb832, 0x059c6ca, 0x2e1c537, 0x1f95fa8, 0x3444141, 0x07eeabb, 0x164dfa6, 0x0f4ef70 } },
+          { { 0x0c2177d, 0x0b6273a, 0x2182cf4, 0x1b344ae, 0x19a7697, 0x082a2b0, 0x2cc72d9, 0x14e7eac, 0x31ede20, 0x15b0223 } } },
+        { { { 0x0f38f02, 0x0d7eb09, 0x197ab03, 0x1f5d718, 0x2a42fa7, 0x0cf92f0, 0x0b48145, 0x071f344, 0x2483590, 0x00e2dfa } },
+          { { 0x0a86e17, 0x14f4444, 0x25f466d, 0x1905bad, 0x35fce20, 0x1072988, 0x299bb12, 0x170ff22, 0x2b99108, 0x0259d31 } },
+          { { 0x1316ff8, 0x1be0866, 0x1a9f3e9, 0x017553c, 0x0bd274a, 0x0ef3174, 0x0d2d5ad, 0x16ca12e, 0x025969e, 0x1b978c4 } } },
+        { { { 0x3066222, 0x13ec398, 0x347e660, 0x04c3d65, 0x3ecd41a, 0x01061a3, 0x0923bc6, 0x0c417a3, 0x03d1838, 0x0c162b5 } },
+          { { 0x3e593fb, 0x118bd61, 0x3ce362d, 0x0f652e9, 0x12667b7, 0x0cc3e6d, 0x0e0f00a, 0x1751692, 0x0789a8d, 0x023d445 } },
+          { { 0x17663d0, 0x103ff79, 0x0c20647, 0x1c51175, 0x0170f7c, 0x0994f9a, 0x3c55ed6, 0x19337b8, 0x24efe3d, 0x099527e } } },
+    },
+#endif
+#if (14 % (16 / ROWS)) == 0
+    {
+        { { { 0x13b877f, 0x1803246, 0x20d7765, 0x08706e2, 0x3b38ea2, 0x0de649f, 0x1dbe01b, 0x1c35d9e, 0x0898de9, 0x17d1810 } },
+          { { 0x32fcedb, 0x1621160, 0x30c6e73, 0x04d735f, 0x3e8e35b, 0x14ffef7, 0x206e55b, 0x08bc657, 0x0814bce, 0x1ce4dfa } },
+          { { 0x17bf48d, 0x0dc458a, 0x1069720, 0x116a783, 0x2a744ec, 0x096bdc6, 0x38aaba3, 0x106bc32, 0x2891d5e, 0x0b3e293 } } },
+        { { { 0x3d06ba2, 0x1521f85, 0x32d6596, 0x0e1ca80, 0x09348e0, 0x1978a30, 0x2ce40c2, 0x09edaec, 0x2891d6a, 0x1e9bdfc } },
+          { { 0x3110f67, 0x0ff61c1, 0x2a92db2, 0x09be1c5, 0x3753027, 0x0736a86, 0x0b52661, 0x1412f96, 0x2e58252, 0x08126f5 } },
+          { { 0x29aef49, 0x07f635a, 0x3216fa1, 0x1f2d9ed, 0x3c3b982, 0x19ebfd4, 0x0da9628, 0x083a984, 0x1fc5459, 0x18046ab } } },
+        { { { 0x2cbf890, 0x1b43200, 0x1554c7b, 0x0506ffb, 0x3ef4263, 0x1b6ed99, 0x2857edc, 0x163cc49, 0x3779340, 0x1a73862 } },
+          { { 0x395f83c, 0x1e49b73, 0x20e2bec, 0x10b8944, 0x1f1fa15, 0x18f7a5b, 0x0f3f9cc, 0x13c1ad4, 0x1b0b62f, 0x1bf1730 } },
+          { { 0x29879cb, 0x1d54a2c, 0x2125a3d, 0x1e6a3f4, 0x3746ab8, 0x09f2352, 0x302210c, 0x03e224f, 0x3ae5710, 0x05565ac } } },
+        { { { 0x25124ca, 0x1cc459f, 0x0bbe13f, 0x05ece3a, 0x02f9056, 0x0f556e5, 0x1be913f, 0x0270525, 0x01afb6d, 0x0ea9389 } },
+          { { 0x39179a2, 0x1ce748f, 0x3b9e8c4, 0x18cbeb6, 0x3fe0c48, 0x1f2148a, 0x3ef5aa9, 0x1bb4260, 0x287b5f4, 0x03488dd } },
+          { { 0x23305f5, 0x04e2fca, 0x0d86598, 0x07d1749, 0x12160fe, 0x149d2eb, 0x158d12a, 0x06d8107, 0x2e4687a, 0x0cbf2a9 } } },
+        { { { 0x387ccdf, 0x1e91cc9, 0x07f0640, 0x047909f, 0x05f8c64, 0x00d964e, 0x1766bfb, 0x17d3ab6, 0x36c2600, 0x1d1bd8c } },
+          { { 0x17d9af5, 0x15ba371, 0x3be4f78, 0x16cef85, 0x0f82f4b, 0x0efe4a3, 0x00a6f11, 0x14b9558, 0x0efebd6, 0x1189fa7 } },
+          { { 0x36c971c, 0x0bcd16a, 0x263e7e9, 0x194ca1b, 0x38a23ad, 0x144186d, 0x0b54501, 0x052666b, 0x007ed66, 0x1ed245c } } },
+        { { { 0x153a2dd, 0x106ca37, 0x387ea86, 0x0defa17, 0x2a85e41, 0x1d2f8f4, 0x2c96ca6, 0x06fa1fe, 0x0fe08cd, 0x0740d88 } },
+          { { 0x384b064, 0x17ed72a, 0x38285b0, 0x0944f9d, 0x125e043, 0x115ce0c, 0x16e223d, 0x1af68ed, 0x36f844f, 0x048ae8d } },
+          { { 0x2b4e554, 0x08cb368, 0x30ff840, 0x0108ae8, 0x27b43f5, 0x1d479d9, 0x1da5f3e, 0x18985d5, 0x352b68e, 0x00b1c2f } } },
+        { { { 0x18d72e1, 0x14cafd1, 0x396b59c, 0x103e5b9, 0x16f9da3, 0x08bbde7, 0x3beca77, 0x1406ad9, 0x23feb43, 0x1ac1a5f } },
+          { { 0x10b2fbb, 0x1fb12d7, 0x0595450, 0x0803a44, 0x105715e, 0x1d0815c, 0x2530f60, 0x0bc1c08, 0x0a409ef, 0x098cd3c } },
+          { { 0x362a3c0, 0x03c12b7, 0x08bb6d9, 0x1783b6d, 0x0fbc003, 0x1f0d2a9, 0x25cac24, 0x1f5d393, 0x03441b2, 0x0730dfd } } },
+        { { { 0x1ceaeb9, 0x195bc72, 0x0ad5aec, 0x1c0c72b, 0x0716c57, 0x04c2334, 0x3941942, 0x10704dc, 0x372f196, 0x0e8d1bd } },
+          { { 0x0c7324f, 0x1d59697, 0x1244a11, 0x0072835, 0x3418713, 0x045ac19, 0x055edae, 0x0295f63, 0x0103803, 0x1b1a027 } },
+          { { 0x2da6ac8, 0x15444b8, 0x23dba5a, 0x18d8f42, 0x3a6f40c, 0x0c67262, 0x3a36ec7, 0x0ba12c0, 0x1f6ef7c, 0x016446e } } },
+    },
+#endif
+#if (15 % (16 / ROWS)) == 0
+    {
+        { { { 0x2730383, 0x1fca4d8, 0x1459c36, 0x1ff5e54, 0x12d49e7, 0x1d41314, 0x23bc55f, 0x021fb5f, 0x149c726, 0x1f7ac40 } },
+          { { 0x3387475, 0x01211e3, 0x1678a3e, 0x1a4e5f6, 0x2c976f3, 0x19f2055, 0x189226c, 0x0bad355, 0x2c1c10a, 0x0b1c279 } },
+          { { 0x366ee7a, 0x0abdaa1, 0x1a1d96c, 0x022aa9e, 0x19b2fb0, 0x10be4b5, 0x0009c07, 0x05d4b10, 0x1ff62ce, 0x0239a3a } } },
+        { { { 0x2b8f2f9, 0x1427542, 0x07be5e5, 0x06e2ac9, 0x2b2e486, 0x1766cb9, 0x39a1339, 0x13ea951, 0x1738f71, 0x132c4ef } },
+          { { 0x3c130ad, 0x1540292, 0x2938695, 0x049e85e, 0x234e36d, 0x00a89be, 0x21ecc28, 0x161344b, 0x07eeba3, 0x0bc7cfe } },
+          { { 0x115b64a, 0x1231d79, 0x2071ef0, 0x1d6da54, 0x2965406, 0x1751b50, 0x2989f9f, 0x1dd1841, 0x13c0ae2, 0x066878d } } },
+        { { { 0x196bdbd, 0x05cb375, 0x3881684, 0x01cc777, 0x24f8115, 0x04109b5, 0x0a9a3da, 0x1c693f6, 0x190266a, 0x1cdaf4e } },
+          { { 0x2fa05c3, 0x11d582e, 0x3cc2fa3, 0x106372a, 0x2cf8682, 0x0d66473, 0x14b8c60, 0x090dc6a, 0x11c20c3, 0x10551ac } },
+          { { 0x334b3b4, 0x0cb5424, 0x0ae70aa, 0x05b040b, 0x11bf445, 0x05c8375, 0x3af9821, 0x16b998b, 0x22b87fa, 0x1048a56 } } },
+        { { { 0x293eac6, 0x1549878, 0x19b65cc, 0x019099d, 0x2116a48, 0x100996b, 0x0bae5bc, 0x1b008c1, 0x0d195ad, 0x01d82ee } },
+          { { 0x17ed6e9, 0x066e23d, 0x104a339, 0x1336fc6, 0x14e4f2c, 0x10ad273, 0x31909d9, 0x1c68b9d, 0x2bb52d2, 0x053854f } },
+          { { 0x1e6818a, 0x18685f3, 0x0108827, 0x14f6b4d, 0x15c55b6, 0x0caccb1, 0x39347a3, 0x0be4597, 0x1bc33ac, 0x1acd2fa } } },
+        { { { 0x171f2d3, 0x11a5959, 0x26f423f, 0x02a9873, 0x31b27a1, 0x0fe5035, 0x173d16a, 0x0617c67, 0x362e6dd, 0x006e71e } },
+          { { 0x278c0b2, 0x1cbd90e, 0x04f9e7b, 0x0f79170, 0x130fa5c, 0x1c1b5a3, 0x28e2f24, 0x1a5bd8f, 0x0f0922d, 0x0804b06 } },
+          { { 0x2c89d29, 0x0d57956, 0x0ec7101, 0x0fa2d05, 0x0520c90, 0x0e76c1f, 0x377efe1, 0x1bd07a6, 0x384e4ba, 0x022bd6d } } },
+        { { { 0x1cc2c4b, 0x0c534a2, 0x2f1bc4e, 0x08d1438, 0x12f92f4, 0x03364ce, 0x2946b7d, 0x04dc31a, 0x15afd98, 0x1908f07 } },
+          { { 0x01f2533, 0x1267722, 0x076c506, 0x0d3bc99, 0x2741497, 0x13441f4, 0x16efdb3, 0x0d1b12f, 0x31163a1, 0x0cade75 } },
+          { { 0x1fcb36a, 0x17e367b, 0x0bf3990, 0x079ba37, 0x08af30a, 0x1e5d3cd, 0x2f19c7c, 0x1b99c93, 0x3bc13e2, 0x120297b } } },
+        { { { 0x2ce221f, 0x0533910, 0x32516cc, 0x0626029, 0x1b86677, 0x01cbe03, 0x3da526e, 0x1c0ccc7, 0x07691c8, 0x092cc75 } },
+          { { 0x1622071, 0x079c2c0, 0x1f8a16a, 0x07c58ed, 0x01ad417, 0x15aabcd, 0x1d830f7, 0x1e6258d, 0x200cb7b, 0x11ea89d } },
+          { { 0x015f8c3, 0x107bb70, 0x3ef854a, 0x1f3e349, 0x04693f9, 0x0a278d6, 0x3b309a7, 0x0129e15, 0x1d14dda, 0x1516d61 } } },
+        { { { 0x3b321e1, 0x1393438, 0x3d2ac40, 0x1d147f8, 0x0eea98d, 0x199bd9e, 0x267fead, 0x00e2161, 0x3e64c8d, 0x1348b70 } },
+          { { 0x0d43a0f, 0x1c9d7a8, 0x1d7ccf7, 0x1a044df, 0x2b79a38, 0x079e72e, 0x089a66a, 0x08a8851, 0x0332ba5, 0x03d8be7 } },
+          { { 0x23b5f39, 0x1196275, 0x1ec3f96, 0x1fabe5e, 0x172b9a8, 0x13afa05, 0x161694a, 0x086dfd7, 0x1a36371, 0x0703e80 } } },
+    },
+#endif
+};
+#endif
+
+static void fe_0(fe *h)
+{
+    memset(h, 0, sizeof(*h));
+}
+
+static void fe_1(fe *h)
+{
+    fe_0(h);
+    h->v[0] = 1;
+}
+
+static void fe_neg(fe *h, const fe *f)
+{
+    fe zero;
+
+    fe_0(&zero);
+    fe_sub(h, &zero, f);
+}
+
+/* square n times */
+static void fe_sqn(fe *h, const fe *f, unsigned n)
+{
+    fe_sq(h, f);
+    while (--n) {
+        fe_sq(h, h);
+    }
+}
+
+static bool fe_iszero(const fe *f)
+{
+    uint8_t s[32];
+    uint8_t acc = 0;
+
+    fe_tobytes(s, f);
+    for (unsigned i = 0; i < sizeof(s); i++) {
+        acc |= s[i];
+    }
+    return acc == 0;
+}
+
+static bool fe_isnegative(const fe *f)
+{
+    uint8_t s[32];
+
+    fe_tobytes(s, f);
+    return s[0] & 1;
+}
+
+/* z^(2^250 - 1) in @p h and z^11 in @p z11 */
+static void _fe_pow2250(fe *h, fe *z11, const fe *z)
+{
+    fe t0, t1, t2;
+
+    fe_sq(&t0, z);                  /* 2 */
+    fe_sqn(&t1, &t0, 2);            /* 8 */
+    fe_mul(&t1, z, &t1);            /* 9 */
+    fe_mul(z11, &t0, &t1);          /* 11 */
+    fe_sq(&t0, z11);                /* 22 */
+    fe_mul(&t0, &t1, &t0);          /* 2^5 - 1 */
+    fe_sqn(&t1, &t0, 5);
+    fe_mul(&t0, &t1, &t0);          /* 2^10 - 1 */
+    fe_sqn(&t1, &t0, 10);
+    fe_mul(&t1, &t1, &t0);          /* 2^20 - 1 */
+    fe_sqn(&t2, &t1, 20);
+    fe_mul(&t1, &t2, &t1);          /* 2^40 - 1 */
+    fe_sqn(&t1, &t1, 10);
+    fe_mul(&t0, &t1, &t0);          /* 2^50 - 1 */
+    fe_sqn(&t1, &t0, 50);
+    fe_mul(&t1, &t1, &t0);          /* 2^100 - 1 */
+    fe_sqn(&t2, &t1, 100);
+    fe_mul(&t1, &t2, &t1);          /* 2^200 - 1 */
+    fe_sqn(&t1, &t1, 50);
+    fe_mul(h, &t1, &t0);            /* 2^250 - 1 */
+}
+
+/* z^(p - 2) */
+static void fe_invert(fe *h, const fe *z)
+{
+    fe t, z11;
+
+    _fe_pow2250(&t, &z11, z);
+    fe_sqn(&t, &t, 5);
+    fe_mul(h, &t, &z11);
+}
+
+/* z^((p - 5) / 8) */
+static void fe_pow22523(fe *h, const fe *z)
+{
+    fe t, z11;
+
+    _fe_pow2250(&t, &z11, z);
+    fe_sqn(&t, &t, 2);
+    fe_mul(h, &t, z);
+}
+
+
+static const ge_precomp *_base_row(unsigned row)
+{
+    return row ? _base_rows[row - 1] : _base_row0;
+}
+
+static void _ge_0(ge_p3 *h)
+{
+    fe_0(&h->X);
+    fe_1(&h->Y);
+    fe_1(&h->Z);
+    fe_0(&h->T);
+}
+
+static void _ge_neg(ge_p3 *h)
+{
+    fe_neg(&h->X, &h->X);
+    fe_neg(&h->T, &h->T);
+}
+
+static void _ge_p1p1_to_p2(ge_p3 *r, const ge_p1p1 *p)
+{
+    fe_mul(&r->X, &p->X, &p->T);
+    fe_mul(&r->Y, &p->Y, &p->Z);
+    fe_mul(&r->Z, &p->Z, &p->T);
+}
+
+static void _ge_p1p1_to_p3(ge_p3 *r, const ge_p1p1 *p)
+{
+    _ge_p1p1_to_p2(r, p);
+    fe_mul(&r->T, &p->X, &p->Y);
+}
+
+static void _ge_p3_to_cached(ge_cached *r, const ge_p3 *p)
+{
+    fe_add(&r->YplusX, &p->Y, &p->X);
+    fe_sub(&r->YminusX, &p->Y, &p->X);
+    r->Z = p->Z;
+    fe_mul(&r->T2d, &p->T, &_d2);
+}
+
+/* r = 2 * p, T of p is not used */
+static void _ge_dbl(ge_p1p1 *r, const ge_p3 *p)
+{
+    fe t0;
+
+    fe_sq(&r->X, &p->X);
+    fe_sq(&r->Z, &p->Y);
+    fe_sq(&r->T, &p->Z);
+    fe_add(&r->T, &r->T, &r->T);
+    fe_add(&r->Y, &p->X, &p->Y);
+    fe_sq(&t0, &r->Y);
+    fe_add(&r->Y, &r->Z, &r->X);
+    fe_sub(&r->Z, &r->Z, &r->X);
+    fe_sub(&r->X, &t0, &r->Y);
+    fe_sub(&r->T, &r->T, &r->Z);
+}
+
+/* r = p + q or r = p - q */
+static void _ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q, bool sub)
+{
+    fe t0;
+
+    fe_add(&r->X, &p->Y, &p->X);
+    fe_sub(&r->Y, &p->Y, &p->X);
+    fe_mul(&r->Z, &r->X, sub ? &q->YminusX : &q->YplusX);
+    fe_mul(&r->Y, &r->Y, sub ? &q->YplusX : &q->YminusX);
+    fe_mul(&r->T, &q->T2d, &p->T);
+    fe_mul(&r->X, &p->Z, &q->Z);
+    fe_add(&t0, &r->X, &r->X);
+    fe_sub(&r->X, &r->Z, &r->Y);
+    fe_add(&r->Y, &r->Z, &r->Y);
+    if (sub) {
+        fe_sub(&r->Z, &t0, &r->T);
+        fe_add(&r->T, &t0, &r->T);
+    }
+    else {
+        fe_add(&r->Z, &t0, &r->T);
+        fe_sub(&r->T, &t0, &r->T);
+    }
+}
+
+/* r = p + q or r = p - q with q in affine coordinates */
+static void _ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q, bool sub)
+{
+    fe t0;
+
+    fe_add(&r->X, &p->Y, &p->X);
+    fe_sub(&r->Y, &p->Y, &p->X);
+    fe_mul(&r->Z, &r->X, sub ? &q->yminusx : &q->yplusx);
+    fe_mul(&r->Y, &r->Y, sub ? &q->yplusx : &q->yminusx);
+    fe_mul(&r->T, &q->xy2d, &p->T);
+    fe_add(&t0, &p->Z, &p->Z);
+    fe_sub(&r->X, &r->Z, &r->Y);
+    fe_add(&r->Y, &r->Z, &r->Y);
+    if (sub) {
+        fe_sub(&r->Z, &t0, &r->T);
+        fe_add(&r->T, &t0, &r->T);
+    }
+    else {
+        fe_add(&r->Z, &t0, &r->T);
+        fe_sub(&r->T, &t0, &r->T);
+    }
+}
+
+/* add the entry of a table row selected by the signed digit @p d */
+static void _ge_madd_digit(ge_p3 *r, const ge_precomp *row, int d)
+{
+    ge_p1p1 t;
+
+    if (d) {
+        _ge_madd(&t, r, &row[(d > 0 ? d : -d) - 1], d < 0);
+        _ge_p1p1_to_p3(r, &t);
+    }
+}
+
+/* r = 2^n * p */
+static void _ge_dbln(ge_p3 *r, const ge_p3 *p, unsigned n)
+{
+    ge_p1p1 t;
+
+    *r = *p;
+    while (n--) {
+        _ge_dbl(&t, r);
+        if (n) {
+            _ge_p1p1_to_p2(r, &t);
+        }
+        else {
+            _ge_p1p1_to_p3(r, &t);
+        }
+    }
+}
+
+/* true if 8 * p is the neutral element */
+static bool _ge_is_small(const ge_p3 *p)
+{
+    ge_p3 q;
+    fe t;
+
+    _ge_dbln(&q, p, 3);
+    fe_sub(&t, &q.Y, &q.Z);
+    return fe_iszero(&q.X) && fe_iszero(&t);
+}
+
+/* decode a point, the encoding of y has to be canonical */
+static int _ge_frombytes(ge_p3 *h, const uint8_t *s)
+{
+    fe u, v, v3, vxx, check;
+    uint8_t y[32];
+    bool sign = s[31] >> 7;
+
+    fe_frombytes(&h->Y, s);
+    fe_tobytes(y, &h->Y);
+    y[31] |= s[31] & 0x80;
+    if (memcmp(y, s, sizeof(y))) {
+        return -1;
+    }
+    fe_1(&h->Z);
+
+    /* x^2 = u / v = (y^2 - 1) / (d * y^2 + 1) */
+    fe_sq(&u, &h->Y);
+    fe_mul(&v, &u, &_d);
+    fe_sub(&u, &u, &h->Z);
+    fe_add(&v, &v, &h->Z);
+
+    /* x = u * v^3 * (u * v^7)^((p - 5) / 8) */
+    fe_sq(&v3, &v);
+    fe_mul(&v3, &v3, &v);
+    fe_sq(&h->X, &v3);
+    fe_mul(&h->X, &h->X, &v);
+    fe_mul(&h->X, &h->X, &u);
+    fe_pow22523(&h->X, &h->X);
+    fe_mul(&h->X, &h->X, &v3);
+    fe_mul(&h->X, &h->X, &u);
+
+    fe_sq(&vxx, &h->X);
+    fe_mul(&vxx, &vxx, &v);
+    fe_sub(&check, &vxx, &u);
+    if (!fe_iszero(&check)) {
+        fe_add(&check, &vxx, &u);
+        if (!fe_iszero(&check)) {
+            return -1;
+        }
+        fe_mul(&h->X, &h->X, &_sqrtm1);
+    }
+
+    if (fe_isnegative(&h->X) != sign) {
+        if (fe_iszero(&h->X)) {
+            return -1;
+        }
+        fe_neg(&h->X, &h->X);
+    }
+
+    fe_mul(&h->T, &h->X, &h->Y);
+    return 0;
+}
+
+/* odd multiples p, 3p, 5p, ... */
+static void _ge_odd_multiples(ge_cached *c, const ge_p3 *p)
+{
+    ge_p1p1 t;
+    ge_p3 p2, u;
+
+    _ge_p3_to_cached(&c[0], p);
+    _ge_dbl(&t, p);
+    _ge_p1p1_to_p3(&p2, &t);
+    for (unsigned i = 1; i < ODD; i++) {
+        _ge_add(&t, &p2, &c[i - 1], false);
+        _ge_p1p1_to_p3(&u, &t);
+        _ge_p3_to_cached(&c[i], &u);
+    }
+}
+
+/* convert points to affine coordinates with a single inversion */
+static void _ge_to_precomp(ge_precomp *r, const ge_p3 *p, unsigned num)
+{
+    fe acc[8];
+    fe inv, zinv, x, y;
+
+    acc[0] = p[0].Z;
+    for (unsigned i = 1; i < num; i++) {
+        fe_mul(&acc[i], &acc[i - 1], &p[i].Z);
+    }
+    fe_invert(&inv, &acc[num - 1]);
+
+    for (unsigned i = num; i-- > 0;) {
+        if (i) {
+            fe_mul(&zinv, &inv, &acc[i - 1]);
+            fe_mul(&inv, &inv, &p[i].Z);
+        }
+        else {
+            zinv = inv;
+        }
+        fe_mul(&x, &p[i].X, &zinv);
+        fe_mul(&y, &p[i].Y, &zinv);
+        fe_add(&r[i].yplusx, &y, &x);
+        fe_sub(&r[i].yminusx, &y, &x);
+        fe_mul(&r[i].xy2d, &x, &y);
+        fe_mul(&r[i].xy2d, &r[i].xy2d, &_d2);
+    }
+}
+
+/*
+ * Arithmetic modulo the group order L = 2^252 + 27742317777372353535851937790883648493
+ * on little endian byte strings, based on TweetNaCl (public domain)
+ */
+static const int64_t _L[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+    0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+};
+
+static void _sc_reduce(uint8_t *r, int64_t *x)
+{
+    int64_t carry;
+    unsigned j;
+
+    for (unsigned i = 63; i >= 32; i--) {
+        carry = 0;
+        for (j = i - 32; j < i - 12; j++) {
+            x[j] += carry - 16 * x[i] * _L[j - (i - 32)];
+            carry = (x[j] + 128) >> 8;
+            x[j] -= carry * 256;
+        }
+        x[j] += carry;
+        x[i] = 0;
+    }
+    carry = 0;
+    for (j = 0; j < 32; j++) {
+        x[j] += carry - (x[31] >> 4) * _L[j];
+        carry = x[j] >> 8;
+        x[j] &= 255;
+    }
+    for (j = 0; j < 32; j++) {
+        x[j] -= carry * _L[j];
+    }
+    for (j = 0; j < 32; j++) {
+        x[j + 1] += x[j] >> 8;
+        r[j] = x[j] & 255;
+    }
+}
+
+/* r = h mod L for a 64 byte @p h */
+static void _sc_reduce64(uint8_t *r, const uint8_t *h)
+{
+    int64_t x[64];
+
+    for (unsigned i = 0; i < 64; i++) {
+        x[i] = h[i];
+    }
+    _sc_reduce(r, x);
+}
+
+/* r = a * b + c mod L */
+static void _sc_muladd(uint8_t *r, const uint8_t *a, const uint8_t *b,
+                       const uint8_t *c)
+{
+    int64_t x[64] = { 0 };
+
+    for (unsigned i = 0; i < 32; i++) {
+        x[i] = c[i];
+    }
+    for (unsigned i = 0; i < 32; i++) {
+        for (unsigned j = 0; j < 32; j++) {
+            x[i + j] += (int64_t)a[i] * b[j];
+        }
+    }
+    _sc_reduce(r, x);
+}
+
+static bool _sc_is_canonical(const uint8_t *s)
+{
+    for (unsigned i = 32; i-- > 0;) {
+        if (s[i] != _L[i]) {
+            return s[i] < _L[i];
+        }
+    }
+    return false;
+}
+
+/* width 4 NAF with digits in [-7, 7], see ref10 slide() */
+static void _sc_naf(int8_t *r, const uint8_t *a)
+{
+    for (unsigned i = 0; i < 256; i++) {
+        r[i] = 1 & (a[i >> 3] >> (i & 7));
+    }
+    for (unsigned i = 0; i < 256; i++) {
+        if (!r[i]) {
+            continue;
+        }
+        for (unsigned b = 1; b <= 3 && i + b < 256; b++) {
+            if (!r[i + b]) {
+                continue;
+            }
+            if (r[i] + (r[i + b] << b) <= 2 * (int)ODD - 1) {
+                r[i] += r[i + b] << b;
+                r[i + b] = 0;
+            }
+            else if (r[i] - (r[i + b] << b) >= 1 - 2 * (int)ODD) {
+                r[i] -= r[i + b] << b;
+                for (unsigned k = i + b; k < 256; k++) {
+                    if (!r[k]) {
+                        r[k] = 1;
+                        break;
+                    }
+                    r[k] = 0;
+                }
+            }
+            else {
+                break;
+            }
+        }
+    }
+}
+
+/* signed radix 16 digits in [-8, 8], the scalar has to be below 2^255 */
+static void _sc_radix16(int8_t *e, const uint8_t *a)
+{
+    int8_t carry = 0;
+
+    for (unsigned i = 0; i < 32; i++) {
+        e[2 * i] = a[i] & 15;
+        e[2 * i + 1] = a[i] >> 4;
+    }
+    for (unsigned i = 0; i < 63; i++) {
+        e[i] += carry;
+        carry = (e[i] + 8) >> 4;
+        e[i] -= carry * 16;
+    }
+    e[63] += carry;
+}
+
+/* one term of a multi-scalar multiplication */
+typedef struct {
+    int8_t naf[256];                /* NAF of the scalar */
+    const ge_precomp *pre;          /* multiples 1 to 8 of the point, or */
+    ge_cached odd[ODD];             /* odd multiples if pre is NULL */
+} _term_t;
+
+/* r = sum of all terms with Straus' method */
+static void _ge_multi_mul(ge_p3 *r, const _term_t *terms, unsigned num)
+{
+    ge_p1p1 t;
+    int i;
+
+    _ge_0(r);
+    for (i = 255; i >= 0; i--) {
+        unsigned k;
+
+        for (k = 0; k < num && !terms[k].naf[i]; k++) {}
+        if (k < num) {
+            break;
+        }
+    }
+
+    for (; i >= 0; i--) {
+        _ge_dbl(&t, r);
+        for (unsigned k = 0; k < num; k++) {
+            int d = terms[k].naf[i];
+
+            if (!d) {
+                continue;
+            }
+            _ge_p1p1_to_p3(r, &t);
+            if (terms[k].pre) {
+                _ge_madd(&t, r, &terms[k].pre[(d > 0 ? d : -d) - 1], d < 0);
+            }
+            else {
+                _ge_add(&t, r, &terms[k].odd[(d > 0 ? d : -d) / 2], d < 0);
+            }
+        }
+        if (i) {
+            _ge_p1p1_to_p2(r, &t);
+        }
+        else {
+            _ge_p1p1_to_p3(r, &t);
+        }
+    }
+}
+
+/* h = SHA-512(R || A || M) mod L */
+static void _hram(uint8_t *h, const uint8_t *sig, const uint8_t *pk,
+                  const void *msg, size_t len)
+{
+    sha512_context_t ctx;
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+
+    sha512_init(&ctx);
+    sha512_update(&ctx, sig, 32);
+    sha512_update(&ctx, pk, ED25519_PUBLIC_KEY_BYTES);
+    sha512_update(&ctx, msg, len);
+    sha512_final(&ctx, digest);
+    _sc_reduce64(h, digest);
+}
+
+/* true if 8 * (p - R) is the neutral element */
+static bool _check(const ge_p3 *p, const ge_p3 *R)
+{
+    ge_cached c;
+    ge_p1p1 t;
+    ge_p3 q;
+
+    _ge_p3_to_cached(&c, R);
+    _ge_add(&t, p, &c, true);
+    _ge_p1p1_to_p3(&q, &t);
+    return _ge_is_small(&q);
+}
+
+int ed25519_verify(const uint8_t *sig, const void *msg, size_t len,
+                   const uint8_t *pk)
+{
+    _term_t terms[2];
+    ge_p3 A, R, p;
+    uint8_t h[32];
+
+    if (_ge_frombytes(&A, pk)) {
+        return -EINVAL;
+    }
+    if (!_sc_is_canonical(sig + 32) || _ge_frombytes(&R, sig)) {
+        return -EBADMSG;
+    }
+    _hram(h, sig, pk, msg, len);
+
+    /* p = s * B - h * A */
+    _sc_naf(terms[0].naf, sig + 32);
+    terms[0].pre = _base_row0;
+    _sc_naf(terms[1].naf, h);
+    terms[1].pre = NULL;
+    _ge_neg(&A);
+    _ge_odd_multiples(terms[1].odd, &A);
+    _ge_multi_mul(&p, terms, 2);
+
+    return _check(&p, &R) ? 0 : -EBADMSG;
+}
+
+int ed25519_key_init(ed25519_key_t *key, const uint8_t *pk)
+{
+    ge_p3 p;
+
+    if (_ge_frombytes(&p, pk)) {
+        return -EINVAL;
+    }
+    memcpy(key->pk, pk, sizeof(key->pk));
+    _ge_neg(&p);
+
+    for (unsigned row = 0; row < ROWS; row++) {
+        ge_p3 m[8];
+        ge_cached c;
+        ge_p1p1 t;
+
+        /* m[i] = (i + 1) * 16^(PASSES * row) * -A */
+        m[0] = p;
+        _ge_p3_to_cached(&c, &p);
+        _ge_dbl(&t, &p);
+        _ge_p1p1_to_p3(&m[1], &t);
+        for (unsigned i = 2; i < 8; i++) {
+            _ge_add(&t, &m[i - 1], &c, false);
+            _ge_p1p1_to_p3(&m[i], &t);
+        }
+        _ge_to_precomp(key->table[row], m, 8);
+
+        if (row < ROWS - 1) {
+            _ge_dbln(&p, &p, 4 * PASSES);
+        }
+    }
+    return 0;
+}
+
+int ed25519_verify_key(const ed25519_key_t *key, const uint8_t *sig,
+                       const void *msg, size_t len)
+{
+    int8_t es[64], eh[64];
+    uint8_t h[32];
+    ge_p3 R, p;
+
+    if (!_sc_is_canonical(sig + 32) || _ge_frombytes(&R, sig)) {
+        return -EBADMSG;
+    }
+    _hram(h, sig, key->pk, msg, len);
+    _sc_radix16(es, sig + 32);
+    _sc_radix16(eh, h);
+
+    /* p = s * B - h * A, both tables are evaluated in the same passes */
+    _ge_0(&p);
+    for (unsigned pass = PASSES; pass-- > 0;) {
+        if (pass != PASSES - 1) {
+            _ge_dbln(&p, &p, 4);
+        }
+        for (unsigned row = 0; row < ROWS; row++) {
+            _ge_madd_digit(&p, _base_row(row), es[row * PASSES + pass]);
+            _ge_madd_digit(&p, key->table[row], eh[row * PASSES + pass]);
+        }
+    }
+
+    return _check(&p, &R) ? 0 : -EBADMSG;
+}
+
+/*
+ * Checks sum(z_i * s_i) * B - sum(z_i * h_i * A_i) - sum(z_i * R_i) = 0 with
+ * 128 bit coefficients z_i derived from a hash of the whole chunk.
+ */
+static int _verify_chunk(const ed25519_batch_entry_t *entries, unsigned num)
+{
+    /* the base point, the keys and the R of each signature */
+    _term_t terms[2 * BATCH + 1];
+    uint8_t scalars[2 * BATCH + 1][32];
+    const uint8_t *pks[2 * BATCH + 1];
+    uint8_t h[BATCH][32];
+    uint8_t seed[SHA512_DIGEST_LENGTH];
+    uint8_t z[SHA512_DIGEST_LENGTH];
+    unsigned used = 1;
+    sha512_context_t ctx;
+    ge_p3 p;
+
+    sha512_init(&ctx);
+    for (unsigned i = 0; i < num; i++) {
+        const ed25519_batch_entry_t *e = &entries[i];
+        const uint8_t *pk = e->key ? e->key->pk : e->pk;
+
+        if (!_sc_is_canonical(e->sig + 32)) {
+            return -EBADMSG;
+        }
+        _hram(h[i], e->sig, pk, e->msg, e->len);
+        sha512_update(&ctx, e->sig, ED25519_SIGNATURE_BYTES);
+        sha512_update(&ctx, pk, ED25519_PUBLIC_KEY_BYTES);
+        sha512_update(&ctx, h[i], sizeof(h[i]));
+    }
+    sha512_final(&ctx, seed);
+
+    memset(scalars[0], 0, sizeof(scalars[0]));
+    terms[0].pre = _base_row0;
+    pks[0] = NULL;
+
+    for (unsigned i = 0; i < num; i++) {
+        const ed25519_batch_entry_t *e = &entries[i];
+        const uint8_t *pk = e->key ? e->key->pk : e->pk;
+        _term_t *r = &terms[used];
+        uint8_t *zi;
+        unsigned a;
+        ge_p3 q;
+
+        /* four coefficients per hash */
+        if (i % 4 == 0) {
+            uint8_t idx = i / 4;
+
+            sha512_init(&ctx);
+            sha512_update(&ctx, seed, sizeof(seed));
+            sha512_update(&ctx, &idx, sizeof(idx));
+            sha512_final(&ctx, z);
+        }
+        zi = scalars[used];
+        memset(zi, 0, 32);
+        memcpy(zi, &z[16 * (i % 4)], 16);
+        zi[0] |= 1;
+
+        if (_ge_frombytes(&q, e->sig)) {
+            return -EBADMSG;
+        }
+        _ge_neg(&q);
+        r->pre = NULL;
+        _ge_odd_multiples(r->odd, &q);
+        pks[used++] = NULL;
+
+        /* signatures of the same key share a term */
+        for (a = 1; a < used; a++) {
+            if (pks[a] && !memcmp(pks[a], pk, ED25519_PUBLIC_KEY_BYTES)) {
+                break;
+            }
+        }
+        if (a == used) {
+            _term_t *t = &terms[used];
+
+            if (e->key) {
+                t->pre = e->key->table[0];
+            }
+            else {
+                if (_ge_frombytes(&q, pk)) {
+                    return -EBADMSG;
+                }
+                _ge_neg(&q);
+                t->pre = NULL;
+                _ge_odd_multiples(t->odd, &q);
+            }
+            memset(scalars[used], 0, 32);
+            pks[used++] = pk;
+        }
+
+        _sc_muladd(scalars[a], zi, h[i], scalars[a]);
+        _sc_muladd(scalars[0], zi, e->sig + 32, scalars[0]);
+    }
+
+    for (unsigned k = 0; k < used; k++) {
+        _sc_naf(terms[k].naf, scalars[k]);
+    }
+    _ge_multi_mul(&p, terms, used);
+
+    return _ge_is_small(&p) ? 0 : -EBADMSG;
+}
+
+int ed25519_verify_batch(const ed25519_batch_entry_t *entries, size_t num)
+{
+    while (num) {
+        unsigned n = (num < BATCH) ? num : BATCH;
+
+        if (_verify_chunk(entries, n)) {
+            return -EBADMSG;
+        }
+        entries += n;
+        num -= n;
+    }
+    return 0;
+}
@@ -55,9 +55,7 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
                                    block_size : length - offset;
 
         /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (int i = 0; i < block_size_input; ++i) {
-            mac[i] ^= input[offset + i];
-        }
+        crypto_xor(mac, mac, &input[offset], block_size_input);
 
         if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
             return CIPHER_ERR_ENC_FAILED;
@@ -233,9 +231,7 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
     }
 
     /* auth value: mac ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        output[len + i] = mac[i] ^ stream_block[i];
-    }
+    crypto_xor(&output[len], mac, stream_block, mac_length);
 
     return len + mac_length;
 }
@@ -302,9 +298,7 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
     }
 
     /* mac = input[plain_len...plain_len+mac_length] ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        mac_recv[i] = input[len + i] ^ stream_block[i];
-    }
+    crypto_xor(mac_recv, &input[len], stream_block, mac_length);
 
     if (!crypto_equals(mac_recv, mac, mac_length)) {
         return CCM_ERR_INVALID_CBC_MAC;
@@ -312,3 +306,253 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
 
     return plain_len;
 }
+
+/* Absorb data into the running CBC-MAC, full blocks are encrypted at once */
+static int _ccm_mac_update(cipher_ccm_ctx_t *ctx, const uint8_t *data,
+                           size_t len)
+{
+    while (len > 0) {
+        size_t chunk = CCM_BLOCK_SIZE - ctx->mac_pos;
+
+        if (chunk > len) {
+            chunk = len;
+        }
+
+        crypto_xor(&ctx->mac[ctx->mac_pos], &ctx->mac[ctx->mac_pos], data,
+                   chunk);
+        ctx->mac_pos += chunk;
+        data += chunk;
+        len -= chunk;
+
+        if (ctx->mac_pos == CCM_BLOCK_SIZE) {
+            if (cipher_encrypt(ctx->cipher, ctx->mac, ctx->mac) != 1) {
+                return CIPHER_ERR_ENC_FAILED;
+            }
+            ctx->mac_pos = 0;
+        }
+    }
+    return 0;
+}
+
+/* Zero pad the last block of a section (adata, payload) of the CBC-MAC */
+static int _ccm_mac_pad(cipher_ccm_ctx_t *ctx)
+{
+    if (ctx->mac_pos > 0) {
+        if (cipher_encrypt(ctx->cipher, ctx->mac, ctx->mac) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+        ctx->mac_pos = 0;
+    }
+    return 0;
+}
+
+static int _ccm_ctr_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                           size_t len, uint8_t *output)
+{
+    size_t offset = 0;
+
+    /* use up the key stream left over from the previous chunk */
+    while (offset < len && ctx->stream_pos < CCM_BLOCK_SIZE) {
+        output[offset] = input[offset] ^ ctx->stream[ctx->stream_pos++];
+        offset++;
+    }
+
+    /* full blocks are handed to the CTR mode in one go */
+    size_t full = (len - offset) & ~(size_t)(CCM_BLOCK_SIZE - 1);
+    if (full > 0) {
+        if (cipher_encrypt_ctr(ctx->cipher, ctx->counter, ctx->nonce_len,
+                               &input[offset], full, &output[offset]) < 0) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+        offset += full;
+    }
+
+    /* keep the key stream of a trailing partial block for the next chunk */
+    if (offset < len) {
+        if (cipher_encrypt(ctx->cipher, ctx->counter, ctx->stream) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+        crypto_block_inc_ctr(ctx->counter, CCM_BLOCK_SIZE - ctx->nonce_len);
+        ctx->stream_pos = 0;
+        while (offset < len) {
+            output[offset] = input[offset] ^ ctx->stream[ctx->stream_pos++];
+            offset++;
+        }
+    }
+
+    return len;
+}
+
+int cipher_ccm_init(cipher_ccm_ctx_t *ctx, const cipher_t *cipher,
+                    uint32_t auth_data_len, uint8_t mac_length,
+                    uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len,
+                    size_t input_len)
+{
+    uint8_t zero_block[CCM_BLOCK_SIZE] = { 0 };
+    int res;
+
+    if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
+        return CCM_ERR_INVALID_MAC_LENGTH;
+    }
+
+    if (length_encoding < 2 || length_encoding > 8 ||
+        !_fits_in_nbytes(input_len, length_encoding)) {
+        return CCM_ERR_INVALID_LENGTH_ENCODING;
+    }
+
+    if (auth_data_len > 0xFEFF) {
+        DEBUG("UNSUPPORTED Adata length: %" PRIu32 "\n", auth_data_len);
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+
+    assert(cipher_get_block_size(cipher) == CCM_BLOCK_SIZE);
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->cipher = cipher;
+    ctx->mac_length = mac_length;
+    ctx->nonce_len = nonce_len;
+    ctx->auth_data_left = auth_data_len;
+    ctx->input_left = input_len;
+    ctx->stream_pos = CCM_BLOCK_SIZE;
+
+    /* Create B0, encrypt it (X1) and use it as start of the MAC */
+    if (ccm_create_mac_iv(cipher, auth_data_len > 0, mac_length,
+                          length_encoding, nonce, nonce_len, input_len,
+                          ctx->mac) < 0) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+
+    /* The adata is prefixed with its length as two octets */
+    if (auth_data_len > 0) {
+        uint8_t len_encoded[2] = { auth_data_len >> 8, auth_data_len & 0xFF };
+
+        res = _ccm_mac_update(ctx, len_encoded, sizeof(len_encoded));
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    /* Compute first stream block */
+    ctx->counter[0] = length_encoding - 1;
+    memcpy(&ctx->counter[1], nonce,
+           min(nonce_len, (size_t)15 - length_encoding));
+    res = cipher_encrypt_ctr(cipher, ctx->counter, CCM_BLOCK_SIZE,
+                             zero_block, CCM_BLOCK_SIZE, ctx->s0);
+    if (res < 0) {
+        return res;
+    }
+    crypto_block_inc_ctr(ctx->counter, CCM_BLOCK_SIZE - nonce_len);
+
+    return 0;
+}
+
+int cipher_ccm_update_aad(cipher_ccm_ctx_t *ctx,
+                          const uint8_t *auth_data, size_t len)
+{
+    int res;
+
+    if (len > ctx->auth_data_left) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+
+    res = _ccm_mac_update(ctx, auth_data, len);
+    if (res < 0) {
+        return res;
+    }
+
+    ctx->auth_data_left -= len;
+    if (ctx->auth_data_left == 0) {
+        return _ccm_mac_pad(ctx);
+    }
+    return 0;
+}
+
+static int _ccm_check_update(const cipher_ccm_ctx_t *ctx, size_t len)
+{
+    if (ctx->auth_data_left > 0 || len > ctx->input_left) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+    return 0;
+}
+
+int cipher_ccm_encrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output)
+{
+    int res = _ccm_check_update(ctx, len);
+
+    if (res < 0) {
+        return res;
+    }
+
+    /* MAC the plaintext before it may get overwritten by the ciphertext */
+    res = _ccm_mac_update(ctx, input, len);
+    if (res < 0) {
+        return res;
+    }
+    ctx->input_left -= len;
+
+    return _ccm_ctr_update(ctx, input, len, output);
+}
+
+int cipher_ccm_decrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output)
+{
+    int res = _ccm_check_update(ctx, len);
+
+    if (res < 0) {
+        return res;
+    }
+
+    res = _ccm_ctr_update(ctx, input, len, output);
+    if (res < 0) {
+        return res;
+    }
+    ctx->input_left -= len;
+
+    /* MAC the plaintext after decrypting it */
+    if (_ccm_mac_update(ctx, output, len) < 0) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+    return res;
+}
+
+/* Compute the final tag: mac ^ first stream block */
+static int _ccm_finish(cipher_ccm_ctx_t *ctx, uint8_t *tag)
+{
+    int res;
+
+    if (ctx->auth_data_left > 0 || ctx->input_left > 0) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+
+    res = _ccm_mac_pad(ctx);
+    if (res < 0) {
+        return res;
+    }
+
+    crypto_xor(tag, ctx->mac, ctx->s0, ctx->mac_length);
+    return ctx->mac_length;
+}
+
+int cipher_ccm_encrypt_finish(cipher_ccm_ctx_t *ctx, uint8_t *mac)
+{
+    int res = _ccm_finish(ctx, mac);
+
+    crypto_secure_wipe(ctx, sizeof(*ctx));
+    return res;
+}
+
+int cipher_ccm_decrypt_finish(cipher_ccm_ctx_t *ctx, const uint8_t *mac)
+{
+    uint8_t tag[CCM_MAC_MAX_LEN];
+    int res = _ccm_finish(ctx, tag);
+
+    if (res >= 0) {
+        res = crypto_equals(tag, mac, res) ? 0 : CCM_ERR_INVALID_CBC_MAC;
+    }
+
+    crypto_secure_wipe(tag, sizeof(tag));
+    crypto_secure_wipe(ctx, sizeof(*ctx));
+    return res;
+}
@@ -21,8 +21,6 @@
 #include <string.h>
 #include "crypto/poly1305.h"
 
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4);
-
 static uint32_t u8to32(const uint8_t *p)
 {
     return
@@ -49,7 +47,71 @@ static void _clear_c(poly1305_ctx_t *ctx)
     ctx->c_idx = 0;
 }
 
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
+#ifdef __SIZEOF_INT128__
+typedef unsigned __int128 uint128_t;
+
+static uint64_t u8to64(const uint8_t *p)
+{
+    return (uint64_t)u8to32(p) | ((uint64_t)u8to32(p + 4) << 32);
+}
+
+static void u64to8(uint8_t *p, uint64_t v)
+{
+    u32to8(p, (uint32_t)v);
+    u32to8(p + 4, (uint32_t)(v >> 32));
+}
+
+static void poly1305_blocks(poly1305_ctx_t *ctx, const uint8_t *data,
+                            size_t blocks, uint8_t c4)
+{
+    const uint64_t r0 = ctx->r[0];
+    const uint64_t r1 = ctx->r[1];
+    /* r1 * 2^128 = r1 / 4 * 5 * 2^130 / 2^130 mod p, r1 is a multiple of 4 */
+    const uint64_t s1 = r1 + (r1 >> 2);
+
+    uint64_t h0 = ctx->h[0];
+    uint64_t h1 = ctx->h[1];
+    uint64_t h2 = ctx->h[2];
+
+    while (blocks--) {
+        uint128_t d0, d1;
+
+        /* h += c */
+        d0 = (uint128_t)h0 + u8to64(data);
+        h0 = (uint64_t)d0;
+        d1 = (uint128_t)h1 + (uint64_t)(d0 >> 64) + u8to64(data + 8);
+        h1 = (uint64_t)d1;
+        h2 += (uint64_t)(d1 >> 64) + c4;
+
+        /* h *= r, h2 is only a few bits wide */
+        d0 = (uint128_t)h0 * r0 + (uint128_t)h1 * s1;
+        d1 = (uint128_t)h0 * r1 + (uint128_t)h1 * r0 + (uint128_t)h2 * s1;
+        h2 = h2 * r0;
+
+        h0 = (uint64_t)d0;
+        d1 += (uint64_t)(d0 >> 64);
+        h1 = (uint64_t)d1;
+        h2 += (uint64_t)(d1 >> 64);
+
+        /* partial reduction modulo 2^130 - 5: bits above 2^130 times 5 */
+        const uint64_t c = (h2 >> 2) + (h2 & ~(uint64_t)3);
+        h2 &= 3;
+        d0 = (uint128_t)h0 + c;
+        h0 = (uint64_t)d0;
+        d1 = (uint128_t)h1 + (uint64_t)(d0 >> 64);
+        h1 = (uint64_t)d1;
+        h2 += (uint64_t)(d1 >> 64);
+
+        data += POLY1305_BLOCK_SIZE;
+    }
+
+    ctx->h[0] = h0;
+    ctx->h[1] = h1;
+    ctx->h[2] = h2;
+}
+#else /* !__SIZEOF_INT128__ */
+static void poly1305_blocks(poly1305_ctx_t *ctx, const uint8_t *data,
+                            size_t blocks, uint8_t c4)
 {
     /* Local copies */
     const uint32_t r0 = ctx->r[0];
@@ -62,34 +124,64 @@ static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
     const uint32_t rr2 = (r2 >> 2) + r2;
     const uint32_t rr3 = (r3 >> 2) + r3;
 
-    /* s = h + c, without carry propagation */
-    const uint64_t s0 = ctx->h[0] + (uint64_t)ctx->c[0];
-    const uint64_t s1 = ctx->h[1] + (uint64_t)ctx->c[1];
-    const uint64_t s2 = ctx->h[2] + (uint64_t)ctx->c[2];
-    const uint64_t s3 = ctx->h[3] + (uint64_t)ctx->c[3];
-    const uint32_t s4 = ctx->h[4] + c4;
-
-    /* (h + c) * r, without carry propagation */
-    const uint64_t x0 = s0 * r0 + s1 * rr3 + s2 * rr2 + s3 * rr1 + s4 * rr0;
-    const uint64_t x1 = s0 * r1 + s1 * r0  + s2 * rr3 + s3 * rr2 + s4 * rr1;
-    const uint64_t x2 = s0 * r2 + s1 * r1  + s2 * r0  + s3 * rr3 + s4 * rr2;
-    const uint64_t x3 = s0 * r3 + s1 * r2  + s2 * r1  + s3 * r0  + s4 * rr3;
-    const uint32_t x4 = s4 * (r0 & 3);
-
-    /* partial reduction modulo 2^130 - 5 */
-    const uint32_t u5 = x4 + (x3 >> 32); // u5 <= 7ffffff5
-    const uint64_t u0 = (u5 >>  2) * 5 + (x0 & 0xffffffff);
-    const uint64_t u1 = (u0 >> 32)     + (x1 & 0xffffffff) + (x0 >> 32);
-    const uint64_t u2 = (u1 >> 32)     + (x2 & 0xffffffff) + (x1 >> 32);
-    const uint64_t u3 = (u2 >> 32)     + (x3 & 0xffffffff) + (x2 >> 32);
-    const uint64_t u4 = (u3 >> 32)     + (u5 & 3);
-
-    /* Update the hash */
-    ctx->h[0] = (uint32_t)u0;
-    ctx->h[1] = (uint32_t)u1;
-    ctx->h[2] = (uint32_t)u2;
-    ctx->h[3] = (uint32_t)u3;
-    ctx->h[4] = (uint32_t)u4;
+    uint32_t h0 = ctx->h[0];
+    uint32_t h1 = ctx->h[1];
+    uint32_t h2 = ctx->h[2];
+    uint32_t h3 = ctx->h[3];
+    uint32_t h4 = ctx->h[4];
+
+    while (blocks--) {
+        /* s = h + c, without carry propagation */
+        const uint64_t s0 = h0 + (uint64_t)u8to32(&data[0]);
+        const uint64_t s1 = h1 + (uint64_t)u8to32(&data[4]);
+        const uint64_t s2 = h2 + (uint64_t)u8to32(&data[8]);
+        const uint64_t s3 = h3 + (uint64_t)u8to32(&data[12]);
+        const uint32_t s4 = h4 + c4;
+
+        /* (h + c) * r, without carry propagation */
+        const uint64_t x0 = s0 * r0 + s1 * rr3 + s2 * rr2 + s3 * rr1 + s4 * rr0;
+        const uint64_t x1 = s0 * r1 + s1 * r0  + s2 * rr3 + s3 * rr2 + s4 * rr1;
+        const uint64_t x2 = s0 * r2 + s1 * r1  + s2 * r0  + s3 * rr3 + s4 * rr2;
+        const uint64_t x3 = s0 * r3 + s1 * r2  + s2 * r1  + s3 * r0  + s4 * rr3;
+        const uint32_t x4 = s4 * (r0 & 3);
+
+        /* partial reduction modulo 2^130 - 5 */
+        const uint32_t u5 = x4 + (x3 >> 32); // u5 <= 7ffffff5
+        const uint64_t u0 = (u5 >>  2) * 5 + (x0 & 0xffffffff);
+        const uint64_t u1 = (u0 >> 32)     + (x1 & 0xffffffff) + (x0 >> 32);
+        const uint64_t u2 = (u1 >> 32)     + (x2 & 0xffffffff) + (x1 >> 32);
+        const uint64_t u3 = (u2 >> 32)     + (x3 & 0xffffffff) + (x2 >> 32);
+        const uint64_t u4 = (u3 >> 32)     + (u5 & 3);
+
+        /* Update the hash */
+        h0 = (uint32_t)u0;
+        h1 = (uint32_t)u1;
+        h2 = (uint32_t)u2;
+        h3 = (uint32_t)u3;
+        h4 = (uint32_t)u4;
+
+        data += POLY1305_BLOCK_SIZE;
+    }
+
+    ctx->h[0] = h0;
+    ctx->h[1] = h1;
+    ctx->h[2] = h2;
+    ctx->h[3] = h3;
+    ctx->h[4] = h4;
+}
+
+#endif /* __SIZEOF_INT128__ */
+
+/* Process the buffered chunk */
+static void _process_c(poly1305_ctx_t *ctx, uint8_t c4)
+{
+    uint8_t block[POLY1305_BLOCK_SIZE];
+
+    for (size_t i = 0; i < 4; i++) {
+        u32to8(&block[4 * i], ctx->c[i]);
+    }
+    poly1305_blocks(ctx, block, 1, c4);
+    _clear_c(ctx);
 }
 
 static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
@@ -103,15 +195,77 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
+    /* fill up a partial chunk byte by byte */
+    while (len > 0 && ctx->c_idx > 0) {
+        _take_input(ctx, *data++);
+        len--;
         if (ctx->c_idx == 16) {
-            poly1305_block(ctx, 1);
-            _clear_c(ctx);
+            _process_c(ctx, 1);
         }
     }
+
+    /* whole blocks are processed directly from the input */
+    poly1305_blocks(ctx, data, len / POLY1305_BLOCK_SIZE, 1);
+    data += len & ~(size_t)(POLY1305_BLOCK_SIZE - 1);
+    len &= POLY1305_BLOCK_SIZE - 1;
+
+    for (size_t i = 0; i < len; i++) {
+        _take_input(ctx, data[i]);
+    }
 }
 
+#ifdef __SIZEOF_INT128__
+void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
+{
+    /* load everything first, the key may overlap the context */
+    const uint64_t r0 = u8to64(&key[0]);
+    const uint64_t r1 = u8to64(&key[8]);
+    const uint64_t pad0 = u8to64(&key[16]);
+    const uint64_t pad1 = u8to64(&key[24]);
+
+    /* clamp key */
+    ctx->r[0] = r0 & 0x0ffffffc0fffffff;
+    ctx->r[1] = r1 & 0x0ffffffc0ffffffc;
+    ctx->pad[0] = pad0;
+    ctx->pad[1] = pad1;
+
+    /* Zero the hash */
+    memset(ctx->h, 0, sizeof(ctx->h));
+    _clear_c(ctx);
+}
+
+void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
+{
+    /* Process the last block if there is data remaining */
+    if (ctx->c_idx) {
+        /* move the final 1 according to remaining input length */
+        _take_input(ctx, 1);
+        _process_c(ctx, 0);
+    }
+
+    uint64_t h0 = ctx->h[0];
+    uint64_t h1 = ctx->h[1];
+    uint128_t t;
+
+    /* g = h + 5, exceeds 2^130 if h has to be reduced by 2^130 - 5 */
+    t = (uint128_t)h0 + 5;
+    uint64_t g0 = (uint64_t)t;
+    t = (uint128_t)h1 + (uint64_t)(t >> 64);
+    uint64_t g1 = (uint64_t)t;
+    uint64_t g2 = ctx->h[2] + (uint64_t)(t >> 64);
+
+    /* select h or g without branches */
+    uint64_t mask = 0 - (g2 >> 2);
+    h0 = (h0 & ~mask) | (g0 & mask);
+    h1 = (h1 & ~mask) | (g1 & mask);
+
+    /* mac = (h + pad) mod 2^128 */
+    t = (uint128_t)h0 + ctx->pad[0];
+    u64to8(mac, (uint64_t)t);
+    t = (uint128_t)h1 + ctx->pad[1] + (uint64_t)(t >> 64);
+    u64to8(mac + 8, (uint64_t)t);
+}
+#else /* !__SIZEOF_INT128__ */
 void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
 {
     /* load and clamp key */
@@ -136,7 +290,7 @@ void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
         /* (We may add less than 2^130 to the last input block) */
         _take_input(ctx, 1);
         /* And update hash */
-        poly1305_block(ctx, 0);
+        _process_c(ctx, 0);
     }
 
     /* check if we should subtract 2^130-5 by performing the
@@ -162,6 +316,7 @@ void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
     u32to8(mac + 12, uu3);
 
 }
+#endif /* __SIZEOF_INT128__ */
 
 void poly1305_auth(uint8_t *mac, const uint8_t *data, size_t len,
                    const uint8_t *key)
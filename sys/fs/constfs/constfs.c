@@ -44,6 +44,7 @@ static int constfs_close(vfs_file_t *filp);
 static int constfs_fstat(vfs_file_t *filp, struct stat *buf);
 static off_t constfs_lseek(vfs_file_t *filp, off_t off, int whence);
 static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode, const char *abs_path);
+static ssize_t constfs_mmap(vfs_file_t *filp, const void **addr, size_t nbytes);
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
 static ssize_t constfs_write(vfs_file_t *filp, const void *src, size_t nbytes);
 
@@ -64,6 +65,7 @@ static const vfs_file_ops_t constfs_file_ops = {
     .close = constfs_close,
     .fstat = constfs_fstat,
     .lseek = constfs_lseek,
+    .mmap  = constfs_mmap,
     .open  = constfs_open,
     .read  = constfs_read,
     .write = constfs_write,
@@ -228,6 +230,24 @@ static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mo
     return -ENOENT;
 }
 
+static ssize_t constfs_mmap(vfs_file_t *filp, const void **addr, size_t nbytes)
+{
+    constfs_file_t *fp = filp->private_data.ptr;
+    DEBUG("constfs_mmap: %p, %p, %lu\n", (void *)filp, (void *)addr, (unsigned long)nbytes);
+    if ((size_t)filp->pos >= fp->size) {
+        /* Current offset is at or beyond end of file */
+        *addr = fp->data + fp->size;
+        return 0;
+    }
+
+    if (nbytes > (fp->size - filp->pos)) {
+        nbytes = fp->size - filp->pos;
+    }
+    /* the file contents are constant, hand them out in place */
+    *addr = fp->data + filp->pos;
+    return nbytes;
+}
+
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
 {
     constfs_file_t *fp = filp->private_data.ptr;
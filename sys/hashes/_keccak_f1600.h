@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_sha3
+ * @{
+ *
+ * @file
+ * @brief       Internal interface of the Keccak-f[1600] permutation
+ *
+ * The representation of the lanes in the state depends on the
+ * implementation, so the sponge only accesses them through these functions.
+ */
+
+#ifndef KECCAK_F1600_H
+#define KECCAK_F1600_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Apply the Keccak-f[1600] permutation to a state
+ *
+ * @param[in,out] state     the 25 lanes of the state
+ */
+void keccak_f1600_permute(uint64_t *state);
+
+/**
+ * @brief   XOR a lane into the state
+ *
+ * @param[in,out] state     the 25 lanes of the state
+ * @param[in]     idx       index x + 5 * y of the lane
+ * @param[in]     lane      lane value, byte 0 in the least significant bits
+ */
+void keccak_f1600_xor_lane(uint64_t *state, unsigned idx, uint64_t lane);
+
+/**
+ * @brief   Read a lane of the state
+ *
+ * @param[in]     state     the 25 lanes of the state
+ * @param[in]     idx       index x + 5 * y of the lane
+ *
+ * @return  lane value, byte 0 in the least significant bits
+ */
+uint64_t keccak_f1600_get_lane(const uint64_t *state, unsigned idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KECCAK_F1600_H */
+/** @} */
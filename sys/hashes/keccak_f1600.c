@@ -0,0 +1,487 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_sha3
+ * @{
+ *
+ * @file
+ * @brief       Keccak-f[1600] permutation
+ *
+ * Two implementations following the optimized ones of the Keccak Code
+ * Package:
+ *
+ * - On native and 64 bit CPUs, all 25 lanes are kept in 64 bit variables
+ *   and the rounds are fully unrolled. Lane complementing (the "bebigokimisa"
+ *   pattern) saves most of the NOT operations of the chi step.
+ * - On 32 bit CPUs such as Cortex-M, each lane is bit-interleaved into a
+ *   word of the even and a word of the odd bits, so that all 64 bit
+ *   rotations become two 32 bit rotations. The lanes are stored interleaved
+ *   in the state and only converted when absorbing or squeezing.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "hashes/sha3.h"
+#include "_keccak_f1600.h"
+
+#if !CONFIG_HASHES_SHA3_INTERLEAVED
+
+#define ROL64(a, offset) (((a) << (offset)) ^ ((a) >> (64 - (offset))))
+
+static const uint64_t _rc[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+};
+
+/* One round from the lanes A.. to the lanes E.., the lanes be, bi, go, ki,
+ * mi and sa are stored complemented */
+#define KECCAK_ROUND(A, E, rc) do { \
+        Ca = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa; \
+        Ce = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se; \
+        Ci = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si; \
+        Co = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so; \
+        Cu = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su; \
+        Da = Cu ^ ROL64(Ce, 1); \
+        De = Ca ^ ROL64(Ci, 1); \
+        Di = Ce ^ ROL64(Co, 1); \
+        Do = Ci ^ ROL64(Cu, 1); \
+        Du = Co ^ ROL64(Ca, 1); \
+        Ba = A##ba ^ Da; \
+        Be = ROL64(A##ge ^ De, 44); \
+        Bi = ROL64(A##ki ^ Di, 43); \
+        Bo = ROL64(A##mo ^ Do, 21); \
+        Bu = ROL64(A##su ^ Du, 14); \
+        E##ba = Ba ^ (Be | Bi); \
+        E##be = Be ^ (~Bi | Bo); \
+        E##bi = Bi ^ (Bo & Bu); \
+        E##bo = Bo ^ (Bu | Ba); \
+        E##bu = Bu ^ (Ba & Be); \
+        E##ba ^= (rc); \
+        Ba = ROL64(A##bo ^ Do, 28); \
+        Be = ROL64(A##gu ^ Du, 20); \
+        Bi = ROL64(A##ka ^ Da, 3); \
+        Bo = ROL64(A##me ^ De, 45); \
+        Bu = ROL64(A##si ^ Di, 61); \
+        E##ga = Ba ^ (Be | Bi); \
+        E##ge = Be ^ (Bi & Bo); \
+        E##gi = Bi ^ (Bo | ~Bu); \
+        E##go = Bo ^ (Bu | Ba); \
+        E##gu = Bu ^ (Ba & Be); \
+        Ba = ROL64(A##be ^ De, 1); \
+        Be = ROL64(A##gi ^ Di, 6); \
+        Bi = ROL64(A##ko ^ Do, 25); \
+        Bo = ROL64(A##mu ^ Du, 8); \
+        Bu = ROL64(A##sa ^ Da, 18); \
+        E##ka = Ba ^ (Be | Bi); \
+        E##ke = Be ^ (Bi & Bo); \
+        E##ki = Bi ^ (~Bo & Bu); \
+        E##ko = ~Bo ^ (Bu | Ba); \
+        E##ku = Bu ^ (Ba & Be); \
+        Ba = ROL64(A##bu ^ Du, 27); \
+        Be = ROL64(A##ga ^ Da, 36); \
+        Bi = ROL64(A##ke ^ De, 10); \
+        Bo = ROL64(A##mi ^ Di, 15); \
+        Bu = ROL64(A##so ^ Do, 56); \
+        E##ma = Ba ^ (Be & Bi); \
+        E##me = Be ^ (Bi | Bo); \
+        E##mi = Bi ^ (~Bo | Bu); \
+        E##mo = ~Bo ^ (Bu & Ba); \
+        E##mu = Bu ^ (Ba | Be); \
+        Ba = ROL64(A##bi ^ Di, 62); \
+        Be = ROL64(A##go ^ Do, 55); \
+        Bi = ROL64(A##ku ^ Du, 39); \
+        Bo = ROL64(A##ma ^ Da, 41); \
+        Bu = ROL64(A##se ^ De, 2); \
+        E##sa = Ba ^ (~Be & Bi); \
+        E##se = ~Be ^ (Bi | Bo); \
+        E##si = Bi ^ (Bo & Bu); \
+        E##so = Bo ^ (Bu | Ba); \
+        E##su = Bu ^ (Ba & Be); \
+    } while (0)
+
+void keccak_f1600_permute(uint64_t *state)
+{
+    uint64_t Aba, Abe, Abi, Abo, Abu;
+    uint64_t Aga, Age, Agi, Ago, Agu;
+    uint64_t Aka, Ake, Aki, Ako, Aku;
+    uint64_t Ama, Ame, Ami, Amo, Amu;
+    uint64_t Asa, Ase, Asi, Aso, Asu;
+    uint64_t Eba, Ebe, Ebi, Ebo, Ebu;
+    uint64_t Ega, Ege, Egi, Ego, Egu;
+    uint64_t Eka, Eke, Eki, Eko, Eku;
+    uint64_t Ema, Eme, Emi, Emo, Emu;
+    uint64_t Esa, Ese, Esi, Eso, Esu;
+    uint64_t Ca, Ce, Ci, Co, Cu;
+    uint64_t Da, De, Di, Do, Du;
+    uint64_t Ba, Be, Bi, Bo, Bu;
+
+    Aba = state[0];
+    Abe = ~state[1];
+    Abi = ~state[2];
+    Abo = state[3];
+    Abu = state[4];
+    Aga = state[5];
+    Age = state[6];
+    Agi = state[7];
+    Ago = ~state[8];
+    Agu = state[9];
+    Aka = state[10];
+    Ake = state[11];
+    Aki = ~state[12];
+    Ako = state[13];
+    Aku = state[14];
+    Ama = state[15];
+    Ame = state[16];
+    Ami = ~state[17];
+    Amo = state[18];
+    Amu = state[19];
+    Asa = ~state[20];
+    Ase = state[21];
+    Asi = state[22];
+    Aso = state[23];
+    Asu = state[24];
+
+#pragma GCC unroll 12
+    for (unsigned i = 0; i < 24; i += 2) {
+        KECCAK_ROUND(A, E, _rc[i]);
+        KECCAK_ROUND(E, A, _rc[i + 1]);
+    }
+
+    state[0] = Aba;
+    state[1] = ~Abe;
+    state[2] = ~Abi;
+    state[3] = Abo;
+    state[4] = Abu;
+    state[5] = Aga;
+    state[6] = Age;
+    state[7] = Agi;
+    state[8] = ~Ago;
+    state[9] = Agu;
+    state[10] = Aka;
+    state[11] = Ake;
+    state[12] = ~Aki;
+    state[13] = Ako;
+    state[14] = Aku;
+    state[15] = Ama;
+    state[16] = Ame;
+    state[17] = ~Ami;
+    state[18] = Amo;
+    state[19] = Amu;
+    state[20] = ~Asa;
+    state[21] = Ase;
+    state[22] = Asi;
+    state[23] = Aso;
+    state[24] = Asu;
+}
+
+void keccak_f1600_xor_lane(uint64_t *state, unsigned idx, uint64_t lane)
+{
+    state[idx] ^= lane;
+}
+
+uint64_t keccak_f1600_get_lane(const uint64_t *state, unsigned idx)
+{
+    return state[idx];
+}
+
+#else /* CONFIG_HASHES_SHA3_INTERLEAVED */
+
+#define ROL32(a, offset) (((a) << (offset)) ^ ((a) >> (32 - (offset))))
+
+static const uint32_t _rc[24][2] = {
+    { 0x00000001, 0x00000000 }, { 0x00000000, 0x00000089 }, { 0x00000000, 0x8000008b },
+    { 0x00000000, 0x80008080 }, { 0x00000001, 0x0000008b }, { 0x00000001, 0x00008000 },
+    { 0x00000001, 0x80008088 }, { 0x00000001, 0x80000082 }, { 0x00000000, 0x0000000b },
+    { 0x00000000, 0x0000000a }, { 0x00000001, 0x00008082 }, { 0x00000000, 0x00008003 },
+    { 0x00000001, 0x0000808b }, { 0x00000001, 0x8000000b }, { 0x00000001, 0x8000008a },
+    { 0x00000001, 0x80000081 }, { 0x00000000, 0x80000081 }, { 0x00000000, 0x80000008 },
+    { 0x00000000, 0x00000083 }, { 0x00000000, 0x80008003 }, { 0x00000001, 0x80008088 },
+    { 0x00000000, 0x80000088 }, { 0x00000001, 0x00008000 }, { 0x00000000, 0x80008082 },
+};
+
+/* One round from the lanes A.. to the lanes E.., the suffix 0 denotes the
+ * even, 1 the odd bits. The lanes be, bi, go, ki, mi and sa are stored
+ * complemented */
+#define KECCAK_ROUND(A, E, rc0, rc1) do { \
+        Ca0 = A##ba0 ^ A##ga0 ^ A##ka0 ^ A##ma0 ^ A##sa0; \
+        Ca1 = A##ba1 ^ A##ga1 ^ A##ka1 ^ A##ma1 ^ A##sa1; \
+        Ce0 = A##be0 ^ A##ge0 ^ A##ke0 ^ A##me0 ^ A##se0; \
+        Ce1 = A##be1 ^ A##ge1 ^ A##ke1 ^ A##me1 ^ A##se1; \
+        Ci0 = A##bi0 ^ A##gi0 ^ A##ki0 ^ A##mi0 ^ A##si0; \
+        Ci1 = A##bi1 ^ A##gi1 ^ A##ki1 ^ A##mi1 ^ A##si1; \
+        Co0 = A##bo0 ^ A##go0 ^ A##ko0 ^ A##mo0 ^ A##so0; \
+        Co1 = A##bo1 ^ A##go1 ^ A##ko1 ^ A##mo1 ^ A##so1; \
+        Cu0 = A##bu0 ^ A##gu0 ^ A##ku0 ^ A##mu0 ^ A##su0; \
+        Cu1 = A##bu1 ^ A##gu1 ^ A##ku1 ^ A##mu1 ^ A##su1; \
+        Da0 = Cu0 ^ ROL32(Ce1, 1); \
+        Da1 = Cu1 ^ Ce0; \
+        De0 = Ca0 ^ ROL32(Ci1, 1); \
+        De1 = Ca1 ^ Ci0; \
+        Di0 = Ce0 ^ ROL32(Co1, 1); \
+        Di1 = Ce1 ^ Co0; \
+        Do0 = Ci0 ^ ROL32(Cu1, 1); \
+        Do1 = Ci1 ^ Cu0; \
+        Du0 = Co0 ^ ROL32(Ca1, 1); \
+        Du1 = Co1 ^ Ca0; \
+        Ba0 = A##ba0 ^ Da0; \
+        Ba1 = A##ba1 ^ Da1; \
+        Be0 = ROL32(A##ge0 ^ De0, 22); \
+        Be1 = ROL32(A##ge1 ^ De1, 22); \
+        Bi0 = ROL32(A##ki1 ^ Di1, 22); \
+        Bi1 = ROL32(A##ki0 ^ Di0, 21); \
+        Bo0 = ROL32(A##mo1 ^ Do1, 11); \
+        Bo1 = ROL32(A##mo0 ^ Do0, 10); \
+        Bu0 = ROL32(A##su0 ^ Du0, 7); \
+        Bu1 = ROL32(A##su1 ^ Du1, 7); \
+        E##ba0 = Ba0 ^ (Be0 | Bi0); \
+        E##be0 = Be0 ^ (~Bi0 | Bo0); \
+        E##bi0 = Bi0 ^ (Bo0 & Bu0); \
+        E##bo0 = Bo0 ^ (Bu0 | Ba0); \
+        E##bu0 = Bu0 ^ (Ba0 & Be0); \
+        E##ba1 = Ba1 ^ (Be1 | Bi1); \
+        E##be1 = Be1 ^ (~Bi1 | Bo1); \
+        E##bi1 = Bi1 ^ (Bo1 & Bu1); \
+        E##bo1 = Bo1 ^ (Bu1 | Ba1); \
+        E##bu1 = Bu1 ^ (Ba1 & Be1); \
+        E##ba0 ^= (rc0); \
+        E##ba1 ^= (rc1); \
+        Ba0 = ROL32(A##bo0 ^ Do0, 14); \
+        Ba1 = ROL32(A##bo1 ^ Do1, 14); \
+        Be0 = ROL32(A##gu0 ^ Du0, 10); \
+        Be1 = ROL32(A##gu1 ^ Du1, 10); \
+        Bi0 = ROL32(A##ka1 ^ Da1, 2); \
+        Bi1 = ROL32(A##ka0 ^ Da0, 1); \
+        Bo0 = ROL32(A##me1 ^ De1, 23); \
+        Bo1 = ROL32(A##me0 ^ De0, 22); \
+        Bu0 = ROL32(A##si1 ^ Di1, 31); \
+        Bu1 = ROL32(A##si0 ^ Di0, 30); \
+        E##ga0 = Ba0 ^ (Be0 | Bi0); \
+        E##ge0 = Be0 ^ (Bi0 & Bo0); \
+        E##gi0 = Bi0 ^ (Bo0 | ~Bu0); \
+        E##go0 = Bo0 ^ (Bu0 | Ba0); \
+        E##gu0 = Bu0 ^ (Ba0 & Be0); \
+        E##ga1 = Ba1 ^ (Be1 | Bi1); \
+        E##ge1 = Be1 ^ (Bi1 & Bo1); \
+        E##gi1 = Bi1 ^ (Bo1 | ~Bu1); \
+        E##go1 = Bo1 ^ (Bu1 | Ba1); \
+        E##gu1 = Bu1 ^ (Ba1 & Be1); \
+        Ba0 = ROL32(A##be1 ^ De1, 1); \
+        Ba1 = A##be0 ^ De0; \
+        Be0 = ROL32(A##gi0 ^ Di0, 3); \
+        Be1 = ROL32(A##gi1 ^ Di1, 3); \
+        Bi0 = ROL32(A##ko1 ^ Do1, 13); \
+        Bi1 = ROL32(A##ko0 ^ Do0, 12); \
+        Bo0 = ROL32(A##mu0 ^ Du0, 4); \
+        Bo1 = ROL32(A##mu1 ^ Du1, 4); \
+        Bu0 = ROL32(A##sa0 ^ Da0, 9); \
+        Bu1 = ROL32(A##sa1 ^ Da1, 9); \
+        E##ka0 = Ba0 ^ (Be0 | Bi0); \
+        E##ke0 = Be0 ^ (Bi0 & Bo0); \
+        E##ki0 = Bi0 ^ (~Bo0 & Bu0); \
+        E##ko0 = ~Bo0 ^ (Bu0 | Ba0); \
+        E##ku0 = Bu0 ^ (Ba0 & Be0); \
+        E##ka1 = Ba1 ^ (Be1 | Bi1); \
+        E##ke1 = Be1 ^ (Bi1 & Bo1); \
+        E##ki1 = Bi1 ^ (~Bo1 & Bu1); \
+        E##ko1 = ~Bo1 ^ (Bu1 | Ba1); \
+        E##ku1 = Bu1 ^ (Ba1 & Be1); \
+        Ba0 = ROL32(A##bu1 ^ Du1, 14); \
+        Ba1 = ROL32(A##bu0 ^ Du0, 13); \
+        Be0 = ROL32(A##ga0 ^ Da0, 18); \
+        Be1 = ROL32(A##ga1 ^ Da1, 18); \
+        Bi0 = ROL32(A##ke0 ^ De0, 5); \
+        Bi1 = ROL32(A##ke1 ^ De1, 5); \
+        Bo0 = ROL32(A##mi1 ^ Di1, 8); \
+        Bo1 = ROL32(A##mi0 ^ Di0, 7); \
+        Bu0 = ROL32(A##so0 ^ Do0, 28); \
+        Bu1 = ROL32(A##so1 ^ Do1, 28); \
+        E##ma0 = Ba0 ^ (Be0 & Bi0); \
+        E##me0 = Be0 ^ (Bi0 | Bo0); \
+        E##mi0 = Bi0 ^ (~Bo0 | Bu0); \
+        E##mo0 = ~Bo0 ^ (Bu0 & Ba0); \
+        E##mu0 = Bu0 ^ (Ba0 | Be0); \
+        E##ma1 = Ba1 ^ (Be1 & Bi1); \
+        E##me1 = Be1 ^ (Bi1 | Bo1); \
+        E##mi1 = Bi1 ^ (~Bo1 | Bu1); \
+        E##mo1 = ~Bo1 ^ (Bu1 & Ba1); \
+        E##mu1 = Bu1 ^ (Ba1 | Be1); \
+        Ba0 = ROL32(A##bi0 ^ Di0, 31); \
+        Ba1 = ROL32(A##bi1 ^ Di1, 31); \
+        Be0 = ROL32(A##go1 ^ Do1, 28); \
+        Be1 = ROL32(A##go0 ^ Do0, 27); \
+        Bi0 = ROL32(A##ku1 ^ Du1, 20); \
+        Bi1 = ROL32(A##ku0 ^ Du0, 19); \
+        Bo0 = ROL32(A##ma1 ^ Da1, 21); \
+        Bo1 = ROL32(A##ma0 ^ Da0, 20); \
+        Bu0 = ROL32(A##se0 ^ De0, 1); \
+        Bu1 = ROL32(A##se1 ^ De1, 1); \
+        E##sa0 = Ba0 ^ (~Be0 & Bi0); \
+        E##se0 = ~Be0 ^ (Bi0 | Bo0); \
+        E##si0 = Bi0 ^ (Bo0 & Bu0); \
+        E##so0 = Bo0 ^ (Bu0 | Ba0); \
+        E##su0 = Bu0 ^ (Ba0 & Be0); \
+        E##sa1 = Ba1 ^ (~Be1 & Bi1); \
+        E##se1 = ~Be1 ^ (Bi1 | Bo1); \
+        E##si1 = Bi1 ^ (Bo1 & Bu1); \
+        E##so1 = Bo1 ^ (Bu1 | Ba1); \
+        E##su1 = Bu1 ^ (Ba1 & Be1); \
+    } while (0)
+
+void keccak_f1600_permute(uint64_t *state)
+{
+    uint32_t Aba0, Aba1, Abe0, Abe1, Abi0, Abi1, Abo0, Abo1, Abu0, Abu1;
+    uint32_t Aga0, Aga1, Age0, Age1, Agi0, Agi1, Ago0, Ago1, Agu0, Agu1;
+    uint32_t Aka0, Aka1, Ake0, Ake1, Aki0, Aki1, Ako0, Ako1, Aku0, Aku1;
+    uint32_t Ama0, Ama1, Ame0, Ame1, Ami0, Ami1, Amo0, Amo1, Amu0, Amu1;
+    uint32_t Asa0, Asa1, Ase0, Ase1, Asi0, Asi1, Aso0, Aso1, Asu0, Asu1;
+    uint32_t Eba0, Eba1, Ebe0, Ebe1, Ebi0, Ebi1, Ebo0, Ebo1, Ebu0, Ebu1;
+    uint32_t Ega0, Ega1, Ege0, Ege1, Egi0, Egi1, Ego0, Ego1, Egu0, Egu1;
+    uint32_t Eka0, Eka1, Eke0, Eke1, Eki0, Eki1, Eko0, Eko1, Eku0, Eku1;
+    uint32_t Ema0, Ema1, Eme0, Eme1, Emi0, Emi1, Emo0, Emo1, Emu0, Emu1;
+    uint32_t Esa0, Esa1, Ese0, Ese1, Esi0, Esi1, Eso0, Eso1, Esu0, Esu1;
+    uint32_t Ca0, Ca1, Ce0, Ce1, Ci0, Ci1, Co0, Co1, Cu0, Cu1;
+    uint32_t Da0, Da1, De0, De1, Di0, Di1, Do0, Do1, Du0, Du1;
+    uint32_t Ba0, Ba1, Be0, Be1, Bi0, Bi1, Bo0, Bo1, Bu0, Bu1;
+
+    Aba0 = (uint32_t)state[0];
+    Aba1 = (uint32_t)(state[0] >> 32);
+    Abe0 = ~(uint32_t)state[1];
+    Abe1 = ~(uint32_t)(state[1] >> 32);
+    Abi0 = ~(uint32_t)state[2];
+    Abi1 = ~(uint32_t)(state[2] >> 32);
+    Abo0 = (uint32_t)state[3];
+    Abo1 = (uint32_t)(state[3] >> 32);
+    Abu0 = (uint32_t)state[4];
+    Abu1 = (uint32_t)(state[4] >> 32);
+    Aga0 = (uint32_t)state[5];
+    Aga1 = (uint32_t)(state[5] >> 32);
+    Age0 = (uint32_t)state[6];
+    Age1 = (uint32_t)(state[6] >> 32);
+    Agi0 = (uint32_t)state[7];
+    Agi1 = (uint32_t)(state[7] >> 32);
+    Ago0 = ~(uint32_t)state[8];
+    Ago1 = ~(uint32_t)(state[8] >> 32);
+    Agu0 = (uint32_t)state[9];
+    Agu1 = (uint32_t)(state[9] >> 32);
+    Aka0 = (uint32_t)state[10];
+    Aka1 = (uint32_t)(state[10] >> 32);
+    Ake0 = (uint32_t)state[11];
+    Ake1 = (uint32_t)(state[11] >> 32);
+    Aki0 = ~(uint32_t)state[12];
+    Aki1 = ~(uint32_t)(state[12] >> 32);
+    Ako0 = (uint32_t)state[13];
+    Ako1 = (uint32_t)(state[13] >> 32);
+    Aku0 = (uint32_t)state[14];
+    Aku1 = (uint32_t)(state[14] >> 32);
+    Ama0 = (uint32_t)state[15];
+    Ama1 = (uint32_t)(state[15] >> 32);
+    Ame0 = (uint32_t)state[16];
+    Ame1 = (uint32_t)(state[16] >> 32);
+    Ami0 = ~(uint32_t)state[17];
+    Ami1 = ~(uint32_t)(state[17] >> 32);
+    Amo0 = (uint32_t)state[18];
+    Amo1 = (uint32_t)(state[18] >> 32);
+    Amu0 = (uint32_t)state[19];
+    Amu1 = (uint32_t)(state[19] >> 32);
+    Asa0 = ~(uint32_t)state[20];
+    Asa1 = ~(uint32_t)(state[20] >> 32);
+    Ase0 = (uint32_t)state[21];
+    Ase1 = (uint32_t)(state[21] >> 32);
+    Asi0 = (uint32_t)state[22];
+    Asi1 = (uint32_t)(state[22] >> 32);
+    Aso0 = (uint32_t)state[23];
+    Aso1 = (uint32_t)(state[23] >> 32);
+    Asu0 = (uint32_t)state[24];
+    Asu1 = (uint32_t)(state[24] >> 32);
+
+    for (unsigned i = 0; i < 24; i += 2) {
+        KECCAK_ROUND(A, E, _rc[i][0], _rc[i][1]);
+        KECCAK_ROUND(E, A, _rc[i + 1][0], _rc[i + 1][1]);
+    }
+
+    state[0] = (uint32_t)Aba0 | ((uint64_t)Aba1 << 32);
+    state[1] = (uint32_t)~Abe0 | ((uint64_t)~Abe1 << 32);
+    state[2] = (uint32_t)~Abi0 | ((uint64_t)~Abi1 << 32);
+    state[3] = (uint32_t)Abo0 | ((uint64_t)Abo1 << 32);
+    state[4] = (uint32_t)Abu0 | ((uint64_t)Abu1 << 32);
+    state[5] = (uint32_t)Aga0 | ((uint64_t)Aga1 << 32);
+    state[6] = (uint32_t)Age0 | ((uint64_t)Age1 << 32);
+    state[7] = (uint32_t)Agi0 | ((uint64_t)Agi1 << 32);
+    state[8] = (uint32_t)~Ago0 | ((uint64_t)~Ago1 << 32);
+    state[9] = (uint32_t)Agu0 | ((uint64_t)Agu1 << 32);
+    state[10] = (uint32_t)Aka0 | ((uint64_t)Aka1 << 32);
+    state[11] = (uint32_t)Ake0 | ((uint64_t)Ake1 << 32);
+    state[12] = (uint32_t)~Aki0 | ((uint64_t)~Aki1 << 32);
+    state[13] = (uint32_t)Ako0 | ((uint64_t)Ako1 << 32);
+    state[14] = (uint32_t)Aku0 | ((uint64_t)Aku1 << 32);
+    state[15] = (uint32_t)Ama0 | ((uint64_t)Ama1 << 32);
+    state[16] = (uint32_t)Ame0 | ((uint64_t)Ame1 << 32);
+    state[17] = (uint32_t)~Ami0 | ((uint64_t)~Ami1 << 32);
+    state[18] = (uint32_t)Amo0 | ((uint64_t)Amo1 << 32);
+    state[19] = (uint32_t)Amu0 | ((uint64_t)Amu1 << 32);
+    state[20] = (uint32_t)~Asa0 | ((uint64_t)~Asa1 << 32);
+    state[21] = (uint32_t)Ase0 | ((uint64_t)Ase1 << 32);
+    state[22] = (uint32_t)Asi0 | ((uint64_t)Asi1 << 32);
+    state[23] = (uint32_t)Aso0 | ((uint64_t)Aso1 << 32);
+    state[24] = (uint32_t)Asu0 | ((uint64_t)Asu1 << 32);
+}
+
+/* Moves the even bits of x to the lower, the odd bits to the upper half */
+static uint32_t _unzip(uint32_t x)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 1)) & 0x22222222UL; x ^= t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0CUL; x ^= t ^ (t << 2);
+    t = (x ^ (x >> 4)) & 0x00F000F0UL; x ^= t ^ (t << 4);
+    t = (x ^ (x >> 8)) & 0x0000FF00UL; x ^= t ^ (t << 8);
+    return x;
+}
+
+/* Inverse of _unzip() */
+static uint32_t _zip(uint32_t x)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 8)) & 0x0000FF00UL; x ^= t ^ (t << 8);
+    t = (x ^ (x >> 4)) & 0x00F000F0UL; x ^= t ^ (t << 4);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0CUL; x ^= t ^ (t << 2);
+    t = (x ^ (x >> 1)) & 0x22222222UL; x ^= t ^ (t << 1);
+    return x;
+}
+
+void keccak_f1600_xor_lane(uint64_t *state, unsigned idx, uint64_t lane)
+{
+    uint32_t lo = _unzip((uint32_t)lane);
+    uint32_t hi = _unzip((uint32_t)(lane >> 32));
+    uint32_t even = (lo & 0x0000FFFFUL) | (hi << 16);
+    uint32_t odd = (lo >> 16) | (hi & 0xFFFF0000UL);
+
+    state[idx] ^= even | ((uint64_t)odd << 32);
+}
+
+uint64_t keccak_f1600_get_lane(const uint64_t *state, unsigned idx)
+{
+    uint32_t even = (uint32_t)state[idx];
+    uint32_t odd = (uint32_t)(state[idx] >> 32);
+    uint32_t lo = _zip((even & 0x0000FFFFUL) | (odd << 16));
+    uint32_t hi = _zip((even >> 16) | (odd & 0xFFFF0000UL));
+
+    return lo | ((uint64_t)hi << 32);
+}
+
+#endif /* CONFIG_HASHES_SHA3_INTERLEAVED */
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_unkeyed
+ * @{
+ *
+ * @file
+ * @brief       Multi-buffer SHA-256
+ *
+ * Each message is hashed in its own lane of a vector type. The vector
+ * extension of the compiler maps the operations to SIMD instructions where
+ * available and falls back to scalar code elsewhere.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+
+#define LANES       CONFIG_HASHES_SHA256_MB_LANES
+
+#if (LANES & (LANES - 1)) != 0
+#error "CONFIG_HASHES_SHA256_MB_LANES has to be a power of two"
+#endif
+
+typedef uint32_t vec_t __attribute__((vector_size(LANES * sizeof(uint32_t))));
+
+static const uint32_t _iv[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+/* One round on all lanes, see sha2xx_common.c */
+#define ROUND(a, b, c, d, e, f, g, h, i) do { \
+        vec_t t0 = h + S1(e) + Ch(e, f, g) + K[i] + W[(i) & 15]; \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+    } while (0)
+
+static void _compress(vec_t *state, vec_t *W)
+{
+    vec_t a = state[0], b = state[1], c = state[2], d = state[3];
+    vec_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (unsigned i = 0; i < 64; i += 8) {
+        if (i >= 16) {
+            for (unsigned j = i; j < i + 8; j++) {
+                W[j & 15] += s1(W[(j - 2) & 15]) + W[(j - 7) & 15] +
+                             s0(W[(j - 15) & 15]);
+            }
+        }
+        ROUND(a, b, c, d, e, f, g, h, i + 0);
+        ROUND(h, a, b, c, d, e, f, g, i + 1);
+        ROUND(g, h, a, b, c, d, e, f, i + 2);
+        ROUND(f, g, h, a, b, c, d, e, i + 3);
+        ROUND(e, f, g, h, a, b, c, d, i + 4);
+        ROUND(d, e, f, g, h, a, b, c, i + 5);
+        ROUND(c, d, e, f, g, h, a, b, i + 6);
+        ROUND(b, c, d, e, f, g, h, a, i + 7);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+/* Build the padded tail block @p t (0 or 1) of a message of @p len bytes */
+static void _tail_block(uint8_t block[64], const uint8_t *in, size_t len,
+                        unsigned t, unsigned tail_blocks)
+{
+    size_t base = (len & ~(size_t)63) + 64 * t;
+
+    memset(block, 0, 64);
+    if (len > base) {
+        memcpy(block, in + base, len - base);
+    }
+    if (len >= base) {
+        block[len - base] = 0x80;
+    }
+    if (t == tail_blocks - 1) {
+        /* message length in bits, big endian */
+        uint64_t bits = (uint64_t)len << 3;
+
+        for (unsigned i = 0; i < 8; i++) {
+            block[63 - i] = bits >> (8 * i);
+        }
+    }
+}
+
+static void _load(vec_t *W, unsigned lane, const uint8_t *block)
+{
+    for (unsigned i = 0; i < 16; i++) {
+        W[i][lane] = ((uint32_t)block[4 * i] << 24) |
+                     ((uint32_t)block[4 * i + 1] << 16) |
+                     ((uint32_t)block[4 * i + 2] << 8) |
+                     block[4 * i + 3];
+    }
+}
+
+static void _hash_lanes(vec_t *state, const uint8_t *const in[LANES],
+                        size_t len)
+{
+    vec_t W[16];
+    size_t full = len / 64;
+    /* the padding needs 9 bytes at least */
+    unsigned tail_blocks = ((len & 63) < 56) ? 1 : 2;
+
+    for (unsigned i = 0; i < 8; i++) {
+        state[i] = (vec_t){ 0 } + _iv[i];
+    }
+
+    for (size_t blk = 0; blk < full; blk++) {
+        for (unsigned l = 0; l < LANES; l++) {
+            _load(W, l, in[l] + 64 * blk);
+        }
+        _compress(state, W);
+    }
+
+    for (unsigned t = 0; t < tail_blocks; t++) {
+        uint8_t block[64];
+
+        for (unsigned l = 0; l < LANES; l++) {
+            _tail_block(block, in[l], len, t, tail_blocks);
+            _load(W, l, block);
+        }
+        _compress(state, W);
+    }
+}
+
+void sha256_mb(const void *const data[], size_t len, void *const digests[],
+               size_t num)
+{
+    for (size_t i = 0; i < num; i += LANES) {
+        const uint8_t *in[LANES];
+        vec_t state[8];
+        size_t used = (num - i < LANES) ? num - i : LANES;
+
+        /* unused lanes hash the first message again */
+        for (unsigned l = 0; l < LANES; l++) {
+            in[l] = data[i + ((l < used) ? l : 0)];
+        }
+
+        _hash_lanes(state, in, len);
+
+        for (unsigned l = 0; l < used; l++) {
+            uint8_t *digest = digests[i + l];
+
+            for (unsigned j = 0; j < 8; j++) {
+                uint32_t word = state[j][l];
+
+                digest[4 * j] = word >> 24;
+                digest[4 * j + 1] = word >> 16;
+                digest[4 * j + 2] = word >> 8;
+                digest[4 * j + 3] = word;
+            }
+        }
+    }
+}
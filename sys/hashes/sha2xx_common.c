@@ -49,6 +49,7 @@
 #include <stdint.h>
 #include <assert.h>
 
+#include "kernel_defines.h"
 #include "hashes/sha2xx_common.h"
 
 
@@ -97,6 +98,64 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+#if IS_USED(MODULE_HASHES_SHA2XX_UNROLL)
+/* One round, the working variables are rotated by the caller */
+#define ROUND(a, b, c, d, e, f, g, h, i) do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + K[i] + W[(i) & 15]; \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+    } while (0)
+
+/* One round, extending the message schedule kept in W[16] in place */
+#define ROUND_SCHEDULE(a, b, c, d, e, f, g, h, i) do { \
+        W[(i) & 15] += s1(W[((i) - 2) & 15]) + W[((i) - 7) & 15] + \
+                       s0(W[((i) - 15) & 15]); \
+        ROUND(a, b, c, d, e, f, g, h, i); \
+    } while (0)
+
+#define ROUNDS_8(R, i) do { \
+        R(a, b, c, d, e, f, g, h, (i) + 0); \
+        R(h, a, b, c, d, e, f, g, (i) + 1); \
+        R(g, h, a, b, c, d, e, f, (i) + 2); \
+        R(f, g, h, a, b, c, d, e, (i) + 3); \
+        R(e, f, g, h, a, b, c, d, (i) + 4); \
+        R(d, e, f, g, h, a, b, c, (i) + 5); \
+        R(c, d, e, f, g, h, a, b, (i) + 6); \
+        R(b, c, d, e, f, g, h, a, (i) + 7); \
+    } while (0)
+
+/*
+ * SHA256 block compression function, unrolled by eight rounds. The working
+ * variables live in local variables instead of an indexed array and only
+ * the last 16 words of the message schedule are kept, so that most of the
+ * state fits into the registers of e.g. a Cortex-M.
+ */
+static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+{
+    uint32_t W[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    unsigned i;
+
+    be32dec_vect(W, block, 64);
+
+    for (i = 0; i < 16; i += 8) {
+        ROUNDS_8(ROUND, i);
+    }
+    for (; i < 64; i += 8) {
+        ROUNDS_8(ROUND_SCHEDULE, i);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+#else /* !MODULE_HASHES_SHA2XX_UNROLL */
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
@@ -134,6 +193,24 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
         state[i] += S[i];
     }
 }
+#endif /* MODULE_HASHES_SHA2XX_UNROLL */
+
+/* Compress a number of consecutive blocks */
+static void sha2xx_transform_blocks(uint32_t *state, const unsigned char *data,
+                                    size_t blocks)
+{
+#if IS_USED(MODULE_HASHES_SHA_NI)
+    if (sha2xx_sha_ni_supported()) {
+        sha2xx_transform_sha_ni(state, data, blocks);
+        return;
+    }
+#endif
+
+    while (blocks--) {
+        sha2xx_transform(state, data);
+        data += 64;
+    }
+}
 
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -191,16 +268,14 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform_blocks(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
     /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
-    }
+    sha2xx_transform_blocks(ctx->state, src, len / 64);
+    src += len & ~(size_t)63;
+    len &= 63;
 
     /* Copy left over data into buffer */
     memcpy(ctx->buf, src, len);
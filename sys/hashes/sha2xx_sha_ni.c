@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes
+ * @{
+ *
+ * @file
+ * @brief       SHA-256 block compression using the x86 SHA extensions
+ *
+ * Used by the SHA-224 and SHA-256 implementations with the `hashes_sha_ni`
+ * module if the host CPU supports the SHA extensions. Only usable on
+ * `native` running on an x86 host.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "hashes/sha2xx_common.h"
+
+/* the intrinsics are usable without -msha -msse4.1 for the whole application */
+#define SHA_NI_TARGET       __attribute__((target("sha,sse4.1,ssse3")))
+
+bool sha2xx_sha_ni_supported(void)
+{
+    return __builtin_cpu_supports("sha");
+}
+
+SHA_NI_TARGET
+void sha2xx_transform_sha_ni(uint32_t *state, const unsigned char *data,
+                             size_t blocks)
+{
+    /* byte swap of each 32 bit word of the big endian message */
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i abef, cdgh, tmp;
+
+    /* SHA256RNDS2 expects the state as ABEF and CDGH */
+    tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+    cdgh = _mm_loadu_si128((const __m128i *)&state[4]);
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+    cdgh = _mm_shuffle_epi32(cdgh, 0x1B);
+    abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xF0);
+
+    while (blocks--) {
+        __m128i abef_save = abef;
+        __m128i cdgh_save = cdgh;
+        __m128i msg[4];
+
+        /* 16 times four rounds, msg[] holds the last 16 words of the
+         * message schedule */
+#pragma GCC unroll 16
+        for (unsigned i = 0; i < 16; i++) {
+            __m128i *cur = &msg[i & 3];
+            __m128i wk;
+
+            if (i < 4) {
+                *cur = _mm_loadu_si128((const __m128i *)(data + 16 * i));
+                *cur = _mm_shuffle_epi8(*cur, bswap);
+            }
+
+            wk = _mm_add_epi32(*cur, _mm_loadu_si128((const __m128i *)&K[4 * i]));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+
+            if (i >= 3 && i < 15) {
+                /* finish the schedule of the next four words */
+                __m128i *next = &msg[(i + 1) & 3];
+
+                tmp = _mm_alignr_epi8(*cur, msg[(i - 1) & 3], 4);
+                *next = _mm_add_epi32(*next, tmp);
+                *next = _mm_sha256msg2_epu32(*next, *cur);
+            }
+
+            wk = _mm_shuffle_epi32(wk, 0x0E);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, wk);
+
+            if (i >= 1 && i < 13) {
+                /* start the schedule of the words four steps ahead */
+                __m128i *prev = &msg[(i - 1) & 3];
+
+                *prev = _mm_sha256msg1_epu32(*prev, *cur);
+            }
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+        data += 64;
+    }
+
+    /* back to ABCD and EFGH */
+    tmp = _mm_shuffle_epi32(abef, 0x1B);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xB1);
+    abef = _mm_blend_epi16(tmp, cdgh, 0xF0);
+    cdgh = _mm_alignr_epi8(cdgh, tmp, 8);
+    _mm_storeu_si128((__m128i *)&state[0], abef);
+    _mm_storeu_si128((__m128i *)&state[4], cdgh);
+}
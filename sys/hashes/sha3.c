@@ -22,28 +22,15 @@
 
 /*
    ================================================================
-   The purpose of this source file is to demonstrate a readable and compact
-   implementation of all the Keccak instances approved in the FIPS 202 standard,
-   including the hash functions and the extendable-output functions (XOFs).
+   This file implements all the Keccak instances approved in the FIPS 202
+   standard, including the hash functions and the extendable-output functions
+   (XOFs), on top of the Keccak-f[1600] permutation in keccak_f1600.c.
 
-   We focused on clarity and on source-code compactness,
-   rather than on the performance.
-
-   The advantages of this implementation are:
- + The source code is compact, after removing the comments, that is. :-)
- + There are no tables with arbitrary constants.
- + For clarity, the comments link the operations to the specifications using
-        the same notation as much as possible.
- + There is no restriction in cryptographic features. In particular,
-        the SHAKE128 and SHAKE256 XOFs can produce any output length.
- + The code does not use much RAM, as all operations are done in place.
-
-   The drawbacks of this implementation are:
-    - There is no message queue. The whole message must be ready in a buffer.
-    - It is not optimized for performance.
-
-   The implementation is even simpler on a little endian platform. Just define the
-   LITTLE_ENDIAN symbol in that case.
+   The sponge accesses the state only lane-wise through
+   keccak_f1600_xor_lane() and keccak_f1600_get_lane(), as the
+   representation of the lanes depends on the permutation implementation.
+   The SHAKE128 and SHAKE256 XOFs can produce any output length, also in
+   multiple incremental calls.
 
    For a more complete set of implementations, please refer to
    the Keccak Code Package at https://github.com/gvanas/KeccakCodePackage
@@ -51,13 +38,17 @@
    For more information, please refer to:
  * [Keccak Reference] http://keccak.noekeon.org/Keccak-reference-3.0.pdf
  * [Keccak Specifications Summary] http://keccak.noekeon.org/specs_summary.html
-
-   This file uses UTF-8 encoding, as some comments use Greek letters.
    ================================================================
  */
 
-#include <hashes/sha3.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+
+#include "hashes/sha3.h"
+#include "_keccak_f1600.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
 
 /**
  * Function to compute the Keccak[r, c] sponge function over a given input.
@@ -163,30 +154,51 @@ void sha3_512_final(keccak_state_t *ctx, void *digest)
     Keccak_final(ctx, digest, SHA3_512_DIGEST_LENGTH);
 }
 
+/**
+ *  Function to compute SHAKE128 on the input message with any output length.
+ */
+void shake128(void *output, size_t output_len, const void *data, size_t len)
+{
+    Keccak(1344, 256, data, len, 0x1F, output, output_len);
+}
+
+void shake128_init(keccak_state_t *ctx)
+{
+    Keccak_init(ctx, 1344, 256, 0x1F);
+}
+
+/**
+ *  Function to compute SHAKE256 on the input message with any output length.
+ */
+void shake256(void *output, size_t output_len, const void *data, size_t len)
+{
+    Keccak(1088, 512, data, len, 0x1F, output, output_len);
+}
+
+void shake256_init(keccak_state_t *ctx)
+{
+    Keccak_init(ctx, 1088, 512, 0x1F);
+}
+
+void shake_squeeze(keccak_state_t *ctx, void *output, size_t output_len)
+{
+    Keccak_squeeze(ctx, output, output_len);
+}
+
 /*
    ================================================================
    Technicalities
    ================================================================
  */
 
-typedef uint8_t UINT8;
-typedef uint64_t UINT64;
-typedef UINT64 tKeccakLane;
-
-#if __BYTE_ORDER__ == __ORDER__LITTLE_ENDIAN__
-#define LITTLE_ENDIAN
-#endif
-
-#ifndef LITTLE_ENDIAN
 /** Function to load a 64-bit value using the little-endian (LE) convention.
- * On a LE platform, this could be greatly simplified using a cast.
+ * On a LE platform, the compiler merges this into a single load.
  */
-static UINT64 load64(const UINT8 *x)
+static uint64_t load64(const uint8_t *x)
 {
-    int i;
-    UINT64 u = 0;
+    uint64_t u = 0;
 
-    for (i = 7; i >= 0; --i) {
+    for (int i = 7; i >= 0; --i) {
         u <<= 8;
         u |= x[i];
     }
@@ -194,201 +206,83 @@ static UINT64 load64(const UINT8 *x)
 }
 
 /** Function to store a 64-bit value using the little-endian (LE) convention.
- * On a LE platform, this could be greatly simplified using a cast.
  */
-static void store64(UINT8 *x, UINT64 u)
+static void store64(uint8_t *x, uint64_t u)
 {
-    unsigned int i;
-
-    for (i = 0; i < 8; ++i) {
+    for (unsigned i = 0; i < 8; ++i) {
         x[i] = u;
         u >>= 8;
     }
 }
 
-/** Function to XOR into a 64-bit value using the little-endian (LE) convention.
- * On a LE platform, this could be greatly simplified using a cast.
- */
-static void xor64(UINT8 *x, UINT64 u)
-{
-    unsigned int i;
-
-    for (i = 0; i < 8; ++i) {
-        x[i] ^= u;
-        u >>= 8;
-    }
-}
-#endif
-
-/*
-   ================================================================
-   A readable and compact implementation of the Keccak-f[1600] permutation.
-   ================================================================
- */
-
-#define ROL64(a, offset) ((((UINT64)a) << offset) ^ (((UINT64)a) >> (64 - offset)))
-#define i(x, y) ((x) + 5 * (y))
-
-#ifdef LITTLE_ENDIAN
-    #define readLane(x, y)          (((tKeccakLane *)state)[i(x, y)])
-    #define writeLane(x, y, lane)   (((tKeccakLane *)state)[i(x, y)]) = (lane)
-    #define XORLane(x, y, lane)     (((tKeccakLane *)state)[i(x, y)]) ^= (lane)
-#else
-    #define readLane(x, y)          load64((UINT8 *)state + sizeof(tKeccakLane) * i(x, y))
-    #define writeLane(x, y, lane)   store64((UINT8 *)state + sizeof(tKeccakLane) * i(x, y), lane)
-    #define XORLane(x, y, lane)     xor64((UINT8 *)state + sizeof(tKeccakLane) * i(x, y), lane)
-#endif
-
 /**
- * Function that computes the linear feedback shift register (LFSR) used to
- * define the round constants (see [Keccak Reference, Section 1.2]).
+ * Function to XOR @p len bytes of @p data into the state, starting at byte
+ * @p offset.
  */
-static int LFSR86540(UINT8 *LFSR)
+static void xor_bytes(keccak_state_t *ctx, const uint8_t *data,
+                      unsigned offset, unsigned len)
 {
-    int result = ((*LFSR) & 0x01) != 0;
+    while (len > 0) {
+        unsigned shift = offset % 8;
+        unsigned n = MIN(8 - shift, len);
+        uint64_t lane = 0;
 
-    if (((*LFSR) & 0x80) != 0) {
-        /* Primitive polynomial over GF(2): x^8+x^6+x^5+x^4+1 */
-        (*LFSR) = ((*LFSR) << 1) ^ 0x71;
-    }
-    else {
-        (*LFSR) <<= 1;
+        if (n == 8) {
+            lane = load64(data);
+        }
+        else {
+            for (unsigned j = 0; j < n; j++) {
+                lane |= (uint64_t)data[j] << (8 * (shift + j));
+            }
+        }
+        keccak_f1600_xor_lane(ctx->state, offset / 8, lane);
+        data += n;
+        offset += n;
+        len -= n;
     }
-    return result;
 }
 
 /**
- * Function that computes the Keccak-f[1600] permutation on the given state.
+ * Function to copy @p len bytes of the state, starting at byte @p offset, to
+ * @p output.
  */
-static void KeccakF1600_StatePermute(void *state)
+static void extract_bytes(const keccak_state_t *ctx, uint8_t *output,
+                          unsigned offset, unsigned len)
 {
-    unsigned int round, x, y, j, t;
-    UINT8 LFSRstate = 0x01;
-
-    for (round = 0; round < 24; round++) {
-        {   /* === θ step (see [Keccak Reference, Section 2.3.2]) === */
-            tKeccakLane C[5];
-
-            /* Compute the parity of the columns */
-            for (x = 0; x < 5; x++)
-                C[x] = readLane(x, 0) ^ readLane(x, 1) ^ readLane(x, 2) ^ readLane(x, 3) ^
-                       readLane(x, 4);
-            for (x = 0; x < 5; x++) {
-                /* Compute the θ effect for a given column */
-                tKeccakLane D = C[(x + 4) % 5] ^ ROL64(C[(x + 1) % 5], 1);
-                /* Add the θ effect to the whole column */
-                for (y = 0; y < 5; y++)
-                    XORLane(x, y, D);
-            }
-        }
+    while (len > 0) {
+        unsigned shift = offset % 8;
+        unsigned n = MIN(8 - shift, len);
+        uint64_t lane = keccak_f1600_get_lane(ctx->state, offset / 8);
 
-        {   /* === ρ and π steps (see [Keccak Reference, Sections 2.3.3 and 2.3.4]) === */
-            tKeccakLane current;
-            /* Start at coordinates (1 0) */
-            x = 1; y = 0;
-            current = readLane(x, y);
-            /* Iterate over ((0 1)(2 3))^t * (1 0) for 0 ≤ t ≤ 23 */
-            for (t = 0; t < 24; t++) {
-                /* Compute the rotation constant r = (t+1)(t+2)/2 */
-                unsigned int r = ((t + 1) * (t + 2) / 2) % 64;
-                /* Compute ((0 1)(2 3)) * (x y) */
-                unsigned int Y = (2 * x + 3 * y) % 5; x = y; y = Y;
-                /* Swap current and state(x,y), and rotate */
-                tKeccakLane temp = readLane(x, y);
-                writeLane(x, y, ROL64(current, r));
-                current = temp;
-            }
+        if (n == 8) {
+            store64(output, lane);
         }
-
-        {   /* === χ step (see [Keccak Reference, Section 2.3.1]) === */
-            tKeccakLane temp[5];
-            for (y = 0; y < 5; y++) {
-                /* Take a copy of the plane */
-                for (x = 0; x < 5; x++)
-                    temp[x] = readLane(x, y);
-                /* Compute χ on the plane */
-                for (x = 0; x < 5; x++)
-                    writeLane(x, y, temp[x] ^ ((~temp[(x + 1) % 5]) & temp[(x + 2) % 5]));
-            }
-        }
-
-        {
-            /* === ι step (see [Keccak Reference, Section 2.3.5]) === */
-            for (j = 0; j < 7; j++) {
-                unsigned int bitPosition = (1 << j) - 1;    /* 2^j-1 */
-                if (LFSR86540(&LFSRstate)) {
-                    XORLane(0, 0, (tKeccakLane)1 << bitPosition);
-                }
+        else {
+            for (unsigned j = 0; j < n; j++) {
+                output[j] = lane >> (8 * (shift + j));
             }
         }
+        output += n;
+        offset += n;
+        len -= n;
     }
 }
 
 /*
    ================================================================
-   A readable and compact implementation of the Keccak sponge functions
-   that use the Keccak-f[1600] permutation.
+   The Keccak sponge functions that use the Keccak-f[1600] permutation.
    ================================================================
  */
 
-#include <string.h>
-#define MIN(a, b) ((a) < (b) ? (a) : (b))
-
 static void Keccak(unsigned int rate, unsigned int capacity, const unsigned char *input,
                    unsigned long long int inputByteLen, unsigned char delimitedSuffix,
                    unsigned char *output, unsigned long long int outputByteLen)
 {
-    UINT8 state[200];
-    unsigned int rateInBytes = rate / 8;
-    unsigned int blockSize = 0;
-    unsigned int i;
-
-    if (((rate + capacity) != 1600) || ((rate % 8) != 0)) {
-        return;
-    }
-
-    /* === Initialize the state === */
-    memset(state, 0, sizeof(state));
-
-    /* === Absorb all the input blocks === */
-    while (inputByteLen > 0) {
-        blockSize = MIN(inputByteLen, rateInBytes);
-        for (i = 0; i < blockSize; i++)
-            state[i] ^= input[i];
-        input += blockSize;
-        inputByteLen -= blockSize;
-
-        if (blockSize == rateInBytes) {
-            KeccakF1600_StatePermute(state);
-            blockSize = 0;
-        }
-    }
-
-    /* === Do the padding and switch to the squeezing phase === */
-    /* Absorb the last few bits and add the first bit of padding (which coincides with the
-       delimiter in delimitedSuffix) */
-    state[blockSize] ^= delimitedSuffix;
-    /* If the first bit of padding is at position rate-1, we need a whole new block for the
-       second bit of padding */
-    if (((delimitedSuffix & 0x80) != 0) && (blockSize == (rateInBytes - 1))) {
-        KeccakF1600_StatePermute(state);
-    }
-    /* Add the second bit of padding */
-    state[rateInBytes - 1] ^= 0x80;
-    /* Switch to the squeezing phase */
-    KeccakF1600_StatePermute(state);
+    keccak_state_t ctx;
 
-    /* === Squeeze out all the output blocks === */
-    while (outputByteLen > 0) {
-        blockSize = MIN(outputByteLen, rateInBytes);
-        memcpy(output, state, blockSize);
-        output += blockSize;
-        outputByteLen -= blockSize;
-
-        if (outputByteLen > 0) {
-            KeccakF1600_StatePermute(state);
-        }
-    }
+    Keccak_init(&ctx, rate, capacity, delimitedSuffix);
+    Keccak_update(&ctx, input, inputByteLen);
+    Keccak_final(&ctx, output, outputByteLen);
 }
 
 void Keccak_init(keccak_state_t *ctx, unsigned int rate, unsigned int capacity,
@@ -403,6 +297,7 @@ void Keccak_init(keccak_state_t *ctx, unsigned int rate, unsigned int capacity,
     /* === Initialize the state === */
     memset(ctx->state, 0, sizeof(ctx->state));
     ctx->i = 0;
+    ctx->squeezing = false;
 
     ctx->rate = rate;
     ctx->capacity = capacity;
@@ -414,47 +309,66 @@ void Keccak_update(keccak_state_t *ctx, const unsigned char *input,
 {
     /* === Absorb all the input blocks === */
     while (inputByteLen > 0) {
-        unsigned int blockSize = MIN(inputByteLen + ctx->i, ctx->rateInBytes);
-        while (ctx->i < blockSize) {
-            ctx->state[ctx->i] ^= *input;
-            ++(ctx->i);
-            input++;
-            --inputByteLen;
-        }
+        unsigned int blockSize = MIN(inputByteLen, ctx->rateInBytes - ctx->i);
+
+        xor_bytes(ctx, input, ctx->i, blockSize);
+        ctx->i += blockSize;
+        input += blockSize;
+        inputByteLen -= blockSize;
 
-        if (blockSize == ctx->rateInBytes) {
-            KeccakF1600_StatePermute(ctx->state);
+        if (ctx->i == ctx->rateInBytes) {
+            keccak_f1600_permute(ctx->state);
             ctx->i = 0;
         }
     }
 }
 
-void Keccak_final(keccak_state_t *ctx, unsigned char *output, unsigned long long int outputByteLen)
+static void Keccak_pad(keccak_state_t *ctx)
 {
+    const uint8_t last = 0x80;
 
     /* === Do the padding and switch to the squeezing phase === */
     /* Absorb the last few bits and add the first bit of padding (which coincides with the
        delimiter in delimitedSuffix) */
-    ctx->state[ctx->i] ^= ctx->delimitedSuffix;
+    xor_bytes(ctx, &ctx->delimitedSuffix, ctx->i, 1);
     /* If the first bit of padding is at position rate-1, we need a whole new block for the
        second bit of padding */
     if (((ctx->delimitedSuffix & 0x80) != 0) && (ctx->i == (ctx->rateInBytes - 1))) {
-        KeccakF1600_StatePermute(ctx->state);
+        keccak_f1600_permute(ctx->state);
     }
     /* Add the second bit of padding */
-    ctx->state[ctx->rateInBytes - 1] ^= 0x80;
+    xor_bytes(ctx, &last, ctx->rateInBytes - 1, 1);
     /* Switch to the squeezing phase */
-    KeccakF1600_StatePermute(ctx->state);
+    keccak_f1600_permute(ctx->state);
+    ctx->i = 0;
+    ctx->squeezing = true;
+}
+
+void Keccak_squeeze(keccak_state_t *ctx, unsigned char *output,
+                    unsigned long long int outputByteLen)
+{
+    if (!ctx->squeezing) {
+        Keccak_pad(ctx);
+    }
 
     /* === Squeeze out all the output blocks === */
     while (outputByteLen > 0) {
-        unsigned int blockSize = MIN(outputByteLen, ctx->rateInBytes);
-        memcpy(output, ctx->state, blockSize);
-        output += blockSize;
-        outputByteLen -= blockSize;
+        unsigned int blockSize;
 
-        if (outputByteLen > 0) {
-            KeccakF1600_StatePermute(ctx->state);
+        /* the next block is only computed once it is needed */
+        if (ctx->i == ctx->rateInBytes) {
+            keccak_f1600_permute(ctx->state);
+            ctx->i = 0;
         }
+        blockSize = MIN(outputByteLen, ctx->rateInBytes - ctx->i);
+        extract_bytes(ctx, output, ctx->i, blockSize);
+        ctx->i += blockSize;
+        output += blockSize;
+        outputByteLen -= blockSize;
     }
 }
+
+void Keccak_final(keccak_state_t *ctx, unsigned char *output, unsigned long long int outputByteLen)
+{
+    Keccak_squeeze(ctx, output, outputByteLen);
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_sha512
+ * @{
+ *
+ * @file
+ * @brief       SHA-512 hash function implementation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "hashes/sha512.h"
+
+#define ROTR(x, n)  (((x) >> (n)) | ((x) << (64 - (n))))
+#define Ch(x, y, z) (((x) & ((y) ^ (z))) ^ (z))
+#define Maj(x, y, z) (((x) & ((y) | (z))) | ((y) & (z)))
+#define S0(x)       (ROTR(x, 28) ^ ROTR(x, 34) ^ ROTR(x, 39))
+#define S1(x)       (ROTR(x, 14) ^ ROTR(x, 18) ^ ROTR(x, 41))
+#define s0(x)       (ROTR(x, 1) ^ ROTR(x, 8) ^ ((x) >> 7))
+#define s1(x)       (ROTR(x, 19) ^ ROTR(x, 61) ^ ((x) >> 6))
+
+static const uint64_t K[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+    0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+    0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+    0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+    0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+    0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+    0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+    0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+    0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+    0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+    0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+    0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+    0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+    0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+    0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+    0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+    0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+    0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+    0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+    0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+    0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL,
+};
+
+static uint64_t _be64dec(const uint8_t *p)
+{
+    uint64_t v = 0;
+
+    for (unsigned i = 0; i < 8; i++) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+static void _be64enc(uint8_t *p, uint64_t v)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        p[7 - i] = v >> (8 * i);
+    }
+}
+
+static void _transform(uint64_t *state, const uint8_t *data, size_t blocks)
+{
+    uint64_t W[16];
+
+    while (blocks--) {
+        uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (unsigned i = 0; i < 80; i++) {
+            uint64_t t1, t2;
+
+            if (i < 16) {
+                W[i] = _be64dec(data + 8 * i);
+            }
+            else {
+                W[i & 15] += s1(W[(i - 2) & 15]) + W[(i - 7) & 15] +
+                             s0(W[(i - 15) & 15]);
+            }
+
+            t1 = h + S1(e) + Ch(e, f, g) + K[i] + W[i & 15];
+            t2 = S0(a) + Maj(a, b, c);
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+        data += SHA512_INTERNAL_BLOCK_SIZE;
+    }
+}
+
+void sha512_init(sha512_context_t *ctx)
+{
+    ctx->count = 0;
+
+    ctx->state[0] = 0x6a09e667f3bcc908ULL;
+    ctx->state[1] = 0xbb67ae8584caa73bULL;
+    ctx->state[2] = 0x3c6ef372fe94f82bULL;
+    ctx->state[3] = 0xa54ff53a5f1d36f1ULL;
+    ctx->state[4] = 0x510e527fade682d1ULL;
+    ctx->state[5] = 0x9b05688c2b3e6c1fULL;
+    ctx->state[6] = 0x1f83d9abfb41bd6bULL;
+    ctx->state[7] = 0x5be0cd19137e2179ULL;
+}
+
+void sha512_update(sha512_context_t *ctx, const void *data, size_t len)
+{
+    const uint8_t *in = data;
+    size_t used = ctx->count % SHA512_INTERNAL_BLOCK_SIZE;
+
+    if (len == 0) {
+        return;
+    }
+    ctx->count += len;
+
+    if (used) {
+        size_t n = SHA512_INTERNAL_BLOCK_SIZE - used;
+
+        if (len < n) {
+            memcpy(ctx->buf + used, in, len);
+            return;
+        }
+        memcpy(ctx->buf + used, in, n);
+        _transform(ctx->state, ctx->buf, 1);
+        in += n;
+        len -= n;
+    }
+
+    /* whole blocks straight from the input */
+    _transform(ctx->state, in, len / SHA512_INTERNAL_BLOCK_SIZE);
+    in += len & ~(size_t)(SHA512_INTERNAL_BLOCK_SIZE - 1);
+    len &= SHA512_INTERNAL_BLOCK_SIZE - 1;
+
+    memcpy(ctx->buf, in, len);
+}
+
+void sha512_final(sha512_context_t *ctx, void *digest)
+{
+    size_t used = ctx->count % SHA512_INTERNAL_BLOCK_SIZE;
+
+    ctx->buf[used++] = 0x80;
+    if (used > SHA512_INTERNAL_BLOCK_SIZE - 16) {
+        memset(ctx->buf + used, 0, SHA512_INTERNAL_BLOCK_SIZE - used);
+        _transform(ctx->state, ctx->buf, 1);
+        used = 0;
+    }
+    memset(ctx->buf + used, 0, SHA512_INTERNAL_BLOCK_SIZE - 8 - used);
+    /* the upper 64 bit of the 128 bit length are always zero here */
+    _be64enc(ctx->buf + SHA512_INTERNAL_BLOCK_SIZE - 8, ctx->count << 3);
+    _transform(ctx->state, ctx->buf, 1);
+
+    for (unsigned i = 0; i < 8; i++) {
+        _be64enc((uint8_t *)digest + 8 * i, ctx->state[i]);
+    }
+
+    /* Clear the context state */
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void sha512(const void *data, size_t len, void *digest)
+{
+    sha512_context_t c;
+
+    sha512_init(&c);
+    sha512_update(&c, data, len);
+    sha512_final(&c, digest);
+}
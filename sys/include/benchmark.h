@@ -21,6 +21,7 @@
 #ifndef BENCHMARK_H
 #define BENCHMARK_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "irq.h"
@@ -51,6 +52,24 @@ extern "C" {
         benchmark_print_time(_benchmark_time, runs, name);      \
     }
 
+/**
+ * @brief   Measure the throughput of a given function call
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] runs      number of times to run @p func
+ * @param[in] len       number of bytes processed by each call of @p func
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_THROUGHPUT(name, runs, len, func)                 \
+    {                                                               \
+        uint32_t _benchmark_time = xtimer_now_usec();               \
+        for (unsigned long i = 0; i < runs; i++) {                  \
+            func;                                                   \
+        }                                                           \
+        _benchmark_time = (xtimer_now_usec() - _benchmark_time);    \
+        benchmark_print_throughput(_benchmark_time, runs, len, name); \
+    }
+
 /**
  * @brief   Output the given time as well as the time per run on STDIO
  *
@@ -60,6 +79,32 @@ extern "C" {
  */
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name);
 
+/**
+ * @brief   Output the given time and the resulting data rate on STDIO
+ *
+ * On boards that define CLOCK_CORECLOCK, the CPU cycles per byte are printed
+ * as well.
+ *
+ * @param[in] time      overall runtime in us
+ * @param[in] runs      number of runs
+ * @param[in] len       number of bytes processed per run
+ * @param[in] name      name to label the output
+ */
+void benchmark_print_throughput(uint32_t time, unsigned long runs, size_t len,
+                                const char *name);
+
+/**
+ * @brief   Output the given time and the number of runs per second on STDIO
+ *
+ * Unlike benchmark_print_time(), this works for any number of runs, e.g.
+ * for operations that take milliseconds each.
+ *
+ * @param[in] time      overall runtime in us
+ * @param[in] runs      number of runs
+ * @param[in] name      name to label the output
+ */
+void benchmark_print_rate(uint32_t time, unsigned long runs, const char *name);
+
 #ifdef __cplusplus
 }
 #endif
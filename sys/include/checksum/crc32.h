@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_checksum_crc32 CRC-32
+ * @ingroup     sys_checksum
+ * @brief       Table driven CRC-32 and CRC-32C checksum algorithms
+ *
+ * @details     Provides CRC-32 (ISO-HDLC, as used by Ethernet, zlib and PNG)
+ *              and CRC-32C (Castagnoli, as used by iSCSI and ext4) as well as
+ *              a generic engine for other reflected 32 bit polynomials.
+ *
+ *              All variants use slicing-by-N look-up tables, processing
+ *              @ref CONFIG_CHECKSUM_CRC32_SLICES bytes per step. The tables of
+ *              CRC-32 and CRC-32C are constant and only linked in if the
+ *              respective functions are used. Each slice costs 1 KiB of ROM
+ *              per polynomial.
+ *
+ *              With the `checksum_crc32_pclmul` module, CRC-32 and CRC-32C
+ *              are computed with the carry-less multiplication instruction
+ *              (PCLMULQDQ) of the host CPU on `native`, if available.
+ *
+ * @{
+ * @file
+ * @brief       CRC-32 definitions
+ */
+
+#ifndef CHECKSUM_CRC32_H
+#define CHECKSUM_CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of look-up tables (bytes per step), either 1, 4 or 8
+ *
+ * Fewer slices trade speed for less ROM (or RAM for @ref crc32_table_t).
+ */
+#ifndef CONFIG_CHECKSUM_CRC32_SLICES
+#define CONFIG_CHECKSUM_CRC32_SLICES    (8U)
+#endif
+
+/**
+ * @brief   Look-up tables for a generic reflected 32 bit CRC
+ */
+typedef struct {
+    uint32_t t[CONFIG_CHECKSUM_CRC32_SLICES][256];  /**< slicing tables */
+} crc32_table_t;
+
+/**
+ * @brief           Compute the look-up tables for a CRC polynomial
+ *
+ * @param[out] table    Tables to initialize
+ * @param[in]  poly     Generator polynomial in reflected (LSB first)
+ *                      notation, e.g. 0xEDB88320 for CRC-32
+ */
+void crc32_table_init(crc32_table_t *table, uint32_t poly);
+
+/**
+ * @brief           Update a CRC register using generic look-up tables
+ *
+ * No initial value or final XOR is applied, these must be realized by the
+ * caller if needed.
+ *
+ * @param[in]  table    Tables initialized by crc32_table_init()
+ * @param[in]  crc      Current value of the CRC register
+ * @param[in]  buf      Start of the memory area to checksum
+ * @param[in]  len      Number of bytes to checksum
+ *
+ * @return          New value of the CRC register
+ */
+uint32_t crc32_table_update(const crc32_table_t *table, uint32_t crc,
+                            const void *buf, size_t len);
+
+/**
+ * @brief           Update CRC-32
+ *
+ * @param[in]  crc  Return value of a previous call to crc32_calc() or
+ *                  crc32_update(), 0 to start a new checksum
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of all data passed so far
+ */
+uint32_t crc32_update(uint32_t crc, const void *buf, size_t len);
+
+/**
+ * @brief           Calculate CRC-32
+ *
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the specified memory area
+ */
+static inline uint32_t crc32_calc(const void *buf, size_t len)
+{
+    return crc32_update(0, buf, len);
+}
+
+/**
+ * @brief           Update CRC-32C
+ *
+ * @param[in]  crc  Return value of a previous call to crc32c_calc() or
+ *                  crc32c_update(), 0 to start a new checksum
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of all data passed so far
+ */
+uint32_t crc32c_update(uint32_t crc, const void *buf, size_t len);
+
+/**
+ * @brief           Calculate CRC-32C
+ *
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the specified memory area
+ */
+static inline uint32_t crc32c_calc(const void *buf, size_t len)
+{
+    return crc32c_update(0, buf, len);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_CRC32_H */
+
+/** @} */
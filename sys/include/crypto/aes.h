@@ -83,6 +83,8 @@ typedef struct {
  * @return  CIPHER_ERR_BAD_CONTEXT_SIZE if CIPHER_MAX_CONTEXT_SIZE has not
  *          been defined (which means that the cipher has not been included
  *          in the build)
+ * @return  CIPHER_ERR_UNSUPPORTED if the `crypto_aes_ni` implementation is
+ *          used and the host CPU has no AES-NI
  */
 int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 
@@ -106,6 +108,27 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   encrypts @p blocks consecutive plain-blocks (ECB) and saves them in
+ *          @p cipher
+ *
+ * Unlike calling aes_encrypt() for every block, the key schedule is only
+ * expanded once per call.
+ *
+ * @param       context   the cipher_context_t-struct to use for this
+ *                        encryption
+ * @param       plain     a pointer to @p blocks plaintext-blocks
+ * @param       cipher    a pointer to the place where the @p blocks
+ *                        ciphertext-blocks will be stored, may be @p plain
+ * @param       blocks    number of blocks to encrypt
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t blocks);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_crypto_async Asynchronous crypto jobs
+ * @ingroup     sys_crypto
+ * @brief       Asynchronous execution of cryptographic operations
+ *
+ * Cryptographic operations are described as @ref crypto_job_t and submitted
+ * with crypto_job_submit() or crypto_job_submit_batch(). The submitting thread
+ * continues immediately and is notified through the completion callback of
+ * the job, or blocks in crypto_job_wait() once it needs the result.
+ *
+ * Jobs are executed by a backend. Accelerator drivers register a
+ * @ref crypto_async_backend_t for the operations their hardware supports
+ * with crypto_async_register() and report finished jobs with
+ * crypto_async_complete(). All other jobs, and jobs a backend refuses, are
+ * executed in software by the crypto worker thread.
+ *
+ * The memory referenced by a job, including the job itself and the cipher,
+ * must remain valid until the job is completed, i.e. until crypto_job_wait()
+ * returned or crypto_job_is_done() is true. The job can be reused afterwards.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous crypto job API
+ */
+
+#ifndef CRYPTO_ASYNC_H
+#define CRYPTO_ASYNC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clist.h"
+#include "crypto/ciphers.h"
+#include "mutex.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Stack size of the crypto worker thread
+ */
+#ifndef CRYPTO_ASYNC_STACKSIZE
+#define CRYPTO_ASYNC_STACKSIZE      (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the crypto worker thread
+ */
+#ifndef CRYPTO_ASYNC_PRIO
+#define CRYPTO_ASYNC_PRIO           (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Cryptographic operations
+ */
+typedef enum {
+    CRYPTO_JOB_CIPHER_ENCRYPT,          /**< encrypt whole blocks (ECB) */
+    CRYPTO_JOB_CIPHER_DECRYPT,          /**< decrypt whole blocks (ECB) */
+    CRYPTO_JOB_CCM_ENCRYPT,             /**< CCM encryption, needs
+                                             `cipher_modes` */
+    CRYPTO_JOB_CCM_DECRYPT,             /**< CCM decryption, needs
+                                             `cipher_modes` */
+    CRYPTO_JOB_CHACHA20POLY1305_ENCRYPT,    /**< ChaCha20-Poly1305 encryption */
+    CRYPTO_JOB_CHACHA20POLY1305_DECRYPT,    /**< ChaCha20-Poly1305 decryption */
+    CRYPTO_JOB_SHA256,                  /**< SHA-256 digest, needs `hashes` */
+    CRYPTO_JOB_OP_NUMOF,                /**< number of operations */
+} crypto_job_op_t;
+
+/**
+ * @brief   Parameters of @ref CRYPTO_JOB_CIPHER_ENCRYPT and
+ *          @ref CRYPTO_JOB_CIPHER_DECRYPT
+ */
+typedef struct {
+    const cipher_t *cipher;     /**< initialized cipher */
+    const uint8_t *input;       /**< input blocks */
+    uint8_t *output;            /**< output blocks, may equal input */
+    size_t len;                 /**< length, multiple of the block size */
+} crypto_job_cipher_t;
+
+/**
+ * @brief   Parameters of @ref CRYPTO_JOB_CCM_ENCRYPT and
+ *          @ref CRYPTO_JOB_CCM_DECRYPT, see cipher_encrypt_ccm()
+ */
+typedef struct {
+    const cipher_t *cipher;     /**< initialized cipher */
+    const uint8_t *auth_data;   /**< additional data to authenticate */
+    uint32_t auth_data_len;     /**< length of @p auth_data */
+    uint8_t mac_length;         /**< length of the MAC */
+    uint8_t length_encoding;    /**< size of the length field */
+    const uint8_t *nonce;       /**< nonce */
+    size_t nonce_len;           /**< length of the nonce */
+    const uint8_t *input;       /**< input data */
+    size_t input_len;           /**< length of the input data */
+    uint8_t *output;            /**< output data */
+} crypto_job_ccm_t;
+
+/**
+ * @brief   Parameters of @ref CRYPTO_JOB_CHACHA20POLY1305_ENCRYPT and
+ *          @ref CRYPTO_JOB_CHACHA20POLY1305_DECRYPT
+ */
+typedef struct {
+    const uint8_t *key;         /**< key, CHACHA20POLY1305_KEY_BYTES long */
+    const uint8_t *nonce;       /**< nonce, CHACHA20POLY1305_NONCE_BYTES long */
+    const uint8_t *aad;         /**< additional authenticated data */
+    size_t aad_len;             /**< length of @p aad */
+    const uint8_t *input;       /**< message or ciphertext including tag */
+    size_t input_len;           /**< length of @p input */
+    uint8_t *output;            /**< ciphertext including tag or message */
+} crypto_job_aead_t;
+
+/**
+ * @brief   Parameters of @ref CRYPTO_JOB_SHA256
+ */
+typedef struct {
+    const void *data;           /**< data to hash */
+    size_t len;                 /**< length of @p data */
+    uint8_t *digest;            /**< digest, SHA256_DIGEST_LENGTH long */
+} crypto_job_hash_t;
+
+/**
+ * @brief   Forward declaration of the crypto job
+ */
+typedef struct crypto_job crypto_job_t;
+
+/**
+ * @brief   Completion callback
+ *
+ * Called in the context of the backend completing the job, which may be the
+ * crypto worker thread or an interrupt service routine. It must not block.
+ * The job is only completed after the callback returned, so it must not be
+ * submitted again from within the callback.
+ *
+ * @param[in]   job     the completed job, crypto_job_t::result holds the
+ *                      result
+ * @param[in]   arg     argument given in crypto_job_t::arg
+ */
+typedef void (*crypto_job_cb_t)(crypto_job_t *job, void *arg);
+
+/**
+ * @brief   A cryptographic job
+ */
+struct crypto_job {
+    clist_node_t node;          /**< queue entry, used internally */
+    crypto_job_op_t op;         /**< the operation */
+    union {
+        crypto_job_cipher_t cipher; /**< parameters of cipher operations */
+        crypto_job_ccm_t ccm;       /**< parameters of CCM operations */
+        crypto_job_aead_t aead;     /**< parameters of ChaCha20-Poly1305 */
+        crypto_job_hash_t hash;     /**< parameters of hash operations */
+    } params;                   /**< parameters of @ref crypto_job_t::op */
+    crypto_job_cb_t cb;         /**< completion callback, may be NULL */
+    void *arg;                  /**< argument of @ref crypto_job_t::cb */
+    /**
+     * @brief   Result of the job, valid in the completion callback and once
+     *          the job is completed
+     *
+     * The number of bytes written to the output on success, a negative
+     * error code otherwise.
+     */
+    int result;
+    volatile bool pending;      /**< true until the job is completed */
+    mutex_t done;               /**< unlocked on completion, used internally */
+};
+
+/**
+ * @brief   Forward declaration of the backend
+ */
+typedef struct crypto_async_backend crypto_async_backend_t;
+
+/**
+ * @brief   Backend executing crypto jobs, e.g. a hardware accelerator
+ */
+struct crypto_async_backend {
+    crypto_async_backend_t *next;   /**< next registered backend */
+    uint32_t ops;                   /**< supported operations, bit
+                                         (1 << @ref crypto_job_op_t) */
+    /**
+     * @brief   Queue a job for execution
+     *
+     * Must not block, may be called from interrupt context. Once the job
+     * is finished, the backend calls crypto_async_complete().
+     *
+     * @param[in]   backend     the backend
+     * @param[in]   job         the job
+     *
+     * @return  0 if the job was queued
+     * @return  negative error code if the backend does not take the job,
+     *          it is then passed on to the next backend or executed in
+     *          software
+     */
+    int (*submit)(crypto_async_backend_t *backend, crypto_job_t *job);
+};
+
+/**
+ * @brief   Start the crypto worker thread
+ *
+ * Called automatically by auto_init.
+ */
+void crypto_async_init(void);
+
+/**
+ * @brief   Register a backend
+ *
+ * Backends registered later take precedence over earlier ones.
+ *
+ * @param[in]   backend     the backend to register
+ */
+void crypto_async_register(crypto_async_backend_t *backend);
+
+/**
+ * @brief   Submit a job
+ *
+ * May be called from interrupt context.
+ *
+ * @param[in,out]   job     the job, crypto_job_t::op, crypto_job_t::params,
+ *                          crypto_job_t::cb and crypto_job_t::arg have to be
+ *                          set
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the operation is unknown
+ * @return  -EBUSY if the job is still pending
+ */
+int crypto_job_submit(crypto_job_t *job);
+
+/**
+ * @brief   Submit multiple jobs at once
+ *
+ * The jobs are queued in order, their completion order is unspecified if
+ * they end up at different backends.
+ *
+ * @note    This is a convenience over calling crypto_job_submit() for each
+ *          job, there is no batching gain: the jobs are still handed to the
+ *          backends and executed one at a time.
+ *
+ * @param[in,out]   jobs    array of jobs, see crypto_job_submit()
+ * @param[in]       num     number of jobs in @p jobs
+ *
+ * @return  0 on success
+ * @return  -EINVAL if an operation is unknown, no job was submitted then
+ * @return  -EBUSY if a job is still pending, no job was submitted then
+ */
+int crypto_job_submit_batch(crypto_job_t *jobs, size_t num);
+
+/**
+ * @brief   Wait for a job to complete
+ *
+ * Must not be called from interrupt context.
+ *
+ * @param[in]   job     a submitted job
+ *
+ * @return  crypto_job_t::result
+ */
+int crypto_job_wait(crypto_job_t *job);
+
+/**
+ * @brief   Check if a job is completed
+ *
+ * @param[in]   job     a submitted job
+ *
+ * @return  true if the job is completed
+ */
+static inline bool crypto_job_is_done(const crypto_job_t *job)
+{
+    return !job->pending;
+}
+
+/**
+ * @brief   Execute a job synchronously in software
+ *
+ * Used by the crypto worker thread. Backends can use this for jobs with
+ * parameters their hardware does not support.
+ *
+ * @param[in]   job     the job
+ *
+ * @return  the result of the job, see crypto_job_t::result
+ */
+int crypto_job_execute(crypto_job_t *job);
+
+/**
+ * @brief   Complete a job
+ *
+ * Called by backends once a job is finished. Runs the completion callback
+ * and wakes up a thread waiting in crypto_job_wait(). May be called from
+ * interrupt context.
+ *
+ * @param[in]   job     the finished job
+ * @param[in]   result  the result, see crypto_job_t::result
+ */
+void crypto_async_complete(crypto_job_t *job, int result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_ASYNC_H */
+/** @} */
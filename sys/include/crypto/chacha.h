@@ -41,6 +41,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of blocks computed at once by chacha_keystream_blocks() on
+ *          hosts with SIMD instructions (x86 and ARM NEON)
+ *
+ * 4 uses 128 bit registers (SSE2, NEON), 8 needs AVX2 on x86.
+ */
+#ifndef CONFIG_CRYPTO_CHACHA_SIMD_LANES
+#define CONFIG_CRYPTO_CHACHA_SIMD_LANES (4U)
+#endif
+
 /**
  * @brief A ChaCha cipher stream context.
  * @details Initialize with chacha_init().
@@ -81,6 +91,19 @@ int chacha_init(chacha_ctx *ctx,
  */
 void chacha_keystream_bytes(chacha_ctx *ctx, void *x);
 
+/**
+ * @brief Generate the next blocks of the keystream.
+ * @details Equivalent to calling chacha_keystream_bytes() @p blocks times,
+ *          but on hosts with SIMD instructions
+ *          @ref CONFIG_CRYPTO_CHACHA_SIMD_LANES blocks are computed at once.
+ * @warning You need to re-initialize the context with a new nonce after 2^64
+ *          encrypted blocks, or the keystream will repeat!
+ * @param[in,out] ctx    The ChaCha context
+ * @param[out]    x      The blocks of the keystream (`sizeof(x) == 64 * blocks`).
+ * @param[in]     blocks Number of blocks to generate
+ */
+void chacha_keystream_blocks(chacha_ctx *ctx, void *x, size_t blocks);
+
 /**
  * @brief Encode or decode a block of data.
  *
@@ -96,6 +96,107 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              const uint8_t *aad, size_t aadlen,
                              const uint8_t *key, const uint8_t *nonce);
 
+/**
+ * @name Incremental interface
+ *
+ * The message is processed in chunks of arbitrary size with a context of
+ * bounded size. All additional authenticated data has to be passed before
+ * the first chunk of the message. The resulting ciphertext and tag are the
+ * same as with @ref chacha20poly1305_encrypt.
+ * @{
+ */
+
+/**
+ * @brief Chacha20poly1305 incremental state struct
+ */
+typedef struct {
+    poly1305_ctx_t poly;                        /**< Running Poly1305 MAC */
+    uint32_t stream[16];                        /**< Current key stream block */
+    uint8_t key[CHACHA20POLY1305_KEY_BYTES];    /**< Key */
+    uint8_t nonce[CHACHA20POLY1305_NONCE_BYTES];/**< Nonce */
+    uint32_t counter;                           /**< Next key stream block */
+    uint64_t aadlen;                            /**< Length of the AAD so far */
+    uint64_t msglen;                            /**< Length of the message so far */
+    uint8_t stream_pos;                         /**< Used bytes of the key stream block */
+    uint8_t aad_padded;                         /**< AAD is complete and padded */
+} chacha20poly1305_stream_ctx_t;
+
+/**
+ * @brief Start an incremental encryption or decryption
+ *
+ * @param[out]  ctx         context to initialize
+ * @param[in]   key         key to use, must be CHACHA20POLY1305_KEY_BYTES long
+ * @param[in]   nonce       Nonce to use. Must be CHACHA20POLY1305_NONCE_BYTES
+ *                          long
+ */
+void chacha20poly1305_stream_init(chacha20poly1305_stream_ctx_t *ctx,
+                                  const uint8_t *key, const uint8_t *nonce);
+
+/**
+ * @brief Add a chunk of additional authenticated data
+ *
+ * @param[in]   ctx         context of the operation
+ * @param[in]   aad         chunk of additional authenticated data
+ * @param[in]   aadlen      length of the chunk
+ */
+void chacha20poly1305_stream_aad(chacha20poly1305_stream_ctx_t *ctx,
+                                 const uint8_t *aad, size_t aadlen);
+
+/**
+ * @brief Encrypt a chunk of the message
+ *
+ * It is allowed to have cipher == msg
+ *
+ * @param[in]   ctx         context of the operation
+ * @param[out]  cipher      resulting ciphertext, @p len bytes
+ * @param[in]   msg         chunk of the message
+ * @param[in]   len         length of the chunk
+ */
+void chacha20poly1305_stream_encrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *cipher, const uint8_t *msg,
+                                     size_t len);
+
+/**
+ * @brief Decrypt a chunk of the ciphertext
+ *
+ * The plaintext is not authenticated before
+ * @ref chacha20poly1305_stream_verify succeeded, it must not be used before.
+ * It is allowed to have cipher == msg
+ *
+ * @param[in]   ctx         context of the operation
+ * @param[out]  msg         resulting plaintext, @p len bytes
+ * @param[in]   cipher      chunk of the ciphertext, without the tag
+ * @param[in]   len         length of the chunk
+ */
+void chacha20poly1305_stream_decrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *msg, const uint8_t *cipher,
+                                     size_t len);
+
+/**
+ * @brief Finish an encryption and generate the tag
+ *
+ * The context is wiped afterwards.
+ *
+ * @param[in]   ctx         context of the operation
+ * @param[out]  tag         resulting tag, CHACHA20POLY1305_TAG_BYTES long
+ */
+void chacha20poly1305_stream_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                    uint8_t *tag);
+
+/**
+ * @brief Finish a decryption and verify the received tag
+ *
+ * The context is wiped afterwards.
+ *
+ * @param[in]   ctx         context of the operation
+ * @param[in]   tag         received tag, CHACHA20POLY1305_TAG_BYTES long
+ *
+ * @return      1 if the tag is valid, 0 otherwise
+ */
+int chacha20poly1305_stream_verify(chacha20poly1305_stream_ctx_t *ctx,
+                                   const uint8_t *tag);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
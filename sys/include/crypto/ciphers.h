@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -56,6 +57,8 @@ extern "C" {
 #define CIPHER_ERR_INVALID_LENGTH     -4
 #define CIPHER_ERR_ENC_FAILED         -5
 #define CIPHER_ERR_DEC_FAILED         -6
+/** Is returned by the cipher_init functions, if the hardware lacks support */
+#define CIPHER_ERR_UNSUPPORTED        -7
 /** Is returned by the cipher_init functions, if the corresponding alogirithm has not been included in the build */
 #define CIPHER_ERR_BAD_CONTEXT_SIZE    0
 /**  Returned by cipher_init upon successful initialization of a cipher. */
@@ -91,6 +94,17 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief the multi-block encrypt function (optional, may be NULL)
+     *
+     * Encrypts @p blocks consecutive blocks independently of each other (as
+     * in ECB mode). Backends can use this to set up the key or the hardware
+     * only once and to pipeline the blocks. @p plain and @p cipher may be
+     * the same buffer.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *plain,
+                          uint8_t *cipher, size_t blocks);
 } cipher_interface_t;
 
 
@@ -147,6 +161,27 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
 
+/**
+ * @brief Encrypt @p blocks consecutive blocks of BLOCK_SIZE length
+ *
+ * Uses cipher_interface_t::encrypt_blocks if the cipher provides it and falls
+ * back to calling cipher_interface_t::encrypt for every block otherwise.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt, @p blocks * BLOCK_SIZE
+ *                   long
+ * @param output     pointer to allocated memory for encrypted data. It has to
+ *                   be of size @p blocks * BLOCK_SIZE and may be @p input
+ * @param blocks     number of blocks to encrypt
+ *
+ * @return           The result of the encrypt operation of the underlying
+ *                   cipher, which is always 1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_crypto_ed25519 Ed25519 signature verification
+ * @ingroup     sys_crypto
+ * @brief       Fast verification of Ed25519 signatures
+ *
+ * Verifies Ed25519 signatures as specified in
+ * [RFC 8032](https://tools.ietf.org/html/rfc8032), e.g. SUIT manifests or
+ * DTLS certificate chains. Signing is not provided, use a package such as
+ * `c25519` for it.
+ *
+ * Three ways of verifying are offered:
+ *
+ * - ed25519_verify() checks a single signature.
+ * - ed25519_verify_key() uses a @ref ed25519_key_t with precomputed
+ *   multiples of a public key that is used over and over again, e.g. the
+ *   key of the update server. Initializing the key costs about as much as
+ *   one verification, every verification with it takes about half the
+ *   time.
+ * - ed25519_verify_batch() checks many signatures at once by verifying a
+ *   random linear combination of the signature equations. Signatures of the
+ *   same key share their work. If the batch fails, at least one signature is
+ *   invalid, the caller can fall back to single verification to find it.
+ *
+ * The verification equation is checked with the cofactor, as permitted by
+ * RFC 8032, section 5.1.7. Thus all three functions accept the same
+ * signatures. Non-canonical encodings of `S` and of points are rejected.
+ *
+ * The functions only process public data and therefore run in variable
+ * time.
+ *
+ * Field arithmetic uses 64 bit limbs if the compiler supports 128 bit
+ * integers and 32 bit limbs otherwise. The fixed-base table of the base
+ * point takes @ref CONFIG_CRYPTO_ED25519_COMB_ROWS * 960 bytes of ROM, of
+ * which only the first row is linked in when ed25519_verify_key() is not
+ * used.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Ed25519 signature verification
+ */
+
+#ifndef CRYPTO_ED25519_H
+#define CRYPTO_ED25519_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ED25519_PUBLIC_KEY_BYTES    (32U)   /**< Public key length in bytes */
+#define ED25519_SIGNATURE_BYTES     (64U)   /**< Signature length in bytes */
+
+/**
+ * @brief   Number of rows of the fixed-base tables, either 2, 4, 8 or 16
+ *
+ * Each row holds eight points and saves 256 / rows point doublings per
+ * verification with ed25519_verify_key().
+ */
+#ifndef CONFIG_CRYPTO_ED25519_COMB_ROWS
+#define CONFIG_CRYPTO_ED25519_COMB_ROWS     (8U)
+#endif
+
+/**
+ * @brief   Maximum number of signatures combined by ed25519_verify_batch()
+ *
+ * Larger batches are processed in chunks of this size. Each signature in a
+ * chunk takes about 2 KiB of stack.
+ */
+#ifndef CONFIG_CRYPTO_ED25519_BATCH_SIZE
+#define CONFIG_CRYPTO_ED25519_BATCH_SIZE    (4U)
+#endif
+
+/**
+ * @cond INTERNAL
+ */
+typedef struct {
+#ifdef __SIZEOF_INT128__
+    uint64_t v[5];
+#else
+    int32_t v[10];
+#endif
+} ed25519_fe_t;
+
+typedef struct {
+    ed25519_fe_t yplusx;
+    ed25519_fe_t yminusx;
+    ed25519_fe_t xy2d;
+} ed25519_precomp_t;
+/**
+ * @endcond
+ */
+
+/**
+ * @brief   Public key with precomputed fixed-base tables
+ *
+ * Takes @ref CONFIG_CRYPTO_ED25519_COMB_ROWS * 960 bytes of RAM.
+ */
+typedef struct {
+    uint8_t pk[ED25519_PUBLIC_KEY_BYTES];   /**< the public key */
+    /**
+     * @brief   Multiples of the negated key, used internally
+     */
+    ed25519_precomp_t table[CONFIG_CRYPTO_ED25519_COMB_ROWS][8];
+} ed25519_key_t;
+
+/**
+ * @brief   A signature to be verified by ed25519_verify_batch()
+ */
+typedef struct {
+    const uint8_t *sig;         /**< signature, ED25519_SIGNATURE_BYTES long */
+    const void *msg;            /**< signed message */
+    size_t len;                 /**< length of @p msg */
+    const uint8_t *pk;          /**< public key, ignored if @p key is set */
+    const ed25519_key_t *key;   /**< precomputed key or NULL */
+} ed25519_batch_entry_t;
+
+/**
+ * @brief   Verify an Ed25519 signature
+ *
+ * @param[in]   sig     signature, ED25519_SIGNATURE_BYTES long
+ * @param[in]   msg     signed message
+ * @param[in]   len     length of @p msg
+ * @param[in]   pk      public key, ED25519_PUBLIC_KEY_BYTES long
+ *
+ * @return  0 if the signature is valid
+ * @return  -EINVAL if @p pk is not a valid public key
+ * @return  -EBADMSG if the signature is invalid
+ */
+int ed25519_verify(const uint8_t *sig, const void *msg, size_t len,
+                   const uint8_t *pk);
+
+/**
+ * @brief   Precompute the fixed-base tables of a public key
+ *
+ * @param[out]  key     key to initialize
+ * @param[in]   pk      public key, ED25519_PUBLIC_KEY_BYTES long
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p pk is not a valid public key
+ */
+int ed25519_key_init(ed25519_key_t *key, const uint8_t *pk);
+
+/**
+ * @brief   Verify an Ed25519 signature with a precomputed key
+ *
+ * @param[in]   key     key initialized by ed25519_key_init()
+ * @param[in]   sig     signature, ED25519_SIGNATURE_BYTES long
+ * @param[in]   msg     signed message
+ * @param[in]   len     length of @p msg
+ *
+ * @return  0 if the signature is valid
+ * @return  -EBADMSG if the signature is invalid
+ */
+int ed25519_verify_key(const ed25519_key_t *key, const uint8_t *sig,
+                       const void *msg, size_t len);
+
+/**
+ * @brief   Verify multiple Ed25519 signatures at once
+ *
+ * The coefficients of the linear combination are derived from a hash of
+ * all signatures, keys and messages of a chunk, so the result is
+ * deterministic. An invalid signature passes with a probability of at most
+ * 2^-125.
+ *
+ * @param[in]   entries     signatures to verify
+ * @param[in]   num         number of entries
+ *
+ * @return  0 if all signatures are valid
+ * @return  -EBADMSG if at least one signature or public key is invalid
+ */
+int ed25519_verify_batch(const ed25519_batch_entry_t *entries, size_t num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_ED25519_H */
+/** @} */
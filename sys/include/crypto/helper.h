@@ -38,6 +38,19 @@ extern "C" {
 void crypto_block_inc_ctr(uint8_t block[16], int L);
 
 
+/**
+ * @brief   XORs two buffers word-wise: @p out = @p a ^ @p b
+ *
+ * @p out may be the same buffer as @p a or @p b. None of the buffers have to
+ * be aligned.
+ *
+ * @param[out]  out     result, @p len bytes
+ * @param[in]   a       first operand, @p len bytes
+ * @param[in]   b       second operand, @p len bytes
+ * @param[in]   len     number of bytes to XOR
+ */
+void crypto_xor(uint8_t *out, const uint8_t *a, const uint8_t *b, size_t len);
+
 /**
  * @brief   Compares two blocks of same size in deterministic time.
  *
@@ -106,6 +106,140 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
                        const uint8_t *input, size_t input_len,
                        uint8_t *output);
 
+/**
+ * @brief   Context for incremental CCM encryption and decryption
+ *
+ * CCM authenticates the total lengths of the additional data and of the
+ * payload in its first block, so both have to be known when calling
+ * @ref cipher_ccm_init. Apart from that, data can be passed in chunks of
+ * arbitrary size, the context never holds more than one block of buffered
+ * data.
+ */
+typedef struct {
+    const cipher_t *cipher;             /**< Already initialized cipher */
+    uint8_t mac[CCM_BLOCK_SIZE];        /**< Running CBC-MAC */
+    uint8_t counter[CCM_BLOCK_SIZE];    /**< Counter of the next stream block */
+    uint8_t s0[CCM_BLOCK_SIZE];         /**< First stream block, encrypts the tag */
+    uint8_t stream[CCM_BLOCK_SIZE];     /**< Current key stream block */
+    uint32_t auth_data_left;            /**< Additional data still expected */
+    size_t input_left;                  /**< Payload still expected */
+    uint8_t mac_pos;                    /**< Bytes absorbed into the MAC block */
+    uint8_t stream_pos;                 /**< Bytes used of the key stream block */
+    uint8_t mac_length;                 /**< Length of the MAC */
+    uint8_t nonce_len;                  /**< Length of the nonce */
+} cipher_ccm_ctx_t;
+
+/**
+ * @brief Initialize an incremental CCM operation.
+ *
+ * @param ctx              Context to initialize
+ * @param cipher           Already initialized cipher struct, has to stay valid
+ *                         until the operation is finished
+ * @param auth_data_len    Total length of the additional data,
+ *                         max (2^16 - 2^8)
+ * @param mac_length       length of the MAC (between 4 and 16 - only even
+ *                         values)
+ * @param length_encoding  maximal supported length of plaintext
+ *                         (2^(8*length_enc)).
+ * @param nonce            Nounce for ctr mode encryption
+ * @param nonce_len        Length of the nonce in octets
+ *                         (maximum: 15-length_encoding)
+ * @param input_len        Total length of the payload (plaintext), excluding
+ *                         the MAC
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_init(cipher_ccm_ctx_t *ctx, const cipher_t *cipher,
+                    uint32_t auth_data_len, uint8_t mac_length,
+                    uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len,
+                    size_t input_len);
+
+/**
+ * @brief Add a chunk of additional data to authenticate.
+ *
+ * All additional data has to be passed before the first payload chunk.
+ *
+ * @param ctx              Context of the operation
+ * @param auth_data        Chunk of additional data
+ * @param len              Length of the chunk
+ *
+ * @return                 0 on success
+ * @return                 CCM_ERR_INVALID_DATA_LENGTH if more data was passed
+ *                         than declared in @ref cipher_ccm_init
+ * @return                 A negative error code if the cipher failed
+ */
+int cipher_ccm_update_aad(cipher_ccm_ctx_t *ctx,
+                          const uint8_t *auth_data, size_t len);
+
+/**
+ * @brief Encrypt and authenticate a chunk of plaintext.
+ *
+ * @p input and @p output may be the same buffer.
+ *
+ * @param ctx              Context of the operation
+ * @param input            Chunk of plaintext
+ * @param len              Length of the chunk
+ * @param output           Buffer for the ciphertext, @p len bytes
+ *
+ * @return                 Number of bytes written to @p output
+ * @return                 CCM_ERR_INVALID_DATA_LENGTH if the additional data
+ *                         is incomplete or if more payload was passed than
+ *                         declared in @ref cipher_ccm_init
+ * @return                 A negative error code if the cipher failed
+ */
+int cipher_ccm_encrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output);
+
+/**
+ * @brief Decrypt a chunk of ciphertext.
+ *
+ * The plaintext is not authenticated before @ref cipher_ccm_decrypt_finish
+ * succeeded. It must not be used or passed on before that.
+ * @p input and @p output may be the same buffer.
+ *
+ * @param ctx              Context of the operation
+ * @param input            Chunk of ciphertext, without the MAC
+ * @param len              Length of the chunk
+ * @param output           Buffer for the plaintext, @p len bytes
+ *
+ * @return                 Number of bytes written to @p output
+ * @return                 CCM_ERR_INVALID_DATA_LENGTH if the additional data
+ *                         is incomplete or if more payload was passed than
+ *                         declared in @ref cipher_ccm_init
+ * @return                 A negative error code if the cipher failed
+ */
+int cipher_ccm_decrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output);
+
+/**
+ * @brief Finish an encryption and write the MAC.
+ *
+ * @param ctx              Context of the operation, wiped afterwards
+ * @param mac              Buffer for the MAC, of size mac_length
+ *
+ * @return                 Length of the MAC on success
+ * @return                 CCM_ERR_INVALID_DATA_LENGTH if less data was passed
+ *                         than declared in @ref cipher_ccm_init
+ * @return                 A negative error code if the cipher failed
+ */
+int cipher_ccm_encrypt_finish(cipher_ccm_ctx_t *ctx, uint8_t *mac);
+
+/**
+ * @brief Finish a decryption and verify the received MAC.
+ *
+ * @param ctx              Context of the operation, wiped afterwards
+ * @param mac              Received MAC, of size mac_length
+ *
+ * @return                 0 if the MAC is valid
+ * @return                 CCM_ERR_INVALID_CBC_MAC if the MAC does not match
+ * @return                 CCM_ERR_INVALID_DATA_LENGTH if less data was passed
+ *                         than declared in @ref cipher_ccm_init
+ * @return                 A negative error code if the cipher failed
+ */
+int cipher_ccm_decrypt_finish(cipher_ccm_ctx_t *ctx, const uint8_t *mac);
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of key stream blocks generated with one call of
+ *          @ref cipher_encrypt_blocks()
+ *
+ * This much times the block size is allocated on the stack by
+ * @ref cipher_encrypt_ctr().
+ */
+#ifndef CONFIG_CRYPTO_CTR_PARALLEL_BLOCKS
+#define CONFIG_CRYPTO_CTR_PARALLEL_BLOCKS   (4U)
+#endif
+
 /**
  * @brief Encrypt data of arbitrary length in counter mode.
  *
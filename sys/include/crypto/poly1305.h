@@ -44,9 +44,16 @@ extern "C" {
  * @brief Poly1305 context
  */
 typedef struct {
+#if defined(__SIZEOF_INT128__) || defined(DOXYGEN)
+    /* 64x64->128 bit multiplications are available, use 64 bit limbs */
+    uint64_t r[2];                          /**< first key part         */
+    uint64_t pad[2];                        /**< Second key part        */
+    uint64_t h[3];                          /**< Hash                   */
+#else
     uint32_t r[4];                          /**< first key part         */
     uint32_t pad[4];                        /**< Second key part        */
     uint32_t h[5];                          /**< Hash                   */
+#endif
     uint32_t c[4];                          /**< Message chunk          */
     size_t c_idx;                           /**< Chunk length            */
 } poly1305_ctx_t;
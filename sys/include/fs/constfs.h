@@ -15,6 +15,10 @@
  * RIOT VFS layer. The implementation uses an array of @c constfs_file_t objects
  * as its storage back-end.
  *
+ * The file contents are usually constant arrays in (memory mapped) flash, so
+ * they can be accessed in place using vfs_mmap() or vfs_read_direct() instead
+ * of being copied to RAM.
+ *
  * @{
  * @file
  * @brief   ConstFS public API
@@ -34,6 +34,15 @@
  * @defgroup    sys_hashes_sha256 SHA-256
  * @ingroup     sys_hashes_unkeyed
  * @brief       Implementation of the SHA-256 hashing function
+ *
+ * The compression function can be replaced by faster variants with the
+ * following modules:
+ *
+ *  * hashes_sha2xx_unroll: unrolls eight rounds and keeps the working
+ *    variables in registers, more flash but faster e.g. on Cortex-M
+ *  * hashes_sha_ni: uses the x86 SHA extensions if the CPU supports them,
+ *    only available on `native`
+ *
  * @{
  *
  * @file
@@ -67,6 +76,16 @@ extern "C" {
  */
 #define SHA256_INTERNAL_BLOCK_SIZE (64)
 
+/**
+ * @brief   Number of messages hashed in parallel by @ref sha256_mb
+ *
+ * Has to be a power of two. With 4 lanes the lanes fit into 128 bit SIMD
+ * registers (e.g. SSE2 or NEON), 8 lanes need 256 bit registers (AVX2).
+ */
+#ifndef CONFIG_HASHES_SHA256_MB_LANES
+#define CONFIG_HASHES_SHA256_MB_LANES   (4U)
+#endif
+
 /**
  * @brief Context for cipher operations based on sha256
  */
@@ -242,6 +261,27 @@ int sha256_chain_verify_element(void *element,
                                 void *tail_element,
                                 size_t chain_length);
 
+/**
+ * @brief   SHA-256 hashing of multiple independent messages of equal length
+ *
+ * Hashes up to @ref CONFIG_HASHES_SHA256_MB_LANES messages in parallel, each
+ * in its own lane of a SIMD vector. On platforms without SIMD instructions
+ * the lanes are processed one after another and there is no speedup over
+ * calling @ref sha256 for each message.
+ *
+ * This is useful to e.g. verify the nodes of a level of a Merkle tree.
+ *
+ * @note    Only available with the `hashes_sha256_mb` module.
+ *
+ * @param[in]  data     array of @p num pointers to the messages
+ * @param[in]  len      length of each message
+ * @param[out] digests  array of @p num pointers to buffers of
+ *                      SHA256_DIGEST_LENGTH bytes for the digests
+ * @param[in]  num      number of messages
+ */
+void sha256_mb(const void *const data[], size_t len, void *const digests[],
+               size_t num);
+
 #ifdef __cplusplus
 }
 #endif
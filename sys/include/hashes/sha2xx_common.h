@@ -50,6 +50,7 @@
 #ifndef HASHES_SHA2XX_COMMON_H
 #define HASHES_SHA2XX_COMMON_H
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdint.h>
 
@@ -129,6 +130,27 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
  */
 void sha2xx_final(sha2xx_context_t *ctx, void *digest, size_t dig_len);
 
+/**
+ * @brief   Check if the host CPU supports the SHA extensions
+ *
+ * @note    Only available with the `hashes_sha_ni` module
+ *
+ * @return  true if the SHA-NI transform can be used
+ */
+bool sha2xx_sha_ni_supported(void);
+
+/**
+ * @brief   SHA-256 block compression function using the x86 SHA extensions
+ *
+ * @note    Only available with the `hashes_sha_ni` module
+ *
+ * @param[in,out]   state   SHA-256 state to update
+ * @param[in]       data    consecutive 64 byte blocks to compress
+ * @param[in]       blocks  number of blocks
+ */
+void sha2xx_transform_sha_ni(uint32_t *state, const unsigned char *data,
+                             size_t blocks);
+
 #ifdef __cplusplus
 }
 #endif
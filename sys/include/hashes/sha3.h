@@ -27,6 +27,8 @@
 #ifndef HASHES_SHA3_H
 #define HASHES_SHA3_H
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #ifdef __cplusplus
@@ -48,12 +50,28 @@ extern "C" {
  */
 #define SHA3_512_DIGEST_LENGTH 64
 
+/**
+ * @brief   Use the bit-interleaved Keccak-f[1600] implementation
+ *
+ * The bit-interleaved implementation only needs 32 bit operations and is
+ * considerably faster on 32 bit CPUs such as Cortex-M. Defaults to 1 except
+ * on native and 64 bit CPUs, where the 64 bit implementation is used.
+ */
+#ifndef CONFIG_HASHES_SHA3_INTERLEAVED
+#if defined(CPU_NATIVE) || (UINTPTR_MAX > UINT32_MAX)
+#define CONFIG_HASHES_SHA3_INTERLEAVED  0
+#else
+#define CONFIG_HASHES_SHA3_INTERLEAVED  1
+#endif
+#endif
+
 /**
  * @brief Context for operations on a sponge with keccak permutation
  */
 typedef struct {
-    /** State of the Keccak sponge */
-    unsigned char state[200];
+    /** State of the Keccak sponge, the representation of the lanes depends
+     *  on the permutation implementation */
+    uint64_t state[25];
     /** Current position within the state */
     unsigned int i;
     /** The suffix used for padding */
@@ -64,6 +82,8 @@ typedef struct {
     unsigned int capacity;
     /** The rate in bytes of the sponge */
     unsigned int rateInBytes;
+    /** Whether the sponge is in the squeezing phase */
+    bool squeezing;
 } keccak_state_t;
 
 /**
@@ -97,6 +117,20 @@ void Keccak_update(keccak_state_t *ctx, const unsigned char *input,
 void Keccak_final(keccak_state_t *ctx, unsigned char *output,
                   unsigned long long int outputByteLen);
 
+/**
+ * @brief Squeeze data from a sponge, can be called multiple times
+ *
+ * The first call pads the absorbed data and switches the sponge to the
+ * squeezing phase, no more data can be absorbed afterwards. Subsequent calls
+ * continue the output stream where the previous one ended.
+ *
+ * @param[in,out] ctx        context handle of the sponge
+ * @param[out] output        the squeezed data
+ * @param[in] outputByteLen  size of the data to be squeezed.
+ */
+void Keccak_squeeze(keccak_state_t *ctx, unsigned char *output,
+                    unsigned long long int outputByteLen);
+
 /**
  * @brief SHA3-256 initialization.  Begins a SHA3-256 operation.
  *
@@ -185,6 +219,58 @@ void sha3_384(void *digest, const void *data, size_t len);
  */
 void sha3_512(void *digest, const void *data, size_t len);
 
+/**
+ * @brief SHAKE128 initialization.  Begins a SHAKE128 operation.
+ *
+ * Data is absorbed with sha3_update(), output is squeezed with
+ * shake_squeeze().
+ *
+ * @param[in] ctx  keccak_state_t handle to initialise
+ */
+void shake128_init(keccak_state_t *ctx);
+
+/**
+ * @brief SHAKE256 initialization.  Begins a SHAKE256 operation.
+ *
+ * Data is absorbed with sha3_update(), output is squeezed with
+ * shake_squeeze().
+ *
+ * @param[in] ctx  keccak_state_t handle to initialise
+ */
+void shake256_init(keccak_state_t *ctx);
+
+/**
+ * @brief Squeeze output of a SHAKE128 or SHAKE256 operation
+ *
+ * Can be called multiple times to produce an output stream of any length.
+ * After the first call, no more data can be added with sha3_update().
+ *
+ * @param[in,out] ctx    context handle to use
+ * @param[out] output    buffer for the output
+ * @param[in] output_len number of bytes to squeeze
+ */
+void shake_squeeze(keccak_state_t *ctx, void *output, size_t output_len);
+
+/**
+ * @brief A wrapper function to compute SHAKE128 of one buffer
+ *
+ * @param[out] output    buffer for the output
+ * @param[in] output_len desired output length in bytes
+ * @param[in] data       pointer to the buffer to generate the output from
+ * @param[in] len        length of the buffer
+ */
+void shake128(void *output, size_t output_len, const void *data, size_t len);
+
+/**
+ * @brief A wrapper function to compute SHAKE256 of one buffer
+ *
+ * @param[out] output    buffer for the output
+ * @param[in] output_len desired output length in bytes
+ * @param[in] data       pointer to the buffer to generate the output from
+ * @param[in] len        length of the buffer
+ */
+void shake256(void *output, size_t output_len, const void *data, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
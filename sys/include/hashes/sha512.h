@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_hashes_sha512 SHA-512
+ * @ingroup     sys_hashes_unkeyed
+ * @brief       Implementation of the SHA-512 hashing function
+ *
+ * @{
+ *
+ * @file
+ * @brief       Header definitions for the SHA-512 hash function
+ */
+
+#ifndef HASHES_SHA512_H
+#define HASHES_SHA512_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Length of SHA-512 digests in bytes
+ */
+#define SHA512_DIGEST_LENGTH            (64)
+
+/**
+ * @brief   1024 Bit (128 Byte) internally used block size for SHA-512
+ */
+#define SHA512_INTERNAL_BLOCK_SIZE      (128)
+
+/**
+ * @brief   Context for SHA-512 operations
+ */
+typedef struct {
+    uint64_t state[8];                          /**< global state */
+    uint64_t count;                             /**< processed bytes */
+    uint8_t buf[SHA512_INTERNAL_BLOCK_SIZE];    /**< data buffer */
+} sha512_context_t;
+
+/**
+ * @brief SHA-512 initialization. Begins a SHA-512 operation.
+ *
+ * @param ctx  sha512_context_t handle to init
+ */
+void sha512_init(sha512_context_t *ctx);
+
+/**
+ * @brief Add bytes into the hash
+ *
+ * @param ctx      sha512_context_t handle to use
+ * @param[in] data Input data
+ * @param[in] len  Length of @p data
+ */
+void sha512_update(sha512_context_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief SHA-512 finalization. Pads the input data, exports the hash value,
+ * and clears the context state.
+ *
+ * @param ctx    sha512_context_t handle to use
+ * @param digest resulting digest, this is the hash of all the bytes
+ */
+void sha512_final(sha512_context_t *ctx, void *digest);
+
+/**
+ * @brief A wrapper function to simplify the generation of a hash, this is
+ * useful for generating sha512 for one buffer
+ *
+ * @param[in] data    pointer to the buffer to generate hash from
+ * @param[in] len     length of the buffer
+ * @param[out] digest pointer to an array for the result, length must
+ *                    be SHA512_DIGEST_LENGTH
+ */
+void sha512(const void *data, size_t len, void *digest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HASHES_SHA512_H */
+/** @} */
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_kvstore Key-value store on MTD
+ * @ingroup     sys
+ * @brief       Log-structured key-value store for small records on MTD
+ *              devices
+ *
+ * Records are appended to MTD sectors and never modified in place, so
+ * updating a key costs a single write of the new record. Each record is
+ * protected by a CRC-32, an interrupted write is detected when the store is
+ * initialized and the record is ignored.
+ *
+ * A hash index in RAM maps the keys to the location of their newest record,
+ * so lookups read the record directly without scanning the device. The index
+ * is rebuilt by kvstore_init(). It needs one @ref kvstore_entry_t per key,
+ * including deleted keys that still have records on the device.
+ *
+ * Outdated records are reclaimed by compacting sectors: the live records of
+ * the sector with the most garbage are copied to the active sector and the
+ * sector is erased. This happens when a write runs out of space, but can be
+ * done ahead of time by calling kvstore_gc() from a low priority thread, so
+ * writes don't have to wait for it. One sector is always kept free for the
+ * compaction.
+ *
+ * Erase counts are stored in the sector headers. New sectors are taken from
+ * the free sectors with the least erase cycles, and sectors holding static
+ * data are compacted once they fall behind by more than
+ * @ref CONFIG_KVSTORE_WEAR_DELTA erase cycles, so their sectors take part in
+ * the rotation.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += kvstore
+ * ```
+ *
+ * The store uses the sectors of the device starting at a given sector. It
+ * needs an entry in @p sectors for each of them and an index with a power of
+ * two number of entries:
+ *
+ * ```
+ * static kvstore_sector_t sectors[8];
+ * static kvstore_entry_t index[64];
+ * static kvstore_t kv = KVSTORE_INIT(MTD_0, 0, sectors, index);
+ *
+ * kvstore_init(&kv);
+ * kvstore_set(&kv, "boot_count", &count, sizeof(count));
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Key-value store interface definitions
+ */
+
+#ifndef KVSTORE_H
+#define KVSTORE_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_kvstore_conf Key-value store compile configurations
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Maximum length of a key
+ */
+#ifndef CONFIG_KVSTORE_KEY_LEN_MAX
+#define CONFIG_KVSTORE_KEY_LEN_MAX      (32)
+#endif
+
+/**
+ * @brief   Alignment of the records on the device
+ *
+ * Must be a power of two and match the write granularity of the device.
+ * At most 8.
+ */
+#ifndef CONFIG_KVSTORE_ALIGN
+#define CONFIG_KVSTORE_ALIGN            (4)
+#endif
+
+/**
+ * @brief   kvstore_gc() compacts sectors while fewer sectors than this are
+ *          free
+ */
+#ifndef CONFIG_KVSTORE_GC_FREE_SECTORS
+#define CONFIG_KVSTORE_GC_FREE_SECTORS  (2)
+#endif
+
+/**
+ * @brief   Difference in erase cycles after which the least worn sector is
+ *          compacted, even if it contains no garbage
+ */
+#ifndef CONFIG_KVSTORE_WEAR_DELTA
+#define CONFIG_KVSTORE_WEAR_DELTA       (64)
+#endif
+/** @} */
+
+/**
+ * @brief   Unused index entry
+ */
+#define KVSTORE_ADDR_NONE               (UINT32_MAX)
+
+/**
+ * @brief   Static initializer for @ref kvstore_t
+ *
+ * @param[in]   _dev        the MTD device
+ * @param[in]   _first      the first sector of @p _dev used by the store
+ * @param[in]   _sectors    array of @ref kvstore_sector_t, one per sector
+ * @param[in]   _index      array of @ref kvstore_entry_t, the number of
+ *                          entries must be a power of two
+ */
+#define KVSTORE_INIT(_dev, _first, _sectors, _index) \
+{ \
+    .dev = _dev, \
+    .first_sector = _first, \
+    .sectors = _sectors, \
+    .sector_num = ARRAY_SIZE(_sectors), \
+    .index = _index, \
+    .index_size = ARRAY_SIZE(_index), \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   Index entry
+ */
+typedef struct {
+    uint32_t addr;              /**< offset of the newest record of the key
+                                     in the store, @ref KVSTORE_ADDR_NONE
+                                     if unused */
+    uint16_t hash;              /**< hash of the key */
+} kvstore_entry_t;
+
+/**
+ * @brief   State of a sector
+ */
+typedef struct {
+    uint32_t seq;               /**< sequence number, 0 if the sector is
+                                     free */
+    uint32_t erase_count;       /**< number of erase cycles */
+    uint32_t used;              /**< bytes written */
+    uint32_t live;              /**< bytes of records in the index */
+} kvstore_sector_t;
+
+/**
+ * @brief   Key-value store
+ */
+typedef struct {
+    mtd_dev_t *dev;             /**< the MTD device */
+    uint32_t first_sector;      /**< first sector of the store */
+    kvstore_sector_t *sectors;  /**< state of the sectors */
+    unsigned sector_num;        /**< number of sectors */
+    kvstore_entry_t *index;     /**< the index */
+    unsigned index_size;        /**< number of index entries */
+    unsigned entries;           /**< number of used index entries */
+    uint32_t sector_size;       /**< size of a sector in bytes */
+    uint32_t seq;               /**< sequence number of the active sector */
+    unsigned active;            /**< the sector records are appended to */
+    unsigned free;              /**< number of free sectors */
+    mutex_t lock;               /**< protects the store */
+} kvstore_t;
+
+/**
+ * @brief   Initialize a store
+ *
+ * Initializes the MTD device, formats sectors not belonging to a store and
+ * builds the index from the records found on the device.
+ *
+ * @param[in,out]   kv      the store
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the configuration is invalid
+ * @return  -ENOMEM if the index is too small for the keys found
+ * @return  <0 on MTD errors
+ */
+int kvstore_init(kvstore_t *kv);
+
+/**
+ * @brief   Erase all records and reinitialize the store
+ *
+ * @param[in,out]   kv      the store
+ *
+ * @return  0 on success
+ * @return  <0 on error
+ */
+int kvstore_format(kvstore_t *kv);
+
+/**
+ * @brief   Store a value
+ *
+ * @param[in,out]   kv      the store
+ * @param[in]       key     the key, a string of at most
+ *                          @ref CONFIG_KVSTORE_KEY_LEN_MAX characters
+ * @param[in]       value   the value
+ * @param[in]       len     length of @p value
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the key is empty or too long
+ * @return  -ENOMEM if the index is full
+ * @return  -ENOSPC if the store is full
+ * @return  <0 on MTD errors
+ */
+int kvstore_set(kvstore_t *kv, const char *key, const void *value, size_t len);
+
+/**
+ * @brief   Read a value
+ *
+ * @param[in,out]   kv      the store
+ * @param[in]       key     the key
+ * @param[out]      value   buffer for the value
+ * @param[in]       len     size of @p value
+ *
+ * @return  length of the value on success, only the first @p len bytes are
+ *          copied if it is larger than the buffer
+ * @return  -ENOENT if the key does not exist
+ * @return  <0 on MTD errors
+ */
+ssize_t kvstore_get(kvstore_t *kv, const char *key, void *value, size_t len);
+
+/**
+ * @brief   Delete a key
+ *
+ * @param[in,out]   kv      the store
+ * @param[in]       key     the key
+ *
+ * @return  0 on success
+ * @return  -ENOENT if the key does not exist
+ * @return  -ENOSPC if the store is full
+ * @return  <0 on MTD errors
+ */
+int kvstore_delete(kvstore_t *kv, const char *key);
+
+/**
+ * @brief   Compact a sector if less than @ref CONFIG_KVSTORE_GC_FREE_SECTORS
+ *          sectors are free
+ *
+ * Meant to be called when the system is idle, so later writes find a free
+ * sector without compacting one first.
+ *
+ * @param[in,out]   kv      the store
+ *
+ * @return  1 if a sector was compacted
+ * @return  0 if there was nothing to do
+ * @return  <0 on MTD errors
+ */
+int kvstore_gc(kvstore_t *kv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KVSTORE_H */
+/** @} */
@@ -271,6 +271,25 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Number of hash buckets for the host route index of the off-link
+ *          entries
+ *
+ * When not 0, off-link entries with a prefix length of 128 (host routes, e.g.
+ * the downward routes a RPL root in storing mode installs for every DAO
+ * target) are additionally kept in a hash index. This makes refreshing,
+ * removing, and looking up host routes independent of
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF. Adding a new host route still searches
+ * the off-link entries linearly for a free one. The index costs
+ * `2 * (CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF + CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)`
+ * bytes of RAM.
+ *
+ * @note    Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+#define CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF      (0)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
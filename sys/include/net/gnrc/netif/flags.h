@@ -139,6 +139,15 @@ enum {
  * @brief   Network interface is configured in raw mode
  */
 #define GNRC_NETIF_FLAGS_RAWMODE                   (0x00010000U)
+
+/**
+ * @brief   The device requested its ISR handler to be called again
+ *
+ * Set if a @ref NETDEV_EVENT_ISR issued from within the ISR handler (see
+ * @ref netdev_sec_irq_mitigation) could not be queued. The interface then
+ * calls the ISR handler once it handled its current message.
+ */
+#define GNRC_NETIF_FLAGS_ISR_POLL                  (0x00020000U)
 /** @} */
 
 #ifdef __cplusplus
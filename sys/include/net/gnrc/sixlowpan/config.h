@@ -53,6 +53,20 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Number of flows for which the IPHC encoder caches the results of
+ *          the compression context lookups
+ *
+ * A flow is identified by its source and destination address. The cache is
+ * invalidated as a whole whenever the context buffer changes.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_iphc_cache](@ref net_gnrc_sixlowpan_iphc) module
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (4U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
@@ -113,17 +113,24 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp);
 
-#ifdef MODULE_GNRC_SIXLOWPAN_CTX
 /**
  * @brief   Removes context.
  *
  * @param[in] id    A context ID.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-}
-#endif
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the current version of the context buffer.
+ *
+ * The version changes every time a context is added, updated, removed, or
+ * becomes invalid for compression because its lifetime expired. Users that
+ * cache the results of @ref gnrc_sixlowpan_ctx_lookup_addr() can use it to
+ * check if their cached results are still valid.
+ *
+ * @return  The current version of the context buffer.
+ */
+unsigned gnrc_sixlowpan_ctx_version(void);
 
 #ifdef TEST_SUITES
 /**
@@ -10,6 +10,12 @@
  * @defgroup    net_gnrc_sixlowpan_iphc   IPv6 header compression (IPHC)
  * @ingroup     net_gnrc_sixlowpan
  * @brief       IPv6 header compression for 6LoWPAN.
+ *
+ * Compile with the `gnrc_sixlowpan_iphc_cache` pseudo-module to cache the
+ * results of the compression context lookups for the
+ * @ref CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE most recent flows. This speeds up
+ * compression for nodes that send most of their traffic in a few long-lived
+ * flows, e.g. to their border router.
  * @{
  *
  * @file
@@ -22,9 +22,16 @@
  *  - Simple Park-Miller PRNG
  *  - Musl C PRNG
  *  - Fortuna (CS)PRNG
+ *  - xoshiro256**
  *  - Hardware Random Number Generator (non-seedable)
  *    HWRNG differ in how they generate random numbers and may not use a PRNG internally.
  *    Refer to the manual of your MCU for details.
+ *
+ * Independent of the selected implementation, a xoshiro256** generator with
+ * caller provided state is available through @ref random_ctx_t. Users that
+ * draw many random numbers, e.g. for randomized backoff, can keep their own
+ * context instead of sharing the global generator. As a context is only
+ * accessed by its owner, no locking is needed.
  */
 
 #ifndef RANDOM_H
@@ -97,6 +104,100 @@ void random_bytes(uint8_t *buf, size_t size);
  */
 uint32_t random_uint32_range(uint32_t a, uint32_t b);
 
+/**
+ * @brief   State of a xoshiro256** generator
+ *
+ * @warning xoshiro256** is fast, but not cryptographically secure.
+ */
+typedef struct {
+    uint64_t s[4];      /**< generator state, must not be all zero */
+} random_ctx_t;
+
+/**
+ * @brief   Initialize a generator from a seed
+ *
+ * The seed is expanded to the full state with SplitMix64, so seeds of any
+ * length, including all zero seeds, give a valid state.
+ *
+ * @param[out]  ctx     generator to initialize
+ * @param[in]   seed    seed
+ * @param[in]   len     length of @p seed in bytes
+ */
+void random_ctx_init(random_ctx_t *ctx, const void *seed, size_t len);
+
+/**
+ * @brief   Initialize a generator from the available entropy
+ *
+ * The seed is drawn from the global generator, so each call gives a
+ * different state, and mixed with the hardware RNG or the ADC noise entropy
+ * source, if used.
+ *
+ * @param[out]  ctx     generator to initialize
+ */
+void random_ctx_seed(random_ctx_t *ctx);
+
+/**
+ * @brief   Generate a random number on [0,0xffffffffffffffff]-interval
+ *
+ * @param[in,out]   ctx     generator
+ *
+ * @return  random number
+ */
+static inline uint64_t random_ctx_uint64(random_ctx_t *ctx)
+{
+    uint64_t *s = ctx->s;
+    uint64_t r = s[1] * 5;
+    uint64_t t = s[1] << 17;
+
+    r = ((r << 7) | (r >> 57)) * 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+
+    return r;
+}
+
+/**
+ * @brief   Generate a random number on [0,0xffffffff]-interval
+ *
+ * @param[in,out]   ctx     generator
+ *
+ * @return  random number
+ */
+static inline uint32_t random_ctx_uint32(random_ctx_t *ctx)
+{
+    /* the upper bits are of slightly better quality */
+    return random_ctx_uint64(ctx) >> 32;
+}
+
+/**
+ * @brief   Fill a buffer with random bytes
+ *
+ * Consumes one 64 bit number per eight bytes.
+ *
+ * @param[in,out]   ctx     generator
+ * @param[out]      buf     buffer to fill
+ * @param[in]       size    number of bytes to write to @p buf
+ */
+void random_ctx_bytes(random_ctx_t *ctx, void *buf, size_t size);
+
+/**
+ * @brief   Generate a random number r with a <= r < b
+ *
+ * @param[in,out]   ctx     generator
+ * @param[in]       a       minimum for random number
+ * @param[in]       b       upper bound for random number
+ *
+ * @pre     a < b
+ *
+ * @return  a random number on [a,b)-interval
+ */
+uint32_t random_ctx_uint32_range(random_ctx_t *ctx, uint32_t a, uint32_t b);
+
 #if PRNG_FLOAT || defined(DOXYGEN)
 /* These real versions are due to Isaku Wada, 2002/01/09 added */
 
@@ -63,8 +63,14 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+
+#include "kernel_defines.h"
 #include "riotboot/slot.h"
 #include "periph/flashpage.h"
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256) || DOXYGEN
+#include "hashes/sha256.h"
+#endif
 
 /**
  * @brief Enable/disable raw writes to flash
@@ -121,6 +127,13 @@ typedef struct {
     uint8_t RIOTBOOT_FLASHPAGE_BUFFER_ATTRS
         firstblock_buf[RIOTBOOT_FLASHPAGE_BUFFER_SIZE];
 #endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256) || DOXYGEN
+    /**
+     * @brief SHA-256 of the image written so far, see
+     *        riotboot_flashwrite_sha256_final()
+     */
+    sha256_context_t sha256;
+#endif
 } riotboot_flashwrite_t;
 
 /**
@@ -165,8 +178,14 @@ static inline int riotboot_flashwrite_init(riotboot_flashwrite_t *state,
                                            int target_slot)
 {
     /* initialize state, but skip "RIOT" */
-    return riotboot_flashwrite_init_raw(state, target_slot,
-                                        RIOTBOOT_FLASHWRITE_SKIPLEN);
+    int res = riotboot_flashwrite_init_raw(state, target_slot,
+                                           RIOTBOOT_FLASHWRITE_SKIPLEN);
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    /* the magic number is only written by riotboot_flashwrite_finish(), but
+     * is part of the image */
+    sha256_update(&state->sha256, "RIOT", RIOTBOOT_FLASHWRITE_SKIPLEN);
+#endif
+    return res;
 }
 
 /**
@@ -273,6 +292,26 @@ size_t riotboot_flashwrite_slotsize(const riotboot_flashwrite_t *state);
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
                                       size_t img_size, int target_slot);
 
+/**
+ * @brief       Get the SHA-256 digest of the image written so far
+ *
+ * The digest is calculated while the data is passed to
+ * riotboot_flashwrite_putbytes(), so verifying the image with it needs no
+ * second pass over the slot. Only the data handed to the writer is covered,
+ * the flash contents are not read back. For updates started with
+ * riotboot_flashwrite_init() the digest includes the magic number, so it
+ * matches the digest of the complete image file.
+ *
+ * Needs the `riotboot_flashwrite_sha256` module. The state is not modified,
+ * so the digest can be queried repeatedly, e.g. each time a SUIT command
+ * sequence checks the image.
+ *
+ * @param[in]       state   ptr to previously used update state
+ * @param[out]      digest  the digest, @ref SHA256_DIGEST_LENGTH bytes
+ */
+void riotboot_flashwrite_sha256_final(const riotboot_flashwrite_t *state,
+                                      void *digest);
+
 #ifdef __cplusplus
 }
 #endif
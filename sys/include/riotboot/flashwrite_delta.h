@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_riotboot_flashwrite_delta riotboot delta updates
+ * @ingroup     sys_riotboot_flashwrite
+ * @{
+ *
+ * @file
+ * @brief       Reconstruct a firmware image from a binary patch against the
+ *              image in another slot
+ *
+ * Instead of the complete new image only a patch is transferred, which
+ * describes the new image as a sequence of ranges copied from the image in
+ * the source slot (usually the running one) and literal data. The patch is
+ * applied while it is received, the reconstructed image is written to the
+ * target slot through @ref sys_riotboot_flashwrite. Apart from the flashwrite
+ * buffers no RAM is needed that depends on image or patch size, the source
+ * image is read directly from flash.
+ *
+ * Patches are created on the host with `dist/tools/riotboot_delta/gen_delta.py`
+ * from the image installed on the device and the new image, both including
+ * their riotboot header.
+ *
+ * The patch starts with a header:
+ *
+ * | field          | size | description                                    |
+ * |----------------|------|------------------------------------------------|
+ * | magic          | 4    | "RBDP"                                         |
+ * | source length  | 4    | length of the source image                     |
+ * | target length  | 4    | length of the reconstructed image              |
+ * | source digest  | 32   | SHA-256 of the source image                    |
+ *
+ * followed by operations, each of them starting with its type:
+ *
+ * - @ref RIOTBOOT_FLASHWRITE_DELTA_COPY, 4 bytes source offset, 4 bytes length:
+ *   append a range of the source image
+ * - @ref RIOTBOOT_FLASHWRITE_DELTA_INSERT, 4 bytes length, the data:
+ *   append the data
+ *
+ * All numbers are big endian. The digest of the source image is checked
+ * before anything is written, so a patch is never applied to the wrong image.
+ * The reconstructed image must be verified just like a complete image, e.g.
+ * with riotboot_flashwrite_verify_sha256().
+ *
+ * Usage:
+ *
+ * 1. initialize the writer using riotboot_flashwrite_init()
+ * 2. initialize the patching using riotboot_flashwrite_delta_init()
+ * 3. put the patch using riotboot_flashwrite_delta_putbytes()
+ * 4. call riotboot_flashwrite_delta_flush() after the last chunk
+ * 5. verify the reconstructed image
+ * 6. finish the update using riotboot_flashwrite_finish()
+ */
+
+#ifndef RIOTBOOT_FLASHWRITE_DELTA_H
+#define RIOTBOOT_FLASHWRITE_DELTA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "riotboot/flashwrite.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Magic number at the start of a patch
+ */
+#define RIOTBOOT_FLASHWRITE_DELTA_MAGIC     "RBDP"
+
+/**
+ * @brief   Length of the patch header
+ */
+#define RIOTBOOT_FLASHWRITE_DELTA_HDR_LEN   (44U)
+
+/**
+ * @name    Patch operations
+ * @{
+ */
+#define RIOTBOOT_FLASHWRITE_DELTA_COPY      (0x01)  /**< copy from source */
+#define RIOTBOOT_FLASHWRITE_DELTA_INSERT    (0x02)  /**< insert literal data */
+/** @} */
+
+/**
+ * @brief   Patch state
+ */
+typedef struct {
+    riotboot_flashwrite_t *writer;  /**< the writer receiving the image */
+    const uint8_t *source;          /**< start of the source slot */
+    size_t source_len;              /**< length of the source image, the
+                                         size of the source slot until the
+                                         header was received */
+    size_t target_len;              /**< length of the reconstructed image */
+    size_t produced;                /**< image bytes reconstructed so far */
+    size_t offset;                  /**< patch bytes received so far */
+    size_t skip;                    /**< image bytes still to drop */
+    uint32_t copy_from;             /**< source offset of the current copy */
+    uint32_t remaining;             /**< bytes left of the current operation */
+    uint8_t op;                     /**< current operation, 0 if none */
+    uint8_t buf_len;                /**< bytes in @ref buf */
+    /** header of the patch or the current operation */
+    uint8_t buf[RIOTBOOT_FLASHWRITE_DELTA_HDR_LEN];
+} riotboot_flashwrite_delta_t;
+
+/**
+ * @brief   Initialize the patching of an image
+ *
+ * @param[out]  state       patch state to initialize
+ * @param[in]   writer      initialized writer the reconstructed image is
+ *                          written with
+ * @param[in]   source_slot slot holding the image the patch applies to, must
+ *                          not be the target slot of @p writer
+ */
+void riotboot_flashwrite_delta_init(riotboot_flashwrite_delta_t *state,
+                                    riotboot_flashwrite_t *writer,
+                                    int source_slot);
+
+/**
+ * @brief   Apply a chunk of the patch
+ *
+ * @param[in,out]   state   patch state
+ * @param[in]       bytes   patch data
+ * @param[in]       len     length of @p bytes
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the patch is malformed
+ * @return  -EFBIG if the image doesn't fit into the slot
+ * @return  -EBADMSG if the patch doesn't apply to the source image
+ * @return  <0 on write errors
+ */
+int riotboot_flashwrite_delta_putbytes(riotboot_flashwrite_delta_t *state,
+                                       const uint8_t *bytes, size_t len);
+
+/**
+ * @brief   Check that the patch was complete and flush the writer
+ *
+ * Must be called once after the last chunk of the patch.
+ *
+ * @param[in,out]   state   patch state
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the patch is incomplete
+ * @return  <0 on write errors
+ */
+int riotboot_flashwrite_delta_flush(riotboot_flashwrite_delta_t *state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIOTBOOT_FLASHWRITE_DELTA_H */
+/** @} */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_riotboot_flashwrite_heatshrink riotboot heatshrink decompression
+ * @ingroup     sys_riotboot_flashwrite
+ * @{
+ *
+ * @file
+ * @brief       Streaming decompression of heatshrink compressed firmware
+ *              images for riotboot flashwrite
+ *
+ * This module sits in front of @ref sys_riotboot_flashwrite. Compressed data
+ * is passed to the decoder in whatever chunks it is received and the
+ * decompressed image is written to the target slot as it comes out of the
+ * decoder, so neither the compressed nor the decompressed image has to fit
+ * into RAM.
+ *
+ * The decoder uses the static configuration of the heatshrink package, its
+ * window and lookahead size are fixed at compile time. Images must be
+ * compressed with the same parameters, e.g.
+ *
+ *     heatshrink -e -w 8 -l 4 firmware-slot1.riot.bin firmware-slot1.riot.bin.hs
+ *
+ * Usage:
+ *
+ * 1. initialize the writer using riotboot_flashwrite_init()
+ * 2. initialize the decompression using riotboot_flashwrite_heatshrink_init()
+ * 3. put compressed data using riotboot_flashwrite_heatshrink_putbytes()
+ * 4. call riotboot_flashwrite_heatshrink_flush() after the last chunk
+ * 5. verify the decompressed image, e.g. using
+ *    riotboot_flashwrite_verify_sha256() with the offset of the writer as
+ *    image length
+ * 6. finish the update using riotboot_flashwrite_finish()
+ *
+ * The compressed stream contains the complete image, including the riotboot
+ * magic number. The decompressed bytes in front of the offset the writer was
+ * initialized with are dropped, just like a caller of
+ * riotboot_flashwrite_putbytes() skips @ref RIOTBOOT_FLASHWRITE_SKIPLEN bytes.
+ */
+
+#ifndef RIOTBOOT_FLASHWRITE_HEATSHRINK_H
+#define RIOTBOOT_FLASHWRITE_HEATSHRINK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "heatshrink_decoder.h"
+#include "riotboot/flashwrite.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the buffer decompressed data is polled into before it is
+ *          passed to the writer
+ */
+#ifndef CONFIG_RIOTBOOT_FLASHWRITE_HEATSHRINK_BUF_SIZE
+#define CONFIG_RIOTBOOT_FLASHWRITE_HEATSHRINK_BUF_SIZE  (64U)
+#endif
+
+/**
+ * @brief   Decompression state
+ */
+typedef struct {
+    riotboot_flashwrite_t *writer;  /**< the writer receiving the image */
+    heatshrink_decoder decoder;     /**< heatshrink decoder state */
+    size_t offset;                  /**< compressed bytes received so far */
+    size_t skip;                    /**< decompressed bytes still to drop */
+    /** decompressed data */
+    uint8_t buf[CONFIG_RIOTBOOT_FLASHWRITE_HEATSHRINK_BUF_SIZE];
+} riotboot_flashwrite_heatshrink_t;
+
+/**
+ * @brief   Initialize the decompression of an image
+ *
+ * @param[out]  state       decompression state to initialize
+ * @param[in]   writer      initialized writer the decompressed image is
+ *                          written with
+ */
+void riotboot_flashwrite_heatshrink_init(riotboot_flashwrite_heatshrink_t *state,
+                                         riotboot_flashwrite_t *writer);
+
+/**
+ * @brief   Decompress a chunk of the compressed image and write the result
+ *
+ * @param[in,out]   state   decompression state
+ * @param[in]       bytes   compressed data
+ * @param[in]       len     length of @p bytes
+ *
+ * @return  0 on success
+ * @return  <0 on error, e.g. if the decompressed image is larger than the
+ *          target slot
+ */
+int riotboot_flashwrite_heatshrink_putbytes(riotboot_flashwrite_heatshrink_t *state,
+                                            const uint8_t *bytes, size_t len);
+
+/**
+ * @brief   Write the data left in the decoder and flush the writer
+ *
+ * Must be called once after the last chunk of the compressed image.
+ *
+ * @param[in,out]   state   decompression state
+ *
+ * @return  0 on success
+ * @return  <0 on error
+ */
+int riotboot_flashwrite_heatshrink_flush(riotboot_flashwrite_heatshrink_t *state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIOTBOOT_FLASHWRITE_HEATSHRINK_H */
+/** @} */
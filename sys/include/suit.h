@@ -138,6 +138,23 @@ typedef enum {
     SUIT_DIGEST_TYPE_PREIMAGE   = 4     /**< Pre-image digest */
 } suit_digest_type_t;
 
+/**
+ * @brief SUIT payload compression algorithms
+ *
+ * Unofficial list from
+ * [suit-manifest-generator](https://github.com/ARMmbed/suit-manifest-generator),
+ * heatshrink has no entry there and uses a value from the private range.
+ */
+typedef enum {
+    SUIT_COMPRESSION_HEATSHRINK = -1,   /**< heatshrink */
+    SUIT_COMPRESSION_NONE       = 0,    /**< Payload is not compressed */
+    SUIT_COMPRESSION_GZIP       = 1,    /**< gzip */
+    SUIT_COMPRESSION_BZIP2      = 2,    /**< bzip2 */
+    SUIT_COMPRESSION_DEFLATE    = 3,    /**< deflate */
+    SUIT_COMPRESSION_LZ4        = 4,    /**< lz4 */
+    SUIT_COMPRESSION_LZMA       = 7,    /**< lzma */
+} suit_compression_t;
+
 /**
  * @brief SUIT component types
  *
@@ -220,6 +237,7 @@ typedef struct {
     suit_param_ref_t param_digest;              /**< Payload verification digest */
     suit_param_ref_t param_uri;                 /**< Payload fetch URI */
     suit_param_ref_t param_size;                /**< Payload size */
+    suit_param_ref_t param_compression_info;    /**< Payload compression */
 
     /**
      * @brief Component offset inside the device memory.
@@ -324,6 +342,25 @@ int suit_component_name_to_string(const suit_manifest_t *manifest,
                                   const suit_component_t *component,
                                   char separator, char *buf, size_t buf_len);
 
+/**
+ * @brief Get the compression algorithm of the payload of a component
+ *
+ * The payload is fetched compressed, the storage backend must decompress it
+ * while writing, image size and digest refer to the decompressed payload.
+ *
+ * @param[in]   manifest    SUIT manifest context
+ * @param[in]   component   the component
+ * @param[out]  compression the compression algorithm, see
+ *                          @ref suit_compression_t, @ref SUIT_COMPRESSION_NONE
+ *                          if the component has no compression info
+ *
+ * @return      SUIT_OK if successful
+ * @return      SUIT_ERR_INVALID_MANIFEST if the compression info is malformed
+ */
+int suit_component_get_compression(const suit_manifest_t *manifest,
+                                   const suit_component_t *component,
+                                   int32_t *compression);
+
 /**
  * @brief Helper function for writing bytes on flash a specified offset
  *
@@ -189,6 +189,22 @@ typedef struct suit_storage_driver {
     int (*read_ptr)(suit_storage_t *storage,
                     const uint8_t **buf, size_t *len);
 
+    /**
+     * @brief retrieve the SHA-256 digest of the payload written since the
+     *        last start
+     *
+     * @note Optional to implement, backends hashing the payload while it is
+     *       written save reading it back for verification
+     *
+     * @param[in]   storage     Storage context
+     * @param[out]  digest      SHA-256 digest of the payload
+     * @param[out]  len         Full length of the payload
+     *
+     * @returns     @ref SUIT_OK on successfully providing the digest
+     * @returns     @ref suit_error_t on error
+     */
+    int (*sha256)(suit_storage_t *storage, uint8_t *digest, size_t *len);
+
     /**
      * @brief Install the payload or mark the payload as valid
      *
@@ -376,6 +392,20 @@ static inline bool suit_storage_has_readptr(const suit_storage_t *storage)
     return (storage->driver->read_ptr);
 }
 
+/**
+ * @brief Check if the storage backend implements the @ref
+ * suit_storage_driver_t::sha256 function
+ *
+ * @param[in]   storage     Storage context
+ *
+ * @returns     True if the function is implemented,
+ * @returns     False otherwise
+ */
+static inline bool suit_storage_has_sha256(const suit_storage_t *storage)
+{
+    return (storage->driver->sha256);
+}
+
 /**
  * @brief Check if the storage backend implements the @ref
  * suit_storage_driver_t::match_offset function
@@ -487,6 +517,25 @@ static inline int suit_storage_read_ptr(suit_storage_t *storage, const uint8_t
     return storage->driver->read_ptr(storage, buf, len);
 }
 
+/**
+ * @brief retrieve the SHA-256 digest of the payload written since the last
+ *        start
+ *
+ * @note Optional to implement
+ *
+ * @param[in]   storage     Storage context
+ * @param[out]  digest      SHA-256 digest of the payload
+ * @param[out]  len         Full length of the payload
+ *
+ * @returns     @ref SUIT_OK on successfully providing the digest
+ * @returns     @ref suit_error_t on error
+ */
+static inline int suit_storage_sha256(suit_storage_t *storage,
+                                      uint8_t *digest, size_t *len)
+{
+    return storage->driver->sha256(storage, digest, len);
+}
+
 /**
  * @brief Install the payload or mark the payload as valid
  *
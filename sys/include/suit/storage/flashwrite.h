@@ -20,8 +20,17 @@
 #ifndef SUIT_STORAGE_FLASHWRITE_H
 #define SUIT_STORAGE_FLASHWRITE_H
 
+#include <stdbool.h>
+
+#include "kernel_defines.h"
 #include "suit.h"
 #include "riotboot/flashwrite.h"
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA) || DOXYGEN
+#include "riotboot/flashwrite_delta.h"
+#endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_HEATSHRINK) || DOXYGEN
+#include "riotboot/flashwrite_heatshrink.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,6 +42,22 @@ extern "C" {
 typedef struct {
     suit_storage_t storage;       /**< parent struct */
     riotboot_flashwrite_t writer; /**< Riotboot flashwriter */
+    size_t size;                  /**< Size of the image being written */
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_HEATSHRINK) || DOXYGEN
+    /**
+     * @brief   Decompression of heatshrink compressed payloads
+     */
+    riotboot_flashwrite_heatshrink_t heatshrink;
+    bool compressed;              /**< The payload is compressed */
+#endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA) || DOXYGEN
+    /**
+     * @brief   Reconstruction of the image from a patch against the running
+     *          image
+     */
+    riotboot_flashwrite_delta_t delta;
+    bool patch;                   /**< The payload is a patch */
+#endif
 } suit_storage_flashwrite_t;
 
 #ifdef __cplusplus
@@ -78,6 +78,7 @@ typedef struct CONFIG_SUIT_STORAGE_RAM_ATTR {
      */
     suit_storage_ram_region_t regions[CONFIG_SUIT_STORAGE_RAM_REGIONS];
     size_t active_region; /**< Active region to write to */
+    size_t size;          /**< Size of the payload being written */
     uint32_t sequence_no; /**< Ephemeral sequence number */
 } suit_storage_ram_t;
 
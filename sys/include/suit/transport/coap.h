@@ -133,7 +133,9 @@ typedef enum {
  *
  * This function will fetch the content of the specified resource path via
  * block-wise-transfer. A coap_blockwise_cb_t will be called on each received
- * block.
+ * block. The next block is requested before the callback is called, so it is
+ * in flight while the callback processes the current block. Two blocks are
+ * buffered on the stack of the calling thread.
  *
  * @param[in]   url        url pointer to source path
  * @param[in]   blksize    sender suggested SZX for the COAP block request
@@ -150,6 +150,21 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+#ifndef VFS_MOUNT_TABLE_SIZE
+/**
+ * @brief Number of mounts in the lock-free path lookup table
+ *
+ * Path lookups search the mounts with the longest mount points in a sorted
+ * table without taking a lock. A lookup that doesn't match any of them, or
+ * that races a mount or umount, falls back to searching all mounts under the
+ * mount lock. There is no limit on the number of mounts.
+ *
+ * Interrupts are disabled while the table is searched. 0 disables the table,
+ * all lookups take the mount lock then.
+ */
+#define VFS_MOUNT_TABLE_SIZE (4)
+#endif
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -388,6 +403,24 @@ struct vfs_file_ops {
      */
     off_t (*lseek) (vfs_file_t *filp, off_t off, int whence);
 
+    /**
+     * @brief Get a pointer to the contents of an open file
+     *
+     * Only file systems whose files are stored contiguously in addressable
+     * memory, e.g. in RAM or memory mapped flash, can implement this. The
+     * contents must stay at the returned address and unchanged as long as the
+     * file is open. The seek position is not changed.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[out] addr     address of the contents at the current position
+     * @param[in]  nbytes   maximum number of bytes to map
+     *
+     * @return number of bytes readable at @p addr on success, 0 at the end of
+     *         the file
+     * @return <0 on error
+     */
+    ssize_t (*mmap) (vfs_file_t *filp, const void **addr, size_t nbytes);
+
     /**
      * @brief Attempt to open a file in the file system at rel_path
      *
@@ -727,6 +760,42 @@ int vfs_open(const char *name, int flags, mode_t mode);
  */
 ssize_t vfs_read(int fd, void *dest, size_t count);
 
+/**
+ * @brief Get a pointer to the contents of an open file
+ *
+ * The contents at the current position are accessed in place, without
+ * copying them. This is only supported by file systems storing the files in
+ * addressable memory, like constfs. The seek position is not changed.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] addr     address of the contents at the current position, valid
+ *                      until the file is closed
+ * @param[in]  count    maximum number of bytes to map
+ *
+ * @return number of bytes readable at @p addr on success
+ * @return -ENOTSUP if the file system doesn't support direct access
+ * @return <0 on other errors
+ */
+ssize_t vfs_mmap(int fd, const void **addr, size_t count);
+
+/**
+ * @brief Read bytes from an open file, without copying them if possible
+ *
+ * Like vfs_read(), but if the file system supports vfs_mmap(), @p addr is set
+ * to the contents in place and @p buf is left untouched. Otherwise the bytes
+ * are read into @p buf and @p addr is set to @p buf. Either way the seek
+ * position is advanced by the number of bytes returned.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] addr     address of the bytes read
+ * @param[out] buf      buffer used if the file can't be accessed in place
+ * @param[in]  count    maximum number of bytes to read, size of @p buf
+ *
+ * @return number of bytes read on success
+ * @return <0 on error
+ */
+ssize_t vfs_read_direct(int fd, const void **addr, void *buf, size_t count);
+
 /**
  * @brief Write bytes to an open file
  *
@@ -0,0 +1,803 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_kvstore
+ * @{
+ *
+ * @file
+ * @brief       Log-structured key-value store on MTD
+ *
+ * Each sector starts with a @ref sector_hdr_t. The magic number and the
+ * erase count are written right after erasing the sector, the sequence
+ * number and the CRC once records are appended to the sector. The records
+ * follow the header, aligned to @ref CONFIG_KVSTORE_ALIGN.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "checksum/crc32.h"
+#include "hashes.h"
+#include "iolist.h"
+#include "kvstore.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SECTOR_MAGIC        (0x3153564bUL)  /* "KVS1" */
+#define SECTOR_NONE         (UINT_MAX)
+#define SEQ_FREE            (UINT32_MAX)
+
+#define REC_FLAG_DELETED    (0x01)
+
+#define REC_ALIGN(x)        (((x) + CONFIG_KVSTORE_ALIGN - 1) & \
+                             ~(uint32_t)(CONFIG_KVSTORE_ALIGN - 1))
+
+/* size of the buffer used to copy records and to verify their CRC */
+#define COPY_BUF_SIZE       (64U)
+
+/**
+ * @brief   Sector header
+ */
+typedef struct {
+    uint32_t magic;         /**< SECTOR_MAGIC */
+    uint32_t erase_count;   /**< number of erase cycles of the sector */
+    uint32_t seq;           /**< sequence number, SEQ_FREE while free */
+    uint32_t crc;           /**< CRC-32 of the fields above */
+} sector_hdr_t;
+
+/**
+ * @brief   Record header, followed by the key and the value
+ */
+typedef struct {
+    uint32_t crc;           /**< CRC-32 of the rest of the record */
+    uint8_t key_len;        /**< length of the key */
+    uint8_t flags;          /**< record flags */
+    uint16_t val_len;       /**< length of the value */
+} rec_hdr_t;
+
+static_assert(CONFIG_KVSTORE_KEY_LEN_MAX < UINT8_MAX,
+              "CONFIG_KVSTORE_KEY_LEN_MAX too large");
+static_assert((CONFIG_KVSTORE_ALIGN & (CONFIG_KVSTORE_ALIGN - 1)) == 0,
+              "CONFIG_KVSTORE_ALIGN must be a power of two");
+static_assert(CONFIG_KVSTORE_ALIGN <= 8, "CONFIG_KVSTORE_ALIGN too large");
+
+static inline uint32_t _rec_size(const rec_hdr_t *hdr)
+{
+    return REC_ALIGN(sizeof(*hdr) + hdr->key_len + hdr->val_len);
+}
+
+static inline uint32_t _rec_crc(const rec_hdr_t *hdr)
+{
+    return crc32_calc(&hdr->key_len, sizeof(*hdr) - sizeof(hdr->crc));
+}
+
+static inline unsigned _sector_of(const kvstore_t *kv, uint32_t addr)
+{
+    return addr / kv->sector_size;
+}
+
+static inline uint16_t _hash(const char *key, size_t len)
+{
+    return fnv_hash((const uint8_t *)key, len);
+}
+
+static int _read(kvstore_t *kv, void *dst, uint32_t addr, uint32_t len)
+{
+    return mtd_read(kv->dev, dst,
+                    kv->first_sector * kv->sector_size + addr, len);
+}
+
+static int _write(kvstore_t *kv, const void *src, uint32_t addr, uint32_t len)
+{
+    return mtd_write(kv->dev, src,
+                     kv->first_sector * kv->sector_size + addr, len);
+}
+
+static int _format_sector(kvstore_t *kv, unsigned sector, uint32_t erase_count)
+{
+    const sector_hdr_t hdr = {
+        .magic = SECTOR_MAGIC,
+        .erase_count = erase_count,
+    };
+
+    DEBUG("kvstore: erasing sector %u (%" PRIu32 " cycles)\n", sector,
+          erase_count);
+
+    kv->sectors[sector] = (kvstore_sector_t) {
+        .erase_count = erase_count,
+        .used = sizeof(sector_hdr_t),
+    };
+
+    int res = mtd_erase_sector(kv->dev, kv->first_sector + sector, 1);
+    if (res < 0) {
+        return res;
+    }
+
+    /* the sequence number is written when the sector is opened */
+    res = _write(kv, &hdr, sector * kv->sector_size,
+                 offsetof(sector_hdr_t, seq));
+    if (res < 0) {
+        return res;
+    }
+
+    kv->free++;
+    return 0;
+}
+
+/* opens the least worn free sector for appending records */
+static int _open_sector(kvstore_t *kv)
+{
+    unsigned sector = SECTOR_NONE;
+
+    for (unsigned i = 0; i < kv->sector_num; i++) {
+        if (kv->sectors[i].seq == 0 &&
+            (sector == SECTOR_NONE ||
+             kv->sectors[i].erase_count < kv->sectors[sector].erase_count)) {
+            sector = i;
+        }
+    }
+
+    if (sector == SECTOR_NONE) {
+        return -ENOSPC;
+    }
+
+    sector_hdr_t hdr = {
+        .magic = SECTOR_MAGIC,
+        .erase_count = kv->sectors[sector].erase_count,
+        .seq = ++kv->seq,
+    };
+    hdr.crc = crc32_calc(&hdr, offsetof(sector_hdr_t, crc));
+
+    DEBUG("kvstore: opening sector %u (seq %" PRIu32 ")\n", sector, hdr.seq);
+
+    kv->sectors[sector].seq = hdr.seq;
+    kv->active = sector;
+    kv->free--;
+
+    return _write(kv, &hdr.seq, sector * kv->sector_size +
+                  offsetof(sector_hdr_t, seq),
+                  sizeof(hdr) - offsetof(sector_hdr_t, seq));
+}
+
+static int _read_hdr(kvstore_t *kv, uint32_t addr, rec_hdr_t *hdr)
+{
+    return _read(kv, hdr, addr, sizeof(*hdr));
+}
+
+/* looks up a key, returns -ENOENT and the slot to insert it if not found */
+static int _lookup(kvstore_t *kv, const char *key, uint8_t key_len,
+                   uint16_t hash, rec_hdr_t *hdr, unsigned *slot)
+{
+    const unsigned mask = kv->index_size - 1;
+    char buf[CONFIG_KVSTORE_KEY_LEN_MAX];
+
+    /* the index always has an unused entry, so this terminates */
+    for (unsigned i = hash & mask;; i = (i + 1) & mask) {
+        const kvstore_entry_t *e = &kv->index[i];
+
+        if (e->addr == KVSTORE_ADDR_NONE) {
+            *slot = i;
+            return -ENOENT;
+        }
+        if (e->hash != hash) {
+            continue;
+        }
+
+        int res = _read_hdr(kv, e->addr, hdr);
+        if (res < 0) {
+            return res;
+        }
+        if (hdr->key_len != key_len) {
+            continue;
+        }
+        res = _read(kv, buf, e->addr + sizeof(*hdr), key_len);
+        if (res < 0) {
+            return res;
+        }
+        if (memcmp(buf, key, key_len) == 0) {
+            *slot = i;
+            return 0;
+        }
+    }
+}
+
+/* removes an entry, moving later entries of the probe sequence up */
+static void _index_remove(kvstore_t *kv, unsigned i)
+{
+    const unsigned mask = kv->index_size - 1;
+
+    for (unsigned j = (i + 1) & mask; kv->index[j].addr != KVSTORE_ADDR_NONE;
+         j = (j + 1) & mask) {
+        unsigned home = kv->index[j].hash & mask;
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            kv->index[i] = kv->index[j];
+            i = j;
+        }
+    }
+
+    kv->index[i].addr = KVSTORE_ADDR_NONE;
+    kv->entries--;
+}
+
+/* makes the newest record of a key the one at addr */
+static int _index_update(kvstore_t *kv, const char *key, uint8_t key_len,
+                         uint32_t addr, uint32_t size)
+{
+    rec_hdr_t old;
+    unsigned slot;
+    uint16_t hash = _hash(key, key_len);
+    int res = _lookup(kv, key, key_len, hash, &old, &slot);
+
+    if (res == 0) {
+        kv->sectors[_sector_of(kv, kv->index[slot].addr)].live -= _rec_size(&old);
+    }
+    else if (res == -ENOENT) {
+        /* keep one entry unused */
+        if (kv->entries + 1 >= kv->index_size) {
+            return -ENOMEM;
+        }
+        kv->index[slot].hash = hash;
+        kv->entries++;
+    }
+    else {
+        return res;
+    }
+
+    kv->index[slot].addr = addr;
+    kv->sectors[_sector_of(kv, addr)].live += size;
+    return 0;
+}
+
+/* picks the sector with the most garbage if it has at least min bytes */
+static unsigned _victim(kvstore_t *kv, uint32_t min)
+{
+    const uint32_t payload = kv->sector_size - sizeof(sector_hdr_t);
+    unsigned victim = SECTOR_NONE;
+    uint32_t garbage = 0;
+
+    for (unsigned i = 0; i < kv->sector_num; i++) {
+        const kvstore_sector_t *s = &kv->sectors[i];
+        if (i == kv->active || s->seq == 0) {
+            continue;
+        }
+        uint32_t g = payload - s->live;
+        if (g > garbage ||
+            (g == garbage && victim != SECTOR_NONE &&
+             s->erase_count < kv->sectors[victim].erase_count)) {
+            victim = i;
+            garbage = g;
+        }
+    }
+
+    return (garbage && garbage >= min) ? victim : SECTOR_NONE;
+}
+
+/* picks a sector holding static data that fell behind in erase cycles */
+static unsigned _coldest(kvstore_t *kv)
+{
+    unsigned coldest = SECTOR_NONE;
+    uint32_t max = 0;
+
+    for (unsigned i = 0; i < kv->sector_num; i++) {
+        const kvstore_sector_t *s = &kv->sectors[i];
+        if (s->erase_count > max) {
+            max = s->erase_count;
+        }
+        if (i == kv->active || s->seq == 0) {
+            continue;
+        }
+        if (coldest == SECTOR_NONE ||
+            s->erase_count < kv->sectors[coldest].erase_count) {
+            coldest = i;
+        }
+    }
+
+    if (coldest != SECTOR_NONE &&
+        max - kv->sectors[coldest].erase_count > CONFIG_KVSTORE_WEAR_DELTA) {
+        return coldest;
+    }
+    return SECTOR_NONE;
+}
+
+static int _compact(kvstore_t *kv, unsigned victim);
+
+/* makes room for size bytes in the active sector */
+static int _make_room(kvstore_t *kv, uint32_t size, bool compacting)
+{
+    /* each compaction frees garbage, give up if that doesn't help */
+    unsigned attempts = kv->sector_num;
+
+    while (kv->sectors[kv->active].used + size > kv->sector_size) {
+        /* the last free sector is reserved for compacting */
+        if (kv->free > 1 || (compacting && kv->free)) {
+            int res = _open_sector(kv);
+            if (res < 0) {
+                return res;
+            }
+            continue;
+        }
+
+        unsigned victim = _victim(kv, size);
+        if (compacting || !attempts-- || victim == SECTOR_NONE) {
+            return -ENOSPC;
+        }
+
+        int res = _compact(kv, victim);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return 0;
+}
+
+static int _copy(kvstore_t *kv, uint32_t dst, uint32_t src, uint32_t size)
+{
+    uint8_t buf[COPY_BUF_SIZE];
+    /* sectors start at a page boundary, page size is a power of two */
+    const uint32_t page_mask = kv->dev->page_size - 1;
+
+    while (size) {
+        uint32_t chunk = (size < sizeof(buf)) ? size : sizeof(buf);
+        /* mtd_write() must not cross page boundaries */
+        if (chunk > kv->dev->page_size - (dst & page_mask)) {
+            chunk = kv->dev->page_size - (dst & page_mask);
+        }
+        int res = _read(kv, buf, src, chunk);
+        if (res < 0) {
+            return res;
+        }
+        res = _write(kv, buf, dst, chunk);
+        if (res < 0) {
+            return res;
+        }
+        src += chunk;
+        dst += chunk;
+        size -= chunk;
+    }
+
+    return 0;
+}
+
+/* moves the live records of a sector to the active sector and erases it */
+static int _compact(kvstore_t *kv, unsigned victim)
+{
+    kvstore_sector_t *vs = &kv->sectors[victim];
+    bool oldest = true;
+
+    DEBUG("kvstore: compacting sector %u (%" PRIu32 " live bytes)\n", victim,
+          vs->live);
+
+    /* no older records exist if this is the oldest sector, so tombstones
+     * in it can be dropped */
+    for (unsigned i = 0; i < kv->sector_num; i++) {
+        if (kv->sectors[i].seq && kv->sectors[i].seq < vs->seq) {
+            oldest = false;
+            break;
+        }
+    }
+
+    unsigned i = 0;
+    while (i < kv->index_size) {
+        kvstore_entry_t *e = &kv->index[i];
+        if (e->addr == KVSTORE_ADDR_NONE || _sector_of(kv, e->addr) != victim) {
+            i++;
+            continue;
+        }
+
+        rec_hdr_t hdr;
+        int res = _read_hdr(kv, e->addr, &hdr);
+        if (res < 0) {
+            return res;
+        }
+        uint32_t size = _rec_size(&hdr);
+
+        if (oldest && (hdr.flags & REC_FLAG_DELETED)) {
+            vs->live -= size;
+            /* another entry may have moved into this slot */
+            _index_remove(kv, i);
+            continue;
+        }
+
+        res = _make_room(kv, size, true);
+        if (res < 0) {
+            return res;
+        }
+
+        kvstore_sector_t *as = &kv->sectors[kv->active];
+        uint32_t addr = kv->active * kv->sector_size + as->used;
+        as->used += size;
+        res = _copy(kv, addr, e->addr, size);
+        if (res < 0) {
+            return res;
+        }
+
+        vs->live -= size;
+        as->live += size;
+        e->addr = addr;
+        i++;
+    }
+
+    int res = _format_sector(kv, victim, vs->erase_count + 1);
+    return (res < 0) ? res : 1;
+}
+
+static int _put(kvstore_t *kv, const char *key, const void *value,
+                size_t len, uint8_t flags)
+{
+    size_t key_len = strlen(key);
+
+    if (key_len == 0 || key_len > CONFIG_KVSTORE_KEY_LEN_MAX ||
+        len > UINT16_MAX) {
+        return -EINVAL;
+    }
+
+    rec_hdr_t hdr = {
+        .key_len = key_len,
+        .flags = flags,
+        .val_len = len,
+    };
+    const uint32_t size = _rec_size(&hdr);
+
+    if (size > kv->sector_size - sizeof(sector_hdr_t)) {
+        return -ENOSPC;
+    }
+
+    mutex_lock(&kv->lock);
+
+    /* compacting may rearrange the index, so look up the key after */
+    int res = _make_room(kv, size, false);
+    if (res < 0) {
+        goto out;
+    }
+
+    rec_hdr_t old;
+    unsigned slot;
+    uint16_t hash = _hash(key, key_len);
+    res = _lookup(kv, key, key_len, hash, &old, &slot);
+    if (res < 0 && res != -ENOENT) {
+        goto out;
+    }
+    const bool found = (res == 0);
+    if ((flags & REC_FLAG_DELETED) &&
+        (!found || (old.flags & REC_FLAG_DELETED))) {
+        res = -ENOENT;
+        goto out;
+    }
+    if (!found && kv->entries + 1 >= kv->index_size) {
+        res = -ENOMEM;
+        goto out;
+    }
+
+    static const uint8_t pad[CONFIG_KVSTORE_ALIGN];
+    iolist_t iol_pad = {
+        .iol_base = (void *)pad,
+        .iol_len = size - (sizeof(hdr) + key_len + len),
+    };
+    iolist_t iol_value = {
+        .iol_next = &iol_pad,
+        .iol_base = (void *)value,
+        .iol_len = len,
+    };
+    iolist_t iol_key = {
+        .iol_next = &iol_value,
+        .iol_base = (void *)key,
+        .iol_len = key_len,
+    };
+    iolist_t iol = {
+        .iol_next = &iol_key,
+        .iol_base = &hdr,
+        .iol_len = sizeof(hdr),
+    };
+
+    hdr.crc = _rec_crc(&hdr);
+    hdr.crc = crc32_update(hdr.crc, key, key_len);
+    hdr.crc = crc32_update(hdr.crc, value, len);
+
+    kvstore_sector_t *as = &kv->sectors[kv->active];
+    uint32_t addr = kv->active * kv->sector_size + as->used;
+
+    /* the space is lost even if writing fails */
+    as->used += size;
+    res = mtd_write_iol(kv->dev, &iol, kv->first_sector * kv->sector_size + addr);
+    if (res < 0) {
+        goto out;
+    }
+
+    if (found) {
+        kv->sectors[_sector_of(kv, kv->index[slot].addr)].live -= _rec_size(&old);
+    }
+    else {
+        kv->index[slot].hash = hash;
+        kv->entries++;
+    }
+    kv->index[slot].addr = addr;
+    as->live += size;
+    res = 0;
+
+out:
+    mutex_unlock(&kv->lock);
+    return res;
+}
+
+/* checks the records of a sector and adds them to the index */
+static int _scan(kvstore_t *kv, unsigned sector)
+{
+    const uint32_t base = sector * kv->sector_size;
+    uint32_t off = sizeof(sector_hdr_t);
+    uint8_t buf[COPY_BUF_SIZE];
+
+    while (off + sizeof(rec_hdr_t) <= kv->sector_size) {
+        rec_hdr_t hdr;
+        char key[CONFIG_KVSTORE_KEY_LEN_MAX];
+        int res = _read_hdr(kv, base + off, &hdr);
+        if (res < 0) {
+            return res;
+        }
+
+        /* erased space follows the last record */
+        if (hdr.crc == UINT32_MAX && hdr.key_len == UINT8_MAX &&
+            hdr.flags == UINT8_MAX && hdr.val_len == UINT16_MAX) {
+            break;
+        }
+
+        uint32_t size = _rec_size(&hdr);
+        if (hdr.key_len == 0 || hdr.key_len > CONFIG_KVSTORE_KEY_LEN_MAX ||
+            off + size > kv->sector_size) {
+            /* don't append to a sector with a corrupted record */
+            DEBUG("kvstore: sector %u corrupted at %" PRIu32 "\n", sector, off);
+            off = kv->sector_size;
+            break;
+        }
+
+        res = _read(kv, key, base + off + sizeof(hdr), hdr.key_len);
+        if (res < 0) {
+            return res;
+        }
+        uint32_t crc = crc32_update(_rec_crc(&hdr), key, hdr.key_len);
+        uint32_t addr = base + off + sizeof(hdr) + hdr.key_len;
+        for (uint32_t left = hdr.val_len; left;) {
+            uint32_t chunk = (left < sizeof(buf)) ? left : sizeof(buf);
+            res = _read(kv, buf, addr, chunk);
+            if (res < 0) {
+                return res;
+            }
+            crc = crc32_update(crc, buf, chunk);
+            addr += chunk;
+            left -= chunk;
+        }
+
+        if (crc == hdr.crc) {
+            res = _index_update(kv, key, hdr.key_len, base + off, size);
+            if (res < 0) {
+                return res;
+            }
+        }
+        else {
+            DEBUG("kvstore: CRC mismatch at %" PRIu32 "\n", base + off);
+        }
+
+        off += size;
+    }
+
+    kv->sectors[sector].used = off;
+    return 0;
+}
+
+static int _mount(kvstore_t *kv)
+{
+    for (unsigned i = 0; i < kv->index_size; i++) {
+        kv->index[i].addr = KVSTORE_ADDR_NONE;
+    }
+    kv->entries = 0;
+    kv->seq = 0;
+    kv->free = 0;
+    kv->active = SECTOR_NONE;
+
+    for (unsigned i = 0; i < kv->sector_num; i++) {
+        sector_hdr_t hdr;
+        int res = _read(kv, &hdr, i * kv->sector_size, sizeof(hdr));
+        if (res < 0) {
+            return res;
+        }
+
+        if (hdr.magic != SECTOR_MAGIC) {
+            res = _format_sector(kv, i, 0);
+        }
+        else if (hdr.seq == SEQ_FREE) {
+            kv->sectors[i] = (kvstore_sector_t) {
+                .erase_count = hdr.erase_count,
+                .used = sizeof(sector_hdr_t),
+            };
+            kv->free++;
+        }
+        else if (hdr.crc != crc32_calc(&hdr, offsetof(sector_hdr_t, crc))) {
+            /* opening the sector was interrupted */
+            res = _format_sector(kv, i, hdr.erase_count + 1);
+        }
+        else {
+            kv->sectors[i] = (kvstore_sector_t) {
+                .seq = hdr.seq,
+                .erase_count = hdr.erase_count,
+            };
+            if (hdr.seq > kv->seq) {
+                kv->seq = hdr.seq;
+                kv->active = i;
+            }
+        }
+
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    /* replay the sectors from the oldest to the newest */
+    for (uint32_t seq = 0;;) {
+        unsigned next = SECTOR_NONE;
+        for (unsigned i = 0; i < kv->sector_num; i++) {
+            uint32_t s = kv->sectors[i].seq;
+            if (s > seq && (next == SECTOR_NONE || s < kv->sectors[next].seq)) {
+                next = i;
+            }
+        }
+        if (next == SECTOR_NONE) {
+            break;
+        }
+        seq = kv->sectors[next].seq;
+
+        int res = _scan(kv, next);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    /* sectors without live records are left over from an interrupted
+     * compaction */
+    for (unsigned i = 0; i < kv->sector_num; i++) {
+        kvstore_sector_t *s = &kv->sectors[i];
+        if (i != kv->active && s->seq && !s->live) {
+            s->seq = 0;
+            int res = _format_sector(kv, i, s->erase_count + 1);
+            if (res < 0) {
+                return res;
+            }
+        }
+    }
+
+    if (kv->active == SECTOR_NONE) {
+        return _open_sector(kv);
+    }
+
+    return 0;
+}
+
+int kvstore_init(kvstore_t *kv)
+{
+    if (kv->sector_num < 2 || kv->index_size < 2 ||
+        (kv->index_size & (kv->index_size - 1)) ||
+        kv->index_size > UINT16_MAX + 1) {
+        return -EINVAL;
+    }
+
+    int res = mtd_init(kv->dev);
+    if (res < 0) {
+        return res;
+    }
+
+    if (kv->first_sector + kv->sector_num > kv->dev->sector_count) {
+        return -EINVAL;
+    }
+
+    mutex_lock(&kv->lock);
+    kv->sector_size = kv->dev->pages_per_sector * kv->dev->page_size;
+    res = _mount(kv);
+    mutex_unlock(&kv->lock);
+
+    return res;
+}
+
+int kvstore_format(kvstore_t *kv)
+{
+    int res = 0;
+
+    mutex_lock(&kv->lock);
+    kv->free = 0;
+    for (unsigned i = 0; i < kv->sector_num; i++) {
+        res = _format_sector(kv, i, kv->sectors[i].erase_count + 1);
+        if (res < 0) {
+            goto out;
+        }
+    }
+    res = _mount(kv);
+
+out:
+    mutex_unlock(&kv->lock);
+    return res;
+}
+
+int kvstore_set(kvstore_t *kv, const char *key, const void *value, size_t len)
+{
+    return _put(kv, key, value, len, 0);
+}
+
+int kvstore_delete(kvstore_t *kv, const char *key)
+{
+    return _put(kv, key, NULL, 0, REC_FLAG_DELETED);
+}
+
+ssize_t kvstore_get(kvstore_t *kv, const char *key, void *value, size_t len)
+{
+    size_t key_len = strlen(key);
+
+    if (key_len == 0 || key_len > CONFIG_KVSTORE_KEY_LEN_MAX) {
+        return -ENOENT;
+    }
+
+    rec_hdr_t hdr;
+    unsigned slot;
+
+    mutex_lock(&kv->lock);
+
+    int res = _lookup(kv, key, key_len, _hash(key, key_len), &hdr, &slot);
+    if (res < 0) {
+        goto out;
+    }
+    if (hdr.flags & REC_FLAG_DELETED) {
+        res = -ENOENT;
+        goto out;
+    }
+
+    if (len > hdr.val_len) {
+        len = hdr.val_len;
+    }
+    res = _read(kv, value, kv->index[slot].addr + sizeof(hdr) + key_len, len);
+    if (res == 0) {
+        res = hdr.val_len;
+    }
+
+out:
+    mutex_unlock(&kv->lock);
+    return res;
+}
+
+int kvstore_gc(kvstore_t *kv)
+{
+    int res = 0;
+
+    mutex_lock(&kv->lock);
+
+    unsigned victim = _coldest(kv);
+    if (victim == SECTOR_NONE && kv->free < CONFIG_KVSTORE_GC_FREE_SECTORS) {
+        const uint32_t payload = kv->sector_size - sizeof(sector_hdr_t);
+        const kvstore_sector_t *as = &kv->sectors[kv->active];
+        unsigned v = _victim(kv, 1);
+
+        /* only compact if that frees a sector, right away or after the
+         * next compaction */
+        if (v != SECTOR_NONE &&
+            (kv->sectors[v].live <= kv->sector_size - as->used ||
+             kv->sectors[v].live <= payload / 2)) {
+            victim = v;
+        }
+    }
+    if (victim != SECTOR_NONE) {
+        res = _compact(kv, victim);
+    }
+
+    mutex_unlock(&kv->lock);
+    return res;
+}
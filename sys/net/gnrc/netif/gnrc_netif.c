@@ -22,6 +22,7 @@
 
 #include "bitfield.h"
 #include "event.h"
+#include "irq.h"
 #include "net/ethernet.h"
 #include "net/ipv6.h"
 #include "net/gnrc.h"
@@ -1752,6 +1753,15 @@ static void *_gnrc_netif_thread(void *args)
                 }
                 break;
         }
+        /* the flag may be set from whichever context called
+         * netdev_trigger_event_isr(), so test and clear it atomically */
+        unsigned state = irq_disable();
+        bool isr_poll = netif->flags & GNRC_NETIF_FLAGS_ISR_POLL;
+        netif->flags &= ~GNRC_NETIF_FLAGS_ISR_POLL;
+        irq_restore(state);
+        if (isr_poll) {
+            dev->driver->isr(dev);
+        }
     }
     /* never reached */
     return NULL;
@@ -1781,7 +1791,16 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                           .content = { .ptr = netif } };
 
             if (msg_send(&msg, netif->pid) <= 0) {
-                puts("gnrc_netif: possibly lost interrupt.");
+                if (!irq_is_in()) {
+                    /* device polls from within its ISR handler, but our
+                     * queue is full: don't lose the request */
+                    unsigned state = irq_disable();
+                    netif->flags |= GNRC_NETIF_FLAGS_ISR_POLL;
+                    irq_restore(state);
+                }
+                else {
+                    puts("gnrc_netif: possibly lost interrupt.");
+                }
             }
         }
     }
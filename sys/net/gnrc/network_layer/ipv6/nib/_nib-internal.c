@@ -39,6 +39,15 @@ static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+/* the bucket of an address is selected by masking its hash */
+static_assert((CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF &
+               (CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF - 1)) == 0,
+              "CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF must be a power of 2");
+/* host route index: chains of indexes into _dsts + 1 (0 terminates chain) */
+static uint16_t _host_idx[CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF];
+static uint16_t _host_idx_next[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
@@ -62,6 +71,10 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+    memset(_host_idx, 0, sizeof(_host_idx));
+    memset(_host_idx_next, 0, sizeof(_host_idx_next));
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -467,10 +480,122 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+static inline bool _offl_exact_match(const _nib_offl_entry_t *tmp,
+                                     const ipv6_addr_t *next_hop,
+                                     unsigned iface,
+                                     const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _nib_onl_entry_t *tmp_node = tmp->next_hop;
+
+    return (tmp->pfx_len == pfx_len) &&                 /* prefix length matches and */
+           (tmp_node != NULL) &&                        /* there is a next hop that */
+           (_nib_onl_get_if(tmp_node) == iface) &&      /* has a matching interface and */
+           _addr_equals(next_hop, tmp_node) &&          /* equal address to next_hop, also */
+           (ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len); /* the prefix matches */
+}
+
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+static inline uint16_t *_host_idx_bucket(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return &_host_idx[hash & (CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF - 1)];
+}
+
+static inline _nib_offl_entry_t *_host_idx_entry(uint16_t idx)
+{
+    return (idx == 0) ? NULL : &_dsts[idx - 1];
+}
+
+static inline uint16_t *_host_idx_next_ptr(const _nib_offl_entry_t *dst)
+{
+    return &_host_idx_next[dst - _dsts];
+}
+
+static void _host_idx_add(_nib_offl_entry_t *dst)
+{
+    uint16_t *bucket = _host_idx_bucket(&dst->pfx);
+
+    *_host_idx_next_ptr(dst) = *bucket;
+    *bucket = (dst - _dsts) + 1;
+}
+
+static void _host_idx_remove(_nib_offl_entry_t *dst)
+{
+    uint16_t *ptr = _host_idx_bucket(&dst->pfx);
+
+    while (*ptr != 0) {
+        _nib_offl_entry_t *tmp = _host_idx_entry(*ptr);
+
+        if (tmp == dst) {
+            *ptr = *_host_idx_next_ptr(dst);
+            *_host_idx_next_ptr(dst) = 0;
+            return;
+        }
+        ptr = _host_idx_next_ptr(tmp);
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_get_host(const ipv6_addr_t *addr)
+{
+    _nib_offl_entry_t *dst = _host_idx_entry(*_host_idx_bucket(addr));
+
+    while (dst != NULL) {
+        if ((dst->mode != _EMPTY) && ipv6_addr_equal(&dst->pfx, addr)) {
+            return dst;
+        }
+        dst = _host_idx_entry(*_host_idx_next_ptr(dst));
+    }
+    return NULL;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
+
+static _nib_offl_entry_t *_offl_get_exact_match(const ipv6_addr_t *next_hop,
+                                                unsigned iface,
+                                                const ipv6_addr_t *pfx,
+                                                unsigned pfx_len,
+                                                _nib_offl_entry_t **free)
+{
+    *free = NULL;
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+    if (pfx_len == IPV6_ADDR_BIT_LEN) {
+        /* only need to walk the chain for the bucket of the host route */
+        _nib_offl_entry_t *tmp = _host_idx_entry(*_host_idx_bucket(pfx));
+
+        while (tmp != NULL) {
+            if (_offl_exact_match(tmp, next_hop, iface, pfx, pfx_len)) {
+                return tmp;
+            }
+            tmp = _host_idx_entry(*_host_idx_next_ptr(tmp));
+        }
+        for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+            if (_dsts[i].next_hop == NULL) {
+                *free = &_dsts[i];
+                break;
+            }
+        }
+        return NULL;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        _nib_offl_entry_t *tmp = &_dsts[i];
+
+        if (_offl_exact_match(tmp, next_hop, iface, pfx, pfx_len)) {
+            return tmp;
+        }
+        if ((*free == NULL) && (tmp->next_hop == NULL)) {
+            *free = tmp;
+        }
+    }
+    return NULL;
+}
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
-    _nib_offl_entry_t *dst = NULL;
+    _nib_offl_entry_t *dst, *tmp;
 
     assert((pfx != NULL) && (!ipv6_addr_is_unspecified(pfx)) &&
            (pfx_len > 0) && (pfx_len <= 128));
@@ -481,26 +606,15 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
           iface);
     DEBUG("pfx = %s/%u)\n", ipv6_addr_to_str(addr_str, pfx,
                                              sizeof(addr_str)), pfx_len);
-    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
-        _nib_offl_entry_t *tmp = &_dsts[i];
-        _nib_onl_entry_t *tmp_node = tmp->next_hop;
-
-        if ((tmp->pfx_len == pfx_len) &&                /* prefix length matches and */
-            (tmp_node != NULL) &&                       /* there is a next hop that */
-            (_nib_onl_get_if(tmp_node) == iface) &&     /* has a matching interface and */
-            _addr_equals(next_hop, tmp_node) &&         /* equal address to next_hop, also */
-            (ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len)) {  /* the prefix matches */
-            /* exact match (or next hop address was previously unset) */
-            DEBUG("  %p is an exact match\n", (void *)tmp);
-            if (next_hop != NULL) {
-                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
-            }
-            tmp->next_hop->mode |= _DST;
-            return tmp;
-        }
-        if ((dst == NULL) && (tmp_node == NULL)) {
-            dst = tmp;
+    tmp = _offl_get_exact_match(next_hop, iface, pfx, pfx_len, &dst);
+    if (tmp != NULL) {
+        /* exact match (or next hop address was previously unset) */
+        DEBUG("  %p is an exact match\n", (void *)tmp);
+        if (next_hop != NULL) {
+            memcpy(&tmp->next_hop->ipv6, next_hop, sizeof(tmp->next_hop->ipv6));
         }
+        tmp->next_hop->mode |= _DST;
+        return tmp;
     }
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
@@ -514,6 +628,11 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+        if (pfx_len == IPV6_ADDR_BIT_LEN) {
+            _host_idx_add(dst);
+        }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
     }
     return dst;
 }
@@ -550,6 +669,11 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+        if (dst->pfx_len == IPV6_ADDR_BIT_LEN) {
+            _host_idx_remove(dst);
+        }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -580,6 +704,17 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+    /* a host route is always the longest match */
+    if ((res = _nib_offl_get_host(dst)) != NULL) {
+        DEBUG("nib: found host route via %s%%%u\n",
+              (res->mode == _PL) ? "(nil)" :
+              ipv6_addr_to_str(addr_str, &res->next_hop->ipv6,
+                               sizeof(addr_str)),
+              _nib_onl_get_if(res->next_hop));
+        return res;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
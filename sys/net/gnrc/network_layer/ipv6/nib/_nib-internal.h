@@ -545,6 +545,23 @@ _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last);
  */
 bool _nib_offl_is_entry(const _nib_offl_entry_t *entry);
 
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF || defined(DOXYGEN)
+/**
+ * @brief   Gets an off-link entry for a host route (prefix length 128) from
+ *          the host route index
+ *
+ * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+ *          not 0.
+ *
+ * @param[in] addr  The address of the destination host.
+ *
+ * @return  An off-link entry with _nib_offl_entry_t::pfx equal to @p addr
+ *          and a prefix length of 128.
+ * @return  NULL, if no such entry exists.
+ */
+_nib_offl_entry_t *_nib_offl_get_host(const ipv6_addr_t *addr);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF || defined(DOXYGEN) */
+
 /**
  * @brief   Helper function for view-level add-functions below
  *
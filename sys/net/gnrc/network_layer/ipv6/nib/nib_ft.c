@@ -95,6 +95,15 @@ void gnrc_ipv6_nib_ft_del(const ipv6_addr_t *dst, unsigned dst_len)
         }
     }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF
+    else if (dst_len == IPV6_ADDR_BIT_LEN) {
+        _nib_offl_entry_t *entry = _nib_offl_get_host(dst);
+
+        if (entry != NULL) {
+            _nib_ft_remove(entry);
+        }
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HOST_IDX_NUMOF */
     else {
         _nib_offl_entry_t *entry = NULL;
 
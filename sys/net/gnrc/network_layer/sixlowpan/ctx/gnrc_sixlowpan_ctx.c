@@ -12,9 +12,11 @@
  * @file
  */
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <inttypes.h>
 
+#include "irq.h"
 #include "mutex.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -30,9 +32,12 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+static uint32_t _ctx_next_inval = UINT32_MAX;
+static atomic_uint _ctx_version = 1;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
+static void _update_next_inval(void);
 
 static char ipv6str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -129,11 +134,47 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    _update_next_inval();
+    atomic_fetch_add(&_ctx_version, 1);
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
+{
+    if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
+        return;
+    }
+
+    /* might be called from interrupt context (e.g. a timer callback) so
+     * we can't use the mutex here */
+    unsigned state = irq_disable();
+    _ctxs[id].prefix_len = 0;
+    atomic_fetch_add(&_ctx_version, 1);
+    irq_restore(state);
+}
+
+unsigned gnrc_sixlowpan_ctx_version(void)
+{
+    /* the lock is only needed when a lifetime expired and contexts must be
+     * invalidated, otherwise the version is just read */
+    if ((_ctx_next_inval != UINT32_MAX) &&
+        (_current_minute() >= _ctx_next_inval)) {
+        mutex_lock(&_ctx_mutex);
+        if ((_ctx_next_inval != UINT32_MAX) &&
+            (_current_minute() >= _ctx_next_inval)) {
+            for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+                _update_lifetime(id);
+            }
+            _update_next_inval();
+        }
+        mutex_unlock(&_ctx_mutex);
+    }
+
+    return atomic_load(&_ctx_version);
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -158,18 +199,33 @@ static void _update_lifetime(uint8_t id)
         DEBUG("6lo ctx: context %u was invalidated for compression\n", id);
         _ctxs[id].ltime = 0;
         _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+        atomic_fetch_add(&_ctx_version, 1);
     }
     else {
         _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - now);
     }
 }
 
+static void _update_next_inval(void)
+{
+    _ctx_next_inval = UINT32_MAX;
+    for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if ((_ctxs[id].ltime > 0) && (_ctx_inval_times[id] < _ctx_next_inval)) {
+            _ctx_next_inval = _ctx_inval_times[id];
+        }
+    }
+}
+
 #ifdef TEST_SUITES
 #include <string.h>
 
 void gnrc_sixlowpan_ctx_reset(void)
 {
+    mutex_lock(&_ctx_mutex);
     memset(_ctxs, 0, sizeof(_ctxs));
+    _ctx_next_inval = UINT32_MAX;
+    atomic_fetch_add(&_ctx_version, 1);
+    mutex_unlock(&_ctx_mutex);
 }
 #endif
 
@@ -38,11 +38,6 @@ static inline uint16_t _floor8(uint16_t length)
     return length & 0xfff8U;
 }
 
-static inline size_t _min(size_t a, size_t b)
-{
-    return (a < b) ? a : b;
-}
-
 static inline uint8_t _max_frag_size(gnrc_netif_t *iface,
                                      gnrc_sixlowpan_frag_fb_t *fbuf)
 {
@@ -71,20 +66,11 @@ static inline int _payload_diff(gnrc_sixlowpan_frag_fb_t *fbuf,
 
 static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt,
                                        gnrc_sixlowpan_frag_fb_t *fbuf,
-                                       size_t payload_len, size_t size)
+                                       size_t hdr_size)
 {
     sixlowpan_frag_t *frag_hdr;
     gnrc_netif_hdr_t *netif_hdr = pkt->data, *new_netif_hdr;
     gnrc_pktsnip_t *netif, *frag;
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_HINT
-    size_t fragment_size = ((fbuf->hint.fragsz > 0) &&
-                            (fbuf->offset == 0))
-                         ? size     /* we want the calculated fragment size
-                                     * to include full IPHC header */
-                         : _min(size, payload_len);
-#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_HINT */
-    size_t fragment_size = _min(size, payload_len);
-#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_HINT */
 
     netif = gnrc_netif_hdr_build(gnrc_netif_hdr_get_src_addr(netif_hdr),
                                  netif_hdr->src_l2addr_len,
@@ -100,10 +86,10 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt,
     /* src_l2addr_len and dst_l2addr_len are already the same, now copy the rest */
     *new_netif_hdr = *netif_hdr;
 
-    frag = gnrc_pktbuf_add(NULL, NULL, fragment_size, GNRC_NETTYPE_SIXLOWPAN);
+    frag = gnrc_pktbuf_add(NULL, NULL, hdr_size, GNRC_NETTYPE_SIXLOWPAN);
 
     if (frag == NULL) {
-        DEBUG("6lo frag: error allocating first fragment\n");
+        DEBUG("6lo frag: error allocating fragment header\n");
         gnrc_pktbuf_release(netif);
         return NULL;
     }
@@ -115,18 +101,77 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt,
     return gnrc_pkt_prepend(frag, netif);
 }
 
-static uint16_t _copy_pkt_to_frag(uint8_t *data, const gnrc_pktsnip_t *pkt,
-                                  uint16_t max_frag_size, uint16_t init_offset)
+/**
+ * @brief   Gets exclusive write access to all snips of the datagram, so they
+ *          can be moved into the fragments
+ *
+ * Snips are only duplicated if they are shared with someone else (e.g. when
+ * the datagram is sent over multiple interfaces), so in most cases no data
+ * is copied.
+ */
+static int _start_write_payload(gnrc_pktsnip_t *pkt)
 {
-    uint16_t offset = init_offset;
-
-    while ((pkt != NULL) && (offset < max_frag_size)) {
-        uint16_t len = _min(max_frag_size - offset, pkt->size);
+    while (pkt->next != NULL) {
+        if (pkt->next->users > 1) {
+            gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(pkt->next);
+
+            if (tmp == NULL) {
+                DEBUG("6lo frag: unable to get write access to datagram\n");
+                return -ENOMEM;
+            }
+            pkt->next = tmp;
+        }
+        pkt = pkt->next;
+    }
+    return 0;
+}
 
-        memcpy(data + offset, pkt->data, len);
+/**
+ * @brief   Moves up to @p max_frag_size bytes from the front of the datagram
+ *          in @p fbuf to the end of @p frag
+ *
+ * The packet snips of the datagram are relinked into the fragment (splitting
+ * the snip at the fragment boundary with @ref gnrc_pktbuf_mark()), so the
+ * payload is not copied into an intermediate buffer. The network interface
+ * then serializes the fragment directly from the datagram's snips.
+ *
+ * @return  Number of bytes moved to @p frag.
+ * @return  0 on error.
+ */
+static uint16_t _move_pkt_to_frag(gnrc_pktsnip_t *frag,
+                                  gnrc_sixlowpan_frag_fb_t *fbuf,
+                                  uint16_t max_frag_size)
+{
+    gnrc_pktsnip_t *tail = frag;
+    uint16_t offset = 0;
 
-        offset += len;
-        pkt = pkt->next;
+    while (tail->next != NULL) {
+        tail = tail->next;
+    }
+    while ((fbuf->pkt->next != NULL) && (offset < max_frag_size)) {
+        gnrc_pktsnip_t *snip = fbuf->pkt->next, *front;
+        uint16_t len = max_frag_size - offset;
+
+        if (snip->size > len) {
+            /* split snip at fragment boundary: snip keeps the remainder and
+             * the marked snip, now at snip->next, holds the first len bytes */
+            front = gnrc_pktbuf_mark(snip, len, snip->type);
+
+            if (front == NULL) {
+                DEBUG("6lo frag: unable to split datagram at fragment "
+                      "boundary\n");
+                return 0;
+            }
+            snip->next = front->next;
+        }
+        else {
+            fbuf->pkt->next = snip->next;
+            front = snip;
+        }
+        front->next = NULL;
+        tail->next = front;
+        tail = front;
+        offset += front->size;
     }
     return offset;
 }
@@ -135,9 +180,8 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
                                    gnrc_sixlowpan_frag_fb_t *fbuf,
                                    size_t payload_len)
 {
-    gnrc_pktsnip_t *frag, *pkt = fbuf->pkt;
+    gnrc_pktsnip_t *frag;
     sixlowpan_frag_t *hdr;
-    uint8_t *data;
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
     int payload_diff = _payload_diff(fbuf, payload_len);
@@ -150,23 +194,26 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
 
     DEBUG("6lo frag: determined max_frag_size = %" PRIu16 "\n", max_frag_size);
 
-    frag = _build_frag_pkt(pkt, fbuf, payload_len,
-                           max_frag_size + sizeof(sixlowpan_frag_t));
+    if (_start_write_payload(fbuf->pkt) < 0) {
+        return 0;
+    }
+    frag = _build_frag_pkt(fbuf->pkt, fbuf, sizeof(sixlowpan_frag_t));
 
     if (frag == NULL) {
         return 0;
     }
 
     hdr = frag->next->data;
-    data = (uint8_t *)(hdr + 1);
     hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
 
     /* Tell the link layer that we will send more fragments */
     gnrc_netif_hdr_t *netif_hdr = frag->data;
     netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
 
-    pkt = pkt->next;    /* don't copy netif header */
-    local_offset = _copy_pkt_to_frag(data, pkt, max_frag_size, 0);
+    if ((local_offset = _move_pkt_to_frag(frag, fbuf, max_frag_size)) == 0) {
+        gnrc_pktbuf_release(frag);
+        return 0;
+    }
 
     DEBUG("6lo frag: send first fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", fragment size: %" PRIu16 ")\n",
@@ -180,10 +227,9 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
                                    size_t payload_len,
                                    gnrc_pktsnip_t **tx_sync)
 {
-    gnrc_pktsnip_t *frag, *pkt = fbuf->pkt;
+    gnrc_pktsnip_t *frag;
     sixlowpan_frag_n_t *hdr;
-    uint8_t *data;
-    uint16_t local_offset = 0, offset_count = 0, offset = fbuf->offset;
+    uint16_t local_offset, offset = fbuf->offset;
     /* since dispatches aren't supposed to go into subsequent fragments, we need not account
      * for payload difference as for the first fragment */
     uint16_t max_frag_size = _floor8(iface->sixlo.max_frag_size -
@@ -191,39 +237,24 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
 
     DEBUG("6lo frag: determined max_frag_size = %" PRIu16 "\n", max_frag_size);
 
-    frag = _build_frag_pkt(pkt, fbuf,
-                           payload_len - offset + sizeof(sixlowpan_frag_n_t),
-                           max_frag_size + sizeof(sixlowpan_frag_n_t));
+    frag = _build_frag_pkt(fbuf->pkt, fbuf, sizeof(sixlowpan_frag_n_t));
 
     if (frag == NULL) {
         return 0;
     }
 
     hdr = frag->next->data;
-    data = (uint8_t *)(hdr + 1);
     hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
     /* don't mention payload diff in offset */
     hdr->offset = (uint8_t)((offset + _payload_diff(fbuf,
                                                     payload_len)) >> 3);
-    pkt = pkt->next;    /* don't copy netif header */
-    while ((pkt != NULL) && (offset_count != offset)) {   /* go to offset */
-        offset_count += (uint16_t)pkt->size;
-
-        if (offset_count > offset) {    /* we overshot */
-            /* => copy rest of partly send packet snip */
-            uint16_t pkt_offset = offset - (offset_count - ((uint16_t)pkt->size));
-            size_t clen = _min(max_frag_size, pkt->size - pkt_offset);
-
-            memcpy(data, ((uint8_t *)pkt->data) + pkt_offset, clen);
-            local_offset = clen;
-            pkt = pkt->next;
-            break;
-        }
-
-        pkt = pkt->next;
+    /* the already sent part of the datagram was moved to the previous
+     * fragments, so the remaining payload starts at the front of
+     * fbuf->pkt->next */
+    if ((local_offset = _move_pkt_to_frag(frag, fbuf, max_frag_size)) == 0) {
+        gnrc_pktbuf_release(frag);
+        return 0;
     }
-    /* copy remaining packet snips */
-    local_offset = _copy_pkt_to_frag(data, pkt, max_frag_size, local_offset);
 
     if ((offset + local_offset) < payload_len) {
         gnrc_netif_hdr_t *netif_hdr = frag->data;
@@ -249,8 +280,10 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     gnrc_pktsnip_t *tx_sync = NULL;
     uint16_t res;
     /* payload_len: actual size of the packet vs
-     * datagram_size: size of the uncompressed IPv6 packet */
-    size_t payload_len = gnrc_pkt_len(fbuf->pkt->next);
+     * datagram_size: size of the uncompressed IPv6 packet.
+     * The part of the packet that was already sent was moved out of
+     * fbuf->pkt into the previous fragments */
+    size_t payload_len = fbuf->offset + gnrc_pkt_len(fbuf->pkt->next);
 
     assert((fbuf->pkt == pkt) || (pkt == NULL));
     (void)page;
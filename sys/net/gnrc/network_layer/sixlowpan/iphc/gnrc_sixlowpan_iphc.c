@@ -119,6 +119,23 @@
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+/**
+ * @brief   Cached context lookup results for a flow
+ */
+typedef struct {
+    ipv6_addr_t src;                    /**< source address of the flow */
+    ipv6_addr_t dst;                    /**< destination address of the flow */
+    gnrc_sixlowpan_ctx_t *src_ctx;      /**< context for the source address */
+    gnrc_sixlowpan_ctx_t *dst_ctx;      /**< context for the destination address */
+    unsigned version;                   /**< context buffer version the entry is valid for */
+} _ctx_cache_entry_t;
+
+/* only accessed from the 6LoWPAN thread, so no locking required */
+static _ctx_cache_entry_t _ctx_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _ctx_cache_next;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
 static inline bool _is_rfrag(gnrc_pktsnip_t *sixlo)
 {
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -1035,6 +1052,69 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
+static void _lookup_ctxs_uncached(const ipv6_hdr_t *ipv6_hdr,
+                                  gnrc_sixlowpan_ctx_t **src_ctx,
+                                  gnrc_sixlowpan_ctx_t **dst_ctx)
+{
+    *src_ctx = NULL;
+    *dst_ctx = NULL;
+    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
+        *src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
+        /* do not use source context for compression if */
+        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
+        if (*src_ctx && !((*src_ctx)->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            *src_ctx = NULL;
+        }
+    }
+
+    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
+        *dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
+        /* do not use destination context for compression if */
+        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
+        if (*dst_ctx && !((*dst_ctx)->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            *dst_ctx = NULL;
+        }
+    }
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+static void _lookup_ctxs(const ipv6_hdr_t *ipv6_hdr,
+                         gnrc_sixlowpan_ctx_t **src_ctx,
+                         gnrc_sixlowpan_ctx_t **dst_ctx)
+{
+    unsigned version = gnrc_sixlowpan_ctx_version();
+    _ctx_cache_entry_t *entry;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        entry = &_ctx_cache[i];
+        if ((entry->version == version) &&
+            ipv6_addr_equal(&entry->src, &ipv6_hdr->src) &&
+            ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst)) {
+            DEBUG("6lo iphc: using cached contexts for flow %u\n", i);
+            *src_ctx = entry->src_ctx;
+            *dst_ctx = entry->dst_ctx;
+            return;
+        }
+    }
+    _lookup_ctxs_uncached(ipv6_hdr, src_ctx, dst_ctx);
+    /* replace oldest entry */
+    entry = &_ctx_cache[_ctx_cache_next];
+    _ctx_cache_next = (_ctx_cache_next + 1) % CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->src_ctx = *src_ctx;
+    entry->dst_ctx = *dst_ctx;
+    entry->version = version;
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+static inline void _lookup_ctxs(const ipv6_hdr_t *ipv6_hdr,
+                                gnrc_sixlowpan_ctx_t **src_ctx,
+                                gnrc_sixlowpan_ctx_t **dst_ctx)
+{
+    _lookup_ctxs_uncached(ipv6_hdr, src_ctx, dst_ctx);
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
 static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface,
@@ -1052,23 +1132,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     iphc_hdr[IPHC2_IDX] = 0;
 
     /* check for available contexts */
-    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
-        /* do not use source context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            src_ctx = NULL;
-        }
-    }
-
-    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
-        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
-        /* do not use destination context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            dst_ctx = NULL;
-        }
-    }
+    _lookup_ctxs(ipv6_hdr, &src_ctx, &dst_ctx);
 
     /* if contexts available and both != 0 */
     /* since this moves inline_pos we have to do this ahead*/
@@ -20,6 +20,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include <assert.h>
 
 #include "log.h"
@@ -32,6 +33,10 @@
 #ifdef MODULE_PERIPH_HWRNG
 #include "periph/hwrng.h"
 #endif
+#ifdef MODULE_ENTROPY_SOURCE_ADC_NOISE
+#include "entropy_source.h"
+#include "entropy_source/adc_noise.h"
+#endif
 #ifdef MODULE_PERIPH_CPUID
 #include "luid.h"
 #endif
@@ -50,6 +55,13 @@ void auto_init_random(void)
     seed = puf_sram_seed;
 #elif defined (MODULE_PERIPH_HWRNG)
     hwrng_read(&seed, 4);
+#elif defined (MODULE_ENTROPY_SOURCE_ADC_NOISE)
+    if ((entropy_source_adc_init() != ENTROPY_SOURCE_OK) ||
+        (entropy_source_adc_get((uint8_t *)&seed, sizeof(seed)) !=
+         ENTROPY_SOURCE_OK)) {
+        LOG_WARNING("random: entropy source failed\n");
+        seed = RANDOM_SEED_DEFAULT;
+    }
 #elif defined (MODULE_PERIPH_CPUID)
     luid_get(&seed, 4);
 #else
@@ -63,15 +75,18 @@ void auto_init_random(void)
 void random_bytes(uint8_t *target, size_t n)
 {
     uint32_t random;
-    uint8_t *random_pos = (uint8_t*)&random;
-    unsigned _n = 0;
 
-    while (n--) {
-        if (! (_n++ & 0x3)) {
-            random = random_uint32();
-            random_pos = (uint8_t *) &random;
-        }
-        *target++ = *random_pos++;
+    /* copy whole words, gives the same bytes as copying byte by byte */
+    while (n >= sizeof(random)) {
+        random = random_uint32();
+        memcpy(target, &random, sizeof(random));
+        target += sizeof(random);
+        n -= sizeof(random);
+    }
+
+    if (n) {
+        random = random_uint32();
+        memcpy(target, &random, n);
     }
 }
 
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ *
+ * xoshiro256** and SplitMix64 by David Blackman and Sebastiano Vigna
+ * (https://prng.di.unimi.it/), released to the public domain.
+ */
+
+ /**
+ * @ingroup     sys_random
+ * @{
+ * @file
+ *
+ * @brief       xoshiro256** generator with caller provided state
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "random.h"
+
+#ifdef MODULE_PERIPH_HWRNG
+#include "periph/hwrng.h"
+#endif
+#ifdef MODULE_ENTROPY_SOURCE_ADC_NOISE
+#include "entropy_source.h"
+#include "entropy_source/adc_noise.h"
+#endif
+
+static uint64_t _splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+void random_ctx_init(random_ctx_t *ctx, const void *seed, size_t len)
+{
+    const uint8_t *in = seed;
+    uint64_t x = len;
+
+    /* absorb the seed as little endian 64 bit words */
+    while (len) {
+        uint64_t word = 0;
+        size_t n = (len < sizeof(word)) ? len : sizeof(word);
+
+        for (unsigned i = 0; i < n; i++) {
+            word |= (uint64_t)in[i] << (8 * i);
+        }
+        x = _splitmix64(&x) ^ word;
+        in += n;
+        len -= n;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx->s); i++) {
+        ctx->s[i] = _splitmix64(&x);
+    }
+}
+
+void random_ctx_seed(random_ctx_t *ctx)
+{
+    uint8_t seed[sizeof(ctx->s)];
+
+    random_bytes(seed, sizeof(seed));
+
+    /* mix in the seed source used by auto_init_random() */
+#if defined(MODULE_PERIPH_HWRNG) || \
+    (defined(MODULE_ENTROPY_SOURCE_ADC_NOISE) && !defined(MODULE_PUF_SRAM))
+    uint8_t extra[sizeof(seed)];
+
+#ifdef MODULE_PERIPH_HWRNG
+    hwrng_read(extra, sizeof(extra));
+#else
+    if (entropy_source_adc_get(extra, sizeof(extra)) != ENTROPY_SOURCE_OK) {
+        memset(extra, 0, sizeof(extra));
+    }
+#endif
+    for (unsigned i = 0; i < sizeof(seed); i++) {
+        seed[i] ^= extra[i];
+    }
+#endif
+
+    random_ctx_init(ctx, seed, sizeof(seed));
+}
+
+void random_ctx_bytes(random_ctx_t *ctx, void *buf, size_t size)
+{
+    uint8_t *out = buf;
+
+    while (size >= sizeof(uint64_t)) {
+        uint64_t r = random_ctx_uint64(ctx);
+
+        memcpy(out, &r, sizeof(r));
+        out += sizeof(r);
+        size -= sizeof(r);
+    }
+
+    if (size) {
+        uint64_t r = random_ctx_uint64(ctx);
+
+        memcpy(out, &r, size);
+    }
+}
+
+uint32_t random_ctx_uint32_range(random_ctx_t *ctx, uint32_t a, uint32_t b)
+{
+    assert(a < b);
+
+    /* Lemire's multiply and shift, rejecting the biased low part */
+    uint32_t range = b - a;
+    uint64_t m = (uint64_t)random_ctx_uint32(ctx) * range;
+
+    if ((uint32_t)m < range) {
+        uint32_t threshold = -range % range;
+
+        while ((uint32_t)m < threshold) {
+            m = (uint64_t)random_ctx_uint32(ctx) * range;
+        }
+    }
+
+    return a + (m >> 32);
+}
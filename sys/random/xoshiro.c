@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+ * @ingroup     sys_random
+ * @{
+ * @file
+ *
+ * @brief       xoshiro256** as global random number generator
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "random.h"
+
+static random_ctx_t _ctx;
+
+uint32_t random_uint32(void)
+{
+    return random_ctx_uint32(&_ctx);
+}
+
+void random_init(uint32_t val)
+{
+    random_ctx_init(&_ctx, &val, sizeof(val));
+}
+
+void random_init_by_array(uint32_t init_key[], int key_length)
+{
+    random_ctx_init(&_ctx, init_key, key_length * sizeof(uint32_t));
+}
@@ -64,6 +64,9 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
 
     state->offset = offset;
     state->target_slot = target_slot;
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    sha256_init(&state->sha256);
+#endif
     state->flashpage =
         flashpage_page((void *)riotboot_slot_get_hdr(target_slot));
 
@@ -111,6 +114,10 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
     LOG_DEBUG(LOG_PREFIX "processing bytes %u-%u\n", state->offset,
               state->offset + len - 1);
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    sha256_update(&state->sha256, bytes, len);
+#endif
+
     while (len) {
         /* Position within the page, calculated from state->offset by
          * subtracting the start offset of the current page */
@@ -155,7 +162,10 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                        state->flashpage_buf, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
             else {
-                flashpage_write((uint8_t *)addr + flashpage_pos,
+                /* the buffer may have been filled starting at
+                 * flashwrite_buffer_pos, write it where it starts */
+                flashpage_write((uint8_t *)addr + flashpage_pos -
+                                flashwrite_buffer_pos,
                                 state->flashpage_buf,
                                 RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
@@ -248,3 +258,14 @@ int riotboot_flashwrite_finish_raw(riotboot_flashwrite_t *state,
 #endif /* !CONFIG_RIOTBOOT_FLASHWRITE_RAW */
     return 0;
 }
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+void riotboot_flashwrite_sha256_final(const riotboot_flashwrite_t *state,
+                                      void *digest)
+{
+    /* finalize a copy, the digest may be queried more than once */
+    sha256_context_t ctx = state->sha256;
+
+    sha256_final(&ctx, digest);
+}
+#endif
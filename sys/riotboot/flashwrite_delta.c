@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_riotboot_flashwrite_delta
+ * @{
+ *
+ * @file
+ * @brief       Delta updates for riotboot flashwrite
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "hashes/sha256.h"
+#include "riotboot/flashwrite_delta.h"
+#include "riotboot/slot.h"
+
+#define LOG_PREFIX "riotboot_flashwrite_delta: "
+#include "log.h"
+
+/* offsets of the header fields */
+#define HDR_SOURCE_LEN      (4U)
+#define HDR_TARGET_LEN      (8U)
+#define HDR_SOURCE_DIGEST   (12U)
+
+/* length of the operations, including their type */
+#define OP_COPY_LEN         (9U)
+#define OP_INSERT_LEN       (5U)
+
+/* op value while the patch header is received */
+#define OP_HEADER           (0xff)
+
+static inline size_t min(size_t a, size_t b)
+{
+    return a <= b ? a : b;
+}
+
+void riotboot_flashwrite_delta_init(riotboot_flashwrite_delta_t *state,
+                                    riotboot_flashwrite_t *writer,
+                                    int source_slot)
+{
+    assert(source_slot != writer->target_slot);
+
+    memset(state, 0, sizeof(*state));
+    state->writer = writer;
+    state->source = (const uint8_t *)riotboot_slot_get_hdr(source_slot);
+    state->source_len = riotboot_slot_size(source_slot);
+    /* the writer doesn't expect the bytes in front of its start offset */
+    state->skip = writer->offset;
+    state->op = OP_HEADER;
+}
+
+static int _write(riotboot_flashwrite_delta_t *state,
+                  const uint8_t *bytes, size_t len)
+{
+    state->produced += len;
+
+    if (state->skip) {
+        size_t skip = min(state->skip, len);
+        state->skip -= skip;
+        bytes += skip;
+        len -= skip;
+    }
+
+    if (len == 0) {
+        return 0;
+    }
+
+    return riotboot_flashwrite_putbytes(state->writer, bytes, len, true);
+}
+
+static int _parse_header(riotboot_flashwrite_delta_t *state)
+{
+    const uint8_t *hdr = state->buf;
+
+    if (memcmp(hdr, RIOTBOOT_FLASHWRITE_DELTA_MAGIC,
+               sizeof(RIOTBOOT_FLASHWRITE_DELTA_MAGIC) - 1)) {
+        LOG_WARNING(LOG_PREFIX "invalid magic number\n");
+        return -EINVAL;
+    }
+
+    size_t source_len = byteorder_bebuftohl(hdr + HDR_SOURCE_LEN);
+    size_t target_len = byteorder_bebuftohl(hdr + HDR_TARGET_LEN);
+
+    if (source_len > state->source_len) {
+        return -EBADMSG;
+    }
+    if ((target_len < state->skip) ||
+        (target_len > riotboot_flashwrite_slotsize(state->writer))) {
+        LOG_WARNING(LOG_PREFIX "image doesn't fit into the slot\n");
+        return -EFBIG;
+    }
+
+    /* make sure the patch is applied to the image it was created for */
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256(state->source, source_len, digest);
+    if (memcmp(digest, hdr + HDR_SOURCE_DIGEST, sizeof(digest))) {
+        LOG_WARNING(LOG_PREFIX "patch doesn't apply to the source image\n");
+        return -EBADMSG;
+    }
+
+    state->source_len = source_len;
+    state->target_len = target_len;
+
+    return 0;
+}
+
+static int _parse_op(riotboot_flashwrite_delta_t *state)
+{
+    const uint8_t *op = state->buf;
+
+    state->remaining = byteorder_bebuftohl(op + 1);
+
+    if (op[0] == RIOTBOOT_FLASHWRITE_DELTA_COPY) {
+        state->copy_from = state->remaining;
+        state->remaining = byteorder_bebuftohl(op + 5);
+        if ((state->copy_from > state->source_len) ||
+            (state->remaining > state->source_len - state->copy_from)) {
+            return -EINVAL;
+        }
+    }
+    else if (op[0] != RIOTBOOT_FLASHWRITE_DELTA_INSERT) {
+        return -EINVAL;
+    }
+
+    if (state->remaining > state->target_len - state->produced) {
+        return -EINVAL;
+    }
+
+    state->op = op[0];
+    return 0;
+}
+
+/* collects the header of the patch or of the next operation, returns the
+ * number of bytes consumed */
+static int _collect(riotboot_flashwrite_delta_t *state,
+                    const uint8_t *bytes, size_t len)
+{
+    size_t need;
+
+    if (state->op == OP_HEADER) {
+        need = RIOTBOOT_FLASHWRITE_DELTA_HDR_LEN;
+    }
+    else if ((state->buf_len ? state->buf[0] : bytes[0]) ==
+             RIOTBOOT_FLASHWRITE_DELTA_COPY) {
+        need = OP_COPY_LEN;
+    }
+    else {
+        need = OP_INSERT_LEN;
+    }
+
+    size_t n = min(need - state->buf_len, len);
+    memcpy(state->buf + state->buf_len, bytes, n);
+    state->buf_len += n;
+
+    if (state->buf_len < need) {
+        return n;
+    }
+
+    int res;
+    if (state->op == OP_HEADER) {
+        res = _parse_header(state);
+        state->op = 0;
+    }
+    else {
+        res = _parse_op(state);
+    }
+    state->buf_len = 0;
+
+    return res < 0 ? res : (int)n;
+}
+
+int riotboot_flashwrite_delta_putbytes(riotboot_flashwrite_delta_t *state,
+                                       const uint8_t *bytes, size_t len)
+{
+    LOG_DEBUG(LOG_PREFIX "processing patch bytes %u-%u\n",
+              (unsigned)state->offset, (unsigned)(state->offset + len - 1));
+
+    state->offset += len;
+
+    while (len) {
+        int res;
+
+        if (state->op == RIOTBOOT_FLASHWRITE_DELTA_INSERT) {
+            size_t n = min(state->remaining, len);
+            res = _write(state, bytes, n);
+            if (res < 0) {
+                return res;
+            }
+            state->remaining -= n;
+            bytes += n;
+            len -= n;
+        }
+        else {
+            if (state->op != OP_HEADER &&
+                state->produced == state->target_len) {
+                LOG_WARNING(LOG_PREFIX "data after the end of the image\n");
+                return -EINVAL;
+            }
+            res = _collect(state, bytes, len);
+            if (res < 0) {
+                return res;
+            }
+            bytes += res;
+            len -= res;
+        }
+
+        /* copies need no patch data, apply them right away */
+        if (state->op == RIOTBOOT_FLASHWRITE_DELTA_COPY) {
+            res = _write(state, state->source + state->copy_from,
+                         state->remaining);
+            if (res < 0) {
+                return res;
+            }
+            state->remaining = 0;
+        }
+
+        if (state->remaining == 0 && state->op != OP_HEADER) {
+            state->op = 0;
+        }
+    }
+
+    return 0;
+}
+
+int riotboot_flashwrite_delta_flush(riotboot_flashwrite_delta_t *state)
+{
+    if (state->op != 0 || state->buf_len ||
+        state->produced != state->target_len) {
+        LOG_WARNING(LOG_PREFIX "incomplete patch\n");
+        return -EINVAL;
+    }
+
+    return riotboot_flashwrite_flush(state->writer);
+}
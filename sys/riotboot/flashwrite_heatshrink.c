@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_riotboot_flashwrite_heatshrink
+ * @{
+ *
+ * @file
+ * @brief       Streaming heatshrink decompression for riotboot flashwrite
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "riotboot/flashwrite_heatshrink.h"
+
+#define LOG_PREFIX "riotboot_flashwrite_heatshrink: "
+#include "log.h"
+
+void riotboot_flashwrite_heatshrink_init(riotboot_flashwrite_heatshrink_t *state,
+                                         riotboot_flashwrite_t *writer)
+{
+    state->writer = writer;
+    state->offset = 0;
+    /* the writer doesn't expect the bytes in front of its start offset */
+    state->skip = writer->offset;
+    heatshrink_decoder_reset(&state->decoder);
+}
+
+static int _write(riotboot_flashwrite_heatshrink_t *state,
+                  const uint8_t *bytes, size_t len)
+{
+    if (state->skip) {
+        size_t skip = state->skip < len ? state->skip : len;
+        state->skip -= skip;
+        bytes += skip;
+        len -= skip;
+    }
+
+    if (len == 0) {
+        return 0;
+    }
+
+    /* the size of the decompressed image isn't known in advance, make sure
+     * a bogus stream doesn't run over the end of the slot */
+    if (state->writer->offset + len >
+        riotboot_flashwrite_slotsize(state->writer)) {
+        LOG_WARNING(LOG_PREFIX "image exceeds slot size\n");
+        return -EFBIG;
+    }
+
+    return riotboot_flashwrite_putbytes(state->writer, bytes, len, true);
+}
+
+static int _poll(riotboot_flashwrite_heatshrink_t *state)
+{
+    HSD_poll_res res;
+
+    do {
+        size_t len = 0;
+        res = heatshrink_decoder_poll(&state->decoder, state->buf,
+                                      sizeof(state->buf), &len);
+        if (res < 0) {
+            LOG_WARNING(LOG_PREFIX "decoder error %d\n", (int)res);
+            return -EINVAL;
+        }
+
+        int err = _write(state, state->buf, len);
+        if (err) {
+            return err;
+        }
+    } while (res == HSDR_POLL_MORE);
+
+    return 0;
+}
+
+int riotboot_flashwrite_heatshrink_putbytes(riotboot_flashwrite_heatshrink_t *state,
+                                            const uint8_t *bytes, size_t len)
+{
+    LOG_DEBUG(LOG_PREFIX "processing compressed bytes %u-%u\n",
+              (unsigned)state->offset, (unsigned)(state->offset + len - 1));
+
+    while (len) {
+        size_t sunk = 0;
+
+        /* the decoder only takes what fits into its input buffer, the rest
+         * follows after the output was polled */
+        if (heatshrink_decoder_sink(&state->decoder, (uint8_t *)bytes, len,
+                                    &sunk) < 0) {
+            return -EINVAL;
+        }
+        bytes += sunk;
+        len -= sunk;
+        state->offset += sunk;
+
+        int res = _poll(state);
+        if (res) {
+            return res;
+        }
+    }
+
+    return 0;
+}
+
+int riotboot_flashwrite_heatshrink_flush(riotboot_flashwrite_heatshrink_t *state)
+{
+    HSD_finish_res res;
+
+    while ((res = heatshrink_decoder_finish(&state->decoder)) ==
+           HSDR_FINISH_MORE) {
+        int err = _poll(state);
+        if (err) {
+            return err;
+        }
+    }
+
+    if (res != HSDR_FINISH_DONE) {
+        return -EINVAL;
+    }
+
+    if (state->skip) {
+        LOG_WARNING(LOG_PREFIX "image too small\n");
+        return -EINVAL;
+    }
+
+    return riotboot_flashwrite_flush(state->writer);
+}
@@ -97,6 +97,24 @@ int suit_component_name_to_string(const suit_manifest_t *manifest,
 
 }
 
+int suit_component_get_compression(const suit_manifest_t *manifest,
+                                   const suit_component_t *component,
+                                   int32_t *compression)
+{
+    nanocbor_value_t param;
+
+    *compression = SUIT_COMPRESSION_NONE;
+    if (suit_param_ref_to_cbor(manifest, &component->param_compression_info,
+                               &param) == 0) {
+        return SUIT_OK;
+    }
+    if (nanocbor_get_int32(&param, compression) < 0) {
+        return SUIT_ERR_INVALID_MANIFEST;
+    }
+
+    return SUIT_OK;
+}
+
 int suit_handle_manifest_structure(suit_manifest_t *manifest,
                                    nanocbor_value_t *it,
                                    const suit_manifest_handler_t *handlers,
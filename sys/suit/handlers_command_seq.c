@@ -279,6 +279,9 @@ static int _dtv_set_param(suit_manifest_t *manifest, int key,
             case SUIT_PARAMETER_URI:
                 ref = &comp->param_uri;
                 break;
+            case SUIT_PARAMETER_COMPRESSION_INFO:
+                ref = &comp->param_compression_info;
+                break;
             default:
                 LOG_DEBUG("Unsupported parameter %" PRIi32 "\n", param_key);
                 return SUIT_ERR_UNSUPPORTED;
@@ -413,7 +416,19 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
-    if (suit_storage_has_readptr(storage)) {
+    if (suit_storage_has_sha256(storage)) {
+        /* Hashed while it was written */
+        size_t payload_len = 0;
+
+        if (suit_storage_sha256(storage, payload_digest,
+                                &payload_len) != SUIT_OK) {
+            return SUIT_ERR_STORAGE;
+        }
+        if (payload_size != payload_len) {
+            return SUIT_ERR_STORAGE_EXCEEDED;
+        }
+    }
+    else if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
         size_t payload_len = 0;
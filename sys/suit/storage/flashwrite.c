@@ -18,6 +18,7 @@
  *
  * @}
  */
+#include <inttypes.h>
 #include <string.h>
 
 #include "kernel_defines.h"
@@ -47,13 +48,92 @@ static int _flashwrite_start(suit_storage_t *storage,
                              const suit_manifest_t *manifest,
                              size_t len)
 {
-    (void)manifest;
-    (void)len;
     suit_storage_flashwrite_t *fw = _get_fw(storage);
     int target_slot = riotboot_slot_other();
+    int32_t compression;
+
+    if (len > riotboot_slot_size(target_slot)) {
+        LOG_ERROR("Image doesn't fit into the slot\n");
+        return SUIT_ERR_STORAGE_EXCEEDED;
+    }
+
+    int res = suit_component_get_compression(manifest,
+                    &manifest->components[manifest->component_current],
+                    &compression);
+    if (res < 0) {
+        return res;
+    }
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_HEATSHRINK)
+    fw->compressed = (compression == SUIT_COMPRESSION_HEATSHRINK);
+    if (fw->compressed) {
+        compression = SUIT_COMPRESSION_NONE;
+    }
+#endif
+
+    if (compression != SUIT_COMPRESSION_NONE) {
+        LOG_ERROR("Unsupported compression: %" PRIi32 "\n", compression);
+        return SUIT_ERR_UNSUPPORTED;
+    }
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA)
+    fw->patch = false;
+#endif
+
+    fw->size = len;
+    res = riotboot_flashwrite_init(&fw->writer, target_slot);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_HEATSHRINK)
+    if (fw->compressed) {
+        riotboot_flashwrite_heatshrink_init(&fw->heatshrink, &fw->writer);
+    }
+#endif
+
+    return res;
+}
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_HEATSHRINK)
+static int _flashwrite_write_compressed(suit_storage_flashwrite_t *fw,
+                                        const uint8_t *buf, size_t offset,
+                                        size_t len)
+{
+    /* the decompression stage drops the magic number itself, offsets refer to
+     * the compressed payload */
+    if (offset != fw->heatshrink.offset) {
+        LOG_ERROR("Unexpected offset: %u - expected: %u\n", (unsigned)offset,
+                  (unsigned)fw->heatshrink.offset);
+        return SUIT_ERR_STORAGE;
+    }
+
+    return riotboot_flashwrite_heatshrink_putbytes(&fw->heatshrink, buf, len) < 0
+           ? SUIT_ERR_STORAGE : SUIT_OK;
+}
+#endif
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA)
+static int _flashwrite_write_patch(suit_storage_flashwrite_t *fw,
+                                   const uint8_t *buf, size_t offset,
+                                   size_t len)
+{
+    if (offset == 0) {
+        int source_slot = riotboot_slot_current();
+        if (source_slot < 0) {
+            LOG_ERROR("No running image to apply the patch to\n");
+            return SUIT_ERR_STORAGE;
+        }
+        riotboot_flashwrite_delta_init(&fw->delta, &fw->writer, source_slot);
+    }
+
+    if (offset != fw->delta.offset) {
+        LOG_ERROR("Unexpected offset: %u - expected: %u\n", (unsigned)offset,
+                  (unsigned)fw->delta.offset);
+        return SUIT_ERR_STORAGE;
+    }
 
-    return riotboot_flashwrite_init(&fw->writer, target_slot);
+    return riotboot_flashwrite_delta_putbytes(&fw->delta, buf, len) < 0
+           ? SUIT_ERR_STORAGE : SUIT_OK;
 }
+#endif
 
 static int _flashwrite_write(suit_storage_t *storage,
                              const suit_manifest_t *manifest,
@@ -62,6 +142,24 @@ static int _flashwrite_write(suit_storage_t *storage,
     (void)manifest;
     suit_storage_flashwrite_t *fw = _get_fw(storage);
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_HEATSHRINK)
+    if (fw->compressed) {
+        return _flashwrite_write_compressed(fw, buf, offset, len);
+    }
+#endif
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA)
+    /* patches are told apart from images by their magic number */
+    if (offset == 0) {
+        fw->patch = (len >= sizeof(RIOTBOOT_FLASHWRITE_DELTA_MAGIC) - 1) &&
+                    !memcmp(buf, RIOTBOOT_FLASHWRITE_DELTA_MAGIC,
+                            sizeof(RIOTBOOT_FLASHWRITE_DELTA_MAGIC) - 1);
+    }
+    if (fw->patch) {
+        return _flashwrite_write_patch(fw, buf, offset, len);
+    }
+#endif
+
     if (offset == 0) {
         if (len < RIOTBOOT_FLASHWRITE_SKIPLEN) {
             LOG_WARNING("_suit_flashwrite(): offset==0, len<4. aborting\n");
@@ -78,17 +176,63 @@ static int _flashwrite_write(suit_storage_t *storage,
         return SUIT_ERR_STORAGE;
     }
 
+    if (offset + len > fw->size) {
+        LOG_ERROR("Image beyond size, offset + len=%u, image_size=%u\n",
+                  (unsigned)(offset + len), (unsigned)fw->size);
+        return SUIT_ERR_STORAGE_EXCEEDED;
+    }
+
     return riotboot_flashwrite_putbytes(&fw->writer, buf, len, 1);
 }
 
+static int _flashwrite_flush(suit_storage_flashwrite_t *fw)
+{
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_HEATSHRINK)
+    if (fw->compressed) {
+        return riotboot_flashwrite_heatshrink_flush(&fw->heatshrink);
+    }
+#endif
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA)
+    if (fw->patch) {
+        return riotboot_flashwrite_delta_flush(&fw->delta);
+    }
+#endif
+
+    return riotboot_flashwrite_flush(&fw->writer);
+}
+
 static int _flashwrite_finish(suit_storage_t *storage,
                               const suit_manifest_t *manifest)
 {
     (void)manifest;
     suit_storage_flashwrite_t *fw = _get_fw(storage);
 
-    return riotboot_flashwrite_flush(&fw->writer) <
-           0 ? SUIT_ERR_STORAGE : SUIT_OK;
+    if (_flashwrite_flush(fw) < 0) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    /* compressed payloads and patches only show their image size now */
+    if (fw->writer.offset != fw->size) {
+        LOG_INFO("Incorrect size received, got %u, expected %u\n",
+                 (unsigned)fw->writer.offset, (unsigned)fw->size);
+        return SUIT_ERR_STORAGE;
+    }
+
+    return SUIT_OK;
+}
+
+static int _flashwrite_sha256(suit_storage_t *storage, uint8_t *digest,
+                              size_t *len)
+{
+    suit_storage_flashwrite_t *fw = _get_fw(storage);
+
+    /* the writer hashed the image as it was written, including the magic
+     * number that isn't in flash yet */
+    riotboot_flashwrite_sha256_final(&fw->writer, digest);
+    *len = fw->writer.offset;
+
+    return SUIT_OK;
 }
 
 static int _flashwrite_install(suit_storage_t *storage,
@@ -225,6 +369,7 @@ static const suit_storage_driver_t suit_storage_flashwrite_driver = {
     .write = _flashwrite_write,
     .finish = _flashwrite_finish,
     .read = _flashwrite_read,
+    .sha256 = _flashwrite_sha256,
     .install = _flashwrite_install,
     .has_location = _flashwrite_has_location,
     .set_active_location = _flashwrite_set_active_location,
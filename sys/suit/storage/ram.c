@@ -85,14 +85,22 @@ static int _ram_init(suit_storage_t *storage)
 static int _ram_start(suit_storage_t *storage, const suit_manifest_t *manifest,
                       size_t len)
 {
-    (void)manifest;
     suit_storage_ram_t *ram = _get_ram(storage);
     suit_storage_ram_region_t *region = _get_active_region(ram);
+    int32_t compression;
+
+    if ((suit_component_get_compression(manifest,
+                &manifest->components[manifest->component_current],
+                &compression) < 0) ||
+        (compression != SUIT_COMPRESSION_NONE)) {
+        return SUIT_ERR_UNSUPPORTED;
+    }
 
     if (len > CONFIG_SUIT_STORAGE_RAM_SIZE) {
         return SUIT_ERR_STORAGE_EXCEEDED;
     }
 
+    ram->size = len;
     region->occupied = 0;
     return SUIT_OK;
 }
@@ -104,7 +112,9 @@ static int _ram_write(suit_storage_t *storage, const suit_manifest_t *manifest,
     suit_storage_ram_t *ram = _get_ram(storage);
     suit_storage_ram_region_t *region = _get_active_region(ram);
 
-    if (offset + len > CONFIG_SUIT_STORAGE_RAM_SIZE) {
+    if (offset + len > ram->size) {
+        LOG_ERROR("Image beyond size, offset + len=%u, image_size=%u\n",
+                  (unsigned)(offset + len), (unsigned)ram->size);
         return SUIT_ERR_STORAGE_EXCEEDED;
     }
 
@@ -115,8 +125,15 @@ static int _ram_write(suit_storage_t *storage, const suit_manifest_t *manifest,
 
 static int _ram_finish(suit_storage_t *storage, const suit_manifest_t *manifest)
 {
-    (void)storage;
     (void)manifest;
+    suit_storage_ram_t *ram = _get_ram(storage);
+    suit_storage_ram_region_t *region = _get_active_region(ram);
+
+    if (region->occupied != ram->size) {
+        LOG_INFO("Incorrect size received, got %u, expected %u\n",
+                 (unsigned)region->occupied, (unsigned)ram->size);
+        return SUIT_ERR_STORAGE;
+    }
     return SUIT_OK;
 }
 
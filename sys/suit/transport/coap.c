@@ -133,10 +133,23 @@ static inline uint32_t deadline_left(uint32_t deadline)
     return left;
 }
 
-static ssize_t _nanocoap_request(sock_udp_t *sock, coap_pkt_t *pkt, size_t len)
+static ssize_t _nanocoap_send(sock_udp_t *sock, coap_pkt_t *pkt)
 {
-    ssize_t res = -EAGAIN;
     size_t pdu_len = (pkt->payload - (uint8_t *)pkt->hdr) + pkt->payload_len;
+    ssize_t res = sock_udp_send(sock, pkt->hdr, pdu_len, NULL);
+
+    if (res <= 0) {
+        DEBUG("nanocoap: error sending coap request, %d\n", (int)res);
+    }
+    return res;
+}
+
+/* waits for the response to a request sent by _nanocoap_send() and
+ * retransmits the request on timeouts */
+static ssize_t _nanocoap_response(sock_udp_t *sock, coap_pkt_t *pkt,
+                                  size_t len)
+{
+    ssize_t res = 0;
     uint8_t *buf = (uint8_t *)pkt->hdr;
     uint32_t id = coap_get_id(pkt);
 
@@ -150,9 +163,8 @@ static ssize_t _nanocoap_request(sock_udp_t *sock, coap_pkt_t *pkt, size_t len)
 
     while (tries_left) {
         if (res == -EAGAIN) {
-            res = sock_udp_send(sock, buf, pdu_len, NULL);
+            res = _nanocoap_send(sock, pkt);
             if (res <= 0) {
-                DEBUG("nanocoap: error sending coap request, %d\n", (int)res);
                 break;
             }
         }
@@ -194,12 +206,14 @@ static ssize_t _nanocoap_request(sock_udp_t *sock, coap_pkt_t *pkt, size_t len)
     return res;
 }
 
-static int _fetch_block(coap_pkt_t *pkt, uint8_t *buf, sock_udp_t *sock,
-                        const char *path, coap_blksize_t blksize, size_t num)
+static int _request_block(coap_pkt_t *pkt, uint8_t *buf, sock_udp_t *sock,
+                          const char *path, coap_blksize_t blksize, size_t num)
 {
     uint8_t *pktpos = buf;
     uint16_t lastonum = 0;
 
+    DEBUG("fetching block %u\n", (unsigned)num);
+
     pkt->hdr = (coap_hdr_t *)buf;
 
     pktpos += coap_build_hdr(pkt->hdr, COAP_TYPE_CON, NULL, 0, COAP_METHOD_GET,
@@ -212,7 +226,13 @@ static int _fetch_block(coap_pkt_t *pkt, uint8_t *buf, sock_udp_t *sock,
     pkt->payload = pktpos;
     pkt->payload_len = 0;
 
-    int res = _nanocoap_request(sock, pkt, 64 + (0x1 << (blksize + 4)));
+    return _nanocoap_send(sock, pkt) <= 0 ? -1 : 0;
+}
+
+static int _await_block(coap_pkt_t *pkt, sock_udp_t *sock,
+                        coap_blksize_t blksize)
+{
+    int res = _nanocoap_response(sock, pkt, 64 + (0x1 << (blksize + 4)));
     if (res < 0) {
         return res;
     }
@@ -230,10 +250,12 @@ int suit_coap_get_blockwise(sock_udp_ep_t *remote, const char *path,
                             coap_blksize_t blksize,
                             coap_blockwise_cb_t callback, void *arg)
 {
-    /* mmmmh dynamically sized array */
-    uint8_t buf[64 + (0x1 << (blksize + 4))];
+    /* mmmmh dynamically sized array, one buffer receives the next block
+     * while the callback processes the other one */
+    uint8_t buf[2][64 + (0x1 << (blksize + 4))];
     sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
-    coap_pkt_t pkt;
+    coap_pkt_t pkt[2];
+    unsigned cur = 0;
 
     /* HACK: use random local port */
     local.port = 0x8000 + (xtimer_now_usec() % 0XFFF);
@@ -246,36 +268,45 @@ int suit_coap_get_blockwise(sock_udp_ep_t *remote, const char *path,
 
     int more = 1;
     size_t num = 0;
-    res = -1;
-    while (more == 1) {
-        DEBUG("fetching block %u\n", (unsigned)num);
-        res = _fetch_block(&pkt, buf, &sock, path, blksize, num);
+    res = _request_block(&pkt[cur], buf[cur], &sock, path, blksize, num);
+    while (!res) {
+        res = _await_block(&pkt[cur], &sock, blksize);
         DEBUG("res=%i\n", res);
+        if (res) {
+            DEBUG("error fetching block\n");
+            break;
+        }
 
-        if (!res) {
-            coap_block1_t block2;
-            coap_get_block2(&pkt, &block2);
-            more = block2.more;
-
-            if (callback(arg, block2.offset, pkt.payload, pkt.payload_len,
-                         more)) {
-                DEBUG("callback res != 0, aborting.\n");
-                res = -1;
-                goto out;
+        coap_block1_t block2;
+        coap_get_block2(&pkt[cur], &block2);
+        more = block2.more;
+
+        /* request the next block first, so the transfer overlaps with e.g.
+         * writing the current one to flash */
+        if (more == 1) {
+            num += 1;
+            res = _request_block(&pkt[!cur], buf[!cur], &sock, path, blksize,
+                                 num);
+            if (res) {
+                break;
             }
         }
-        else {
-            DEBUG("error fetching block\n");
+
+        if (callback(arg, block2.offset, pkt[cur].payload,
+                     pkt[cur].payload_len, more)) {
+            DEBUG("callback res != 0, aborting.\n");
             res = -1;
-            goto out;
+            break;
         }
 
-        num += 1;
+        if (more != 1) {
+            break;
+        }
+        cur = !cur;
     }
 
-out:
     sock_udp_close(&sock);
-    return res;
+    return res ? -1 : 0;
 }
 
 int suit_coap_get_blockwise_url(const char *url,
@@ -394,7 +425,6 @@ int suit_storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
 
     uint32_t image_size;
     nanocbor_value_t param_size;
-    size_t total = offset + len;
     suit_component_t *comp = &manifest->components[manifest->component_current];
     suit_param_ref_t *ref_size = &comp->param_size;
 
@@ -405,24 +435,14 @@ int suit_storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
         return -1;
     }
 
-    if (image_size < offset + len) {
-        /* Extra newline at the start to compensate for the progress bar */
-        LOG_ERROR(
-            "\n_suit_coap(): Image beyond size, offset + len=%u, "
-            "image_size=%u\n", (unsigned)(total), (unsigned)image_size);
-        return -1;
-    }
-
-    if (!more && image_size != total) {
-        LOG_INFO("Incorrect size received, got %u, expected %u\n",
-                 (unsigned)total, (unsigned)image_size);
-        return -1;
-    }
+    /* The payload can be compressed or a patch, so its size needn't match the
+     * image size. The storage backend checks the size of the image it stores
+     * when writing and finishing. */
 
     _print_download_progress(manifest, offset, len, image_size);
 
     int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
-    if (!more) {
+    if (!more && res == SUIT_OK) {
         LOG_INFO("Finalizing payload store\n");
         /* Finalize the write if no more data available */
         res = suit_storage_finish(comp->storage_backend, manifest);
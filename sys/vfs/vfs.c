@@ -23,6 +23,7 @@
 #include <fcntl.h> /* for O_ACCMODE, ..., fcntl */
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
+#include "irq.h"
 #include "vfs.h"
 #include "mutex.h"
 #include "thread.h"
@@ -60,6 +61,34 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+#if VFS_MOUNT_TABLE_SIZE
+/**
+ * @internal
+ * @brief Lookup table of the mounts, sorted by descending mount point length
+ *
+ * Only written with _mount_mutex held and read with interrupts disabled. If
+ * there are more mounts than entries, the table holds those with the longest
+ * mount points, so a match found in the table is the longest match among all
+ * mounts.
+ */
+static vfs_mount_t *_vfs_mount_table[VFS_MOUNT_TABLE_SIZE];
+
+/**
+ * @internal
+ * @brief Number of valid entries in _vfs_mount_table
+ */
+static unsigned _vfs_mount_table_len;
+#endif
+
+/**
+ * @internal
+ * @brief Generation of _vfs_mount_table
+ *
+ * Incremented before and after the mounts are changed, so it is odd while a
+ * mount or umount is in progress and the table must not be used.
+ */
+static atomic_uint _vfs_mount_gen;
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -130,8 +159,23 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
+/**
+ * @internal
+ * @brief Mark the start of a change to the mounts
+ *
+ * Must be called with _mount_mutex held.
+ */
+static inline void _mounts_change_begin(void);
+
+/**
+ * @internal
+ * @brief Rebuild the lookup table and mark the end of a change to the mounts
+ *
+ * Must be called with _mount_mutex held.
+ */
+static void _mounts_change_end(void);
+
 static mutex_t _mount_mutex = MUTEX_INIT;
-static mutex_t _open_mutex = MUTEX_INIT;
 
 int vfs_close(int fd)
 {
@@ -265,9 +309,7 @@ int vfs_open(const char *name, int flags, mode_t mode)
         DEBUG("vfs_open: no matching mount\n");
         return res;
     }
-    mutex_lock(&_open_mutex);
     int fd = _init_fd(VFS_ANY_FD, mountp->fs->f_op, mountp, flags, NULL);
-    mutex_unlock(&_open_mutex);
     if (fd < 0) {
         DEBUG("vfs_open: _init_fd: ERR %d!\n", fd);
         /* remember to decrement the open_files count */
@@ -311,6 +353,49 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
     return filp->f_op->read(filp, dest, count);
 }
 
+ssize_t vfs_mmap(int fd, const void **addr, size_t count)
+{
+    DEBUG("vfs_mmap: %d, %p, %lu\n", fd, (void *)addr, (unsigned long)count);
+    if (addr == NULL) {
+        return -EFAULT;
+    }
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (((filp->flags & O_ACCMODE) != O_RDONLY) & ((filp->flags & O_ACCMODE) != O_RDWR)) {
+        /* File not open for reading */
+        return -EBADF;
+    }
+    if (filp->f_op->mmap == NULL) {
+        /* driver does not implement mmap() */
+        return -ENOTSUP;
+    }
+    return filp->f_op->mmap(filp, addr, count);
+}
+
+ssize_t vfs_read_direct(int fd, const void **addr, void *buf, size_t count)
+{
+    DEBUG("vfs_read_direct: %d, %p, %p, %lu\n", fd, (void *)addr, buf, (unsigned long)count);
+    if ((addr == NULL) || (buf == NULL)) {
+        return -EFAULT;
+    }
+    ssize_t res = vfs_mmap(fd, addr, count);
+    if (res == -ENOTSUP) {
+        /* fall back to copying */
+        *addr = buf;
+        return vfs_read(fd, buf, count);
+    }
+    if (res > 0) {
+        off_t pos = vfs_lseek(fd, res, SEEK_CUR);
+        if (pos < 0) {
+            return pos;
+        }
+    }
+    return res;
+}
+
 
 ssize_t vfs_write(int fd, const void *src, size_t count)
 {
@@ -483,7 +568,9 @@ int vfs_mount(vfs_mount_t *mountp)
         }
     }
     /* insert last in list */
+    _mounts_change_begin();
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _mounts_change_end();
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -507,18 +594,20 @@ int vfs_umount(vfs_mount_t *mountp)
         return -EINVAL;
     }
     DEBUG("vfs_umount: -> \"%s\" open=%d\n", mountp->mount_point, atomic_load(&mountp->open_files));
+    /* lookups in the table either took their reference on the mount already,
+     * or they now fall back to searching the list with the lock held */
+    _mounts_change_begin();
     if (atomic_load(&mountp->open_files) > 0) {
-        mutex_unlock(&_mount_mutex);
-        return -EBUSY;
+        ret = -EBUSY;
+        goto out;
     }
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->umount != NULL) {
-            int res = mountp->fs->fs_op->umount(mountp);
-            if (res < 0) {
+            ret = mountp->fs->fs_op->umount(mountp);
+            if (ret < 0) {
                 /* umount failed */
-                DEBUG("vfs_umount: ERR %d!\n", res);
-                mutex_unlock(&_mount_mutex);
-                return res;
+                DEBUG("vfs_umount: ERR %d!\n", ret);
+                goto out;
             }
         }
     }
@@ -527,11 +616,15 @@ int vfs_umount(vfs_mount_t *mountp)
     if (node == NULL) {
         /* not found */
         DEBUG("vfs_umount: ERR not mounted!\n");
-        mutex_unlock(&_mount_mutex);
-        return -EINVAL;
+        ret = -EINVAL;
+        goto out;
     }
+    ret = 0;
+
+out:
+    _mounts_change_end();
     mutex_unlock(&_mount_mutex);
-    return 0;
+    return ret;
 }
 
 int vfs_rename(const char *from_path, const char *to_path)
@@ -767,9 +860,7 @@ int vfs_bind(int fd, int flags, const vfs_file_ops_t *f_op, void *private_data)
     if (f_op == NULL) {
         return -EINVAL;
     }
-    mutex_lock(&_open_mutex);
     fd = _init_fd(fd, f_op, NULL, flags, private_data);
-    mutex_unlock(&_open_mutex);
     if (fd < 0) {
         DEBUG("vfs_bind: _init_fd: ERR %d!\n", fd);
         return fd;
@@ -875,6 +966,27 @@ const vfs_file_t *vfs_file_get(int fd)
     }
 }
 
+static inline bool _claim_fd(int fd)
+{
+    kernel_pid_t pid = thread_getpid();
+    if (pid == KERNEL_PID_UNDEF) {
+        /* This happens when calling vfs_bind during boot, before threads have
+         * been started. */
+        pid = -1;
+    }
+
+    /* entries are claimed one by one, so threads opening files don't
+     * serialize on a common lock */
+    unsigned state = irq_disable();
+    bool free = (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF);
+    if (free) {
+        _vfs_open_files[fd].pid = pid;
+    }
+    irq_restore(state);
+
+    return free;
+}
+
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
@@ -886,36 +998,37 @@ static inline int _allocate_fd(int fd)
                  * to bind to these specific file descriptor numbers. */
                 continue;
             }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
-                break;
+            if (_claim_fd(fd)) {
+                return fd;
             }
         }
+        /* The _vfs_open_files array is full */
+        return -ENFILE;
     }
     if (fd >= VFS_MAX_OPEN_FILES) {
-        /* The _vfs_open_files array is full */
         return -ENFILE;
     }
-    else if (_vfs_open_files[fd].pid != KERNEL_PID_UNDEF) {
+    if (!_claim_fd(fd)) {
         /* The desired fd is already in use */
         return -EEXIST;
     }
-    kernel_pid_t pid = thread_getpid();
-    if (pid == KERNEL_PID_UNDEF) {
-        /* This happens when calling vfs_bind during boot, before threads have
-         * been started. */
-        pid = -1;
-    }
-    _vfs_open_files[fd].pid = pid;
     return fd;
 }
 
 static inline void _free_fd(int fd)
 {
     DEBUG("_free_fd: %d, pid=%d\n", fd, _vfs_open_files[fd].pid);
-    if (_vfs_open_files[fd].mp != NULL) {
-        atomic_fetch_sub(&_vfs_open_files[fd].mp->open_files, 1);
-    }
+    vfs_mount_t *mp = _vfs_open_files[fd].mp;
+
+    unsigned state = irq_disable();
+    bool used = (_vfs_open_files[fd].pid != KERNEL_PID_UNDEF);
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    irq_restore(state);
+
+    /* only the thread that actually freed the entry drops the reference */
+    if (used && (mp != NULL)) {
+        atomic_fetch_sub(&mp->open_files, 1);
+    }
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -933,17 +1046,102 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
-static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+static inline bool _mount_matches(const vfs_mount_t *mountp,
+                                  const char *name, size_t name_len)
 {
-    size_t longest_match = 0;
-    size_t name_len = strlen(name);
-    mutex_lock(&_mount_mutex);
+    size_t len = mountp->mount_point_len;
+    if (len > name_len) {
+        /* path name is shorter than the mount point name */
+        return false;
+    }
+    if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
+        /* name does not have a directory separator where mount point name ends */
+        return false;
+    }
+    /* mount_point is a prefix of name */
+    return strncmp(name, mountp->mount_point, len) == 0;
+}
 
+static inline void _mounts_change_begin(void)
+{
+    atomic_fetch_add(&_vfs_mount_gen, 1);
+}
+
+static void _mounts_change_end(void)
+{
+#if VFS_MOUNT_TABLE_SIZE
+    unsigned n = 0;
+    clist_node_t *node = _vfs_mounts_list.next;
+
+    if (node != NULL) {
+        do {
+            node = node->next;
+            vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+            unsigned i = n;
+            if (n == ARRAY_SIZE(_vfs_mount_table)) {
+                /* table is full, the shortest mount point drops out */
+                if (_vfs_mount_table[n - 1]->mount_point_len >
+                    it->mount_point_len) {
+                    continue;
+                }
+                --i;
+            }
+            else {
+                ++n;
+            }
+            /* later mounts go first among mount points of equal length, like
+             * in the search of the list */
+            while ((i > 0) && (_vfs_mount_table[i - 1]->mount_point_len <=
+                               it->mount_point_len)) {
+                _vfs_mount_table[i] = _vfs_mount_table[i - 1];
+                --i;
+            }
+            _vfs_mount_table[i] = it;
+        } while (node != _vfs_mounts_list.next);
+    }
+    _vfs_mount_table_len = n;
+#endif
+
+    atomic_fetch_add(&_vfs_mount_gen, 1);
+}
+
+static vfs_mount_t *_find_mount_table(const char *name, size_t name_len)
+{
+    vfs_mount_t *mountp = NULL;
+
+#if VFS_MOUNT_TABLE_SIZE
+    /* The search and taking the reference must not be preempted: a umount
+     * running in between would neither see the reference nor be noticed
+     * here, and the mount would be used after it was removed. The table is
+     * small, so interrupts are disabled for a short time only. */
+    unsigned state = irq_disable();
+    if ((atomic_load(&_vfs_mount_gen) & 1) == 0) {
+        unsigned n = _vfs_mount_table_len;
+        for (unsigned i = 0; i < n; i++) {
+            if (_mount_matches(_vfs_mount_table[i], name, name_len)) {
+                /* sorted by length, so this is the longest match */
+                mountp = _vfs_mount_table[i];
+                atomic_fetch_add(&mountp->open_files, 1);
+                break;
+            }
+        }
+    }
+    irq_restore(state);
+#else
+    (void)name;
+    (void)name_len;
+#endif
+
+    return mountp;
+}
+
+static vfs_mount_t *_find_mount_list(const char *name, size_t name_len)
+{
+    size_t longest_match = 0;
     clist_node_t *node = _vfs_mounts_list.next;
     if (node == NULL) {
         /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+        return NULL;
     }
     vfs_mount_t *mountp = NULL;
     do {
@@ -954,16 +1152,7 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             /* Already found a longer prefix */
             continue;
         }
-        if (len > name_len) {
-            /* path name is shorter than the mount point name */
-            continue;
-        }
-        if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
-            /* name does not have a directory separator where mount point name ends */
-            continue;
-        }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
+        if (_mount_matches(it, name, name_len)) {
             /* special check for mount_point == "/" */
             if (len > 1) {
                 longest_match = len;
@@ -971,17 +1160,33 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             mountp = it;
         }
     } while (node != _vfs_mounts_list.next);
+    if (mountp != NULL) {
+        /* Increment open files counter for this mount */
+        atomic_fetch_add(&mountp->open_files, 1);
+    }
+    return mountp;
+}
+
+static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+{
+    size_t name_len = strlen(name);
+
+    vfs_mount_t *mountp = _find_mount_table(name, name_len);
     if (mountp == NULL) {
-        /* not found */
+        /* not in the table or raced a (u)mount, search all mounts */
+        mutex_lock(&_mount_mutex);
+        mountp = _find_mount_list(name, name_len);
         mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+        if (mountp == NULL) {
+            /* not found */
+            return -ENOENT;
+        }
     }
-    /* Increment open files counter for this mount */
-    atomic_fetch_add(&mountp->open_files, 1);
-    mutex_unlock(&_mount_mutex);
     *mountpp = mountp;
     if (rel_path != NULL) {
-        *rel_path = name + longest_match;
+        /* the relative path of mount_point == "/" keeps its leading slash */
+        size_t len = mountp->mount_point_len;
+        *rel_path = name + ((len > 1) ? len : 0);
     }
     return 0;
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Receive rate and CPU load of GNRC under a UDP flood
+ *
+ * Counts the UDP packets received on @ref BENCH_PORT and prints the number
+ * of packets per second together with the share of time the CPU was not
+ * idle. The flood is sent by the host over the TAP interface.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "fmt.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif.h"
+#include "net/ipv6/addr.h"
+#include "schedstatistics.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef BENCH_PORT
+#define BENCH_PORT          (9U)
+#endif
+
+#ifndef BENCH_SECONDS
+#define BENCH_SECONDS       (10U)
+#endif
+
+#define MSG_QUEUE_SIZE      (32U)
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static uint64_t _last_busy;
+static uint64_t _last_total;
+
+static void _cpu_ticks(uint64_t *busy, uint64_t *total)
+{
+    /* without idle thread the time spent idle is accounted to
+     * KERNEL_PID_UNDEF */
+    uint64_t idle = sched_pidlist[KERNEL_PID_UNDEF].runtime_ticks;
+
+    *busy = 0;
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *thread = thread_get(i);
+
+        if (thread == NULL) {
+            continue;
+        }
+        if (thread->priority == THREAD_PRIORITY_IDLE) {
+            idle += sched_pidlist[i].runtime_ticks;
+        }
+        else {
+            *busy += sched_pidlist[i].runtime_ticks;
+        }
+    }
+    *total = *busy + idle;
+}
+
+static void _print_result(unsigned second, uint32_t pkts, uint32_t usec)
+{
+    uint64_t busy, total;
+
+    _cpu_ticks(&busy, &total);
+    busy -= _last_busy;
+    total -= _last_total;
+    _last_busy += busy;
+    _last_total += total;
+
+    print_str("rx ");
+    print_u32_dec(second);
+    print_str(": ");
+    print_u32_dec(pkts);
+    print_str(" pkts in ");
+    print_u32_dec(usec);
+    print_str(" µs (");
+    print_u32_dec((uint32_t)(((uint64_t)pkts * US_PER_SEC) / (usec ? usec : 1)));
+    print_str(" pkts/s, cpu ");
+    print_u32_dec((uint32_t)((busy * 100) / (total ? total : 1)));
+    print_str(" %)\n");
+}
+
+static void _print_addr(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    ipv6_addr_t addrs[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
+    char addr_str[IPV6_ADDR_MAX_STR_LEN];
+    int res;
+
+    if ((netif == NULL) ||
+        ((res = gnrc_netif_ipv6_addrs_get(netif, addrs, sizeof(addrs))) <= 0)) {
+        return;
+    }
+    for (unsigned i = 0; i < (res / sizeof(ipv6_addr_t)); i++) {
+        if (ipv6_addr_is_link_local(&addrs[i])) {
+            print_str("address: ");
+            print_str(ipv6_addr_to_str(addr_str, &addrs[i], sizeof(addr_str)));
+            print_str("\n");
+        }
+    }
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(BENCH_PORT,
+                                                           thread_getpid());
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+
+    _print_addr();
+    print_str("port: ");
+    print_u32_dec(BENCH_PORT);
+    print_str("\n");
+
+    /* wait for the flood to start */
+    msg_t msg;
+    do {
+        msg_receive(&msg);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    } while (msg.type != GNRC_NETAPI_MSG_TYPE_RCV);
+
+    _cpu_ticks(&_last_busy, &_last_total);
+    for (unsigned second = 1; second <= BENCH_SECONDS; second++) {
+        uint32_t start = xtimer_now_usec();
+        uint32_t now = start;
+        uint32_t pkts = 0;
+
+        while ((now - start) < US_PER_SEC) {
+            if ((xtimer_msg_receive_timeout(&msg, US_PER_SEC - (now - start)) >= 0) &&
+                (msg.type == GNRC_NETAPI_MSG_TYPE_RCV)) {
+                gnrc_pktbuf_release(msg.content.ptr);
+                pkts++;
+            }
+            now = xtimer_now_usec();
+        }
+        _print_result(second, pkts, now - start);
+    }
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &entry);
+    print_str("done\n");
+    return 0;
+}
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+import threading
+
+from testrunner import run
+
+
+PAYLOAD = bytes(64)
+
+
+def flood(addr, port, tap, stop):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    dst = (addr, port, 0, socket.if_nametoindex(tap))
+    while not stop.is_set():
+        try:
+            sock.sendto(PAYLOAD, dst)
+        except OSError:
+            # socket buffer full, the node can't keep up
+            pass
+    sock.close()
+
+
+def testfunc(child):
+    child.expect(r"address: (fe80:[0-9a-f:]+)\r\n")
+    addr = child.match.group(1)
+    child.expect(r"port: (\d+)\r\n")
+    port = int(child.match.group(1))
+
+    stop = threading.Event()
+    sender = threading.Thread(target=flood,
+                              args=(addr, port, os.environ["TAPDEV"], stop))
+    sender.start()
+    try:
+        child.expect_exact("done", timeout=60)
+    finally:
+        stop.set()
+        sender.join()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Small record write and read rates of kvstore and littlefs2
+ *
+ * Both use their own range of sectors of MTD_0. littlefs2 stores each key
+ * in a file of its own.
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "board.h"
+#include "fmt.h"
+#include "fs/littlefs2_fs.h"
+#include "kvstore.h"
+#include "mtd.h"
+#include "vfs.h"
+
+/* number of sectors used by each of the stores */
+#ifndef BENCH_SECTORS
+#define BENCH_SECTORS       (16U)
+#endif
+
+#define KEYS                (16U)
+#define ROUNDS              (32U)
+#define VALUE_SIZE          (8U)
+
+#define MOUNT_POINT         "/lfs"
+
+static kvstore_sector_t sectors[BENCH_SECTORS];
+static kvstore_entry_t kv_index[2 * KEYS];
+static kvstore_t kv = KVSTORE_INIT(NULL, 0, sectors, kv_index);
+
+static littlefs2_desc_t fs_desc = {
+    .lock = MUTEX_INIT,
+    .base_addr = BENCH_SECTORS,
+    .config = {
+        .block_count = BENCH_SECTORS,
+    },
+};
+
+static vfs_mount_t flash_mount = {
+    .fs = &littlefs2_file_system,
+    .mount_point = MOUNT_POINT,
+    .private_data = &fs_desc,
+};
+
+static uint8_t value[VALUE_SIZE];
+
+static void _key(char *buf, unsigned i)
+{
+    buf += fmt_str(buf, "key");
+    buf += fmt_u32_dec(buf, i);
+    *buf = '\0';
+}
+
+static void _path(char *buf, unsigned i)
+{
+    buf += fmt_str(buf, MOUNT_POINT "/");
+    _key(buf, i);
+}
+
+static int _kvstore_write(unsigned i)
+{
+    char key[16];
+
+    _key(key, i);
+    return kvstore_set(&kv, key, value, sizeof(value));
+}
+
+static int _kvstore_read(unsigned i)
+{
+    char key[16];
+
+    _key(key, i);
+    return (kvstore_get(&kv, key, value, sizeof(value)) == sizeof(value)) ? 0 : -1;
+}
+
+static int _lfs_write(unsigned i)
+{
+    char path[32];
+
+    _path(path, i);
+    int fd = vfs_open(path, O_CREAT | O_TRUNC | O_WRONLY, 0);
+    if (fd < 0) {
+        return fd;
+    }
+    int res = vfs_write(fd, value, sizeof(value));
+    vfs_close(fd);
+    return (res == sizeof(value)) ? 0 : -1;
+}
+
+static int _lfs_read(unsigned i)
+{
+    char path[32];
+
+    _path(path, i);
+    int fd = vfs_open(path, O_RDONLY, 0);
+    if (fd < 0) {
+        return fd;
+    }
+    int res = vfs_read(fd, value, sizeof(value));
+    vfs_close(fd);
+    return (res == sizeof(value)) ? 0 : -1;
+}
+
+static int _run(const char *name, int (*fn)(unsigned))
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        value[0] = round;
+        for (unsigned i = 0; i < KEYS; i++) {
+            if (fn(i)) {
+                printf("%s failed\n", name);
+                return -1;
+            }
+        }
+    }
+
+    benchmark_print_rate(xtimer_now_usec() - start, KEYS * ROUNDS, name);
+    return 0;
+}
+
+int main(void)
+{
+    kv.dev = MTD_0;
+    fs_desc.dev = MTD_0;
+
+    if (kvstore_init(&kv) || kvstore_format(&kv)) {
+        puts("kvstore init failed");
+        return 1;
+    }
+    if (vfs_format(&flash_mount) || vfs_mount(&flash_mount)) {
+        puts("littlefs2 mount failed");
+        return 1;
+    }
+
+    if (_run("kvstore write", _kvstore_write) ||
+        _run("kvstore read", _kvstore_read) ||
+        _run("littlefs2 write", _lfs_write) ||
+        _run("littlefs2 read", _lfs_read)) {
+        return 1;
+    }
+
+    vfs_umount(&flash_mount);
+    puts("done");
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for name in ("kvstore", "littlefs2"):
+        for op in ("write", "read"):
+            child.expect(r"{} {}: [0-9]+ in [0-9]+us \([0-9]+ per sec\)\r\n"
+                         .format(name, op))
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Sequential read and write throughput of SD cards via MTD
+ *
+ * The same amount of data is written and read back with different transfer
+ * sizes. Transfers of more than one block are issued as multi-block
+ * commands, so the results show how much the per-command overhead costs.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "mtd.h"
+#include "mtd_sdcard.h"
+#include "sdcard_spi.h"
+#include "sdcard_spi_params.h"
+
+/* first block of the area that is overwritten by the benchmark */
+#ifndef BENCH_START_BLOCK
+#define BENCH_START_BLOCK   (8192U)
+#endif
+
+/* largest transfer in blocks, must be a power of two */
+#ifndef BENCH_MAX_BLOCKS
+#define BENCH_MAX_BLOCKS    (16U)
+#endif
+
+/* number of blocks transferred per run */
+#ifndef BENCH_TOTAL_BLOCKS
+#define BENCH_TOTAL_BLOCKS  (256U)
+#endif
+
+/* this is provided by the sdcard_spi driver
+ * see drivers/sdcard_spi/sdcard_spi.c */
+extern sdcard_spi_t sdcard_spi_devs[ARRAY_SIZE(sdcard_spi_params)];
+
+static mtd_sdcard_t mtd_sdcard_dev = {
+    .base = {
+        .driver = &mtd_sdcard_driver,
+    },
+    .sd_card = &sdcard_spi_devs[0],
+    .params = &sdcard_spi_params[0],
+};
+
+static mtd_dev_t *dev = &mtd_sdcard_dev.base;
+
+static uint8_t buf[BENCH_MAX_BLOCKS * SD_HC_BLOCK_SIZE];
+
+static int _run(bool write, unsigned blocks)
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < BENCH_TOTAL_BLOCKS; i += blocks) {
+        int res;
+        if (write) {
+            res = mtd_write_page_raw(dev, buf, BENCH_START_BLOCK + i, 0,
+                                     blocks * SD_HC_BLOCK_SIZE);
+        }
+        else {
+            res = mtd_read_page(dev, buf, BENCH_START_BLOCK + i, 0,
+                                blocks * SD_HC_BLOCK_SIZE);
+        }
+        if (res) {
+            printf("%s failed\n", write ? "write" : "read");
+            return res;
+        }
+    }
+
+    uint32_t usec = xtimer_now_usec() - start;
+    char name[24];
+
+    snprintf(name, sizeof(name), "%s %u blocks", write ? "write" : "read",
+             blocks);
+    benchmark_print_throughput(usec, BENCH_TOTAL_BLOCKS / blocks,
+                               blocks * SD_HC_BLOCK_SIZE, name);
+    return 0;
+}
+
+int main(void)
+{
+    if (mtd_init(dev)) {
+        puts("SD card init failed");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i;
+    }
+
+    for (unsigned blocks = 1; blocks <= BENCH_MAX_BLOCKS; blocks *= 2) {
+        if (_run(true, blocks) || _run(false, blocks)) {
+            return 1;
+        }
+    }
+
+    puts("done");
+    return 0;
+}
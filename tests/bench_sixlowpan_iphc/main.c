@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Per packet cost of the 6LoWPAN IPHC encoder
+ *
+ * Sends UDP packets of a few flows through the 6LoWPAN thread to a mock
+ * IEEE 802.15.4 interface that drops them. The time per packet includes
+ * the thread hand-offs and the packet buffer operations, which are the same
+ * with and without the `gnrc_sixlowpan_iphc_cache` module, so the
+ * difference between the two builds is what the cache saves in encoding.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/udp.h"
+#include "net/netdev_test.h"
+#include "thread.h"
+
+#define PACKETS         (10000UL)
+/* long-lived flows to the border router, fit into the cache by default */
+#define FLOWS           (2U)
+#define PAYLOAD_LEN     (32U)
+#define PORT            (61616U)
+
+static const uint8_t _l2addr[] = {
+    0x02, 0x00, 0x5e, 0xef, 0x10, 0x00, 0x00, 0x01
+};
+static const uint8_t _dst_l2addr[] = {
+    0x02, 0x00, 0x5e, 0xef, 0x10, 0x00, 0x00, 0x02
+};
+/* the prefix of the border router, used as compression context 0 */
+static const ipv6_addr_t _prefix = { .u8 = {
+    0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+} };
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+
+static ipv6_addr_t _src;
+static ipv6_addr_t _dst[FLOWS];
+static uint8_t _payload[PAYLOAD_LEN];
+
+static unsigned _sent;
+static unsigned _failed;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    assert(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    assert(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    assert(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    assert(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_l2addr);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    assert(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    _sent++;
+    return iolist_size(iolist);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    gnrc_netif_ieee802154_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                 GNRC_NETIF_PRIO, "mock_netif",
+                                 (netdev_t *)&_dev);
+    thread_yield_higher();
+}
+
+static void _init_addrs(void)
+{
+    /* the source uses the IID derived from the link-layer address, so it is
+     * elided completely */
+    memcpy(&_src, &_prefix, sizeof(_prefix));
+    memcpy(&_src.u8[8], _l2addr, sizeof(_l2addr));
+    _src.u8[8] ^= 0x02;
+    for (unsigned i = 0; i < FLOWS; i++) {
+        memcpy(&_dst[i], &_prefix, sizeof(_prefix));
+        _dst[i].u8[15] = i + 1;
+    }
+}
+
+static void _send_packet(unsigned i)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                          GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        _failed++;
+        return;
+    }
+    hdr = gnrc_udp_hdr_build(pkt, PORT + (i % FLOWS), PORT);
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        _failed++;
+        return;
+    }
+    pkt = hdr;
+    hdr = gnrc_ipv6_hdr_build(pkt, &_src, &_dst[i % FLOWS]);
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        _failed++;
+        return;
+    }
+    pkt = hdr;
+    hdr = gnrc_netif_hdr_build(NULL, 0, _dst_l2addr, sizeof(_dst_l2addr));
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        _failed++;
+        return;
+    }
+    gnrc_netif_hdr_set_netif(hdr->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, hdr);
+    /* the 6LoWPAN and the interface thread have a higher priority, so the
+     * packet is encoded and handed to the device before this returns */
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        _failed++;
+    }
+}
+
+int main(void)
+{
+    _init_netif();
+    _init_addrs();
+    gnrc_sixlowpan_ctx_update(0, &_prefix, 64, UINT16_MAX, true);
+
+    uint32_t start = xtimer_now_usec();
+    for (unsigned long i = 0; i < PACKETS; i++) {
+        _send_packet(i);
+    }
+    uint32_t time = xtimer_now_usec() - start;
+
+    benchmark_print_time(time, PACKETS,
+                         IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+                         ? "IPHC encode, cached" : "IPHC encode");
+#ifdef CLOCK_CORECLOCK
+    printf("%" PRIu32 " cycles per packet\n",
+           (uint32_t)(((uint64_t)time * (CLOCK_CORECLOCK / 1000U)) /
+                      (PACKETS * 1000U)));
+#endif
+
+    if (_failed || (_sent < PACKETS)) {
+        printf("%u packets failed, %u sent\n", _failed, _sent);
+        return 1;
+    }
+    puts("done");
+    return 0;
+}
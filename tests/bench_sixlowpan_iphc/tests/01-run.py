@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"IPHC encode(, cached)?: +[0-9]+us +--- +[0-9.]+us per call "
+                 r"+--- +[0-9]+ calls per sec\r\n")
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
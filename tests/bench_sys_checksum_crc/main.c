@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the CRC implementations
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "benchmark.h"
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc32.h"
+#include "checksum/ucrc16.h"
+
+#define BUF_SIZE        (1024U)
+#define ITERATIONS      (100U)
+
+static uint8_t input[BUF_SIZE];
+static crc32_table_t table;
+
+/* keeps the compiler from optimizing the calculations away */
+static volatile uint32_t result;
+
+int main(void)
+{
+    for (unsigned i = 0; i < BUF_SIZE; i++) {
+        input[i] = i;
+    }
+    crc32_table_init(&table, 0xEDB88320);
+
+    BENCHMARK_THROUGHPUT("CRC-16 bitwise", ITERATIONS, BUF_SIZE,
+                         result = ucrc16_calc_le(input, BUF_SIZE,
+                                                 UCRC16_CCITT_POLY_LE, 0xffff));
+    BENCHMARK_THROUGHPUT("CRC-16 table", ITERATIONS, BUF_SIZE,
+                         result = crc16_ccitt_calc(input, BUF_SIZE));
+    BENCHMARK_THROUGHPUT("CRC-32", ITERATIONS, BUF_SIZE,
+                         result = crc32_calc(input, BUF_SIZE));
+    BENCHMARK_THROUGHPUT("CRC-32C", ITERATIONS, BUF_SIZE,
+                         result = crc32c_calc(input, BUF_SIZE));
+    BENCHMARK_THROUGHPUT("CRC-32 generic", ITERATIONS, BUF_SIZE,
+                         result = crc32_table_update(&table, 0xffffffff, input,
+                                                     BUF_SIZE));
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the Ed25519 signature verification
+ *
+ * Compares the verification of the c25519 package with the single,
+ * precomputed key and batched verification of crypto/ed25519.h.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "crypto/ed25519.h"
+#include "edsign.h"
+#include "ed25519.h"
+
+#define SIGNATURES      (8U)
+#define KEYS            (4U)
+#define MSG_LEN         (64U)
+
+static uint8_t msgs[SIGNATURES][MSG_LEN];
+static uint8_t pks[KEYS][EDSIGN_PUBLIC_KEY_SIZE];
+static uint8_t sigs[SIGNATURES][EDSIGN_SIGNATURE_SIZE];
+/* the same messages, all signed with the first key */
+static uint8_t sigs_key[SIGNATURES][EDSIGN_SIGNATURE_SIZE];
+
+static ed25519_key_t key;
+static ed25519_batch_entry_t entries[SIGNATURES];
+
+static void _setup(void)
+{
+    for (unsigned k = 0; k < KEYS; k++) {
+        uint8_t sk[EDSIGN_SECRET_KEY_SIZE];
+
+        for (unsigned i = 0; i < sizeof(sk); i++) {
+            sk[i] = 31 * k + i;
+        }
+        ed25519_prepare(sk);
+        edsign_sec_to_pub(pks[k], sk);
+        for (unsigned i = k; i < SIGNATURES; i += KEYS) {
+            for (unsigned j = 0; j < MSG_LEN; j++) {
+                msgs[i][j] = i + j;
+            }
+            edsign_sign(sigs[i], pks[k], sk, msgs[i], MSG_LEN);
+        }
+        if (k == 0) {
+            for (unsigned i = 0; i < SIGNATURES; i++) {
+                edsign_sign(sigs_key[i], pks[0], sk, msgs[i], MSG_LEN);
+            }
+        }
+    }
+}
+
+static void _set_entries(uint8_t (*signatures)[EDSIGN_SIGNATURE_SIZE],
+                         unsigned keys)
+{
+    for (unsigned i = 0; i < SIGNATURES; i++) {
+        entries[i].sig = signatures[i];
+        entries[i].msg = msgs[i];
+        entries[i].len = MSG_LEN;
+        entries[i].pk = pks[i % keys];
+        entries[i].key = NULL;
+    }
+}
+
+int main(void)
+{
+    uint32_t start;
+    unsigned failed = 0;
+
+    puts("Signing the messages...");
+    _setup();
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < SIGNATURES; i++) {
+        failed += !edsign_verify(sigs[i], pks[i % KEYS], msgs[i], MSG_LEN);
+    }
+    benchmark_print_rate(xtimer_now_usec() - start, SIGNATURES,
+                         "c25519 edsign_verify");
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < SIGNATURES; i++) {
+        failed += !!ed25519_verify(sigs[i], msgs[i], MSG_LEN, pks[i % KEYS]);
+    }
+    benchmark_print_rate(xtimer_now_usec() - start, SIGNATURES,
+                         "ed25519_verify");
+
+    start = xtimer_now_usec();
+    failed += !!ed25519_key_init(&key, pks[0]);
+    benchmark_print_rate(xtimer_now_usec() - start, 1, "ed25519_key_init");
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < SIGNATURES; i++) {
+        failed += !!ed25519_verify_key(&key, sigs_key[i], msgs[i], MSG_LEN);
+    }
+    benchmark_print_rate(xtimer_now_usec() - start, SIGNATURES,
+                         "ed25519_verify_key");
+
+    _set_entries(sigs, KEYS);
+    start = xtimer_now_usec();
+    failed += !!ed25519_verify_batch(entries, SIGNATURES);
+    benchmark_print_rate(xtimer_now_usec() - start, SIGNATURES,
+                         "ed25519_verify_batch, different keys");
+
+    _set_entries(sigs_key, 1);
+    start = xtimer_now_usec();
+    failed += !!ed25519_verify_batch(entries, SIGNATURES);
+    benchmark_print_rate(xtimer_now_usec() - start, SIGNATURES,
+                         "ed25519_verify_batch, same key");
+
+    for (unsigned i = 0; i < SIGNATURES; i++) {
+        entries[i].key = &key;
+    }
+    start = xtimer_now_usec();
+    failed += !!ed25519_verify_batch(entries, SIGNATURES);
+    benchmark_print_rate(xtimer_now_usec() - start, SIGNATURES,
+                         "ed25519_verify_batch, precomputed key");
+
+    puts(failed ? "FAILED" : "SUCCESS");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Signing the messages...")
+    for name in ("c25519 edsign_verify", "ed25519_verify",
+                 "ed25519_verify_key",
+                 "ed25519_verify_batch, different keys",
+                 "ed25519_verify_batch, same key",
+                 "ed25519_verify_batch, precomputed key"):
+        child.expect(r"{}: 8 in [0-9]+us \([0-9]+ per sec\)\r\n"
+                     .format(name), timeout=300)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=600))
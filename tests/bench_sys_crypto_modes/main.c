@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the AES cipher modes
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+
+#define BUF_SIZE        (512U)
+#define ITERATIONS      (100U)
+#define CCM_MAC_LEN     (8U)
+#define CCM_LEN_ENC     (2U)
+
+static const uint8_t key[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static const uint8_t nonce[13] = {
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac,
+};
+
+static uint8_t input[BUF_SIZE];
+static uint8_t output[BUF_SIZE + CCM_MAC_LEN];
+
+static void _encrypt_ctr(cipher_t *cipher)
+{
+    uint8_t nonce_counter[16];
+
+    memset(nonce_counter, 0, sizeof(nonce_counter));
+    memcpy(nonce_counter, nonce, sizeof(nonce));
+    cipher_encrypt_ctr(cipher, nonce_counter, sizeof(nonce), input,
+                       sizeof(input), output);
+}
+
+int main(void)
+{
+    cipher_t cipher;
+
+    for (unsigned i = 0; i < sizeof(input); i++) {
+        input[i] = i;
+    }
+    if (cipher_init(&cipher, CIPHER_AES_128, key, sizeof(key)) !=
+        CIPHER_INIT_SUCCESS) {
+        puts("Failed to initialize AES");
+        return 1;
+    }
+
+    BENCHMARK_THROUGHPUT("AES-128-ECB", ITERATIONS, BUF_SIZE,
+                         cipher_encrypt_ecb(&cipher, input, sizeof(input),
+                                            output));
+    BENCHMARK_THROUGHPUT("AES-128-CTR", ITERATIONS, BUF_SIZE,
+                         _encrypt_ctr(&cipher));
+    BENCHMARK_THROUGHPUT("AES-128-CCM", ITERATIONS, BUF_SIZE,
+                         cipher_encrypt_ccm(&cipher, NULL, 0, CCM_MAC_LEN,
+                                            CCM_LEN_ENC, nonce, sizeof(nonce),
+                                            input, sizeof(input), output));
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for SHA-256
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "benchmark.h"
+#include "hashes/sha256.h"
+
+#define BUF_SIZE        (512U)
+#define ITERATIONS      (100U)
+#define LANES           CONFIG_HASHES_SHA256_MB_LANES
+
+static uint8_t input[LANES][BUF_SIZE];
+static uint8_t digest[LANES][SHA256_DIGEST_LENGTH];
+
+static void _sha256_lanes(void)
+{
+    for (unsigned l = 0; l < LANES; l++) {
+        sha256(input[l], BUF_SIZE, digest[l]);
+    }
+}
+
+int main(void)
+{
+    const void *data[LANES];
+    void *digests[LANES];
+
+    for (unsigned l = 0; l < LANES; l++) {
+        for (unsigned i = 0; i < BUF_SIZE; i++) {
+            input[l][i] = l + i;
+        }
+        data[l] = input[l];
+        digests[l] = digest[l];
+    }
+
+    BENCHMARK_THROUGHPUT("SHA-256", ITERATIONS, LANES * BUF_SIZE,
+                         _sha256_lanes());
+    BENCHMARK_THROUGHPUT("SHA-256 multi-buffer", ITERATIONS, LANES * BUF_SIZE,
+                         sha256_mb(data, BUF_SIZE, digests, LANES));
+
+    return 0;
+}
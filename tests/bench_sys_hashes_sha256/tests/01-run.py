@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for name in ("SHA-256", "SHA-256 multi-buffer"):
+        child.expect(r"{}: [0-9]+ x [0-9]+ bytes in [0-9]+us "
+                     r"\([0-9]+ kB/s(, [0-9.]+ cycles/byte)?\)\r\n"
+                     .format(name))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
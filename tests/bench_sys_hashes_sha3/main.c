@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for SHA-3 and SHAKE
+ *
+ * Prints the throughput and, on boards that define CLOCK_CORECLOCK, the
+ * CPU cycles per byte.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "benchmark.h"
+#include "hashes/sha3.h"
+
+#define BUF_SIZE        (1024U)
+#define ITERATIONS      (20U)
+
+static uint8_t input[BUF_SIZE];
+static uint8_t output[BUF_SIZE];
+
+int main(void)
+{
+    keccak_state_t ctx;
+
+    for (unsigned i = 0; i < BUF_SIZE; i++) {
+        input[i] = i;
+    }
+
+    BENCHMARK_THROUGHPUT("SHA3-256", ITERATIONS, BUF_SIZE,
+                         sha3_256(output, input, BUF_SIZE));
+    BENCHMARK_THROUGHPUT("SHA3-512", ITERATIONS, BUF_SIZE,
+                         sha3_512(output, input, BUF_SIZE));
+    BENCHMARK_THROUGHPUT("SHAKE128 absorb", ITERATIONS, BUF_SIZE,
+                         shake128(output, 32, input, BUF_SIZE));
+
+    shake128_init(&ctx);
+    sha3_update(&ctx, input, 32);
+    BENCHMARK_THROUGHPUT("SHAKE128 squeeze", ITERATIONS, BUF_SIZE,
+                         shake_squeeze(&ctx, output, BUF_SIZE));
+
+    return 0;
+}
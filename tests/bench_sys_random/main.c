@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the random number generators
+ *
+ * Compares the global generator selected at build time with the
+ * xoshiro256** generator with caller provided state.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "benchmark.h"
+#include "random.h"
+
+#define BUF_SIZE        (1024U)
+#define ITERATIONS      (64U)
+
+static uint8_t buf[BUF_SIZE];
+
+/* keeps the compiler from dropping the generated numbers */
+static volatile uint32_t sink;
+
+static void _uint32(void)
+{
+    uint32_t acc = 0;
+
+    for (unsigned i = 0; i < BUF_SIZE / sizeof(uint32_t); i++) {
+        acc += random_uint32();
+    }
+    sink = acc;
+}
+
+static void _ctx_uint32(random_ctx_t *ctx)
+{
+    uint32_t acc = 0;
+
+    for (unsigned i = 0; i < BUF_SIZE / sizeof(uint32_t); i++) {
+        acc += random_ctx_uint32(ctx);
+    }
+    sink = acc;
+}
+
+int main(void)
+{
+    random_ctx_t ctx;
+
+    random_ctx_seed(&ctx);
+
+    BENCHMARK_THROUGHPUT("random_uint32", ITERATIONS, BUF_SIZE, _uint32());
+    BENCHMARK_THROUGHPUT("random_bytes", ITERATIONS, BUF_SIZE,
+                         random_bytes(buf, BUF_SIZE));
+    BENCHMARK_THROUGHPUT("random_ctx_uint32", ITERATIONS, BUF_SIZE,
+                         _ctx_uint32(&ctx));
+    BENCHMARK_THROUGHPUT("random_ctx_bytes", ITERATIONS, BUF_SIZE,
+                         random_ctx_bytes(&ctx, buf, BUF_SIZE));
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Path lookup and file descriptor rates of vfs
+ *
+ * Several threads open and close, or stat, files on a few constfs mounts
+ * back to back. A thread of higher priority wakes up periodically and does
+ * the same, preempting the workers at arbitrary points, also while they look
+ * up a mount. constfs does next to no work, so the rates are those of vfs.
+ *
+ * The rate of the workers is the cost of an operation. The maximum latency
+ * of the preempting operations shows whether they wait for a lookup they
+ * preempted. With the default lookup table they don't. Build with
+ * VFS_MOUNT_TABLE_SIZE=0 to compare with all lookups taking the mount mutex,
+ * then a preempting lookup waits whenever it interrupted a worker holding it.
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "benchmark.h"
+#include "fs/constfs.h"
+#include "mutex.h"
+#include "thread.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+#define THREADS             (4U)
+#define ROUNDS              (4096U)
+/* period of the preempting thread */
+#define PREEMPT_US          (200U)
+
+static const uint8_t data[] = "data";
+
+static const constfs_file_t files[] = {
+    {
+        .path = "/file",
+        .data = data,
+        .size = sizeof(data),
+    },
+};
+
+static const constfs_t fs_data = {
+    .files = files,
+    .nfiles = ARRAY_SIZE(files),
+};
+
+#define MOUNT(name) { \
+        .fs = &constfs_file_system, \
+        .mount_point = name, \
+        .private_data = (void *)&fs_data, \
+    }
+
+static vfs_mount_t mounts[] = {
+    MOUNT("/const"),
+    MOUNT("/const/a"),
+    MOUNT("/const/b"),
+    MOUNT("/rom"),
+};
+
+static const char *paths[] = {
+    "/const/file",
+    "/const/a/file",
+    "/const/b/file",
+    "/rom/file",
+};
+
+static char stacks[THREADS][THREAD_STACKSIZE_DEFAULT];
+static char preempt_stack[THREAD_STACKSIZE_DEFAULT];
+static unsigned failed;
+
+static volatile bool running;
+static mutex_t preempt_done = MUTEX_INIT_LOCKED;
+static unsigned preempt_count;
+static uint32_t preempt_max;
+
+static int _open(const char *path)
+{
+    int fd = vfs_open(path, O_RDONLY, 0);
+    if (fd < 0) {
+        return fd;
+    }
+    return vfs_close(fd);
+}
+
+static int _stat(const char *path)
+{
+    struct stat buf;
+
+    return vfs_stat(path, &buf);
+}
+
+static void *_worker(void *arg)
+{
+    int (*fn)(const char *) = arg;
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        if (fn(paths[round % ARRAY_SIZE(paths)]) < 0) {
+            failed++;
+        }
+    }
+
+    return NULL;
+}
+
+static void *_preempt(void *arg)
+{
+    int (*fn)(const char *) = arg;
+
+    while (1) {
+        xtimer_usleep(PREEMPT_US);
+        if (!running) {
+            break;
+        }
+
+        uint32_t start = xtimer_now_usec();
+        if (fn(paths[preempt_count % ARRAY_SIZE(paths)]) < 0) {
+            failed++;
+        }
+        uint32_t usec = xtimer_now_usec() - start;
+
+        if (usec > preempt_max) {
+            preempt_max = usec;
+        }
+        preempt_count++;
+    }
+
+    mutex_unlock(&preempt_done);
+    return NULL;
+}
+
+static int _run(const char *op, int (*fn)(const char *))
+{
+    running = true;
+    preempt_count = 0;
+    preempt_max = 0;
+    thread_create(preempt_stack, sizeof(preempt_stack),
+                  THREAD_PRIORITY_MAIN - 2,
+                  THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                  _preempt, fn, "preempt");
+
+    uint32_t start = xtimer_now_usec();
+
+    /* the workers have a higher priority than main, so main only continues
+     * once all of them are done */
+    for (unsigned i = 0; i < THREADS; i++) {
+        thread_create(stacks[i], sizeof(stacks[i]), THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                      _worker, fn, "worker");
+    }
+    thread_yield_higher();
+
+    uint32_t usec = xtimer_now_usec() - start;
+
+    running = false;
+    mutex_lock(&preempt_done);
+
+    if (failed) {
+        printf("%s failed\n", op);
+        return -1;
+    }
+
+    benchmark_print_rate(usec, THREADS * ROUNDS, op);
+    printf("%s preempting: %u, max latency %" PRIu32 "us\n", op,
+           preempt_count, preempt_max);
+    return 0;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(mounts); i++) {
+        if (vfs_mount(&mounts[i])) {
+            puts("mount failed");
+            return 1;
+        }
+    }
+
+    if (_run("open", _open) || _run("stat", _stat)) {
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(mounts); i++) {
+        vfs_umount(&mounts[i]);
+    }
+    puts("done");
+    return 0;
+}
@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests sending of 6LoWPAN fragments
+ *
+ * The fragments are built from the snips of the datagram without copying.
+ * They are compared byte for byte to the fragments the previous
+ * implementation built by copying the datagram into a buffer per fragment,
+ * which is kept here as reference.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "common.h"
+#include "embUnit.h"
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/fb.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "utlist.h"
+#include "xtimer.h"
+
+#define SEND_TIMEOUT_US     (500U * US_PER_MS)
+
+#define TEST_TAG            (0x3a7cU)
+#define TEST_MAX_FRAGS      (8U)
+#define TEST_MAX_FRAG_LEN   (128U)
+#define TEST_DATAGRAM_LEN   (200U)
+
+static const uint8_t _src[] = { 0xde, 0x71, 0x2b, 0x85, 0x08, 0x2f, 0x75, 0xfb };
+static const uint8_t _dst[] = { _LL0, _LL1, _LL2, _LL3, _LL4, _LL5, _LL6, _LL7 + 1 };
+
+typedef struct {
+    uint8_t data[TEST_MAX_FRAG_LEN];
+    size_t len;
+} _frag_t;
+
+static uint8_t _datagram[TEST_DATAGRAM_LEN];
+static _frag_t _exp[TEST_MAX_FRAGS];
+static unsigned _exp_num;
+static _frag_t _sent[TEST_MAX_FRAGS];
+static unsigned _sent_num;
+static bool _sent_overflow;
+/* to protect _sent and _sent_num */
+static mutex_t _sent_lock = MUTEX_INIT;
+
+static int _mock_netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[TEST_MAX_FRAG_LEN + IEEE802154_MAX_HDR_LEN];
+    size_t len = 0;
+
+    (void)dev;
+    for (const iolist_t *ptr = iolist; ptr != NULL; ptr = ptr->iol_next) {
+        if ((len + ptr->iol_len) > sizeof(frame)) {
+            _sent_overflow = true;
+            return -ENOBUFS;
+        }
+        memcpy(&frame[len], ptr->iol_base, ptr->iol_len);
+        len += ptr->iol_len;
+    }
+
+    size_t mhr_len = ieee802154_get_frame_hdr_len(frame);
+
+    mutex_lock(&_sent_lock);
+    if ((mhr_len == 0) || (_sent_num >= TEST_MAX_FRAGS)) {
+        _sent_overflow = true;
+    }
+    else {
+        /* only keep the 6LoWPAN frame */
+        memcpy(_sent[_sent_num].data, &frame[mhr_len], len - mhr_len);
+        _sent[_sent_num].len = len - mhr_len;
+        _sent_num++;
+    }
+    mutex_unlock(&_sent_lock);
+    return len;
+}
+
+static inline uint16_t _floor8(uint16_t length)
+{
+    return length & 0xfff8U;
+}
+
+static inline size_t _min(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/* the copying implementation of the fragmentation, as reference */
+static uint16_t _ref_copy_pkt_to_frag(uint8_t *data, const gnrc_pktsnip_t *pkt,
+                                      uint16_t max_frag_size,
+                                      uint16_t init_offset)
+{
+    uint16_t offset = init_offset;
+
+    while ((pkt != NULL) && (offset < max_frag_size)) {
+        uint16_t len = _min(max_frag_size - offset, pkt->size);
+
+        memcpy(data + offset, pkt->data, len);
+
+        offset += len;
+        pkt = pkt->next;
+    }
+    return offset;
+}
+
+static uint16_t _ref_1st_fragment(_frag_t *frag, const gnrc_pktsnip_t *pkt,
+                                  uint16_t datagram_size, size_t payload_len)
+{
+    sixlowpan_frag_t *hdr = (sixlowpan_frag_t *)frag->data;
+    int payload_diff = datagram_size - payload_len;
+    uint16_t max_frag_size = _floor8(_mock_netif->sixlo.max_frag_size +
+                                     payload_diff - sizeof(sixlowpan_frag_t)) -
+                             payload_diff;
+
+    hdr->disp_size = byteorder_htons(datagram_size);
+    hdr->tag = byteorder_htons(TEST_TAG);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+
+    uint16_t local_offset = _ref_copy_pkt_to_frag((uint8_t *)(hdr + 1),
+                                                  pkt->next, max_frag_size, 0);
+    frag->len = sizeof(*hdr) + local_offset;
+    return local_offset;
+}
+
+static uint16_t _ref_nth_fragment(_frag_t *frag, const gnrc_pktsnip_t *pkt,
+                                  uint16_t datagram_size, size_t payload_len,
+                                  uint16_t offset)
+{
+    sixlowpan_frag_n_t *hdr = (sixlowpan_frag_n_t *)frag->data;
+    uint8_t *data = (uint8_t *)(hdr + 1);
+    uint16_t local_offset = 0, offset_count = 0;
+    uint16_t max_frag_size = _floor8(_mock_netif->sixlo.max_frag_size -
+                                     sizeof(sixlowpan_frag_n_t));
+
+    hdr->disp_size = byteorder_htons(datagram_size);
+    hdr->tag = byteorder_htons(TEST_TAG);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+    hdr->offset = (uint8_t)((offset + (datagram_size - payload_len)) >> 3);
+    pkt = pkt->next;
+    while ((pkt != NULL) && (offset_count != offset)) {
+        offset_count += (uint16_t)pkt->size;
+
+        if (offset_count > offset) {
+            uint16_t pkt_offset = offset - (offset_count - ((uint16_t)pkt->size));
+            size_t clen = _min(max_frag_size, pkt->size - pkt_offset);
+
+            memcpy(data, ((uint8_t *)pkt->data) + pkt_offset, clen);
+            local_offset = clen;
+            pkt = pkt->next;
+            break;
+        }
+
+        pkt = pkt->next;
+    }
+    local_offset = _ref_copy_pkt_to_frag(data, pkt, max_frag_size, local_offset);
+    frag->len = sizeof(*hdr) + local_offset;
+    return local_offset;
+}
+
+static void _ref_fragment(const gnrc_pktsnip_t *pkt, uint16_t datagram_size)
+{
+    size_t payload_len = gnrc_pkt_len(pkt->next);
+    uint16_t offset;
+
+    offset = _ref_1st_fragment(&_exp[0], pkt, datagram_size, payload_len);
+    _exp_num = 1;
+    while ((offset < payload_len) && (_exp_num < TEST_MAX_FRAGS)) {
+        offset += _ref_nth_fragment(&_exp[_exp_num++], pkt, datagram_size,
+                                    payload_len, offset);
+    }
+}
+
+static gnrc_pktsnip_t *_create_datagram(const size_t *sizes, unsigned num)
+{
+    gnrc_pktsnip_t *pkt = NULL, *netif;
+    size_t offset = 0;
+
+    for (unsigned i = 0; i < num; i++) {
+        gnrc_pktsnip_t *snip = gnrc_pktbuf_add(NULL, &_datagram[offset],
+                                               sizes[i],
+                                               GNRC_NETTYPE_SIXLOWPAN);
+        if (snip == NULL) {
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        LL_APPEND(pkt, snip);
+        offset += sizes[i];
+    }
+    netif = gnrc_netif_hdr_build(_src, sizeof(_src), _dst, sizeof(_dst));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _mock_netif->pid;
+    LL_PREPEND(pkt, netif);
+    return pkt;
+}
+
+static void _send_and_check(const size_t *sizes, unsigned num,
+                            uint16_t payload_diff, unsigned shared)
+{
+    gnrc_sixlowpan_frag_fb_t *fbuf;
+    gnrc_pktsnip_t *pkt, *held = NULL;
+
+    TEST_ASSERT_NOT_NULL((pkt = _create_datagram(sizes, num)));
+    uint16_t datagram_size = gnrc_pkt_len(pkt->next) + payload_diff;
+
+    _ref_fragment(pkt, datagram_size);
+    TEST_ASSERT(_exp_num > 1);
+
+    if (shared > 0) {
+        /* someone else (e.g. another interface) uses the snips from the
+         * shared-th on */
+        held = pkt;
+        for (unsigned i = 0; i < shared; i++) {
+            held = held->next;
+        }
+        gnrc_pktbuf_hold(held, 1);
+    }
+
+    TEST_ASSERT_NOT_NULL((fbuf = gnrc_sixlowpan_frag_fb_get()));
+    fbuf->pkt = pkt;
+    fbuf->datagram_size = datagram_size;
+    fbuf->tag = TEST_TAG;
+    fbuf->offset = 0;
+    gnrc_sixlowpan_frag_send(pkt, fbuf, 0);
+
+    /* the subsequent fragments are sent by the 6LoWPAN thread */
+    uint32_t start = xtimer_now_usec();
+    while ((fbuf->pkt != NULL) &&
+           ((xtimer_now_usec() - start) < SEND_TIMEOUT_US)) {
+        xtimer_usleep(US_PER_MS);
+    }
+    TEST_ASSERT_NULL(fbuf->pkt);
+    /* give the interface time to send the last fragment */
+    xtimer_usleep(10 * US_PER_MS);
+
+    mutex_lock(&_sent_lock);
+    TEST_ASSERT(!_sent_overflow);
+    TEST_ASSERT_EQUAL_INT(_exp_num, _sent_num);
+    for (unsigned i = 0; i < _exp_num; i++) {
+        TEST_ASSERT_EQUAL_INT(_exp[i].len, _sent[i].len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(_exp[i].data, _sent[i].data,
+                                        _exp[i].len));
+    }
+    mutex_unlock(&_sent_lock);
+
+    if (held != NULL) {
+        /* the shared snips must not have been touched */
+        size_t offset = gnrc_pkt_len(pkt->next) - gnrc_pkt_len(held);
+
+        for (gnrc_pktsnip_t *snip = held; snip != NULL; snip = snip->next) {
+            TEST_ASSERT_EQUAL_INT(1, snip->users);
+            TEST_ASSERT_EQUAL_INT(0, memcmp(&_datagram[offset], snip->data,
+                                            snip->size));
+            offset += snip->size;
+        }
+        gnrc_pktbuf_release(held);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void _set_up(void)
+{
+    gnrc_pktbuf_init();
+    memset(_exp, 0, sizeof(_exp));
+    memset(_sent, 0, sizeof(_sent));
+    _exp_num = 0;
+    _sent_num = 0;
+    _sent_overflow = false;
+    netdev_test_set_send_cb((netdev_test_t *)_mock_netif->dev,
+                            _mock_netdev_send);
+}
+
+static void _tear_down(void)
+{
+    netdev_test_set_send_cb((netdev_test_t *)_mock_netif->dev, NULL);
+}
+
+static void test_frag_send__one_snip(void)
+{
+    static const size_t sizes[] = { TEST_DATAGRAM_LEN };
+
+    _send_and_check(sizes, ARRAY_SIZE(sizes), 0, 0);
+}
+
+static void test_frag_send__unaligned(void)
+{
+    static const size_t sizes[] = { TEST_DATAGRAM_LEN };
+
+    /* compression saved a number of bytes that is not a multiple of 8, so
+     * the first fragment ends at an odd offset of the snip */
+    _send_and_check(sizes, ARRAY_SIZE(sizes), 3, 0);
+}
+
+static void test_frag_send__many_snips(void)
+{
+    /* boundaries of snips and fragments fall together, cut snips on both
+     * sides, and multiple snips make up a fragment */
+    static const size_t sizes[] = { 7, 33, 1, 64, 45, 2, 48 };
+
+    _send_and_check(sizes, ARRAY_SIZE(sizes), 0, 0);
+    _set_up();
+    _send_and_check(sizes, ARRAY_SIZE(sizes), 13, 0);
+}
+
+static void test_frag_send__shared_snips(void)
+{
+    static const size_t sizes[] = { 40, 17, 80, 63 };
+
+    /* all snips of the datagram are shared */
+    _send_and_check(sizes, ARRAY_SIZE(sizes), 5, 1);
+    _set_up();
+    /* only the last two snips are shared, the first fragment consists of
+     * exclusively owned and shared snips */
+    _send_and_check(sizes, ARRAY_SIZE(sizes), 0, 3);
+}
+
+static Test *tests_gnrc_sixlowpan_frag_send(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_frag_send__one_snip),
+        new_TestFixture(test_frag_send__unaligned),
+        new_TestFixture(test_frag_send__many_snips),
+        new_TestFixture(test_frag_send__shared_snips),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, _set_up, _tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_datagram); i++) {
+        _datagram[i] = (uint8_t)(i * 7 + 3);
+    }
+    _tests_init();
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_sixlowpan_frag_send());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       kvstore module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "kvstore.h"
+#include "mtd.h"
+
+/* Test mock object implementing a simple RAM-based flash */
+#define SECTOR_COUNT        (4)
+#define PAGE_PER_SECTOR     (4)
+#define PAGE_SIZE           (64)
+
+#define MEMORY_SIZE         (PAGE_SIZE * PAGE_PER_SECTOR * SECTOR_COUNT)
+#define SECTOR_SIZE         (PAGE_SIZE * PAGE_PER_SECTOR)
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static unsigned _erases[SECTOR_COUNT];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+    memcpy(buff, _dummy_memory + addr, size);
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+    const uint8_t *src = buff;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    /* flash semantics */
+    for (uint32_t i = 0; i < size; i++) {
+        _dummy_memory[addr + i] &= src[i];
+    }
+
+    return size;
+}
+
+/* like mtd_native, refuses writes across a page boundary */
+static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
+{
+    const uint8_t *src = buff;
+
+    if (addr + size > MEMORY_SIZE) {
+        return -EOVERFLOW;
+    }
+    if ((addr % dev->page_size) + size > dev->page_size) {
+        return -EOVERFLOW;
+    }
+
+    for (uint32_t i = 0; i < size; i++) {
+        _dummy_memory[addr + i] &= src[i];
+    }
+
+    return 0;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+    while (count--) {
+        _erases[sector++]++;
+    }
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init         = _init,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .write        = _write,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static kvstore_sector_t _sectors[SECTOR_COUNT];
+static kvstore_entry_t _index[8];
+static kvstore_t _kv = KVSTORE_INIT(&dev, 0, _sectors, _index);
+
+static void setup(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    memset(_erases, 0, sizeof(_erases));
+    kvstore_init(&_kv);
+}
+
+static void test_kvstore_set_get(void)
+{
+    static const char value[] = "value";
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvstore_get(&_kv, "key", buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "key", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_INT(sizeof(value), kvstore_get(&_kv, "key", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING(value, buf);
+
+    /* only part of the value fits */
+    memset(buf, 0, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(sizeof(value), kvstore_get(&_kv, "key", buf, 2));
+    TEST_ASSERT_EQUAL_STRING("va", buf);
+
+    /* empty values are allowed */
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "empty", NULL, 0));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_get(&_kv, "empty", buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, kvstore_set(&_kv, "", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, kvstore_set(&_kv, "big", _dummy_memory,
+                                               SECTOR_SIZE));
+}
+
+static void test_kvstore_overwrite(void)
+{
+    uint32_t val;
+
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "counter", &i, sizeof(i)));
+    }
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvstore_get(&_kv, "counter", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(3, val);
+}
+
+static void test_kvstore_delete(void)
+{
+    uint32_t val = 42;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvstore_delete(&_kv, "key"));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "key", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_delete(&_kv, "key"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvstore_get(&_kv, "key", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvstore_delete(&_kv, "key"));
+
+    /* the key can be set again */
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "key", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvstore_get(&_kv, "key", &val, sizeof(val)));
+}
+
+static void test_kvstore_reinit(void)
+{
+    uint32_t val = 1;
+
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "a", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "b", &val, sizeof(val)));
+    val = 2;
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "a", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_delete(&_kv, "b"));
+
+    /* the index is rebuilt from the device */
+    TEST_ASSERT_EQUAL_INT(0, kvstore_init(&_kv));
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvstore_get(&_kv, "a", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(2, val);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, kvstore_get(&_kv, "b", &val, sizeof(val)));
+
+    /* new records are appended after the existing ones */
+    val = 3;
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "b", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_init(&_kv));
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvstore_get(&_kv, "b", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(3, val);
+}
+
+static void test_kvstore_torn_write(void)
+{
+    uint32_t val = 1;
+
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "key", &val, sizeof(val)));
+    val = 0xffff;
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "key", &val, sizeof(val)));
+
+    /* the last record is 8 bytes header, 3 bytes key and 4 bytes value,
+     * find it and damage its value */
+    unsigned last = 0;
+    for (unsigned i = 0; i < MEMORY_SIZE - 16; i++) {
+        if (memcmp(&_dummy_memory[i + 8], "key", 3) == 0) {
+            last = i;
+        }
+    }
+    _dummy_memory[last + 11] = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, kvstore_init(&_kv));
+    TEST_ASSERT_EQUAL_INT(sizeof(val), kvstore_get(&_kv, "key", &val, sizeof(val)));
+    TEST_ASSERT_EQUAL_INT(1, val);
+}
+
+static void test_kvstore_gc(void)
+{
+    uint8_t buf[48];
+    char key[] = "k0";
+
+    /* three keys updated round robin need far more space than available */
+    for (unsigned i = 0; i < 100; i++) {
+        key[1] = '0' + i % 3;
+        memset(buf, i, sizeof(buf));
+        TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, key, buf, sizeof(buf)));
+    }
+
+    for (unsigned i = 97; i < 100; i++) {
+        key[1] = '0' + i % 3;
+        TEST_ASSERT_EQUAL_INT(sizeof(buf), kvstore_get(&_kv, key, buf, sizeof(buf)));
+        TEST_ASSERT_EQUAL_INT(i, buf[0]);
+        TEST_ASSERT_EQUAL_INT(i, buf[sizeof(buf) - 1]);
+    }
+
+    /* one sector is always kept free */
+    TEST_ASSERT(_kv.free >= 1);
+
+    /* the erase cycles are spread over all sectors */
+    for (unsigned i = 0; i < SECTOR_COUNT; i++) {
+        TEST_ASSERT(_erases[i] > 2);
+    }
+
+    /* compacting ahead of time */
+    while (kvstore_gc(&_kv) > 0) {}
+    TEST_ASSERT(_kv.free >= CONFIG_KVSTORE_GC_FREE_SECTORS);
+
+    TEST_ASSERT_EQUAL_INT(0, kvstore_init(&_kv));
+    for (unsigned i = 97; i < 100; i++) {
+        key[1] = '0' + i % 3;
+        TEST_ASSERT_EQUAL_INT(sizeof(buf), kvstore_get(&_kv, key, buf, sizeof(buf)));
+        TEST_ASSERT_EQUAL_INT(i, buf[0]);
+    }
+}
+
+static void test_kvstore_gc_straddle(void)
+{
+    /* records of 8 bytes header, 1 byte key and 84 bytes value, each one
+     * crosses at least one page boundary, two fit into a sector */
+    uint8_t buf[96 - 9];
+    static const char keys[] = "xaxbcde";
+    const unsigned erases = _erases[0];
+
+    /* "a" in the first sector outlives the first "x", so the first sector
+     * is compacted when the last free sector is needed */
+    for (unsigned i = 0; i < sizeof(keys) - 1; i++) {
+        char key[] = { keys[i], '\0' };
+        memset(buf, i, sizeof(buf));
+        TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, key, buf, sizeof(buf)));
+    }
+    TEST_ASSERT_EQUAL_INT(erases + 1, _erases[0]);
+
+    TEST_ASSERT_EQUAL_INT(0, kvstore_init(&_kv));
+    for (unsigned i = 1; i < sizeof(keys) - 1; i++) {
+        char key[] = { keys[i], '\0' };
+        TEST_ASSERT_EQUAL_INT(sizeof(buf), kvstore_get(&_kv, key, buf, sizeof(buf)));
+        TEST_ASSERT_EQUAL_INT(i, buf[0]);
+        TEST_ASSERT_EQUAL_INT(i, buf[sizeof(buf) - 1]);
+    }
+}
+
+static void test_kvstore_full(void)
+{
+    uint8_t buf[100];
+    char key[] = "k0";
+
+    /* the index has room for seven keys */
+    for (unsigned i = 0; i < ARRAY_SIZE(_index) - 1; i++) {
+        key[1] = '0' + i;
+        TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, key, NULL, 0));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, kvstore_set(&_kv, "new", NULL, 0));
+
+    /* the data of three sectors doesn't fit */
+    TEST_ASSERT_EQUAL_INT(0, kvstore_format(&_kv));
+    int res = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(_index) - 1 && res == 0; i++) {
+        key[1] = '0' + i;
+        res = kvstore_set(&_kv, key, buf, sizeof(buf));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, res);
+
+    /* deleting keys frees space */
+    TEST_ASSERT_EQUAL_INT(0, kvstore_delete(&_kv, "k0"));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_delete(&_kv, "k1"));
+    TEST_ASSERT_EQUAL_INT(0, kvstore_set(&_kv, "k2", buf, sizeof(buf)));
+}
+
+Test *tests_kvstore_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_kvstore_set_get),
+        new_TestFixture(test_kvstore_overwrite),
+        new_TestFixture(test_kvstore_delete),
+        new_TestFixture(test_kvstore_reinit),
+        new_TestFixture(test_kvstore_torn_write),
+        new_TestFixture(test_kvstore_gc),
+        new_TestFixture(test_kvstore_gc_straddle),
+        new_TestFixture(test_kvstore_full),
+    };
+
+    EMB_UNIT_TESTCALLER(kvstore_tests, setup, NULL, fixtures);
+
+    return (Test *)&kvstore_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_kvstore_tests());
+    TESTS_END();
+    return 0;
+}
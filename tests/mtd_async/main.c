@@ -0,0 +1,291 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Tests for the asynchronous MTD job API
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "event.h"
+#include "mtd.h"
+#include "mtd_async.h"
+
+/* Test mock object implementing a simple RAM-based flash */
+#define SECTOR_COUNT        (4)
+#define PAGE_PER_SECTOR     (4)
+#define PAGE_SIZE           (32)
+
+#define MEMORY_SIZE         (PAGE_SIZE * PAGE_PER_SECTOR * SECTOR_COUNT)
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+    memcpy(buff, _dummy_memory + page * dev->page_size + offset, size);
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    const uint8_t *src = buff;
+    uint8_t *dst = _dummy_memory + page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] &= src[i];
+    }
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    const uint32_t sector_size = dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    memset(_dummy_memory + sector * sector_size, 0xff, count * sector_size);
+
+    return 0;
+}
+
+static unsigned submit_calls;
+
+/* completes the job right away, like a driver finishing in its ISR */
+static int _submit(mtd_dev_t *dev, mtd_job_t *job)
+{
+    (void)dev;
+    submit_calls++;
+    mtd_job_complete(job, mtd_job_execute(job));
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static const mtd_desc_t driver_submit = {
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .submit = _submit,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_dev_t dev_submit = {
+    .driver = &driver_submit,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static const char hdr[] = "header";
+static const char payload[] = "a payload spanning two pages";
+
+static mtd_job_t job;
+static mtd_job_t jobs[3];
+
+static unsigned cb_calls;
+static int cb_result;
+
+static void _cb(mtd_job_t *j, void *arg)
+{
+    (void)arg;
+    cb_calls++;
+    cb_result = j->result;
+}
+
+static void _job(mtd_job_t *j, mtd_dev_t *d, mtd_job_op_t op,
+                 const iolist_t *iol, uint32_t addr)
+{
+    memset(j, 0, sizeof(*j));
+    j->dev = d;
+    j->op = op;
+    j->iol = iol;
+    j->addr = addr;
+}
+
+static void setup(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    cb_calls = 0;
+    cb_result = 1;
+    submit_calls = 0;
+}
+
+static void test_mtd_async_write_read(void)
+{
+    char buf[sizeof(hdr) + sizeof(payload)];
+    iolist_t iol_payload = {
+        .iol_base = (void *)payload,
+        .iol_len = sizeof(payload),
+    };
+    iolist_t iol = {
+        .iol_next = &iol_payload,
+        .iol_base = (void *)hdr,
+        .iol_len = sizeof(hdr),
+    };
+    iolist_t iol_read = {
+        .iol_base = buf,
+        .iol_len = sizeof(buf),
+    };
+
+    _job(&job, &dev, MTD_JOB_WRITE, &iol, PAGE_SIZE - 4);
+    job.cb = _cb;
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_wait(&job));
+    TEST_ASSERT(mtd_job_is_done(&job));
+    TEST_ASSERT_EQUAL_INT(1, cb_calls);
+    TEST_ASSERT_EQUAL_INT(0, cb_result);
+
+    _job(&job, &dev, MTD_JOB_READ, &iol_read, PAGE_SIZE - 4);
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(hdr, buf, sizeof(hdr)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(payload, buf + sizeof(hdr),
+                                    sizeof(payload)));
+
+    /* errors are reported as the result */
+    _job(&job, &dev, MTD_JOB_READ, &iol_read, MEMORY_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_job_wait(&job));
+}
+
+static void test_mtd_async_order(void)
+{
+    char buf[sizeof(hdr)];
+    iolist_t iol = {
+        .iol_base = (void *)hdr,
+        .iol_len = sizeof(hdr),
+    };
+    iolist_t iol_read = {
+        .iol_base = buf,
+        .iol_len = sizeof(buf),
+    };
+
+    /* erase, write and read back without waiting in between */
+    memset(_dummy_memory, 0, sizeof(_dummy_memory));
+    _job(&jobs[0], &dev, MTD_JOB_ERASE_SECTOR, NULL, 1);
+    jobs[0].count = 1;
+    _job(&jobs[1], &dev, MTD_JOB_WRITE, &iol, PAGE_SIZE * PAGE_PER_SECTOR);
+    _job(&jobs[2], &dev, MTD_JOB_READ, &iol_read, PAGE_SIZE * PAGE_PER_SECTOR);
+    for (unsigned i = 0; i < ARRAY_SIZE(jobs); i++) {
+        jobs[i].cb = _cb;
+        TEST_ASSERT_EQUAL_INT(0, mtd_job_submit(&jobs[i]));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_wait(&jobs[2]));
+    TEST_ASSERT(mtd_job_is_done(&jobs[0]));
+    TEST_ASSERT(mtd_job_is_done(&jobs[1]));
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(jobs), cb_calls);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(hdr, buf, sizeof(hdr)));
+}
+
+static void test_mtd_async_event(void)
+{
+    event_queue_t queue;
+    event_t event = { 0 };
+    char buf[4];
+    iolist_t iol_read = {
+        .iol_base = buf,
+        .iol_len = sizeof(buf),
+    };
+
+    event_queue_init(&queue);
+
+    _job(&job, &dev, MTD_JOB_READ, &iol_read, 0);
+    job.queue = &queue;
+    job.event = &event;
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_submit(&job));
+
+    TEST_ASSERT(event_wait(&queue) == &event);
+    TEST_ASSERT(mtd_job_is_done(&job));
+    TEST_ASSERT_EQUAL_INT(0, job.result);
+}
+
+static void test_mtd_async_submit(void)
+{
+    char buf[sizeof(hdr)];
+    iolist_t iol = {
+        .iol_base = (void *)hdr,
+        .iol_len = sizeof(hdr),
+    };
+
+    /* executed by the driver, completed before returning */
+    _job(&job, &dev_submit, MTD_JOB_WRITE, &iol, 0);
+    job.cb = _cb;
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_submit(&job));
+    TEST_ASSERT(mtd_job_is_done(&job));
+    TEST_ASSERT_EQUAL_INT(1, submit_calls);
+    TEST_ASSERT_EQUAL_INT(1, cb_calls);
+    TEST_ASSERT_EQUAL_INT(0, mtd_job_wait(&job));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(&dev_submit, buf, 0, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(hdr, buf, sizeof(buf)));
+
+    /* invalid jobs are rejected */
+    _job(&job, &dev_submit, MTD_JOB_OP_NUMOF, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, mtd_job_submit(&job));
+    _job(&job, NULL, MTD_JOB_READ, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(-ENODEV, mtd_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(1, submit_calls);
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_write_read),
+        new_TestFixture(test_mtd_async_order),
+        new_TestFixture(test_mtd_async_event),
+        new_TestFixture(test_mtd_async_submit),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
+/** @} */
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based flash */
+#ifndef SECTOR_COUNT
+#define SECTOR_COUNT 8
+#endif
+#ifndef PAGE_PER_SECTOR
+#define PAGE_PER_SECTOR 4
+#endif
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 64
+#endif
+
+#define CACHE_LINES         (4)
+
+#define MEMORY_SIZE         (PAGE_SIZE * PAGE_PER_SECTOR * SECTOR_COUNT)
+#define SECTOR_SIZE         (PAGE_SIZE * PAGE_PER_SECTOR)
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static unsigned _reads;
+static unsigned _writes;
+
+static uint8_t _buffer[PAGE_SIZE];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    memcpy(buff, _dummy_memory + addr, size);
+    _reads++;
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+    const uint8_t *src = buff;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    /* flash semantics */
+    for (uint32_t i = 0; i < size; i++) {
+        _dummy_memory[addr + i] &= src[i];
+    }
+    _writes++;
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static const mtd_desc_t driver_direct = {
+    .init = _init,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+    .flags        = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_cache_line_t _lines[CACHE_LINES];
+static uint8_t _cache_buf[CACHE_LINES * PAGE_SIZE];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&dev, _lines, _cache_buf);
+
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static void _test_mem(const uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void setup(void)
+{
+    mtd_init(_dev);
+    mtd_cache_reset_stats(&_cache);
+    _reads = 0;
+    _writes = 0;
+}
+
+static void test_mtd_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+}
+
+static void test_mtd_read_hit(void)
+{
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 0, PAGE_SIZE));
+        _test_mem(_buffer, PAGE_SIZE, 0xff);
+    }
+
+    TEST_ASSERT_EQUAL_INT(1, _cache.misses);
+    TEST_ASSERT_EQUAL_INT(2, _cache.hits);
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+
+    /* reading across two pages loads the second one */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, PAGE_SIZE / 2, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(2, _cache.misses);
+    TEST_ASSERT_EQUAL_INT(3, _cache.hits);
+}
+
+static void test_mtd_write_coalesce(void)
+{
+    static const uint8_t data[] = { 0x12, 0x34, 0x56, 0x78 };
+
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, data, PAGE_SIZE + 8 * i,
+                                           sizeof(data)));
+    }
+
+    /* nothing written yet, but the data is visible */
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[PAGE_SIZE + 8]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, PAGE_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buffer + 8, data, sizeof(data)));
+    _test_mem(_buffer + 4, 4, 0xff);
+
+    /* all four writes end up in a single write of the backing device */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(1, _cache.writebacks);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_dummy_memory + PAGE_SIZE + 24, data,
+                                    sizeof(data)));
+
+    /* flushing again is a no-op */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+}
+
+static void test_mtd_write_and(void)
+{
+    static const uint8_t a = 0xf0;
+    static const uint8_t b = 0x3c;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, &a, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, &b, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 0, 1));
+    TEST_ASSERT_EQUAL_INT(a & b, _buffer[0]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(a & b, _dummy_memory[0]);
+}
+
+static void test_mtd_write_direct(void)
+{
+    static const uint8_t a = 0xf0;
+    static const uint8_t b = 0x3c;
+
+    TEST_ASSERT_EQUAL_INT(0, _dev->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE);
+
+    /* the cache takes over the write semantics of the backing device */
+    dev.driver = &driver_direct;
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    TEST_ASSERT(_dev->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, &a, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, &b, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 0, 1));
+    TEST_ASSERT_EQUAL_INT(b, _buffer[0]);
+
+    dev.driver = &driver;
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    TEST_ASSERT_EQUAL_INT(0, _dev->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE);
+}
+
+static void test_mtd_evict_lru(void)
+{
+    /* fill the cache with dirty pages */
+    for (unsigned i = 0; i < CACHE_LINES; i++) {
+        memset(_buffer, i, PAGE_SIZE);
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, i * PAGE_SIZE,
+                                           PAGE_SIZE));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+
+    /* make page 0 the most recently used one */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 0, 1));
+
+    /* loading another page evicts page 1 */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, CACHE_LINES * PAGE_SIZE,
+                                      PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory + PAGE_SIZE, PAGE_SIZE, 1);
+    _test_mem(_dummy_memory, PAGE_SIZE, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    for (unsigned i = 0; i < CACHE_LINES; i++) {
+        _test_mem(_dummy_memory + i * PAGE_SIZE, PAGE_SIZE, i);
+    }
+}
+
+static void test_mtd_erase(void)
+{
+    memset(_buffer, 0x00, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, SECTOR_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(_dev, SECTOR_SIZE, SECTOR_SIZE));
+
+    /* the pending write is dropped */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase(_dev, 1, SECTOR_SIZE));
+}
+
+static void test_mtd_overflow(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_read(_dev, _buffer, MEMORY_SIZE, 1));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_write(_dev, _buffer, MEMORY_SIZE, 1));
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_init),
+        new_TestFixture(test_mtd_read_hit),
+        new_TestFixture(test_mtd_write_coalesce),
+        new_TestFixture(test_mtd_write_and),
+        new_TestFixture(test_mtd_write_direct),
+        new_TestFixture(test_mtd_evict_lru),
+        new_TestFixture(test_mtd_erase),
+        new_TestFixture(test_mtd_overflow),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
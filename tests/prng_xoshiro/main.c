@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ *
+ * @file
+ * @brief       Test cases for the xoshiro256** pseudo random number generator
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "random.h"
+
+/**
+ * @brief expected sequence for the state {1, 2, 3, 4}, generated with the
+ *        reference implementation from https://prng.di.unimi.it/xoshiro256starstar.c
+ */
+static const uint64_t seq_ref[] = {
+    0x0000000000002d00ULL, 0x0000000000000000ULL, 0x000000005a007080ULL,
+    0x10e0000000009d80ULL, 0x10e0b61ce1009d80ULL, 0x0870021ce143ad00ULL,
+    0xe071c3c2e143f089ULL, 0x75a1690ef7a20380ULL,
+};
+
+/**
+ * @brief expected sequence for seed=1. This is only a regression test. The
+ *        expected output was generated when adding the generator to RIOT.
+ */
+static const uint32_t seq_seed1[] = {
+    0xe818559f, 0x17115db4, 0x5d8a7967, 0xfc1d55fc,
+    0x172f5249, 0x08316349, 0x74310bc7, 0x479b40de,
+};
+
+static void _result(const char *func, int success)
+{
+    printf("%s:%s\n", func, success ? "SUCCESS" : "FAILURE");
+}
+
+static void test_prng_xoshiro_reference(void)
+{
+    random_ctx_t ctx = { .s = { 1, 2, 3, 4 } };
+    int success = 1;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(seq_ref); i++) {
+        success &= (random_ctx_uint64(&ctx) == seq_ref[i]);
+    }
+
+    _result(__func__, success);
+}
+
+static void test_prng_xoshiro_seed1_u32(void)
+{
+    uint32_t test32[ARRAY_SIZE(seq_seed1)];
+
+    random_init(1);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(seq_seed1); i++) {
+        test32[i] = random_uint32();
+    }
+
+    _result(__func__, !memcmp(test32, seq_seed1, sizeof(seq_seed1)));
+}
+
+static void test_prng_xoshiro_bytes(void)
+{
+    static const uint8_t seed[] = "bulk";
+    random_ctx_t a, b;
+    uint64_t words[3];
+    uint8_t bytes[sizeof(words) - 3];
+
+    random_ctx_init(&a, seed, sizeof(seed));
+    random_ctx_init(&b, seed, sizeof(seed));
+
+    /* the bytes are the numbers in memory order, including the last one */
+    random_ctx_bytes(&a, bytes, sizeof(bytes));
+    for (unsigned i = 0; i < ARRAY_SIZE(words); i++) {
+        words[i] = random_ctx_uint64(&b);
+    }
+
+    _result(__func__, !memcmp(bytes, words, sizeof(bytes)) &&
+                      (random_ctx_uint64(&a) == random_ctx_uint64(&b)));
+}
+
+static void test_prng_xoshiro_range(void)
+{
+    random_ctx_t ctx;
+    unsigned hits[7] = { 0 };
+    int success = 1;
+
+    random_ctx_init(&ctx, NULL, 0);
+
+    for (unsigned i = 0; i < 700; i++) {
+        uint32_t r = random_ctx_uint32_range(&ctx, 10, 17);
+
+        if ((r < 10) || (r >= 17)) {
+            success = 0;
+            break;
+        }
+        hits[r - 10]++;
+    }
+    /* every value shows up */
+    for (unsigned i = 0; i < ARRAY_SIZE(hits); i++) {
+        success &= (hits[i] > 0);
+    }
+    success &= (random_ctx_uint32_range(&ctx, 5, 6) == 5);
+
+    _result(__func__, success);
+}
+
+static void test_prng_xoshiro_seed_ctx(void)
+{
+    random_ctx_t a, b;
+
+    random_ctx_seed(&a);
+    random_ctx_seed(&b);
+
+    _result(__func__, memcmp(&a, &b, sizeof(a)) != 0);
+}
+
+int main(void)
+{
+    test_prng_xoshiro_reference();
+    test_prng_xoshiro_seed1_u32();
+    test_prng_xoshiro_bytes();
+    test_prng_xoshiro_range();
+    test_prng_xoshiro_seed_ctx();
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect("test_prng_xoshiro_reference:SUCCESS\r\n")
+    child.expect("test_prng_xoshiro_seed1_u32:SUCCESS\r\n")
+    child.expect("test_prng_xoshiro_bytes:SUCCESS\r\n")
+    child.expect("test_prng_xoshiro_range:SUCCESS\r\n")
+    child.expect("test_prng_xoshiro_seed_ctx:SUCCESS\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
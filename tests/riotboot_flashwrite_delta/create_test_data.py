@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Create two versions of a fake firmware image and the patch between them"""
+
+import os
+import random
+import struct
+import subprocess
+import sys
+
+RIOTBASE = os.environ.get("RIOTBASE", os.path.join(os.path.dirname(__file__),
+                                                   "..", ".."))
+GEN_DELTA = os.path.join(RIOTBASE, "dist", "tools", "riotboot_delta",
+                         "gen_delta.py")
+
+HDR_LEN = 0x100
+IMAGE_LEN = 5000
+
+
+def fletcher32(data):
+    sum1, sum2 = 0xffff, 0xffff
+    for (word,) in struct.iter_unpack("<H", data):
+        sum1 = (sum1 + word) % 0xffff
+        sum2 = (sum2 + sum1) % 0xffff
+    return (sum2 << 16) | sum1
+
+
+def riotboot_hdr(version, start_addr):
+    hdr = struct.pack("<4sII", b"RIOT", version, start_addr)
+    hdr += struct.pack("<I", fletcher32(hdr))
+    return hdr.ljust(HDR_LEN, b"\0")
+
+
+def main(outdir):
+    rand = random.Random(42)
+    firmware = bytearray(rand.getrandbits(8) for _ in range(IMAGE_LEN))
+    old = riotboot_hdr(1, 0x1000 + HDR_LEN) + firmware
+
+    # a changed constant, new code in the middle and removed code further on
+    firmware[100:104] = b"\xde\xad\xbe\xef"
+    firmware[2000:2000] = bytes(rand.getrandbits(8) for _ in range(200))
+    del firmware[4000:4100]
+    new = riotboot_hdr(2, 0x3000 + HDR_LEN) + firmware
+
+    with open(os.path.join(outdir, "slot0.bin"), "wb") as f:
+        f.write(old)
+    with open(os.path.join(outdir, "slot1.bin"), "wb") as f:
+        f.write(new)
+
+    subprocess.check_call([GEN_DELTA,
+                           os.path.join(outdir, "slot0.bin"),
+                           os.path.join(outdir, "slot1.bin"),
+                           os.path.join(outdir, "patch.bin")])
+
+
+if __name__ == "__main__":
+    main(sys.argv[1])
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests applying a delta update between two riotboot slots
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "hashes/sha256.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/flashwrite_delta.h"
+#include "riotboot/slot.h"
+
+#define TEST_DELTA_INCLUDE(file) <blob/bin/BOARD_NAME_UNQ/delta/file>
+
+/* cppcheck-suppress preprocessorErrorDirective
+ * (reason: board-dependent include paths) */
+#include TEST_DELTA_INCLUDE(slot0.bin.h)
+#include TEST_DELTA_INCLUDE(slot1.bin.h)
+#include TEST_DELTA_INCLUDE(patch.bin.h)
+
+/* the patch is received in chunks of about the size of a CoAP block */
+#define CHUNK_LEN       (32U)
+
+#define SOURCE_SLOT     (0)
+#define TARGET_SLOT     (1)
+
+static riotboot_flashwrite_t writer;
+static riotboot_flashwrite_delta_t delta;
+
+static int _write_image(int slot, const uint8_t *img, size_t len)
+{
+    int res = riotboot_flashwrite_init(&writer, slot);
+    if (res == 0) {
+        res = riotboot_flashwrite_putbytes(&writer,
+                                           img + RIOTBOOT_FLASHWRITE_SKIPLEN,
+                                           len - RIOTBOOT_FLASHWRITE_SKIPLEN,
+                                           false);
+    }
+    if (res == 0) {
+        res = riotboot_flashwrite_finish(&writer);
+    }
+    return res;
+}
+
+static int _apply_patch(const uint8_t *patch, size_t len)
+{
+    riotboot_flashwrite_init(&writer, TARGET_SLOT);
+    riotboot_flashwrite_delta_init(&delta, &writer, SOURCE_SLOT);
+
+    while (len) {
+        size_t n = len < CHUNK_LEN ? len : CHUNK_LEN;
+        int res = riotboot_flashwrite_delta_putbytes(&delta, patch, n);
+        if (res < 0) {
+            return res;
+        }
+        patch += n;
+        len -= n;
+    }
+
+    return riotboot_flashwrite_delta_flush(&delta);
+}
+
+static void setUp(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _write_image(SOURCE_SLOT, slot0_bin,
+                                          slot0_bin_len));
+}
+
+static void test_delta_apply(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    const uint8_t *target = (const uint8_t *)riotboot_slot_get_hdr(TARGET_SLOT);
+
+    sha256(slot1_bin, slot1_bin_len, digest);
+
+    TEST_ASSERT_EQUAL_INT(0, _apply_patch(patch_bin, patch_bin_len));
+    TEST_ASSERT_EQUAL_INT(slot1_bin_len, writer.offset);
+
+    /* the digest calculated while writing matches the one of the slot */
+    uint8_t streamed[SHA256_DIGEST_LENGTH];
+    riotboot_flashwrite_sha256_final(&writer, streamed);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(digest, streamed, sizeof(digest)));
+
+    /* every command sequence with condition-image-match queries it again */
+    memset(streamed, 0, sizeof(streamed));
+    riotboot_flashwrite_sha256_final(&writer, streamed);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(digest, streamed, sizeof(digest)));
+
+    /* the first block is only written to flash when finishing */
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_finish(&writer));
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_verify_sha256(digest,
+                                                               writer.offset,
+                                                               TARGET_SLOT));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(target, slot1_bin, slot1_bin_len));
+    TEST_ASSERT_EQUAL_INT(0, riotboot_slot_validate(TARGET_SLOT));
+}
+
+static void test_delta_wrong_source(void)
+{
+    /* the new image isn't what the patch was created for */
+    TEST_ASSERT_EQUAL_INT(0, _write_image(SOURCE_SLOT, slot1_bin,
+                                          slot1_bin_len));
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _apply_patch(patch_bin, patch_bin_len));
+}
+
+static void test_delta_truncated(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _apply_patch(patch_bin, patch_bin_len - 1));
+}
+
+static void test_delta_bad_magic(void)
+{
+    static uint8_t patch[RIOTBOOT_FLASHWRITE_DELTA_HDR_LEN];
+
+    memcpy(patch, patch_bin, sizeof(patch));
+    patch[0] = 'X';
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _apply_patch(patch, sizeof(patch)));
+}
+
+Test *tests_riotboot_flashwrite_delta(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_delta_apply),
+        new_TestFixture(test_delta_wrong_source),
+        new_TestFixture(test_delta_truncated),
+        new_TestFixture(test_delta_bad_magic),
+    };
+
+    EMB_UNIT_TESTCALLER(riotboot_flashwrite_delta_tests, setUp, NULL, fixtures);
+
+    return (Test *)&riotboot_flashwrite_delta_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_riotboot_flashwrite_delta());
+    TESTS_END();
+    return 0;
+}
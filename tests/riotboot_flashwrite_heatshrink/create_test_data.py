@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Create a fake firmware image and its heatshrink compressed version"""
+
+import os
+import random
+import struct
+import sys
+
+# must match the static configuration of the heatshrink package
+WINDOW_BITS = 8
+LOOKAHEAD_BITS = 4
+
+HDR_LEN = 0x100
+IMAGE_LEN = 5000
+# larger than the slot the test writes to
+OVERSIZED_LEN = 0x2000 + 0x100
+
+
+def fletcher32(data):
+    sum1, sum2 = 0xffff, 0xffff
+    for (word,) in struct.iter_unpack("<H", data):
+        sum1 = (sum1 + word) % 0xffff
+        sum2 = (sum2 + sum1) % 0xffff
+    return (sum2 << 16) | sum1
+
+
+def riotboot_hdr(version, start_addr):
+    hdr = struct.pack("<4sII", b"RIOT", version, start_addr)
+    hdr += struct.pack("<I", fletcher32(hdr))
+    return hdr.ljust(HDR_LEN, b"\0")
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.byte = 0
+        self.bits = 0
+
+    def put(self, value, count):
+        for i in reversed(range(count)):
+            self.byte = (self.byte << 1) | ((value >> i) & 1)
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.byte)
+                self.byte = 0
+                self.bits = 0
+
+    def finish(self):
+        # pad with zeros, the decoder ignores a trailing partial back-reference
+        if self.bits:
+            self.out.append(self.byte << (8 - self.bits))
+        return bytes(self.out)
+
+
+def heatshrink_compress(data):
+    """Greedy heatshrink encoder, the output is decodable by any decoder
+    configured with the same window and lookahead size"""
+    window = 1 << WINDOW_BITS
+    lookahead = 1 << LOOKAHEAD_BITS
+    bits = BitWriter()
+    pos = 0
+
+    while pos < len(data):
+        best_len, best_off = 0, 0
+        for off in range(1, min(pos, window) + 1):
+            n = 0
+            while (n < lookahead and pos + n < len(data) and
+                   data[pos + n] == data[pos - off + n]):
+                n += 1
+            if n > best_len:
+                best_len, best_off = n, off
+        # a back-reference only saves space from two bytes on
+        if best_len >= 2:
+            bits.put(0, 1)
+            bits.put(best_off - 1, WINDOW_BITS)
+            bits.put(best_len - 1, LOOKAHEAD_BITS)
+            pos += best_len
+        else:
+            bits.put(1, 1)
+            bits.put(data[pos], 8)
+            pos += 1
+
+    return bits.finish()
+
+
+def main(outdir):
+    rand = random.Random(42)
+    # code consisting of repeated sequences compresses like real firmware
+    snippets = [bytes(rand.getrandbits(8) for _ in range(rand.randint(4, 24)))
+                for _ in range(32)]
+    firmware = bytearray()
+    while len(firmware) < IMAGE_LEN:
+        firmware += rand.choice(snippets)
+        firmware.append(rand.getrandbits(8))
+    image = riotboot_hdr(2, 0x3000 + HDR_LEN) + firmware[:IMAGE_LEN]
+    oversized = riotboot_hdr(3, 0x3000 + HDR_LEN).ljust(OVERSIZED_LEN, b"\0")
+
+    with open(os.path.join(outdir, "slot1.bin"), "wb") as f:
+        f.write(image)
+    with open(os.path.join(outdir, "slot1.hs"), "wb") as f:
+        f.write(heatshrink_compress(image))
+    with open(os.path.join(outdir, "oversized.hs"), "wb") as f:
+        f.write(heatshrink_compress(oversized))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1])
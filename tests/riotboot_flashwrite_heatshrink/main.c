@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests writing a heatshrink compressed image to a riotboot slot
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/flashwrite_heatshrink.h"
+#include "riotboot/slot.h"
+
+#define TEST_HS_INCLUDE(file) <blob/bin/BOARD_NAME_UNQ/heatshrink/file>
+
+/* cppcheck-suppress preprocessorErrorDirective
+ * (reason: board-dependent include paths) */
+#include TEST_HS_INCLUDE(slot1.bin.h)
+#include TEST_HS_INCLUDE(slot1.hs.h)
+#include TEST_HS_INCLUDE(oversized.hs.h)
+
+#define TARGET_SLOT     (1)
+
+/* chunk sizes that don't line up with the decoder's buffers or flash pages */
+static const uint8_t chunk_lens[] = { 1, 3, 7, 13, 31, 61 };
+
+static riotboot_flashwrite_t writer;
+static riotboot_flashwrite_heatshrink_t hs;
+
+static int _decompress(const uint8_t *img, size_t len)
+{
+    unsigned i = 0;
+
+    riotboot_flashwrite_init(&writer, TARGET_SLOT);
+    riotboot_flashwrite_heatshrink_init(&hs, &writer);
+
+    while (len) {
+        size_t n = chunk_lens[i++ % ARRAY_SIZE(chunk_lens)];
+        if (n > len) {
+            n = len;
+        }
+        int res = riotboot_flashwrite_heatshrink_putbytes(&hs, img, n);
+        if (res < 0) {
+            return res;
+        }
+        img += n;
+        len -= n;
+    }
+
+    return riotboot_flashwrite_heatshrink_flush(&hs);
+}
+
+static void test_heatshrink_apply(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t streamed[SHA256_DIGEST_LENGTH];
+    const uint8_t *target = (const uint8_t *)riotboot_slot_get_hdr(TARGET_SLOT);
+
+    sha256(slot1_bin, slot1_bin_len, digest);
+
+    TEST_ASSERT_EQUAL_INT(0, _decompress(slot1_hs, slot1_hs_len));
+    TEST_ASSERT_EQUAL_INT(slot1_bin_len, writer.offset);
+    riotboot_flashwrite_sha256_final(&writer, streamed);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(digest, streamed, sizeof(digest)));
+
+    /* the first block is only written to flash when finishing */
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_finish(&writer));
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_verify_sha256(digest,
+                                                               writer.offset,
+                                                               TARGET_SLOT));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(target, slot1_bin, slot1_bin_len));
+    TEST_ASSERT_EQUAL_INT(0, riotboot_slot_validate(TARGET_SLOT));
+}
+
+static void test_heatshrink_oversized(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EFBIG, _decompress(oversized_hs, oversized_hs_len));
+    TEST_ASSERT(writer.offset <= riotboot_slot_size(TARGET_SLOT));
+}
+
+static void test_heatshrink_truncated(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t streamed[SHA256_DIGEST_LENGTH];
+
+    /* the stream has no end marker, a truncated image only shows in its size
+     * and digest, which the caller has to check */
+    sha256(slot1_bin, slot1_bin_len, digest);
+    TEST_ASSERT_EQUAL_INT(0, _decompress(slot1_hs, slot1_hs_len / 2));
+    TEST_ASSERT(writer.offset < slot1_bin_len);
+    riotboot_flashwrite_sha256_final(&writer, streamed);
+    TEST_ASSERT(memcmp(digest, streamed, sizeof(digest)) != 0);
+
+    /* not even the riotboot magic number */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _decompress(slot1_hs, 2));
+}
+
+Test *tests_riotboot_flashwrite_heatshrink(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_heatshrink_apply),
+        new_TestFixture(test_heatshrink_oversized),
+        new_TestFixture(test_heatshrink_truncated),
+    };
+
+    EMB_UNIT_TESTCALLER(riotboot_flashwrite_heatshrink_tests, NULL, NULL,
+                        fixtures);
+
+    return (Test *)&riotboot_flashwrite_heatshrink_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_riotboot_flashwrite_heatshrink());
+    TESTS_END();
+    return 0;
+}
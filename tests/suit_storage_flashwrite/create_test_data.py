@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Create the image of the running firmware, an update and the patch between
+them"""
+
+import os
+import random
+import struct
+import subprocess
+import sys
+
+RIOTBASE = os.environ.get("RIOTBASE", os.path.join(os.path.dirname(__file__),
+                                                   "..", ".."))
+GEN_DELTA = os.path.join(RIOTBASE, "dist", "tools", "riotboot_delta",
+                         "gen_delta.py")
+
+HDR_LEN = 0x100
+IMAGE_LEN = 3000
+# cpu_get_image_baseaddr() of native, the first slot holding an image
+# starting there is the running one
+NATIVE_IMAGE_BASEADDR = 0x0
+# the update goes to the other slot
+SLOT1_OFFSET = 0x2000
+
+
+def fletcher32(data):
+    sum1, sum2 = 0xffff, 0xffff
+    for (word,) in struct.iter_unpack("<H", data):
+        sum1 = (sum1 + word) % 0xffff
+        sum2 = (sum2 + sum1) % 0xffff
+    return (sum2 << 16) | sum1
+
+
+def riotboot_hdr(version, start_addr):
+    hdr = struct.pack("<4sII", b"RIOT", version, start_addr)
+    hdr += struct.pack("<I", fletcher32(hdr))
+    return hdr.ljust(HDR_LEN, b"\0")
+
+
+def main(outdir):
+    rand = random.Random(23)
+    firmware = bytearray(rand.getrandbits(8) for _ in range(IMAGE_LEN))
+    running = riotboot_hdr(1, NATIVE_IMAGE_BASEADDR) + firmware
+
+    firmware[1000:1000] = bytes(rand.getrandbits(8) for _ in range(100))
+    update = riotboot_hdr(2, SLOT1_OFFSET + HDR_LEN) + firmware
+
+    with open(os.path.join(outdir, "running.bin"), "wb") as f:
+        f.write(running)
+    with open(os.path.join(outdir, "update.bin"), "wb") as f:
+        f.write(update)
+
+    subprocess.check_call([GEN_DELTA,
+                           os.path.join(outdir, "running.bin"),
+                           os.path.join(outdir, "update.bin"),
+                           os.path.join(outdir, "patch.bin")])
+
+
+if __name__ == "__main__":
+    main(sys.argv[1])
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the riotboot flashwrite SUIT storage backend
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "hashes/sha256.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/slot.h"
+#include "suit.h"
+#include "suit/storage.h"
+
+#define TEST_DELTA_INCLUDE(file) <blob/bin/BOARD_NAME_UNQ/delta/file>
+
+/* cppcheck-suppress preprocessorErrorDirective
+ * (reason: board-dependent include paths) */
+#include TEST_DELTA_INCLUDE(running.bin.h)
+#include TEST_DELTA_INCLUDE(update.bin.h)
+#include TEST_DELTA_INCLUDE(patch.bin.h)
+
+#define IMAGE_LEN       (1000U)
+/* the payload is received in chunks of about the size of a CoAP block */
+#define CHUNK_LEN       (64U)
+
+/* running.bin starts at the image base address of native, so the first slot
+ * holding it is the running one */
+#define RUNNING_SLOT    (0)
+
+static uint8_t image[IMAGE_LEN];
+static suit_manifest_t manifest;
+static suit_storage_t *storage;
+
+static int _write(const uint8_t *data, size_t len)
+{
+    for (size_t offset = 0; offset < len; offset += CHUNK_LEN) {
+        size_t n = len - offset < CHUNK_LEN ? len - offset : CHUNK_LEN;
+        int res = suit_storage_write(storage, &manifest, data + offset,
+                                     offset, n);
+        if (res != SUIT_OK) {
+            return res;
+        }
+    }
+    return SUIT_OK;
+}
+
+static void setUp(void)
+{
+    memcpy(image, "RIOT", 4);
+    for (unsigned i = 4; i < IMAGE_LEN; i++) {
+        image[i] = i * 7;
+    }
+
+    /* a component without parameters, the payload isn't compressed */
+    memset(&manifest, 0, sizeof(manifest));
+    storage = suit_storage_find_by_id("");
+    TEST_ASSERT_NOT_NULL(storage);
+}
+
+static void test_suit_storage_flashwrite_sha256(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t stored[SHA256_DIGEST_LENGTH];
+    size_t len;
+
+    sha256(image, sizeof(image), digest);
+
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_start(storage, &manifest,
+                                                      sizeof(image)));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, _write(image, sizeof(image)));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_finish(storage, &manifest));
+
+    /* condition-image-match asks for the digest in the install and in the
+     * validate sequence */
+    for (unsigned i = 0; i < 2; i++) {
+        memset(stored, 0, sizeof(stored));
+        len = 0;
+        TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_sha256(storage, stored,
+                                                           &len));
+        TEST_ASSERT_EQUAL_INT(sizeof(image), len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(digest, stored, sizeof(digest)));
+    }
+}
+
+static void test_suit_storage_flashwrite_beyond_size(void)
+{
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_start(storage, &manifest,
+                                                      sizeof(image) - 1));
+    TEST_ASSERT_EQUAL_INT(SUIT_ERR_STORAGE_EXCEEDED,
+                          _write(image, sizeof(image)));
+}
+
+static void test_suit_storage_flashwrite_incomplete(void)
+{
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_start(storage, &manifest,
+                                                      sizeof(image)));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, _write(image, sizeof(image) - CHUNK_LEN));
+    TEST_ASSERT_EQUAL_INT(SUIT_ERR_STORAGE,
+                          suit_storage_finish(storage, &manifest));
+}
+
+static int _install_running(void)
+{
+    const size_t skip = RIOTBOOT_FLASHWRITE_SKIPLEN;
+    riotboot_flashwrite_t writer;
+
+    int res = riotboot_flashwrite_init(&writer, RUNNING_SLOT);
+    if (res == 0) {
+        res = riotboot_flashwrite_putbytes(&writer, running_bin + skip,
+                                           running_bin_len - skip, false);
+    }
+    if (res == 0) {
+        res = riotboot_flashwrite_finish(&writer);
+    }
+    return res;
+}
+
+static void test_suit_storage_flashwrite_patch(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t stored[SHA256_DIGEST_LENGTH];
+    size_t len = 0;
+
+    /* the patch applies to the image in the running slot */
+    TEST_ASSERT_EQUAL_INT(0, _install_running());
+    TEST_ASSERT_EQUAL_INT(RUNNING_SLOT, riotboot_slot_current());
+
+    sha256(update_bin, update_bin_len, digest);
+
+    /* the payload is told apart from an image by the magic number of the
+     * patch, the size in the manifest is the one of the image */
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_start(storage, &manifest,
+                                                      update_bin_len));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, _write(patch_bin, patch_bin_len));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_finish(storage, &manifest));
+
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_sha256(storage, stored, &len));
+    TEST_ASSERT_EQUAL_INT(update_bin_len, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(digest, stored, sizeof(digest)));
+
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_install(storage, &manifest));
+    const void *target = riotboot_slot_get_hdr(riotboot_slot_other());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(target, update_bin, update_bin_len));
+}
+
+Test *tests_suit_storage_flashwrite(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_suit_storage_flashwrite_sha256),
+        new_TestFixture(test_suit_storage_flashwrite_beyond_size),
+        new_TestFixture(test_suit_storage_flashwrite_incomplete),
+        new_TestFixture(test_suit_storage_flashwrite_patch),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_storage_flashwrite_tests, setUp, NULL, fixtures);
+
+    return (Test *)&suit_storage_flashwrite_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_suit_storage_flashwrite());
+    TESTS_END();
+    return 0;
+}
@@ -16,6 +16,7 @@ int main(void)
     TESTS_RUN(tests_crypto_chacha_tests());
     TESTS_RUN(tests_crypto_poly1305_tests());
     TESTS_RUN(tests_crypto_chacha20poly1305_tests());
+    TESTS_RUN(tests_crypto_ed25519_tests());
     TESTS_RUN(tests_crypto_aes_tests());
     TESTS_RUN(tests_crypto_cipher_tests());
     TESTS_RUN(tests_crypto_modes_ccm_tests());
@@ -131,12 +131,43 @@ static void test_crypto_chacha20_tc8(void)
                         TC8_CHACHA20_BLOCK0, TC8_CHACHA20_BLOCK1);
 }
 
+/* Cross-check the multi-block keystream against the single-block one */
+static void _test_crypto_chacha_blocks(unsigned rounds, uint32_t counter)
+{
+    static uint8_t multi[(2 * CONFIG_CRYPTO_CHACHA_SIMD_LANES + 3) * 64];
+    chacha_ctx ctx_single, ctx_multi;
+    uint8_t block[64];
+
+    TEST_ASSERT_EQUAL_INT(0, chacha_init(&ctx_single, rounds, TC8_KEY, 16,
+                                         TC8_IV));
+    ctx_single.state[12] = counter;
+    memcpy(&ctx_multi, &ctx_single, sizeof(ctx_multi));
+
+    chacha_keystream_blocks(&ctx_multi, multi, sizeof(multi) / 64);
+    for (unsigned i = 0; i < sizeof(multi) / 64; i++) {
+        chacha_keystream_bytes(&ctx_single, block);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(block, &multi[64 * i], 64));
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ctx_single.state, ctx_multi.state,
+                                    sizeof(ctx_single.state)));
+}
+
+static void test_crypto_chacha_blocks(void)
+{
+    _test_crypto_chacha_blocks(8, 0);
+    _test_crypto_chacha_blocks(12, 0);
+    _test_crypto_chacha_blocks(20, 0);
+    /* the block counter wraps into the upper word within a batch */
+    _test_crypto_chacha_blocks(20, UINT32_MAX - 1);
+}
+
 Test *tests_crypto_chacha_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha8_tc8),
         new_TestFixture(test_crypto_chacha12_tc8),
         new_TestFixture(test_crypto_chacha20_tc8),
+        new_TestFixture(test_crypto_chacha_blocks),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha_tests, NULL, NULL, fixtures);
     return (Test *)&crypto_chacha_tests;
@@ -76,10 +76,66 @@ static void test_crypto_chacha20poly1305_1(void)
     _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1));
 }
 
+static void _test_chacha20poly1305_stream(size_t chunk)
+{
+    chacha20poly1305_stream_ctx_t ctx;
+
+    chacha20poly1305_stream_init(&ctx, key_1, nonce_1);
+    for (size_t pos = 0; pos < sizeof(aad_1); pos += chunk) {
+        size_t n = (sizeof(aad_1) - pos < chunk) ? sizeof(aad_1) - pos : chunk;
+        chacha20poly1305_stream_aad(&ctx, aad_1 + pos, n);
+    }
+    for (size_t pos = 0; pos < sizeof(msg_1); pos += chunk) {
+        size_t n = (sizeof(msg_1) - pos < chunk) ? sizeof(msg_1) - pos : chunk;
+        chacha20poly1305_stream_encrypt(&ctx, ebuf + pos, msg_1 + pos, n);
+    }
+    chacha20poly1305_stream_finish(&ctx, ebuf + sizeof(msg_1));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, ciphertext_1, sizeof(ciphertext_1)));
+
+    /* in-place decryption */
+    chacha20poly1305_stream_init(&ctx, key_1, nonce_1);
+    for (size_t pos = 0; pos < sizeof(aad_1); pos += chunk) {
+        size_t n = (sizeof(aad_1) - pos < chunk) ? sizeof(aad_1) - pos : chunk;
+        chacha20poly1305_stream_aad(&ctx, aad_1 + pos, n);
+    }
+    for (size_t pos = 0; pos < sizeof(msg_1); pos += chunk) {
+        size_t n = (sizeof(msg_1) - pos < chunk) ? sizeof(msg_1) - pos : chunk;
+        chacha20poly1305_stream_decrypt(&ctx, ebuf + pos, ebuf + pos, n);
+    }
+    TEST_ASSERT_EQUAL_INT(1, chacha20poly1305_stream_verify(&ctx,
+                                                 ciphertext_1 + sizeof(msg_1)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, msg_1, sizeof(msg_1)));
+}
+
+static void test_crypto_chacha20poly1305_stream(void)
+{
+    _test_chacha20poly1305_stream(1);
+    _test_chacha20poly1305_stream(5);
+    _test_chacha20poly1305_stream(16);
+    _test_chacha20poly1305_stream(64);
+    _test_chacha20poly1305_stream(sizeof(msg_1));
+}
+
+static void test_crypto_chacha20poly1305_stream_tampered(void)
+{
+    chacha20poly1305_stream_ctx_t ctx;
+
+    memcpy(ebuf, ciphertext_1, sizeof(ciphertext_1));
+    ebuf[3] ^= 0x01;
+
+    chacha20poly1305_stream_init(&ctx, key_1, nonce_1);
+    chacha20poly1305_stream_aad(&ctx, aad_1, sizeof(aad_1));
+    chacha20poly1305_stream_decrypt(&ctx, pbuf, ebuf, sizeof(msg_1));
+    TEST_ASSERT_EQUAL_INT(0, chacha20poly1305_stream_verify(&ctx,
+                                                 ebuf + sizeof(msg_1)));
+}
+
 Test *tests_crypto_chacha20poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha20poly1305_1),
+        new_TestFixture(test_crypto_chacha20poly1305_stream),
+        new_TestFixture(test_crypto_chacha20poly1305_stream_tampered),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha20poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_chacha20poly1305_tests;
@@ -60,6 +60,28 @@ static void test_crypto_cipher_aes_decrypt(void)
     TEST_ASSERT_MESSAGE(1 == cmp, "wrong plaintext");
 }
 
+static void test_crypto_cipher_aes_encrypt_blocks(void)
+{
+    cipher_t cipher;
+    int err, cmp;
+    uint8_t data[3 * 16];
+
+    err = cipher_init(&cipher, CIPHER_AES_128, TEST_KEY, 16);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    /* encrypt in place */
+    for (unsigned i = 0; i < 3; i++) {
+        memcpy(&data[i * 16], TEST_INP, 16);
+    }
+    err = cipher_encrypt_blocks(&cipher, data, data, 3);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    for (unsigned i = 0; i < 3; i++) {
+        cmp = compare(TEST_ENC_AES, &data[i * 16], 16);
+        TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+    }
+}
+
 static void test_crypto_cipher_init_aes_key_length(void)
 {
     cipher_t cipher;
@@ -99,6 +121,7 @@ Test *tests_crypto_cipher_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_cipher_aes_encrypt),
         new_TestFixture(test_crypto_cipher_aes_decrypt),
+        new_TestFixture(test_crypto_cipher_aes_encrypt_blocks),
         new_TestFixture(test_crypto_cipher_init_aes_key_length),
     };
 
@@ -0,0 +1,255 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+#include "kernel_defines.h"
+#include "tests-crypto.h"
+
+#include "crypto/ed25519.h"
+
+/* test vectors 1 to 3 of RFC 8032, section 7.1 */
+static const uint8_t msg_2[] = { 0x72 };
+static const uint8_t msg_3[] = { 0xaf, 0x82 };
+
+static const uint8_t pk_1[] = {
+    0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7,
+    0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a,
+    0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25,
+    0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a,
+};
+
+static const uint8_t sig_1[] = {
+    0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72,
+    0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+    0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+    0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+    0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac,
+    0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+    0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
+    0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b,
+};
+
+static const uint8_t pk_2[] = {
+    0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a,
+    0x92, 0xb7, 0x0a, 0xa7, 0x4d, 0x1b, 0x7e, 0xbc,
+    0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4, 0x96, 0x8c,
+    0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c,
+};
+
+static const uint8_t sig_2[] = {
+    0x92, 0xa0, 0x09, 0xa9, 0xf0, 0xd4, 0xca, 0xb8,
+    0x72, 0x0e, 0x82, 0x0b, 0x5f, 0x64, 0x25, 0x40,
+    0xa2, 0xb2, 0x7b, 0x54, 0x16, 0x50, 0x3f, 0x8f,
+    0xb3, 0x76, 0x22, 0x23, 0xeb, 0xdb, 0x69, 0xda,
+    0x08, 0x5a, 0xc1, 0xe4, 0x3e, 0x15, 0x99, 0x6e,
+    0x45, 0x8f, 0x36, 0x13, 0xd0, 0xf1, 0x1d, 0x8c,
+    0x38, 0x7b, 0x2e, 0xae, 0xb4, 0x30, 0x2a, 0xee,
+    0xb0, 0x0d, 0x29, 0x16, 0x12, 0xbb, 0x0c, 0x00,
+};
+
+static const uint8_t pk_3[] = {
+    0xfc, 0x51, 0xcd, 0x8e, 0x62, 0x18, 0xa1, 0xa3,
+    0x8d, 0xa4, 0x7e, 0xd0, 0x02, 0x30, 0xf0, 0x58,
+    0x08, 0x16, 0xed, 0x13, 0xba, 0x33, 0x03, 0xac,
+    0x5d, 0xeb, 0x91, 0x15, 0x48, 0x90, 0x80, 0x25,
+};
+
+static const uint8_t sig_3[] = {
+    0x62, 0x91, 0xd6, 0x57, 0xde, 0xec, 0x24, 0x02,
+    0x48, 0x27, 0xe6, 0x9c, 0x3a, 0xbe, 0x01, 0xa3,
+    0x0c, 0xe5, 0x48, 0xa2, 0x84, 0x74, 0x3a, 0x44,
+    0x5e, 0x36, 0x80, 0xd7, 0xdb, 0x5a, 0xc3, 0xac,
+    0x18, 0xff, 0x9b, 0x53, 0x8d, 0x16, 0xf2, 0x90,
+    0xae, 0x67, 0xf7, 0x60, 0x98, 0x4d, 0xc6, 0x59,
+    0x4a, 0x7c, 0x15, 0xe9, 0x71, 0x6e, 0xd2, 0x8d,
+    0xc0, 0x27, 0xbe, 0xce, 0xea, 0x1e, 0xc4, 0x0a,
+};
+
+static const uint8_t sig_1_a[] = {
+    0x26, 0x12, 0x0e, 0x24, 0x3c, 0x1a, 0x75, 0xaa,
+    0xad, 0x19, 0xa5, 0x63, 0x20, 0x7a, 0xb3, 0x87,
+    0x6e, 0x2c, 0x08, 0xb9, 0x1b, 0x79, 0xd6, 0x89,
+    0x03, 0x52, 0x1d, 0x4d, 0x05, 0xa9, 0xb7, 0xc2,
+    0x86, 0xab, 0xad, 0xda, 0x34, 0x7c, 0xe3, 0x8a,
+    0x37, 0xb1, 0x5e, 0xc2, 0xea, 0xc0, 0x6d, 0x47,
+    0x8e, 0x42, 0x98, 0x8f, 0x53, 0xef, 0x2e, 0x24,
+    0x05, 0x7c, 0x38, 0xff, 0x3e, 0xae, 0x27, 0x0e,
+};
+
+static const uint8_t sig_1_b[] = {
+    0xcc, 0xd4, 0xf9, 0xe7, 0x49, 0x67, 0xc4, 0xa1,
+    0xb0, 0x61, 0x28, 0xa7, 0x38, 0x5f, 0x91, 0x4f,
+    0xe4, 0x96, 0x85, 0xd5, 0x91, 0x16, 0x36, 0x8e,
+    0xce, 0x85, 0xfe, 0xd9, 0x3a, 0x3b, 0x24, 0xf6,
+    0x15, 0x38, 0x5e, 0xc6, 0xc3, 0x75, 0xe8, 0x5b,
+    0x74, 0x30, 0xc3, 0x74, 0xec, 0x5d, 0xe9, 0x48,
+    0x46, 0xec, 0xfa, 0xe4, 0x36, 0x11, 0x76, 0x8a,
+    0x5e, 0x1e, 0x35, 0x57, 0xe8, 0xdd, 0x11, 0x08,
+};
+
+static const uint8_t sig_1_c[] = {
+    0x45, 0x69, 0xe4, 0xd3, 0x7e, 0xe4, 0xef, 0xc1,
+    0x20, 0x54, 0x95, 0x70, 0x59, 0x1b, 0x32, 0x98,
+    0x4b, 0x2b, 0x98, 0x4b, 0x1e, 0x68, 0x50, 0x33,
+    0xdf, 0xce, 0xc2, 0xee, 0x46, 0x8a, 0x2f, 0xf8,
+    0x33, 0x7e, 0x76, 0xea, 0x38, 0x4e, 0xc4, 0x14,
+    0x7b, 0xd2, 0x2b, 0xd4, 0x6d, 0x81, 0x46, 0xc6,
+    0xe9, 0x29, 0x4e, 0xc7, 0xbb, 0x50, 0xd6, 0x1a,
+    0xa3, 0xeb, 0xc2, 0x3a, 0x89, 0x16, 0xcd, 0x0f,
+};
+
+static const uint8_t sig_1_noncanonical[] = {
+    0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72,
+    0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+    0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+    0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+    0x4c, 0x8c, 0x78, 0x72, 0xaa, 0x06, 0x4e, 0x04,
+    0x9d, 0xbb, 0x30, 0x13, 0xfb, 0xf2, 0x93, 0x80,
+    0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
+    0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x1b,
+};
+
+/* messages of sig_1_a to sig_1_c, signed with the key of test vector 1 */
+static const char msg_1_a[] = "RIOT";
+static const char msg_1_b[] = "SUIT manifest";
+static const char msg_1_c[] = "Ed25519 batch";
+
+static ed25519_key_t key;
+
+static void test_crypto_ed25519_verify(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify(sig_1, NULL, 0, pk_1));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify(sig_2, msg_2, sizeof(msg_2), pk_2));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify(sig_3, msg_3, sizeof(msg_3), pk_3));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify(sig_1_b, msg_1_b,
+                                            strlen(msg_1_b), pk_1));
+}
+
+static void test_crypto_ed25519_verify_invalid(void)
+{
+    uint8_t buf[ED25519_SIGNATURE_BYTES];
+
+    /* wrong message or key */
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify(sig_2, msg_3,
+                                                   sizeof(msg_2), pk_2));
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify(sig_2, msg_2,
+                                                   sizeof(msg_2), pk_3));
+    /* modified R and S */
+    memcpy(buf, sig_3, sizeof(buf));
+    buf[5] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify(buf, msg_3, sizeof(msg_3),
+                                                   pk_3));
+    memcpy(buf, sig_3, sizeof(buf));
+    buf[40] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify(buf, msg_3, sizeof(msg_3),
+                                                   pk_3));
+    /* S + L instead of S */
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify(sig_1_noncanonical, NULL, 0,
+                                                   pk_1));
+    /* y = 2^255 - 1 is not a canonical encoding */
+    memset(buf, 0xff, ED25519_PUBLIC_KEY_BYTES);
+    buf[31] = 0x7f;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ed25519_verify(sig_1, NULL, 0, buf));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ed25519_key_init(&key, buf));
+}
+
+static void test_crypto_ed25519_verify_key(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, ed25519_key_init(&key, pk_1));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify_key(&key, sig_1, NULL, 0));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify_key(&key, sig_1_a, msg_1_a,
+                                                strlen(msg_1_a)));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify_key(&key, sig_1_c, msg_1_c,
+                                                strlen(msg_1_c)));
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify_key(&key, sig_1_a, msg_1_b,
+                                                       strlen(msg_1_b)));
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify_key(&key, sig_2, msg_2,
+                                                       sizeof(msg_2)));
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify_key(&key,
+                                                       sig_1_noncanonical,
+                                                       NULL, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, ed25519_key_init(&key, pk_3));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify_key(&key, sig_3, msg_3,
+                                                sizeof(msg_3)));
+}
+
+static void test_crypto_ed25519_verify_batch(void)
+{
+    uint8_t buf[ED25519_SIGNATURE_BYTES];
+    ed25519_batch_entry_t entries[] = {
+        { sig_1, NULL, 0, pk_1, NULL },
+        { sig_2, msg_2, sizeof(msg_2), pk_2, NULL },
+        { sig_1_a, msg_1_a, sizeof(msg_1_a) - 1, pk_1, NULL },
+        { sig_3, msg_3, sizeof(msg_3), NULL, &key },
+        { sig_1_b, msg_1_b, sizeof(msg_1_b) - 1, pk_1, NULL },
+        { sig_1_c, msg_1_c, sizeof(msg_1_c) - 1, pk_1, NULL },
+    };
+    const unsigned num = ARRAY_SIZE(entries);
+
+    TEST_ASSERT_EQUAL_INT(0, ed25519_key_init(&key, pk_3));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify_batch(entries, 0));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify_batch(entries, 1));
+    TEST_ASSERT_EQUAL_INT(0, ed25519_verify_batch(entries, num));
+
+    /* each signature is detected in any position */
+    for (unsigned i = 0; i < num; i++) {
+        const uint8_t *sig = entries[i].sig;
+
+        memcpy(buf, sig, sizeof(buf));
+        buf[(7 * i) % sizeof(buf)] ^= 0x04;
+        entries[i].sig = buf;
+        TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify_batch(entries, num));
+        entries[i].sig = sig;
+    }
+
+    /* swapped messages of the same key */
+    entries[4].msg = msg_1_c;
+    entries[5].msg = msg_1_b;
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify_batch(entries, num));
+}
+
+static void test_crypto_ed25519_verify_batch_distinct_keys(void)
+{
+    /* every chunk of up to three signatures has a different key per entry,
+     * so each signature adds both its R and its key to the chunk */
+    ed25519_batch_entry_t entries[] = {
+        { sig_1, NULL, 0, pk_1, NULL },
+        { sig_2, msg_2, sizeof(msg_2), pk_2, NULL },
+        { sig_3, msg_3, sizeof(msg_3), pk_3, NULL },
+        { sig_1_a, msg_1_a, sizeof(msg_1_a) - 1, pk_1, NULL },
+        { sig_2, msg_2, sizeof(msg_2), pk_2, NULL },
+        { sig_3, msg_3, sizeof(msg_3), pk_3, NULL },
+    };
+    const unsigned num = ARRAY_SIZE(entries);
+
+    for (unsigned i = 1; i <= num; i++) {
+        TEST_ASSERT_EQUAL_INT(0, ed25519_verify_batch(entries, i));
+    }
+
+    entries[num - 1].msg = msg_2;
+    entries[num - 1].len = sizeof(msg_2);
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, ed25519_verify_batch(entries, num));
+}
+
+Test *tests_crypto_ed25519_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_crypto_ed25519_verify),
+        new_TestFixture(test_crypto_ed25519_verify_invalid),
+        new_TestFixture(test_crypto_ed25519_verify_key),
+        new_TestFixture(test_crypto_ed25519_verify_batch),
+        new_TestFixture(test_crypto_ed25519_verify_batch_distinct_keys),
+    };
+    EMB_UNIT_TESTCALLER(crypto_ed25519_tests, NULL, NULL, fixtures);
+    return (Test *) &crypto_ed25519_tests;
+}
@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include "embUnit.h"
+#include "kernel_defines.h"
 #include "crypto/ciphers.h"
 #include "crypto/modes/ccm.h"
 #include "tests-crypto.h"
@@ -1254,6 +1255,131 @@ static void test_crypto_modes_ccm_decrypt(void)
     do_test_decrypt_op(CUSTOM_1);
 }
 
+/* Feed the incremental API in chunks of the given size */
+static void test_stream_op(const uint8_t *key, uint8_t key_len,
+                           const uint8_t *adata, size_t adata_len,
+                           const uint8_t *nonce, uint8_t nonce_len,
+                           const uint8_t *plain, size_t plain_len,
+                           const uint8_t *output_expected,
+                           size_t output_expected_len,
+                           uint8_t mac_length, size_t chunk)
+{
+    cipher_t cipher;
+    cipher_ccm_ctx_t ctx;
+    int err;
+    size_t len_encoding = nonce_and_len_encoding_size - nonce_len;
+
+    TEST_ASSERT_MESSAGE(sizeof(data) >= output_expected_len,
+                        "Output buffer too small");
+    TEST_ASSERT_EQUAL_INT(plain_len + mac_length, output_expected_len);
+
+    err = cipher_init(&cipher, CIPHER_AES_128, key, key_len);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    /* encryption */
+    err = cipher_ccm_init(&ctx, &cipher, adata_len, mac_length, len_encoding,
+                          nonce, nonce_len, plain_len);
+    TEST_ASSERT_EQUAL_INT(0, err);
+    for (size_t pos = 0; pos < adata_len; pos += chunk) {
+        size_t n = (adata_len - pos < chunk) ? adata_len - pos : chunk;
+        TEST_ASSERT_EQUAL_INT(0, cipher_ccm_update_aad(&ctx, adata + pos, n));
+    }
+    for (size_t pos = 0; pos < plain_len; pos += chunk) {
+        size_t n = (plain_len - pos < chunk) ? plain_len - pos : chunk;
+        TEST_ASSERT_EQUAL_INT(n, cipher_ccm_encrypt_update(&ctx, plain + pos,
+                                                           n, data + pos));
+    }
+    err = cipher_ccm_encrypt_finish(&ctx, data + plain_len);
+    TEST_ASSERT_EQUAL_INT(mac_length, err);
+    TEST_ASSERT_MESSAGE(1 == compare(output_expected, data,
+                                     output_expected_len),
+                        "wrong ciphertext");
+
+    /* in-place decryption */
+    err = cipher_ccm_init(&ctx, &cipher, adata_len, mac_length, len_encoding,
+                          nonce, nonce_len, plain_len);
+    TEST_ASSERT_EQUAL_INT(0, err);
+    for (size_t pos = 0; pos < adata_len; pos += chunk) {
+        size_t n = (adata_len - pos < chunk) ? adata_len - pos : chunk;
+        TEST_ASSERT_EQUAL_INT(0, cipher_ccm_update_aad(&ctx, adata + pos, n));
+    }
+    for (size_t pos = 0; pos < plain_len; pos += chunk) {
+        size_t n = (plain_len - pos < chunk) ? plain_len - pos : chunk;
+        TEST_ASSERT_EQUAL_INT(n, cipher_ccm_decrypt_update(&ctx, data + pos,
+                                                           n, data + pos));
+    }
+    err = cipher_ccm_decrypt_finish(&ctx, output_expected + plain_len);
+    TEST_ASSERT_EQUAL_INT(0, err);
+    TEST_ASSERT_MESSAGE(1 == compare(plain, data, plain_len),
+                        "wrong plaintext");
+}
+
+#define do_test_stream_op(name, chunk) do { \
+        test_stream_op(TEST_ ## name ## _KEY, TEST_ ## name ## _KEY_LEN, \
+                       TEST_ ## name ## _INPUT, TEST_ ## name ## _ADATA_LEN, \
+                       TEST_ ## name ## _NONCE, TEST_ ## name ## _NONCE_LEN, \
+                    \
+                       TEST_ ## name ## _INPUT + TEST_ ## name ## _ADATA_LEN, \
+                       TEST_ ## name ## _INPUT_LEN, \
+                    \
+                       TEST_ ## name ## _EXPECTED + TEST_ ## name ## _ADATA_LEN, \
+                       TEST_ ## name ## _EXPECTED_LEN - TEST_ ## name ## _ADATA_LEN, \
+                    \
+                       TEST_ ## name ## _MAC_LEN, chunk \
+                       ); \
+} while (0)
+
+static void test_crypto_modes_ccm_stream(void)
+{
+    static const size_t chunks[] = { 1, 7, 16, 33, 512 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        do_test_stream_op(RFC_1, chunks[i]);
+        do_test_stream_op(RFC_13, chunks[i]);
+        do_test_stream_op(RFC_24, chunks[i]);
+        do_test_stream_op(NIST_1, chunks[i]);
+        do_test_stream_op(NIST_3, chunks[i]);
+        do_test_stream_op(WYCHEPROOF_28, chunks[i]);
+        do_test_stream_op(MANUAL_01, chunks[i]);
+        do_test_stream_op(CUSTOM_1, chunks[i]);
+    }
+}
+
+static void test_crypto_modes_ccm_stream_errors(void)
+{
+    cipher_t cipher;
+    cipher_ccm_ctx_t ctx;
+    uint8_t key[16] = { 0 };
+    uint8_t nonce[13] = { 0 };
+    uint8_t buf[16] = { 0 };
+
+    cipher_init(&cipher, CIPHER_AES_128, key, sizeof(key));
+
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_MAC_LENGTH,
+                          cipher_ccm_init(&ctx, &cipher, 0, 7, 2,
+                                          nonce, sizeof(nonce), 8));
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_ccm_init(&ctx, &cipher, 0xFEFF + 1, 8, 2,
+                                          nonce, sizeof(nonce), 8));
+
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_init(&ctx, &cipher, 4, 8, 2,
+                                             nonce, sizeof(nonce), 8));
+    /* payload before the adata is complete */
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_ccm_encrypt_update(&ctx, buf, 8, buf));
+    /* more adata than declared */
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_ccm_update_aad(&ctx, buf, 5));
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_update_aad(&ctx, buf, 4));
+    /* more payload than declared */
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_ccm_encrypt_update(&ctx, buf, 9, buf));
+    TEST_ASSERT_EQUAL_INT(4, cipher_ccm_encrypt_update(&ctx, buf, 4, buf));
+    /* less payload than declared */
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH,
+                          cipher_ccm_encrypt_finish(&ctx, buf + 8));
+}
+
 
 typedef int (*func_ccm_t)(const cipher_t *, const uint8_t *, uint32_t,
                           uint8_t, uint8_t, const uint8_t *, size_t,
@@ -1336,6 +1462,8 @@ Test *tests_crypto_modes_ccm_tests(void)
         new_TestFixture(test_crypto_modes_ccm_encrypt),
         new_TestFixture(test_crypto_modes_ccm_decrypt),
         new_TestFixture(test_crypto_modes_ccm_check_len),
+        new_TestFixture(test_crypto_modes_ccm_stream),
+        new_TestFixture(test_crypto_modes_ccm_stream_errors),
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ccm_tests, NULL, NULL, fixtures);
@@ -275,6 +275,35 @@ static void test_crypto_poly1305_11(void)
     _test_poly1305(key_11, msg_11, sizeof(msg_11), tag_11);
 }
 
+/* Feed the message in chunks, mixing whole and partial blocks */
+static void _test_poly1305_chunked(const uint8_t *key, const uint8_t *msg,
+                                   size_t msglen, const uint8_t *tag,
+                                   size_t chunk)
+{
+    poly1305_ctx_t ctx;
+    uint8_t gen_tag[16];
+
+    poly1305_init(&ctx, key);
+    for (size_t pos = 0; pos < msglen; pos += chunk) {
+        poly1305_update(&ctx, msg + pos,
+                        (msglen - pos < chunk) ? msglen - pos : chunk);
+    }
+    poly1305_finish(&ctx, gen_tag);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(gen_tag, tag, sizeof(gen_tag)));
+}
+
+static void test_crypto_poly1305_chunked(void)
+{
+    static const size_t chunks[] = { 1, 5, 16, 17, 33 };
+
+    for (unsigned i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        _test_poly1305_chunked(key_2, msg_2, sizeof(msg_2), tag_2, chunks[i]);
+        _test_poly1305_chunked(key_3, msg_3, sizeof(msg_3), tag_3, chunks[i]);
+        _test_poly1305_chunked(key_11, msg_11, sizeof(msg_11), tag_11,
+                               chunks[i]);
+    }
+}
+
 Test *tests_crypto_poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -289,6 +318,7 @@ Test *tests_crypto_poly1305_tests(void)
         new_TestFixture(test_crypto_poly1305_9),
         new_TestFixture(test_crypto_poly1305_10),
         new_TestFixture(test_crypto_poly1305_11),
+        new_TestFixture(test_crypto_poly1305_chunked),
     };
     EMB_UNIT_TESTCALLER(crypto_poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_poly1305_tests;
@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Tests for the asynchronous crypto job API
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "crypto/aes.h"
+#include "crypto/async.h"
+#include "crypto/chacha20poly1305.h"
+#include "crypto/modes/ccm.h"
+#include "hashes/sha256.h"
+
+/* FIPS-197, appendix C.1 */
+static const uint8_t aes_key[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+static const uint8_t aes_plain[] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+};
+static const uint8_t aes_cipher[] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a,
+};
+
+/* FIPS 180-2, appendix B.1 */
+static const uint8_t sha256_abc[] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+    0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+    0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+    0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+};
+
+static const uint8_t aead_key[CHACHA20POLY1305_KEY_BYTES] = { 0x42 };
+static const uint8_t aead_nonce[CHACHA20POLY1305_NONCE_BYTES] = { 0x23 };
+static const uint8_t aead_aad[] = "header";
+static const uint8_t msg[] = "The quick brown fox jumps over the lazy dog";
+
+static cipher_t cipher;
+static crypto_job_t job;
+
+static unsigned cb_calls;
+static int cb_result;
+
+static void _cb(crypto_job_t *j, void *arg)
+{
+    (void)arg;
+    cb_calls++;
+    cb_result = j->result;
+}
+
+static void _cipher_job(crypto_job_t *j, crypto_job_op_t op,
+                        const uint8_t *in, uint8_t *out, size_t len)
+{
+    memset(j, 0, sizeof(*j));
+    j->op = op;
+    j->params.cipher.cipher = &cipher;
+    j->params.cipher.input = in;
+    j->params.cipher.output = out;
+    j->params.cipher.len = len;
+}
+
+static void setup(void)
+{
+    cipher_init(&cipher, CIPHER_AES_128, aes_key, sizeof(aes_key));
+    cb_calls = 0;
+    cb_result = 0;
+}
+
+static void test_crypto_async_cipher(void)
+{
+    uint8_t out[2 * AES_BLOCK_SIZE];
+    uint8_t in[2 * AES_BLOCK_SIZE];
+
+    memcpy(in, aes_plain, AES_BLOCK_SIZE);
+    memcpy(in + AES_BLOCK_SIZE, aes_plain, AES_BLOCK_SIZE);
+
+    _cipher_job(&job, CRYPTO_JOB_CIPHER_ENCRYPT, in, out, sizeof(in));
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(in), crypto_job_wait(&job));
+    TEST_ASSERT(crypto_job_is_done(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, aes_cipher, AES_BLOCK_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out + AES_BLOCK_SIZE, aes_cipher,
+                                    AES_BLOCK_SIZE));
+
+    /* in place */
+    _cipher_job(&job, CRYPTO_JOB_CIPHER_DECRYPT, out, out, sizeof(out));
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(out), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, in, sizeof(in)));
+
+    /* partial blocks are rejected */
+    _cipher_job(&job, CRYPTO_JOB_CIPHER_ENCRYPT, in, out, sizeof(in) - 1);
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, crypto_job_wait(&job));
+}
+
+static void test_crypto_async_ccm(void)
+{
+    uint8_t nonce[13] = { 0x01 };
+    uint8_t expected[sizeof(msg) + 8];
+    uint8_t out[sizeof(msg) + 8];
+    uint8_t plain[sizeof(msg)];
+    int len = cipher_encrypt_ccm(&cipher, aead_aad, sizeof(aead_aad), 8, 2,
+                                 nonce, sizeof(nonce), msg, sizeof(msg),
+                                 expected);
+
+    TEST_ASSERT_EQUAL_INT(sizeof(expected), len);
+
+    memset(&job, 0, sizeof(job));
+    job.op = CRYPTO_JOB_CCM_ENCRYPT;
+    job.params.ccm = (crypto_job_ccm_t){
+        .cipher = &cipher,
+        .auth_data = aead_aad,
+        .auth_data_len = sizeof(aead_aad),
+        .mac_length = 8,
+        .length_encoding = 2,
+        .nonce = nonce,
+        .nonce_len = sizeof(nonce),
+        .input = msg,
+        .input_len = sizeof(msg),
+        .output = out,
+    };
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(len, crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, out, len));
+
+    job.op = CRYPTO_JOB_CCM_DECRYPT;
+    job.params.ccm.input = out;
+    job.params.ccm.input_len = len;
+    job.params.ccm.output = plain;
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(msg), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(msg, plain, sizeof(msg)));
+}
+
+static void test_crypto_async_chacha20poly1305(void)
+{
+    uint8_t expected[sizeof(msg) + CHACHA20POLY1305_TAG_BYTES];
+    uint8_t out[sizeof(msg) + CHACHA20POLY1305_TAG_BYTES];
+    uint8_t plain[sizeof(msg) + CHACHA20POLY1305_TAG_BYTES];
+
+    chacha20poly1305_encrypt(expected, msg, sizeof(msg), aead_aad,
+                             sizeof(aead_aad), aead_key, aead_nonce);
+
+    memset(&job, 0, sizeof(job));
+    job.op = CRYPTO_JOB_CHACHA20POLY1305_ENCRYPT;
+    job.params.aead = (crypto_job_aead_t){
+        .key = aead_key,
+        .nonce = aead_nonce,
+        .aad = aead_aad,
+        .aad_len = sizeof(aead_aad),
+        .input = msg,
+        .input_len = sizeof(msg),
+        .output = out,
+    };
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(out), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, out, sizeof(out)));
+
+    job.op = CRYPTO_JOB_CHACHA20POLY1305_DECRYPT;
+    job.params.aead.input = out;
+    job.params.aead.input_len = sizeof(out);
+    job.params.aead.output = plain;
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(msg), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(msg, plain, sizeof(msg)));
+
+    /* a modified ciphertext fails the authentication */
+    out[0] ^= 1;
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, crypto_job_wait(&job));
+}
+
+static void test_crypto_async_callback(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    memset(&job, 0, sizeof(job));
+    job.op = CRYPTO_JOB_SHA256;
+    job.params.hash.data = "abc";
+    job.params.hash.len = 3;
+    job.params.hash.digest = digest;
+    job.cb = _cb;
+
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(SHA256_DIGEST_LENGTH, crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(1, cb_calls);
+    TEST_ASSERT_EQUAL_INT(SHA256_DIGEST_LENGTH, cb_result);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(sha256_abc, digest, sizeof(digest)));
+}
+
+static void test_crypto_async_batch(void)
+{
+    static crypto_job_t jobs[4];
+    uint8_t out[ARRAY_SIZE(jobs)][AES_BLOCK_SIZE];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(jobs); i++) {
+        _cipher_job(&jobs[i], CRYPTO_JOB_CIPHER_ENCRYPT, aes_plain, out[i],
+                    AES_BLOCK_SIZE);
+        jobs[i].cb = _cb;
+    }
+
+    /* an invalid job rejects the whole batch */
+    jobs[2].op = CRYPTO_JOB_OP_NUMOF;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, crypto_job_submit_batch(jobs,
+                                                           ARRAY_SIZE(jobs)));
+    TEST_ASSERT_EQUAL_INT(0, cb_calls);
+
+    jobs[2].op = CRYPTO_JOB_CIPHER_ENCRYPT;
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit_batch(jobs, ARRAY_SIZE(jobs)));
+    for (unsigned i = 0; i < ARRAY_SIZE(jobs); i++) {
+        TEST_ASSERT_EQUAL_INT(AES_BLOCK_SIZE, crypto_job_wait(&jobs[i]));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(aes_cipher, out[i], AES_BLOCK_SIZE));
+    }
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(jobs), cb_calls);
+}
+
+static unsigned sync_calls;
+static unsigned busy_calls;
+
+/* completes the job right away, like a driver finishing in its ISR */
+static int _sync_submit(crypto_async_backend_t *backend, crypto_job_t *j)
+{
+    (void)backend;
+    sync_calls++;
+    crypto_async_complete(j, crypto_job_execute(j));
+    return 0;
+}
+
+/* never takes a job, like a busy accelerator */
+static int _busy_submit(crypto_async_backend_t *backend, crypto_job_t *j)
+{
+    (void)backend;
+    (void)j;
+    busy_calls++;
+    return -EBUSY;
+}
+
+static crypto_job_t *deferred;
+
+/* keeps the job until the test completes it, like a driver waiting for
+ * its hardware */
+static int _defer_submit(crypto_async_backend_t *backend, crypto_job_t *j)
+{
+    (void)backend;
+    deferred = j;
+    return 0;
+}
+
+static crypto_async_backend_t sync_backend = {
+    .ops = (1UL << CRYPTO_JOB_CIPHER_ENCRYPT),
+    .submit = _sync_submit,
+};
+
+static crypto_async_backend_t busy_backend = {
+    .ops = (1UL << CRYPTO_JOB_CIPHER_ENCRYPT) | (1UL << CRYPTO_JOB_SHA256),
+    .submit = _busy_submit,
+};
+
+static crypto_async_backend_t defer_backend = {
+    .ops = (1UL << CRYPTO_JOB_CIPHER_DECRYPT),
+    .submit = _defer_submit,
+};
+
+static void test_crypto_async_backend(void)
+{
+    uint8_t out[AES_BLOCK_SIZE];
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    crypto_async_register(&sync_backend);
+    crypto_async_register(&busy_backend);
+
+    /* refused by the busy backend, executed by the synchronous one */
+    _cipher_job(&job, CRYPTO_JOB_CIPHER_ENCRYPT, aes_plain, out, sizeof(out));
+    job.cb = _cb;
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT(crypto_job_is_done(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(out), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(aes_cipher, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(1, busy_calls);
+    TEST_ASSERT_EQUAL_INT(1, sync_calls);
+    TEST_ASSERT_EQUAL_INT(1, cb_calls);
+
+    /* not supported by any backend, executed by the worker thread */
+    _cipher_job(&job, CRYPTO_JOB_CIPHER_DECRYPT, aes_cipher, out, sizeof(out));
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(out), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(aes_plain, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(1, busy_calls);
+    TEST_ASSERT_EQUAL_INT(1, sync_calls);
+
+    /* refused by the only capable backend, executed by the worker thread */
+    memset(&job, 0, sizeof(job));
+    job.op = CRYPTO_JOB_SHA256;
+    job.params.hash.data = "abc";
+    job.params.hash.len = 3;
+    job.params.hash.digest = digest;
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(sizeof(digest), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(sha256_abc, digest, sizeof(digest)));
+    TEST_ASSERT_EQUAL_INT(2, busy_calls);
+    TEST_ASSERT_EQUAL_INT(1, sync_calls);
+
+    /* a pending job can't be submitted again */
+    crypto_async_register(&defer_backend);
+    _cipher_job(&job, CRYPTO_JOB_CIPHER_DECRYPT, aes_cipher, out, sizeof(out));
+    TEST_ASSERT_EQUAL_INT(0, crypto_job_submit(&job));
+    TEST_ASSERT(deferred == &job);
+    TEST_ASSERT(!crypto_job_is_done(&job));
+    TEST_ASSERT_EQUAL_INT(-EBUSY, crypto_job_submit(&job));
+    TEST_ASSERT_EQUAL_INT(-EBUSY, crypto_job_submit_batch(&job, 1));
+    crypto_async_complete(deferred, crypto_job_execute(deferred));
+    TEST_ASSERT_EQUAL_INT(sizeof(out), crypto_job_wait(&job));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(aes_plain, out, sizeof(out)));
+}
+
+Test *tests_crypto_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_crypto_async_cipher),
+        new_TestFixture(test_crypto_async_ccm),
+        new_TestFixture(test_crypto_async_chacha20poly1305),
+        new_TestFixture(test_crypto_async_callback),
+        new_TestFixture(test_crypto_async_batch),
+        /* registers backends, has to run last */
+        new_TestFixture(test_crypto_async_backend),
+    };
+
+    EMB_UNIT_TESTCALLER(crypto_async_tests, setup, NULL, fixtures);
+
+    return (Test *)&crypto_async_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_crypto_async_tests());
+    TESTS_END();
+    return 0;
+}
+/** @} */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+#include "kernel_defines.h"
+
+#include "checksum/crc32.h"
+
+#include "tests-checksum.h"
+
+#define CRC32_POLY      (0xEDB88320)
+#define CRC32C_POLY     (0x82F63B78)
+
+/* long enough for the PCLMULQDQ code path, with an odd length */
+#define LONG_LEN        (1000U)
+
+static uint8_t long_buf[LONG_LEN + 1];
+
+static void _fill_long_buf(void)
+{
+    for (unsigned i = 0; i < sizeof(long_buf); i++) {
+        long_buf[i] = i * 7 + 3;
+    }
+}
+
+static void test_checksum_crc32_sequence_empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, crc32_calc("", 0));
+    TEST_ASSERT_EQUAL_INT(0, crc32c_calc("", 0));
+}
+
+static void test_checksum_crc32_sequence_1to9(void)
+{
+    unsigned char buf[] = "123456789";
+
+    TEST_ASSERT_EQUAL_INT(0xCBF43926, crc32_calc(buf, sizeof(buf) - 1));
+    TEST_ASSERT_EQUAL_INT(0xE3069283, crc32c_calc(buf, sizeof(buf) - 1));
+}
+
+static void test_checksum_crc32_sequence_256a(void)
+{
+    unsigned char buf[256];
+
+    memset(buf, 'A', sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(0x49975B13, crc32_calc(buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0xFC55F5E7, crc32c_calc(buf, sizeof(buf)));
+}
+
+static void test_checksum_crc32c_zeros(void)
+{
+    /* RFC 3720, B.4 */
+    unsigned char buf[32] = { 0 };
+
+    TEST_ASSERT_EQUAL_INT(0x8A9136AA, crc32c_calc(buf, sizeof(buf)));
+}
+
+static void test_checksum_crc32_long(void)
+{
+    _fill_long_buf();
+
+    TEST_ASSERT_EQUAL_INT(0x17BC2A46, crc32_calc(long_buf, LONG_LEN));
+    TEST_ASSERT_EQUAL_INT(0xDD2EDFF7, crc32c_calc(long_buf, LONG_LEN));
+}
+
+static void test_checksum_crc32_unaligned(void)
+{
+    uint32_t crc32 = crc32_calc(long_buf, LONG_LEN);
+    uint32_t crc32c = crc32c_calc(long_buf, LONG_LEN);
+
+    /* move the data by one byte */
+    for (unsigned i = LONG_LEN; i > 0; i--) {
+        long_buf[i] = long_buf[i - 1];
+    }
+    TEST_ASSERT_EQUAL_INT(crc32, crc32_calc(long_buf + 1, LONG_LEN));
+    TEST_ASSERT_EQUAL_INT(crc32c, crc32c_calc(long_buf + 1, LONG_LEN));
+}
+
+static void test_checksum_crc32_update(void)
+{
+    static const unsigned chunks[] = { 1, 3, 7, 8, 63, 64, 65, 200 };
+
+    _fill_long_buf();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        uint32_t crc32 = 0;
+        uint32_t crc32c = 0;
+
+        for (unsigned pos = 0; pos < LONG_LEN; pos += chunks[i]) {
+            unsigned len = LONG_LEN - pos;
+
+            if (len > chunks[i]) {
+                len = chunks[i];
+            }
+            crc32 = crc32_update(crc32, long_buf + pos, len);
+            crc32c = crc32c_update(crc32c, long_buf + pos, len);
+        }
+        TEST_ASSERT_EQUAL_INT(0x17BC2A46, crc32);
+        TEST_ASSERT_EQUAL_INT(0xDD2EDFF7, crc32c);
+    }
+}
+
+static void test_checksum_crc32_table(void)
+{
+    static crc32_table_t table;
+
+    _fill_long_buf();
+
+    crc32_table_init(&table, CRC32_POLY);
+    TEST_ASSERT_EQUAL_INT(0x17BC2A46,
+                          ~crc32_table_update(&table, 0xFFFFFFFF, long_buf, LONG_LEN));
+
+    crc32_table_init(&table, CRC32C_POLY);
+    TEST_ASSERT_EQUAL_INT(0xDD2EDFF7,
+                          ~crc32_table_update(&table, 0xFFFFFFFF, long_buf, LONG_LEN));
+}
+
+Test *tests_checksum_crc32_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_checksum_crc32_sequence_empty),
+        new_TestFixture(test_checksum_crc32_sequence_1to9),
+        new_TestFixture(test_checksum_crc32_sequence_256a),
+        new_TestFixture(test_checksum_crc32c_zeros),
+        new_TestFixture(test_checksum_crc32_long),
+        new_TestFixture(test_checksum_crc32_unaligned),
+        new_TestFixture(test_checksum_crc32_update),
+        new_TestFixture(test_checksum_crc32_table),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc32_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc32_tests;
+}
@@ -639,6 +639,69 @@ static void test_nib_ft_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL ,0, &iter_state, &fte));
 }
 
+/*
+ * Emulates a RPL root in storing mode: adds a prefix route and host routes for
+ * many DAO targets behind a few next hops until the off-link table is full,
+ * then deletes every second host route.
+ * Expected result: all host routes resolve to their next hop while they
+ * exist, deleted host routes fall back to the prefix route, and re-adding
+ * them succeeds
+ */
+static void test_nib_ft_add_del__many_host_routes(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    static const ipv6_addr_t def_next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                     { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop = def_next_hop;
+    const unsigned routes = CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx, GLOBAL_PREFIX_LEN,
+                                                  &def_next_hop, IFACE, 0));
+    for (unsigned i = 0; i < routes; i++) {
+        dst.u16[7].u16 = i;
+        next_hop.u8[15] = def_next_hop.u8[15] + (i % 4) + 1;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, IPV6_ADDR_BIT_LEN,
+                                                      &next_hop, IFACE, 0));
+    }
+    for (unsigned i = 0; i < routes; i++) {
+        dst.u16[7].u16 = i;
+        next_hop.u8[15] = def_next_hop.u8[15] + (i % 4) + 1;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT(ipv6_addr_equal(&dst, &fte.dst));
+        TEST_ASSERT_EQUAL_INT(IPV6_ADDR_BIT_LEN, fte.dst_len);
+        TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+    }
+    for (unsigned i = 0; i < routes; i += 2) {
+        dst.u16[7].u16 = i;
+        gnrc_ipv6_nib_ft_del(&dst, IPV6_ADDR_BIT_LEN);
+    }
+    for (unsigned i = 0; i < routes; i++) {
+        dst.u16[7].u16 = i;
+        next_hop.u8[15] = def_next_hop.u8[15] + (i % 4) + 1;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        if (i % 2) {
+            TEST_ASSERT_EQUAL_INT(IPV6_ADDR_BIT_LEN, fte.dst_len);
+            TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+            TEST_ASSERT(ipv6_addr_equal(&def_next_hop, &fte.next_hop));
+        }
+    }
+    for (unsigned i = 0; i < routes; i += 2) {
+        dst.u16[7].u16 = i;
+        next_hop.u8[15] = def_next_hop.u8[15] + (i % 4) + 1;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, IPV6_ADDR_BIT_LEN,
+                                                      &next_hop, IFACE, 0));
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(IPV6_ADDR_BIT_LEN, fte.dst_len);
+        TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+    }
+}
+
 /**
  * Creates three default routes and removes the first one.
  * The prefix list is then iterated.
@@ -748,6 +811,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_add__success_dr),
         new_TestFixture(test_nib_ft_del__unknown),
         new_TestFixture(test_nib_ft_del__success),
+        new_TestFixture(test_nib_ft_add_del__many_host_routes),
         /* most of gnrc_ipv6_nib_ft_iter() is tested during all the tests above */
         new_TestFixture(test_nib_ft_iter__empty_def_route_at_beginning),
         new_TestFixture(test_nib_ft_iter__empty_pref_route_in_the_middle),
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 
 #include "embUnit/embUnit.h"
+#include "kernel_defines.h"
 
 #include "hashes/sha256.h"
 
@@ -266,6 +267,38 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_mb(void)
+{
+    /* lengths around the block and padding boundaries */
+    static const size_t lens[] = { 0, 3, 55, 56, 63, 64, 65, 119, 120, 200 };
+    static uint8_t msgs[6][200];
+    static uint8_t digests[6][SHA256_DIGEST_LENGTH];
+    unsigned char expected[SHA256_DIGEST_LENGTH];
+    const void *data[6];
+    void *out[6];
+
+    for (unsigned m = 0; m < ARRAY_SIZE(msgs); m++) {
+        for (unsigned i = 0; i < sizeof(msgs[m]); i++) {
+            msgs[m][i] = m * 31 + i;
+        }
+        data[m] = msgs[m];
+        out[m] = digests[m];
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        /* covers a single message, a full group of lanes and a partial one */
+        for (unsigned num = 1; num <= ARRAY_SIZE(msgs); num++) {
+            memset(digests, 0, sizeof(digests));
+            sha256_mb(data, lens[i], out, num);
+            for (unsigned m = 0; m < num; m++) {
+                sha256(msgs[m], lens[i], expected);
+                TEST_ASSERT_EQUAL_INT(0, memcmp(expected, digests[m],
+                                                sizeof(expected)));
+            }
+        }
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -284,6 +317,8 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_mb),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
@@ -412,6 +412,77 @@ static void test_hashes_sha3_hash_sequence_failing_compare(void)
 }
 
 
+/* SHAKE128 and SHAKE256 of the empty message, FIPS 202 example values */
+static const uint8_t shake128_empty[] = {
+    0x7F, 0x9C, 0x2B, 0xA4, 0xE8, 0x8F, 0x82, 0x7D, 0x61, 0x60, 0x45, 0x50,
+    0x76, 0x05, 0x85, 0x3E, 0xD7, 0x3B, 0x80, 0x93, 0xF6, 0xEF, 0xBC, 0x88,
+    0xEB, 0x1A, 0x6E, 0xAC, 0xFA, 0x66, 0xEF, 0x26 };
+static const uint8_t shake256_empty[] = {
+    0x46, 0xB9, 0xDD, 0x2B, 0x0B, 0xA8, 0x8D, 0x13, 0x23, 0x3B, 0x3F, 0xEB,
+    0x74, 0x3E, 0xEB, 0x24, 0x3F, 0xCD, 0x52, 0xEA, 0x62, 0xB8, 0x1B, 0x82,
+    0xB5, 0x0C, 0x27, 0x64, 0x6E, 0xD5, 0x76, 0x2F, 0xD7, 0x5D, 0xC4, 0xDD,
+    0xD8, 0xC0, 0xF2, 0x00, 0xCB, 0x05, 0x01, 0x9D, 0x67, 0xB5, 0x92, 0xF6,
+    0xFC, 0x82, 0x1C, 0x49, 0x47, 0x9A, 0xB4, 0x86, 0x40, 0x29, 0x2E, 0xAC,
+    0xB3, 0xB7, 0xC4, 0xBE };
+
+/* last 16 of 400 output bytes for the message 0x00, 0x01, ..., 0xC7 */
+#define SHAKE_MSG_LEN   (200U)
+#define SHAKE_OUT_LEN   (400U)
+static const uint8_t shake128_tail[] = {
+    0x3F, 0xA6, 0xBE, 0x71, 0xB2, 0xCF, 0x38, 0x88, 0xFF, 0x16, 0x9E, 0x5A,
+    0x98, 0xC7, 0xFA, 0x85 };
+static const uint8_t shake256_tail[] = {
+    0x2B, 0x71, 0x68, 0x35, 0x74, 0x32, 0xA6, 0x03, 0xB2, 0x14, 0x2F, 0x74,
+    0xDA, 0xDD, 0x2B, 0x5A };
+
+static void test_hashes_sha3_shake_empty(void)
+{
+    static uint8_t out[64];
+
+    shake128(out, sizeof(shake128_empty), "", 0);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(shake128_empty, out, sizeof(shake128_empty)));
+    shake256(out, sizeof(shake256_empty), "", 0);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(shake256_empty, out, sizeof(shake256_empty)));
+}
+
+static int shake_squeeze_and_compare(void (*init)(keccak_state_t *),
+                                     const uint8_t *tail)
+{
+    /* chunks crossing the rate of 168 (SHAKE128) and 136 (SHAKE256) bytes */
+    static const size_t chunks[] = { 1, 7, 128, 32, 200, 32 };
+    static uint8_t msg[SHAKE_MSG_LEN];
+    static uint8_t out[SHAKE_OUT_LEN];
+    static uint8_t expected[SHAKE_OUT_LEN];
+    keccak_state_t state;
+    size_t pos = 0;
+
+    for (unsigned i = 0; i < sizeof(msg); i++) {
+        msg[i] = i;
+    }
+
+    init(&state);
+    sha3_update(&state, msg, 3);
+    sha3_update(&state, msg + 3, sizeof(msg) - 3);
+    for (unsigned i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        shake_squeeze(&state, out + pos, chunks[i]);
+        pos += chunks[i];
+    }
+
+    init(&state);
+    sha3_update(&state, msg, sizeof(msg));
+    shake_squeeze(&state, expected, sizeof(expected));
+
+    return (pos == sizeof(out)) &&
+           (memcmp(expected, out, sizeof(out)) == 0) &&
+           (memcmp(tail, out + sizeof(out) - 16, 16) == 0);
+}
+
+static void test_hashes_sha3_shake_squeeze(void)
+{
+    TEST_ASSERT(shake_squeeze_and_compare(shake128_init, shake128_tail));
+    TEST_ASSERT(shake_squeeze_and_compare(shake256_init, shake256_tail));
+}
+
 Test *tests_hashes_sha3_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -420,6 +491,8 @@ Test *tests_hashes_sha3_tests(void)
         new_TestFixture(test_hashes_sha3_hash_sequence_03),
         new_TestFixture(test_hashes_sha3_hash_sequence_04),
         new_TestFixture(test_hashes_sha3_hash_sequence_failing_compare),
+        new_TestFixture(test_hashes_sha3_shake_empty),
+        new_TestFixture(test_hashes_sha3_shake_squeeze),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha3_tests, NULL, NULL,
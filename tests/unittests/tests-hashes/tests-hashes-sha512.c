@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     unittests
+ * @{
+ *
+ * @file
+ * @brief       Test cases for the SHA-512 hash implementation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+#include "kernel_defines.h"
+
+#include "hashes/sha512.h"
+
+#include "tests-hashes.h"
+
+/* test vectors from FIPS 180-2, appendix C */
+static const uint8_t h_abc[SHA512_DIGEST_LENGTH] = {
+    0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba,
+    0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+    0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2,
+    0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+    0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8,
+    0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+    0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e,
+    0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f,
+};
+
+static const uint8_t h_empty[SHA512_DIGEST_LENGTH] = {
+    0xcf, 0x83, 0xe1, 0x35, 0x7e, 0xef, 0xb8, 0xbd,
+    0xf1, 0x54, 0x28, 0x50, 0xd6, 0x6d, 0x80, 0x07,
+    0xd6, 0x20, 0xe4, 0x05, 0x0b, 0x57, 0x15, 0xdc,
+    0x83, 0xf4, 0xa9, 0x21, 0xd3, 0x6c, 0xe9, 0xce,
+    0x47, 0xd0, 0xd1, 0x3c, 0x5d, 0x85, 0xf2, 0xb0,
+    0xff, 0x83, 0x18, 0xd2, 0x87, 0x7e, 0xec, 0x2f,
+    0x63, 0xb9, 0x31, 0xbd, 0x47, 0x41, 0x7a, 0x81,
+    0xa5, 0x38, 0x32, 0x7a, 0xf9, 0x27, 0xda, 0x3e,
+};
+
+static const uint8_t h_two_blocks[SHA512_DIGEST_LENGTH] = {
+    0x8e, 0x95, 0x9b, 0x75, 0xda, 0xe3, 0x13, 0xda,
+    0x8c, 0xf4, 0xf7, 0x28, 0x14, 0xfc, 0x14, 0x3f,
+    0x8f, 0x77, 0x79, 0xc6, 0xeb, 0x9f, 0x7f, 0xa1,
+    0x72, 0x99, 0xae, 0xad, 0xb6, 0x88, 0x90, 0x18,
+    0x50, 0x1d, 0x28, 0x9e, 0x49, 0x00, 0xf7, 0xe4,
+    0x33, 0x1b, 0x99, 0xde, 0xc4, 0xb5, 0x43, 0x3a,
+    0xc7, 0xd3, 0x29, 0xee, 0xb6, 0xdd, 0x26, 0x54,
+    0x5e, 0x96, 0xe5, 0x5b, 0x87, 0x4b, 0xe9, 0x09,
+};
+
+static const uint8_t h_million_a[SHA512_DIGEST_LENGTH] = {
+    0xe7, 0x18, 0x48, 0x3d, 0x0c, 0xe7, 0x69, 0x64,
+    0x4e, 0x2e, 0x42, 0xc7, 0xbc, 0x15, 0xb4, 0x63,
+    0x8e, 0x1f, 0x98, 0xb1, 0x3b, 0x20, 0x44, 0x28,
+    0x56, 0x32, 0xa8, 0x03, 0xaf, 0xa9, 0x73, 0xeb,
+    0xde, 0x0f, 0xf2, 0x44, 0x87, 0x7e, 0xa6, 0x0a,
+    0x4c, 0xb0, 0x43, 0x2c, 0xe5, 0x77, 0xc3, 0x1b,
+    0xeb, 0x00, 0x9c, 0x5c, 0x2c, 0x49, 0xaa, 0x2e,
+    0x4e, 0xad, 0xb2, 0x17, 0xad, 0x8c, 0xc0, 0x9b,
+};
+
+static const char two_blocks[] =
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+    "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+static void test_hashes_sha512_abc(void)
+{
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+
+    sha512("abc", 3, digest);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(h_abc, digest, sizeof(digest)));
+}
+
+static void test_hashes_sha512_empty(void)
+{
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+
+    sha512("", 0, digest);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(h_empty, digest, sizeof(digest)));
+}
+
+static void test_hashes_sha512_two_blocks(void)
+{
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+    sha512_context_t ctx;
+
+    /* the padding does not fit into the first block */
+    sha512(two_blocks, strlen(two_blocks), digest);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(h_two_blocks, digest, sizeof(digest)));
+
+    /* unaligned updates */
+    sha512_init(&ctx);
+    for (unsigned i = 0; i < strlen(two_blocks); i += 7) {
+        size_t len = strlen(two_blocks) - i;
+
+        sha512_update(&ctx, two_blocks + i, (len < 7) ? len : 7);
+    }
+    sha512_final(&ctx, digest);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(h_two_blocks, digest, sizeof(digest)));
+}
+
+static void test_hashes_sha512_million_a(void)
+{
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+    uint8_t block[200];
+    sha512_context_t ctx;
+
+    memset(block, 'a', sizeof(block));
+    sha512_init(&ctx);
+    for (unsigned i = 0; i < 1000000 / sizeof(block); i++) {
+        sha512_update(&ctx, block, sizeof(block));
+    }
+    sha512_final(&ctx, digest);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(h_million_a, digest, sizeof(digest)));
+}
+
+Test *tests_hashes_sha512_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_hashes_sha512_abc),
+        new_TestFixture(test_hashes_sha512_empty),
+        new_TestFixture(test_hashes_sha512_two_blocks),
+        new_TestFixture(test_hashes_sha512_million_a),
+    };
+
+    EMB_UNIT_TESTCALLER(hashes_sha512_tests, NULL, NULL, fixtures);
+
+    return (Test *)&hashes_sha512_tests;
+}
@@ -30,4 +30,5 @@ void tests_hashes(void)
     TESTS_RUN(tests_hashes_sha256_hmac_tests());
     TESTS_RUN(tests_hashes_sha256_chain_tests());
     TESTS_RUN(tests_hashes_sha3_tests());
+    TESTS_RUN(tests_hashes_sha512_tests());
 }
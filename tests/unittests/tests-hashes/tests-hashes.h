@@ -86,6 +86,13 @@ Test *tests_hashes_sha256_chain_tests(void);
  */
 Test *tests_hashes_sha3_tests(void);
 
+/**
+ * @brief   Generates tests for hashes/sha512.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_hashes_sha512_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
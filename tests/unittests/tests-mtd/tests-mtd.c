@@ -240,6 +240,13 @@ static void test_mtd_write_read(void)
     TEST_ASSERT_EQUAL_INT(-EOVERFLOW, ret);
 }
 
+static void test_mtd_flush(void)
+{
+    /* nothing is buffered, so flushing must succeed */
+    int ret = mtd_flush(dev);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+}
+
 #ifdef MTD_0
 static void test_mtd_write_read_flash(void)
 {
@@ -301,6 +308,7 @@ Test *tests_mtd_tests(void)
         new_TestFixture(test_mtd_erase),
         new_TestFixture(test_mtd_write_erase),
         new_TestFixture(test_mtd_write_read),
+        new_TestFixture(test_mtd_flush),
 #ifdef MTD_0
         new_TestFixture(test_mtd_write_read_flash),
 #endif
@@ -195,6 +195,22 @@ static void test_sixlowpan_ctx_remove(void)
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
 }
 
+static void test_sixlowpan_ctx_version(void)
+{
+    unsigned version = gnrc_sixlowpan_ctx_version();
+
+    /* version is stable as long as the context buffer does not change */
+    TEST_ASSERT_EQUAL_INT(version, gnrc_sixlowpan_ctx_version());
+    /* add context DEFAULT_TEST_PREFIX to DEFAULT_TEST_ID */
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT(version != gnrc_sixlowpan_ctx_version());
+    version = gnrc_sixlowpan_ctx_version();
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_sixlowpan_ctx_version());
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
+    TEST_ASSERT(version != gnrc_sixlowpan_ctx_version());
+}
+
 Test *tests_sixlowpan_ctx_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -211,6 +227,7 @@ Test *tests_sixlowpan_ctx_tests(void)
         new_TestFixture(test_sixlowpan_ctx_lookup_id__wrong_id),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__success),
         new_TestFixture(test_sixlowpan_ctx_remove),
+        new_TestFixture(test_sixlowpan_ctx_version),
     };
 
     EMB_UNIT_TESTCALLER(sixlowpan_ctx_tests, NULL, tear_down, fixtures);
@@ -98,6 +98,30 @@ static void test_vfs_bind(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_bind__read_direct(void)
+{
+    uint8_t buf[_VFS_TEST_BIND_BUFSIZE];
+    int fd = vfs_bind(VFS_ANY_FD, O_RDONLY, &_test_bind_ops, (void *)&str_data[0]);
+    TEST_ASSERT(fd >= 0);
+    if (fd < 0) {
+        return;
+    }
+
+    /* the mock doesn't provide direct access, the bytes are copied */
+    const void *addr = NULL;
+    ssize_t nbytes = vfs_mmap(fd, &addr, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, nbytes);
+    int ncalls = _mock_read_calls;
+    nbytes = vfs_read_direct(fd, &addr, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(_mock_read_calls, ncalls + 1);
+    TEST_ASSERT_EQUAL_INT(_VFS_TEST_BIND_BUFSIZE, nbytes);
+    TEST_ASSERT(addr == &buf[0]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&str_data[0], &buf[0], nbytes));
+
+    int res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 static void test_vfs_bind__leak_fds(void)
 {
     /* This test was added after a bug was discovered in the _allocate_fd code to
@@ -128,6 +152,7 @@ Test *tests_vfs_bind_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_vfs_bind),
+        new_TestFixture(test_vfs_bind__read_direct),
         new_TestFixture(test_vfs_bind__leak_fds),
         new_TestFixture(test_vfs_bind__allocate_invalid_fd),
     };
@@ -171,6 +171,51 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_constfs_mmap(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/test.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* the contents are accessed in place and the position is kept */
+    const void *addr = NULL;
+    ssize_t nbytes;
+    nbytes = vfs_mmap(fd, &addr, 64);
+    TEST_ASSERT_EQUAL_INT(sizeof(str_data), nbytes);
+    TEST_ASSERT(addr == &str_data[0]);
+    off_t pos = vfs_lseek(fd, 0, SEEK_CUR);
+    TEST_ASSERT_EQUAL_INT(0, pos);
+
+    /* direct reads advance the position without touching the buffer */
+    char strbuf[4];
+    memset(strbuf, '\0', sizeof(strbuf));
+    nbytes = vfs_read_direct(fd, &addr, strbuf, sizeof(strbuf));
+    TEST_ASSERT_EQUAL_INT(sizeof(strbuf), nbytes);
+    TEST_ASSERT(addr == &str_data[0]);
+    TEST_ASSERT_EQUAL_INT('\0', strbuf[0]);
+    nbytes = vfs_read_direct(fd, &addr, strbuf, sizeof(strbuf));
+    TEST_ASSERT_EQUAL_INT(sizeof(strbuf), nbytes);
+    TEST_ASSERT(addr == &str_data[sizeof(strbuf)]);
+
+    /* lseek to near the end */
+    pos = vfs_lseek(fd, -1, SEEK_END);
+    TEST_ASSERT_EQUAL_INT(sizeof(str_data) - 1, pos);
+    nbytes = vfs_read_direct(fd, &addr, strbuf, sizeof(strbuf));
+    TEST_ASSERT_EQUAL_INT(1, nbytes);
+    TEST_ASSERT(addr == &str_data[sizeof(str_data) - 1]);
+    nbytes = vfs_read_direct(fd, &addr, strbuf, sizeof(strbuf));
+    TEST_ASSERT_EQUAL_INT(0, nbytes);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(BOARD_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -210,6 +255,7 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_constfs_mmap),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(BOARD_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif